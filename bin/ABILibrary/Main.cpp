@@ -10,6 +10,7 @@
 #include <pasta/Compile/Compiler.h>
 #include <pasta/Compile/Job.h>
 #include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
 #include <pasta/Util/File.h>
 #include <pasta/Util/FileSystem.h>
 #include <pasta/Util/Init.h>
@@ -61,7 +62,8 @@ int main(int argc, char *argv[]) {
   }
 
   pasta::InitPasta initializer;
-  pasta::FileManager fm(pasta::FileSystem::CreateNative());
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
   auto maybe_compiler =
       pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
   if (!maybe_compiler.Succeeded()) {
@@ -90,8 +92,13 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // We only look at declarations and types, so there's no need to parse or
+  // align function bodies.
+  pasta::CompileJobOptions job_options;
+  job_options.skip_function_bodies = true;
+
   for (const auto &job : maybe_jobs.TakeValue()) {
-    auto maybe_ast = job.Run();
+    auto maybe_ast = job.Run(job_options);
     if (!maybe_ast.Succeeded()) {
       std::cout << maybe_ast.TakeError() << std::endl;
       return EXIT_FAILURE;
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+// Generates a synthetic corpus of stress-test translation units, and times
+// each stage of `CompileJob::Run` on them. Results are printed to stdout as a
+// JSON object, where each run embeds the `ASTStatistics::ToJSON` output of
+// the resulting `AST`.
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Statistics.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+#include <pasta/Util/StdFileSystem.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BenchOptions {
+  unsigned iterations{3u};
+  unsigned scale{1u};
+  unsigned num_alignment_threads{1u};
+  unsigned num_tokenizer_threads{0u};
+  std::filesystem::path corpus_dir;
+  std::string only;
+};
+
+// One generated translation unit.
+struct CorpusEntry {
+  const char *name;
+  const char *file_name;
+  pasta::TargetLanguage lang;
+  void (*generate)(std::ostream &os, unsigned scale);
+};
+
+// Deeply nested function-like macros whose arguments are themselves macro
+// uses, so that every level does argument pre-expansion, rescanning, and
+// token pasting.
+static void GenerateMacroNesting(std::ostream &os, unsigned scale) {
+  static constexpr unsigned kDepth = 10u;
+
+  os << "#define CAT(a, b) a ## b\n"
+     << "#define XCAT(a, b) CAT(a, b)\n"
+     << "#define ID(x) x\n"
+     << "#define M0(x) (ID(x) + 1)\n";
+  for (auto i = 1u; i <= kDepth; ++i) {
+    os << "#define M" << i << "(x) (M" << (i - 1u) << "(ID(x)) * M"
+       << (i - 1u) << "(x))\n";
+  }
+
+  for (auto i = 0u, max_i = 64u * scale; i < max_i; ++i) {
+    os << "static int XCAT(v_, " << i << ") = " << i << ";\n"
+       << "int XCAT(func_, " << i << ")(void) {\n"
+       << "  return M" << kDepth << "(XCAT(v_, " << i << "));\n"
+       << "}\n";
+  }
+}
+
+// Large designated-initializer tables, in the style of the Linux kernel's
+// syscall, opcode, and device ID tables.
+static void GenerateInitTables(std::ostream &os, unsigned scale) {
+  os << "#define FLAG(n) (1u << ((n) % 32u))\n"
+     << "#define ENTRY(n, f) [n] = { .id = n, .name = #n, .flags = f, "
+     << ".handler = 0 }\n"
+     << "struct entry {\n"
+     << "  unsigned id;\n"
+     << "  const char *name;\n"
+     << "  unsigned flags;\n"
+     << "  int (*handler)(void *);\n"
+     << "};\n";
+
+  const auto num_entries = 20000u * scale;
+  os << "static const struct entry macro_table[] = {\n";
+  for (auto i = 0u; i < num_entries; ++i) {
+    os << "  ENTRY(" << i << ", FLAG(" << i << ")),\n";
+  }
+  os << "};\n"
+     << "static const struct entry plain_table[] = {\n";
+  for (auto i = 0u; i < num_entries; ++i) {
+    os << "  [" << i << "] = { .id = " << i << ", .name = \"e" << i
+       << "\", .flags = " << (i % 7u) << "u },\n";
+  }
+  os << "};\n"
+     << "static const unsigned char byte_table[] = {\n";
+  for (auto i = 0u; i < num_entries * 4u; ++i) {
+    os << "0x" << std::hex << (i % 256u) << std::dec
+       << ((i % 16u) == 15u ? ",\n" : ", ");
+  }
+  os << "};\n";
+}
+
+// Template-heavy C++, with recursive class templates, variadic packs,
+// partial specializations, and constexpr evaluation.
+static void GenerateTemplates(std::ostream &os, unsigned scale) {
+  os << "template <typename... Ts> struct TypeList {};\n"
+     << "template <typename T, unsigned N> struct Repeat {\n"
+     << "  using Type = typename Repeat<T, N - 1>::Type;\n"
+     << "  static constexpr unsigned kValue = Repeat<T, N - 1>::kValue + N;\n"
+     << "};\n"
+     << "template <typename T> struct Repeat<T, 0> {\n"
+     << "  using Type = T;\n"
+     << "  static constexpr unsigned kValue = 0;\n"
+     << "};\n"
+     << "template <typename... Ts> constexpr unsigned SizeOf(void) {\n"
+     << "  return (0u + ... + sizeof(Ts));\n"
+     << "}\n";
+
+  for (auto i = 0u, max_i = 200u * scale; i < max_i; ++i) {
+    os << "template <typename T, typename... Rest>\n"
+       << "struct Node" << i << " {\n"
+       << "  T value;\n"
+       << "  TypeList<Rest...> rest;\n"
+       << "  template <typename U> auto Map(U u) const {\n"
+       << "    return Node" << i << "<decltype(u(value)), Rest...>{u(value), "
+       << "rest};\n"
+       << "  }\n"
+       << "  static constexpr unsigned kSize = SizeOf<T, Rest...>();\n"
+       << "};\n"
+       << "template <typename... Rest>\n"
+       << "struct Node" << i << "<void, Rest...> {\n"
+       << "  static constexpr unsigned kSize = 0;\n"
+       << "};\n"
+       << "inline unsigned Use" << i << "(void) {\n"
+       << "  Node" << i << "<int, char, long> n{" << i << ", {}};\n"
+       << "  auto m = n.Map([] (int x) { return x * 2.0; });\n"
+       << "  return Repeat<int, " << (i % 64u) << ">::kValue + "
+       << "decltype(m)::kSize + static_cast<unsigned>(m.value);\n"
+       << "}\n";
+  }
+}
+
+// Multi-megabyte block and line comments between small declarations.
+static void GenerateHugeComments(std::ostream &os, unsigned scale) {
+  static const char kLine[] =
+      " * Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+      "eiusmod tempor incididunt ut labore et dolore magna aliqua.\n";
+
+  for (auto c = 0u, max_c = 4u * scale; c < max_c; ++c) {
+    os << "/*\n";
+    for (auto i = 0u; i < 8192u; ++i) {  // About 1 MiB per comment.
+      os << kLine;
+    }
+    os << " */\n"
+       << "int comment_decl_" << c << ";\n";
+    for (auto i = 0u; i < 4096u; ++i) {
+      os << "//" << (kLine + 2);
+    }
+    os << "int line_comment_decl_" << c << ";\n";
+  }
+}
+
+static const CorpusEntry kCorpus[] = {
+  {"macro_nesting", "macro_nesting.c", pasta::TargetLanguage::kC,
+   GenerateMacroNesting},
+  {"init_tables", "init_tables.c", pasta::TargetLanguage::kC,
+   GenerateInitTables},
+  {"templates", "templates.cpp", pasta::TargetLanguage::kCXX,
+   GenerateTemplates},
+  {"huge_comments", "huge_comments.c", pasta::TargetLanguage::kC,
+   GenerateHugeComments},
+};
+
+// Parse `str` as an unsigned number. Zero is only accepted if `allow_zero`
+// is set, e.g. for thread counts, where zero means "run on this thread".
+static bool ParseUnsigned(const char *str, unsigned &out,
+                          bool allow_zero=false) {
+  char *end = nullptr;
+  const auto val = std::strtoul(str, &end, 10);
+  if (!end || end == str || *end || (!val && !allow_zero) ||
+      val > std::numeric_limits<unsigned>::max()) {
+    return false;
+  }
+  out = static_cast<unsigned>(val);
+  return true;
+}
+
+static int Usage(const char *self) {
+  std::cerr
+      << "Usage: " << self << " [--iterations N] [--scale N] [--threads N] "
+      << "[--tokenizer-threads N] [--corpus DIR] [--only NAME]\n";
+  return EXIT_FAILURE;
+}
+
+static void EscapeString(std::ostream &os, const std::string &str) {
+  os << '"';
+  for (char ch : str) {
+    switch (ch) {
+      case '"': os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      case '\n': os << "\\n"; break;
+      default:
+        if (static_cast<unsigned char>(ch) < 0x20u) {
+          os << ' ';
+        } else {
+          os << ch;
+        }
+        break;
+    }
+  }
+  os << '"';
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  BenchOptions options;
+  for (auto i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    const char *val = (i + 1) < argc ? argv[i + 1] : nullptr;
+    if (!val) {
+      return Usage(argv[0]);
+    } else if (!strcmp(arg, "--iterations")) {
+      if (!ParseUnsigned(val, options.iterations)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--scale")) {
+      if (!ParseUnsigned(val, options.scale)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--threads")) {
+      if (!ParseUnsigned(val, options.num_alignment_threads, true)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--tokenizer-threads")) {
+      if (!ParseUnsigned(val, options.num_tokenizer_threads, true)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--corpus")) {
+      options.corpus_dir = val;
+    } else if (!strcmp(arg, "--only")) {
+      options.only = val;
+    } else {
+      return Usage(argv[0]);
+    }
+    ++i;
+  }
+
+  std::error_code ec;
+  if (options.corpus_dir.empty()) {
+    options.corpus_dir =
+        std::filesystem::temp_directory_path(ec) / "pasta-bench";
+  }
+  std::filesystem::create_directories(options.corpus_dir, ec);
+  if (ec) {
+    std::cerr << "Could not create corpus directory "
+              << options.corpus_dir << ": " << ec.message() << std::endl;
+    return EXIT_FAILURE;
+  }
+  options.corpus_dir = std::filesystem::absolute(options.corpus_dir, ec);
+
+  pasta::InitPasta initializer;
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
+
+  pasta::CompileJobOptions job_options;
+  job_options.num_alignment_threads = options.num_alignment_threads;
+  job_options.num_tokenizer_threads = options.num_tokenizer_threads;
+
+  std::cout << "{\"scale\":" << options.scale
+            << ",\"iterations\":" << options.iterations
+            << ",\"threads\":" << options.num_alignment_threads
+            << ",\"tokenizer_threads\":" << options.num_tokenizer_threads
+            << ",\"results\":[";
+
+  auto sep = "";
+  auto failed = false;
+  for (const CorpusEntry &entry : kCorpus) {
+    if (!options.only.empty() && options.only != entry.name) {
+      continue;
+    }
+
+    const auto path = options.corpus_dir / entry.file_name;
+    {
+      std::ofstream os(path, std::ios::binary | std::ios::trunc);
+      entry.generate(os, options.scale);
+      if (!os) {
+        std::cerr << "Could not write " << path << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    auto maybe_compiler = pasta::Compiler::CreateHostCompiler(fm, entry.lang);
+    if (!maybe_compiler.Succeeded()) {
+      std::cerr << maybe_compiler.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    const bool is_cxx = entry.lang == pasta::TargetLanguage::kCXX;
+    const std::vector<std::string> args{
+        "-x", is_cxx ? "c++" : "c", is_cxx ? "-std=c++17" : "-std=gnu11",
+        "-fsyntax-only", path.generic_string()};
+
+    auto maybe_command = pasta::CompileCommand::CreateFromArguments(
+        pasta::ArgumentVector(args), options.corpus_dir);
+    if (!maybe_command.Succeeded()) {
+      std::cerr << maybe_command.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    auto maybe_jobs = maybe_compiler->CreateJobsForCommand(
+        maybe_command.TakeValue());
+    if (!maybe_jobs.Succeeded()) {
+      std::cerr << maybe_jobs.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    for (const auto &job : maybe_jobs.TakeValue()) {
+      for (auto i = 0u; i < options.iterations; ++i) {
+        std::cout << sep << "{\"corpus\":\"" << entry.name
+                  << "\",\"iteration\":" << i;
+        sep = ",";
+
+        auto maybe_ast = job.Run(job_options);
+        if (maybe_ast.Succeeded()) {
+          std::cout << ",\"ok\":true,\"statistics\":"
+                    << maybe_ast->Statistics().ToJSON() << "}";
+        } else {
+          failed = true;
+          std::cout << ",\"ok\":false,\"error\":";
+          EscapeString(std::cout, maybe_ast.TakeError());
+          std::cout << "}";
+        }
+        std::cout.flush();
+      }
+    }
+  }
+
+  std::cout << "]}" << std::endl;
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -157,6 +157,33 @@ static void DeclareCppMethod0(std::ostream &os, const std::string &class_name,
     } else {
       os << "  " << new_rt << ' ' << meth_name << "(void) const noexcept;\n";
     }
+
+    // Borrowed counterpart, which doesn't reference count the `AST`.
+    if (auto ref_it = gRetTypeToRefMap.find(rt);
+        ref_it != gRetTypeToRefMap.end()) {
+      if (can_ret_null) {
+        os << "  std::optional<" << ref_it->second.first << "> " << meth_name
+           << "Ref(void) const noexcept;\n";
+      } else {
+        os << "  " << ref_it->second.first << ' ' << meth_name
+           << "Ref(void) const noexcept;\n";
+      }
+    }
+
+    // Lazy counterpart to the `std::vector`-returning declaration list.
+    if (auto range_it = gRetTypeToDeclRangeMap.find(rt);
+        range_it != gRetTypeToDeclRangeMap.end()) {
+      os << "  ::pasta::DeclContextRange<" << range_it->second.first << "> "
+         << meth_name << "Range(void) const noexcept;\n";
+    }
+
+    // Lazy counterpart to other `std::vector`-returning lists.
+    if (auto range_it = gRetTypeToLazyRangeMap.find(rt);
+        range_it != gRetTypeToLazyRangeMap.end() &&
+        range_it->second.first == class_name) {
+      os << "  " << range_it->second.second << ' ' << meth_name
+         << "Range(void) const noexcept;\n";
+    }
   }
 }
 
@@ -81,61 +81,109 @@ static void DefineCppMethod0(std::ostream &os, const std::string &class_name,
   const auto null_key = std::make_pair(class_name, meth_name);
   const auto can_ret_null = kCanReturnNullptr.count(null_key) ||
                             kConditionalNullptr.count(null_key);
-  if (can_ret_null) {
-    os << "std::optional<" << rt_type << ">";
-  } else {
-    os << rt_type;
-  }
-
-  os << " " << class_name << "::" << meth_name << "(void) const noexcept {\n";
 
-  const auto is_qual_type = class_name == "QualifiedType";
-  if (is_qual_type) {
-    os << "  auto &ast_ctx = ast->ci->getASTContext();\n"
-       << "  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);\n"
-       << "  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));\n";
-  } else {
-    os << "  auto &self = *const_cast<clang::" << class_name << " *>(u." << class_name << ");\n";
-  }
-  auto handled_null_ret = false;
-  if (auto it = kConditionalNullptr.find(null_key); it != kConditionalNullptr.end()) {
-    os << it->second;
-    handled_null_ret = true;
-  }
-  os << "  decltype(auto) val = self." << meth_name_ref.str() << "();\n";
-  if (rt_ref.endswith("QualType)")) {
+  // Define the method as returning `ret_type`, with `ret_val` converting the
+  // value returned by Clang.
+  auto define_method = [&] (const std::string &ret_type,
+                            const std::string &suffix,
+                            const std::string &ret_val) {
     if (can_ret_null) {
-      os
-          << "  if (val.isNull()) {\n"
-          << "    return std::nullopt;\n"
-          << "  }\n"
-          << rt_val;
+      os << "std::optional<" << ret_type << ">";
     } else {
-      os
-          << "  assert(!val.isNull());\n"
-          << rt_val;
+      os << ret_type;
     }
-  } else if (rt_ref.endswith(" *)")) {
-    if (can_ret_null) {
-      os
-          << "  if (!val) {\n"
-          << "    return std::nullopt;\n"
-          << "  }\n"
-          << rt_val;
+
+    os << " " << class_name << "::" << meth_name << suffix << "(void) const noexcept {\n";
+
+    const auto is_qual_type = class_name == "QualifiedType";
+    if (is_qual_type) {
+      os << "  auto &ast_ctx = ast->ci->getASTContext();\n"
+         << "  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);\n"
+         << "  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));\n";
     } else {
-      os
-         << rt_val
-         << "  assert(false && \"" << class_name << "::"
-         << meth_name << " can return nullptr!\");\n";
+      os << "  auto &self = *const_cast<clang::" << class_name << " *>(u." << class_name << ");\n";
+    }
+    auto handled_null_ret = false;
+    if (auto it = kConditionalNullptr.find(null_key); it != kConditionalNullptr.end()) {
+      os << it->second;
+      handled_null_ret = true;
     }
-  } else {
-    assert(!can_ret_null || handled_null_ret);
-    os << rt_val;
-    (void) handled_null_ret;
+    os << "  decltype(auto) val = self." << meth_name_ref.str() << "();\n";
+    if (rt_ref.endswith("QualType)")) {
+      if (can_ret_null) {
+        os
+            << "  if (val.isNull()) {\n"
+            << "    return std::nullopt;\n"
+            << "  }\n"
+            << ret_val;
+      } else {
+        os
+            << "  assert(!val.isNull());\n"
+            << ret_val;
+      }
+    } else if (rt_ref.endswith(" *)")) {
+      if (can_ret_null) {
+        os
+            << "  if (!val) {\n"
+            << "    return std::nullopt;\n"
+            << "  }\n"
+            << ret_val;
+      } else {
+        os
+           << ret_val
+           << "  assert(false && \"" << class_name << "::"
+           << meth_name << suffix << " can return nullptr!\");\n";
+      }
+    } else {
+      assert(!can_ret_null || handled_null_ret);
+      os << ret_val;
+      (void) handled_null_ret;
+    }
+
+    os << "  __builtin_unreachable();\n"
+       << "}\n\n";
+  };
+
+  define_method(rt_type, "", rt_val);
+
+  // Borrowed counterpart, which doesn't reference count the `AST`.
+  if (auto ref_it = gRetTypeToRefMap.find(rt_str);
+      ref_it != gRetTypeToRefMap.end()) {
+    define_method(ref_it->second.first, "Ref", ref_it->second.second);
   }
 
-  os << "  __builtin_unreachable();\n"
-     << "}\n\n";
+  // Lazy counterpart to the `std::vector`-returning declaration list. The
+  // first declaration comes from Clang's own iterator, so that any external
+  // loading it does still happens.
+  if (auto range_it = gRetTypeToDeclRangeMap.find(rt_str);
+      range_it != gRetTypeToDeclRangeMap.end()) {
+    const auto &[elem_type, filter] = range_it->second;
+    os << "::pasta::DeclContextRange<" << elem_type << "> " << class_name
+       << "::" << meth_name << "Range(void) const noexcept {\n"
+       << "  auto &self = *const_cast<clang::" << class_name << " *>(u."
+       << class_name << ");\n"
+       << "  decltype(auto) val = self." << meth_name_ref.str() << "();\n"
+       << "  const clang::Decl *first = nullptr;\n"
+       << "  if (val.begin() != val.end()) {\n"
+       << "    first = *val.begin();\n"
+       << "  }\n"
+       << "  return ::pasta::DeclContextRange<" << elem_type << ">(\n"
+       << "      ast, first, " << filter << ");\n"
+       << "}\n\n";
+  }
+
+  // Lazy counterpart to other `std::vector`-returning lists.
+  if (auto range_it = gRetTypeToLazyRangeMap.find(rt_str);
+      range_it != gRetTypeToLazyRangeMap.end() &&
+      range_it->second.first == class_name) {
+    os << range_it->second.second << " " << class_name << "::" << meth_name
+       << "Range(void) const noexcept {\n"
+       << "  auto &self = *const_cast<clang::" << class_name << " *>(u."
+       << class_name << ");\n"
+       << "  decltype(auto) val = self." << meth_name_ref.str() << "();\n"
+       << "  return RangeBuilder::Create(ast, self, val);\n"
+       << "}\n\n";
+  }
 }
 
 
@@ -87,6 +87,19 @@ void GenerateAttrCpp(void) {
       // All Attributes will use the inherited function to get Tokens
       << "::pasta::TokenRange Attr::Tokens(void) const noexcept {\n"
       << "  return ast->TokenRangeFrom(u.Attr->getRange());\n"
+      << "}\n\n"
+
+      // Borrowed attribute references.
+      << "AttrRef::AttrRef(ASTImpl *ast_, const ::clang::Attr *attr_)\n"
+      << "    : ast(ast_),\n"
+      << "      attr(attr_),\n"
+      << "      kind(KindOfAttr(attr_)) {}\n\n"
+      << "std::string_view AttrRef::KindName(void) const noexcept {\n"
+      << "  return kAttrNames[static_cast<unsigned>(kind)];\n"
+      << "}\n\n"
+      << "::pasta::Attr AttrRef::Owned(void) const {\n"
+      << "  return AttrBuilder::Create<::pasta::Attr>(\n"
+      << "      ast->shared_from_this(), attr);\n"
       << "}\n\n";
 
   // Define them all.
@@ -77,6 +77,7 @@ void GenerateAttrH(void) {
      << "  }\n"
      << "  static std::optional<::pasta::Attr> From(const TokenContext &);\n\n"
      << " protected:\n"
+     << "  friend class AttrRef;\n"
      << "  friend class TokenContext;\n\n"
      << "  std::shared_ptr<ASTImpl> ast;\n"
      << "  union {\n";
@@ -160,6 +161,40 @@ void GenerateAttrH(void) {
     }
   }
 
+  // Borrowed, non-owning attribute references.
+  os
+    << "// A borrowed, non-owning reference to an attribute. See `DeclRef`.\n"
+    << "class AttrRef {\n"
+    << " public:\n"
+    << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AttrRef)\n\n"
+    << "  inline AttrRef(const Attr &attr) noexcept\n"
+    << "      : ast(attr.ast.get()),\n"
+    << "        attr(attr.u.Attr),\n"
+    << "        kind(attr.kind) {}\n\n"
+    << "  inline AttrKind Kind(void) const noexcept {\n"
+    << "    return kind;\n"
+    << "  }\n\n"
+    << "  std::string_view KindName(void) const noexcept;\n\n"
+    << "  inline const ::clang::Attr *RawAttr(void) const noexcept {\n"
+    << "    return attr;\n"
+    << "  }\n\n"
+    << "  // Return an owning version of this attribute.\n"
+    << "  ::pasta::Attr Owned(void) const;\n\n"
+    << "  inline bool operator==(const AttrRef &that) const noexcept {\n"
+    << "    return attr == that.attr;\n"
+    << "  }\n\n"
+    << "  inline bool operator!=(const AttrRef &that) const noexcept {\n"
+    << "    return attr != that.attr;\n"
+    << "  }\n\n"
+    << " private:\n"
+    << "  friend class RefBuilder;\n\n"
+    << "  AttrRef(void) = delete;\n"
+    << "  explicit AttrRef(ASTImpl *ast_, const ::clang::Attr *attr_);\n\n"
+    << "  ASTImpl *ast;\n"
+    << "  const ::clang::Attr *attr;\n"
+    << "  AttrKind kind;\n"
+    << "};\n\n";
+
   os
     << "}  // namespace pasta\n"
     << "#undef PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR\n"
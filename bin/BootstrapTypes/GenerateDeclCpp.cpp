@@ -195,6 +195,28 @@ void GenerateDeclCpp(void) {
       << "#include <clang/AST/DeclNodes.inc>\n"
       << "  }\n"
       << "  return ast->TokenAt(loc);\n"
+      << "}\n\n"
+
+      // Borrowed declaration references.
+      << "DeclRef::DeclRef(ASTImpl *ast_, const ::clang::Decl *decl_)\n"
+      << "    : ast(ast_),\n"
+      << "      decl(decl_),\n"
+      << "      kind(KindOfDecl(decl_)) {}\n\n"
+      << "std::string_view DeclRef::KindName(void) const noexcept {\n"
+      << "  return kKindNames[static_cast<unsigned>(kind)];\n"
+      << "}\n\n"
+      << "::pasta::Decl DeclRef::Owned(void) const {\n"
+      << "  return DeclBuilder::Create<::pasta::Decl>(\n"
+      << "      ast->shared_from_this(), decl);\n"
+      << "}\n\n"
+      << "::pasta::DeclContextRange<::pasta::DeclRef> DeclContext::DeclarationRefs(void) const noexcept {\n"
+      << "  decltype(auto) val = u.DeclContext->decls();\n"
+      << "  const clang::Decl *first = nullptr;\n"
+      << "  if (val.begin() != val.end()) {\n"
+      << "    first = *val.begin();\n"
+      << "  }\n"
+      << "  return ::pasta::DeclContextRange<::pasta::DeclRef>(\n"
+      << "      ast, first, nullptr);\n"
       << "}\n\n";
 
 
@@ -37,6 +37,7 @@ void GenerateDeclH(void) {
       << "    friend class ASTImpl; \\\n"
       << "    friend class DeclBuilder; \\\n"
       << "    friend class DeclVisitor; \\\n"
+      << "    template <typename> friend class DeclContextIterator; \\\n"
       << "    friend class PrintedTokenRange; \\\n"
       << "    base(void) = delete; \\\n"
       << "    explicit base( \\\n"
@@ -73,6 +74,9 @@ void GenerateDeclH(void) {
 
   DeclareCppMethods(os, decl_context, gClassIDs[decl_context]);
 
+  // Borrowed variant of `Declarations`, which avoids reference counting.
+  os << "  ::pasta::DeclContextRange<::pasta::DeclRef> DeclarationRefs(void) const noexcept;\n";
+
   os << " private:\n"
      << "  friend class Decl;\n"
      << "  friend class DeclVisitor;\n"
@@ -174,6 +178,7 @@ void GenerateDeclH(void) {
           << "  }\n"
           << "  static std::optional<::pasta::Decl> From(const TokenContext &);\n"
           << " protected:\n"
+          << "  friend class DeclRef;\n"
           << "  friend class TokenContext;\n\n"
           << "  std::shared_ptr<ASTImpl> ast;\n"
           << "  union {\n";
@@ -213,6 +218,51 @@ void GenerateDeclH(void) {
     }
   }
 
+  // Borrowed, non-owning declaration references.
+  os
+      << "// A borrowed, non-owning reference to a declaration. Unlike a `Decl`, a\n"
+      << "// `DeclRef` does not keep its `AST` alive, and so copying one involves no\n"
+      << "// reference counting. A `DeclRef` is only valid while some owner of its\n"
+      << "// `AST` is alive. Use `Owned` to get back to the full `Decl` API.\n"
+      << "//\n"
+      << "// NOTE(pag): Every generated method that returns a single declaration,\n"
+      << "//            statement, type, attribute, token, or token range has a\n"
+      << "//            borrowed variant with a `Ref` suffix, e.g.\n"
+      << "//            `VarDecl::InitializerRef`. Methods returning lists only\n"
+      << "//            have owning or lazy `Range` variants.\n"
+      << "class DeclRef {\n"
+      << " public:\n"
+      << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeclRef)\n\n"
+      << "  inline DeclRef(const Decl &decl) noexcept\n"
+      << "      : ast(decl.ast.get()),\n"
+      << "        decl(decl.u.Decl),\n"
+      << "        kind(decl.kind) {}\n\n"
+      << "  inline DeclKind Kind(void) const noexcept {\n"
+      << "    return kind;\n"
+      << "  }\n\n"
+      << "  std::string_view KindName(void) const noexcept;\n\n"
+      << "  inline const ::clang::Decl *RawDecl(void) const noexcept {\n"
+      << "    return decl;\n"
+      << "  }\n\n"
+      << "  // Return an owning version of this declaration.\n"
+      << "  ::pasta::Decl Owned(void) const;\n\n"
+      << "  inline bool operator==(const DeclRef &that) const noexcept {\n"
+      << "    return decl == that.decl;\n"
+      << "  }\n\n"
+      << "  inline bool operator!=(const DeclRef &that) const noexcept {\n"
+      << "    return decl != that.decl;\n"
+      << "  }\n\n"
+      << " private:\n"
+      << "  friend class DeclContext;\n"
+      << "  friend class RefBuilder;\n"
+      << "  template <typename> friend class DeclContextIterator;\n\n"
+      << "  DeclRef(void) = delete;\n"
+      << "  explicit DeclRef(ASTImpl *ast_, const ::clang::Decl *decl_);\n\n"
+      << "  ASTImpl *ast;\n"
+      << "  const ::clang::Decl *decl;\n"
+      << "  DeclKind kind;\n"
+      << "};\n\n";
+
   os
       << "}  // namespace pasta\n"
       << "#undef PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR\n"
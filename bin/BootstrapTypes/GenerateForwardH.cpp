@@ -82,8 +82,13 @@ void GenerateForwardH(void) {
       << "namespace pasta {\n"
       << "class AST;\n"
       << "class ASTImpl;\n"
+      << "class AttrRef;\n"
       << "class DeclBuilder;\n"
-      << "class TypeBuilder;\n\n"
+      << "class DeclRef;\n"
+      << "class RefBuilder;\n"
+      << "class StmtRef;\n"
+      << "class TypeBuilder;\n"
+      << "class TypeRef;\n\n"
       << "#define PASTA_FOR_EACH_DECL_IMPL(m, a) \\\n";
 
   auto sep = "";
@@ -139,6 +139,20 @@ void GenerateStmtCpp(void) {
     DefineCppMethods(os, name, gClassIDs[name]);
   }
 
+  // Borrowed, non-owning statement references.
+  os
+      << "StmtRef::StmtRef(ASTImpl *ast_, const ::clang::Stmt *stmt_)\n"
+      << "    : ast(ast_),\n"
+      << "      stmt(stmt_),\n"
+      << "      kind(static_cast<StmtKind>(stmt_->getStmtClass())) {}\n\n"
+      << "std::string_view StmtRef::KindName(void) const noexcept {\n"
+      << "  return stmt->getStmtClassName();\n"
+      << "}\n\n"
+      << "::pasta::Stmt StmtRef::Owned(void) const {\n"
+      << "  return StmtBuilder::Create<::pasta::Stmt>(\n"
+      << "      ast->shared_from_this(), stmt);\n"
+      << "}\n\n";
+
   os
       << "}  // namespace pasta\n"
       << "#endif  // PASTA_IN_BOOTSTRAP\n";
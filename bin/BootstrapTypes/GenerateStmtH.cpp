@@ -114,6 +114,7 @@ void GenerateStmtH(void) {
           << "    return u.opaque == that.u.opaque;\n"
           << "  }\n"
           << " protected:\n"
+          << "  friend class StmtRef;\n\n"
           << "  std::shared_ptr<ASTImpl> ast;\n"
           << "  union {\n";
 
@@ -147,6 +148,40 @@ void GenerateStmtH(void) {
     }
   }
 
+  // Borrowed, non-owning statement references.
+  os
+      << "// A borrowed, non-owning reference to a statement. See `DeclRef`.\n"
+      << "class StmtRef {\n"
+      << " public:\n"
+      << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StmtRef)\n\n"
+      << "  inline StmtRef(const Stmt &stmt) noexcept\n"
+      << "      : ast(stmt.ast.get()),\n"
+      << "        stmt(stmt.u.Stmt),\n"
+      << "        kind(stmt.kind) {}\n\n"
+      << "  inline StmtKind Kind(void) const noexcept {\n"
+      << "    return kind;\n"
+      << "  }\n\n"
+      << "  std::string_view KindName(void) const noexcept;\n\n"
+      << "  inline const ::clang::Stmt *RawStmt(void) const noexcept {\n"
+      << "    return stmt;\n"
+      << "  }\n\n"
+      << "  // Return an owning version of this statement.\n"
+      << "  ::pasta::Stmt Owned(void) const;\n\n"
+      << "  inline bool operator==(const StmtRef &that) const noexcept {\n"
+      << "    return stmt == that.stmt;\n"
+      << "  }\n\n"
+      << "  inline bool operator!=(const StmtRef &that) const noexcept {\n"
+      << "    return stmt != that.stmt;\n"
+      << "  }\n\n"
+      << " private:\n"
+      << "  friend class RefBuilder;\n\n"
+      << "  StmtRef(void) = delete;\n"
+      << "  explicit StmtRef(ASTImpl *ast_, const ::clang::Stmt *stmt_);\n\n"
+      << "  ASTImpl *ast;\n"
+      << "  const ::clang::Stmt *stmt;\n"
+      << "  StmtKind kind;\n"
+      << "};\n\n";
+
   os
       << "}  // namespace pasta\n"
       << "#undef PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR\n"
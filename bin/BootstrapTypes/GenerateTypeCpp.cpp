@@ -139,6 +139,22 @@ void GenerateTypeCpp(void) {
     }
   }
 
+  // Borrowed, non-owning type references.
+  os
+      << "TypeRef::TypeRef(ASTImpl *ast_, const ::clang::Type *type_,\n"
+      << "                 uint32_t qualifiers_)\n"
+      << "    : ast(ast_),\n"
+      << "      type(type_),\n"
+      << "      kind(static_cast<TypeKind>(type_->getTypeClass())),\n"
+      << "      qualifiers(qualifiers_) {}\n\n"
+      << "std::string_view TypeRef::KindName(void) const noexcept {\n"
+      << "  return type->getTypeClassName();\n"
+      << "}\n\n"
+      << "::pasta::Type TypeRef::Owned(void) const {\n"
+      << "  return TypeBuilder::Create<::pasta::Type>(\n"
+      << "      ast->shared_from_this(), type, qualifiers);\n"
+      << "}\n\n";
+
   os
       << "}  // namespace pasta\n"
       << "#endif  // PASTA_IN_BOOTSTRAP\n";
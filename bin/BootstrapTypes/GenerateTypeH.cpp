@@ -68,6 +68,7 @@ void GenerateTypeH(void) {
       << "class Type {\n"
       << " protected:\n"
       << "  friend class TypeBuilder;\n"
+      << "  friend class TypeRef;\n"
       << "  friend class PrintedTokenRange;\n\n"
       << "  friend class TokenContext;\n"
       << "  std::shared_ptr<ASTImpl> ast;\n"
@@ -212,8 +213,50 @@ void GenerateTypeH(void) {
     }
   }
 
+  // Borrowed, non-owning type references.
   os
-      << "\n\n}  // namespace pasta\n"
+      << "\n\n"
+      << "// A borrowed, non-owning reference to a type, including its qualifiers. See\n"
+      << "// `DeclRef`.\n"
+      << "class TypeRef {\n"
+      << " public:\n"
+      << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeRef)\n\n"
+      << "  inline TypeRef(const Type &type) noexcept\n"
+      << "      : ast(type.ast.get()),\n"
+      << "        type(type.u.Type),\n"
+      << "        kind(type.kind),\n"
+      << "        qualifiers(type.qualifiers) {}\n\n"
+      << "  inline TypeKind Kind(void) const noexcept {\n"
+      << "    return kind;\n"
+      << "  }\n\n"
+      << "  std::string_view KindName(void) const noexcept;\n\n"
+      << "  inline const ::clang::Type *RawType(void) const noexcept {\n"
+      << "    return type;\n"
+      << "  }\n\n"
+      << "  inline uint32_t RawQualifiers(void) const noexcept {\n"
+      << "    return qualifiers;\n"
+      << "  }\n\n"
+      << "  // Return an owning version of this type.\n"
+      << "  ::pasta::Type Owned(void) const;\n\n"
+      << "  inline bool operator==(const TypeRef &that) const noexcept {\n"
+      << "    return type == that.type && qualifiers == that.qualifiers;\n"
+      << "  }\n\n"
+      << "  inline bool operator!=(const TypeRef &that) const noexcept {\n"
+      << "    return type != that.type || qualifiers != that.qualifiers;\n"
+      << "  }\n\n"
+      << " private:\n"
+      << "  friend class RefBuilder;\n\n"
+      << "  TypeRef(void) = delete;\n"
+      << "  explicit TypeRef(ASTImpl *ast_, const ::clang::Type *type_,\n"
+      << "                   uint32_t qualifiers_);\n\n"
+      << "  ASTImpl *ast;\n"
+      << "  const ::clang::Type *type;\n"
+      << "  TypeKind kind;\n"
+      << "  uint32_t qualifiers;\n"
+      << "};\n";
+
+  os
+      << "\n}  // namespace pasta\n"
       << "#undef PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR\n"
       << "#endif  // !PASTA_IN_BOOTSTRAP\n";
 }
@@ -774,6 +774,77 @@ std::unordered_map<std::string, std::string> gRetTypeToValMap{
          "  }\n"},
 };
 
+#define DECL_CONTEXT_RANGE(cls) \
+    "::pasta::" #cls, \
+    "[] (const clang::Decl *decl) {\n" \
+    "    return clang::isa<clang::" #cls ">(decl);\n" \
+    "  }"
+
+#define FILTERED_DECL_CONTEXT_RANGE(cls, pred) \
+    "::pasta::" #cls, \
+    "[] (const clang::Decl *decl) {\n" \
+    "    auto cls_decl = clang::dyn_cast<clang::" #cls ">(decl);\n" \
+    "    return cls_decl && cls_decl->" #pred "();\n" \
+    "  }"
+
+std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToDeclRangeMap{
+  {"(llvm::iterator_range<clang::DeclContext::decl_iterator>)",
+   {"::pasta::Decl", "nullptr"}},
+  {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCMethodDecl, &clang::ObjCMethodDecl::isClassMethod>>)",
+   {FILTERED_DECL_CONTEXT_RANGE(ObjCMethodDecl, isClassMethod)}},
+  {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCPropertyDecl, &clang::ObjCPropertyDecl::isClassProperty>>)",
+   {FILTERED_DECL_CONTEXT_RANGE(ObjCPropertyDecl, isClassProperty)}},
+  {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCMethodDecl, &clang::ObjCMethodDecl::isInstanceMethod>>)",
+   {FILTERED_DECL_CONTEXT_RANGE(ObjCMethodDecl, isInstanceMethod)}},
+  {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCPropertyDecl, &clang::ObjCPropertyDecl::isInstanceProperty>>)",
+   {FILTERED_DECL_CONTEXT_RANGE(ObjCPropertyDecl, isInstanceProperty)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCMethodDecl>>)",
+   {DECL_CONTEXT_RANGE(ObjCMethodDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCPropertyDecl>>)",
+   {DECL_CONTEXT_RANGE(ObjCPropertyDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCPropertyImplDecl>>)",
+   {DECL_CONTEXT_RANGE(ObjCPropertyImplDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCIvarDecl>>)",
+   {DECL_CONTEXT_RANGE(ObjCIvarDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::EnumConstantDecl>>)",
+   {DECL_CONTEXT_RANGE(EnumConstantDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::FieldDecl>>)",
+   {DECL_CONTEXT_RANGE(FieldDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::CXXConstructorDecl>>)",
+   {DECL_CONTEXT_RANGE(CXXConstructorDecl)}},
+  {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::CXXMethodDecl>>)",
+   {DECL_CONTEXT_RANGE(CXXMethodDecl)}},
+};
+
+#undef DECL_CONTEXT_RANGE
+#undef FILTERED_DECL_CONTEXT_RANGE
+
+std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToLazyRangeMap{
+  {"(llvm::iterator_range<clang::Attr *const *>)",
+   {"Decl", "::pasta::AttrRange"}},
+  {"(llvm::iterator_range<clang::Decl::redecl_iterator>)",
+   {"Decl", "::pasta::RedeclarationRange"}},
+  {"(llvm::iterator_range<clang::ConstStmtIterator>)",
+   {"Stmt", "::pasta::StmtChildRange"}},
+};
+
+// NOTE(pag): Pointers to declarations, statements, types, and attributes are
+//            added by `MapDeclRetTypes` and friends.
+std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToRefMap{
+  {"(clang::SourceLocation)",
+   {"::pasta::TokenRef",
+    "  return RefBuilder::Create(*ast, val);\n"}},
+  {"(clang::SourceRange)",
+   {"::pasta::TokenRefRange",
+    "  return RefBuilder::Create(*ast, val);\n"}},
+  {"(clang::QualType)",
+   {"::pasta::TypeRef",
+    "  return RefBuilder::Create(*ast, val);\n"}},
+};
+
 // Prefixes on enumerators to strip.
 std::vector<llvm::StringRef> kEnumPrefixesToStrip{
     "TK_",
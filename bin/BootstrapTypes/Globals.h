@@ -16,6 +16,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <llvm/ADT/StringRef.h>
@@ -56,6 +57,27 @@ extern std::unordered_map<std::string, std::string> gRetTypeMap;
 // in the generated Decl.cpp file.
 extern std::unordered_map<std::string, std::string> gRetTypeToValMap;
 
+// Maps return types from the macros file that iterate over the declarations
+// of a `clang::DeclContext` to the element type and filter of a lazy
+// `DeclContextRange` that can be returned in their place.
+extern std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToDeclRangeMap;
+
+// Maps return types from the macros file that iterate over another of Clang's
+// lists, e.g. attributes or child statements, to the class whose method gets
+// a lazy `LazyRange` counterpart, and to the type of that range. Derived
+// classes don't get one, as e.g. `clang::Stmt::children` already dispatches
+// on the kind of statement.
+extern std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToLazyRangeMap;
+
+// Maps return types from the macros file that produce a single declaration,
+// statement, type, attribute, token, or token range, to the borrowed handle
+// returned by the `Ref`-suffixed variant of the method, and to how that handle
+// should be returned. See `RefBuilder`.
+extern std::unordered_map<std::string, std::pair<std::string, std::string>>
+    gRetTypeToRefMap;
+
 // All methods (class name, method name).
 extern const std::set<std::pair<std::string, std::string>> gMethodNames;
 
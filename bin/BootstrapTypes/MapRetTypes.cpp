@@ -8,6 +8,13 @@
 #include "Globals.h"
 #include "Util.h"
 
+// How the `Ref`-suffixed variants of methods return borrowed handles to
+// declarations, statements, types, and attributes.
+static const std::string kRefVal =
+    "  if (val) {\n"
+    "    return RefBuilder::Create(*ast, val);\n"
+    "  }\n";
+
 // Adds mappings that translate between pointers to clang Decl types and PASTA
 // Decl types.
 void MapDeclRetTypes(void) {
@@ -28,6 +35,9 @@ void MapDeclRetTypes(void) {
 
     gRetTypeMap.emplace(ss2.str(), "::pasta::" + name);
     gRetTypeToValMap[ss2.str()] = rvs.str();
+
+    gRetTypeToRefMap[ss.str()] = {"::pasta::DeclRef", kRefVal};
+    gRetTypeToRefMap[ss2.str()] = {"::pasta::DeclRef", kRefVal};
   }
 }
 
@@ -51,6 +61,9 @@ void MapStmtRetTypes(void) {
 
     gRetTypeMap.emplace(ss2.str(), "::pasta::" + name);
     gRetTypeToValMap[ss2.str()] = rvs.str();
+
+    gRetTypeToRefMap[ss.str()] = {"::pasta::StmtRef", kRefVal};
+    gRetTypeToRefMap[ss2.str()] = {"::pasta::StmtRef", kRefVal};
   }
 }
 
@@ -80,6 +93,9 @@ void MapTypeRetTypes(void) {
         << "    return TypeBuilder::Create<::pasta::" << name << ">(ast, val);\n"
         << "  }\n";
     gRetTypeToValMap[ss2.str()] = crvs.str();
+
+    gRetTypeToRefMap[ss.str()] = {"::pasta::TypeRef", kRefVal};
+    gRetTypeToRefMap[ss2.str()] = {"::pasta::TypeRef", kRefVal};
   }
 }
 
@@ -110,5 +126,8 @@ void MapAttrRetTypes(void) {
         << "    return AttrBuilder::Create<::pasta::" << name << ">(ast, val);\n"
         << "  }\n";
     gRetTypeToValMap[ss2.str()] = crvs.str();
+
+    gRetTypeToRefMap[ss.str()] = {"::pasta::AttrRef", kRefVal};
+    gRetTypeToRefMap[ss2.str()] = {"::pasta::AttrRef", kRefVal};
   }
 }
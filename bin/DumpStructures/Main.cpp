@@ -8,6 +8,7 @@
 #include <pasta/Compile/Compiler.h>
 #include <pasta/Compile/Job.h>
 #include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
 #include <pasta/Util/FileSystem.h>
 #include <pasta/Util/Init.h>
 
@@ -135,7 +136,8 @@ int main(int argc, char *argv[]) {
   }
 
   pasta::InitPasta initializer;
-  pasta::FileManager fm(pasta::FileSystem::CreateNative());
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
   auto maybe_compiler =
       pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
   if (!maybe_compiler.Succeeded()) {
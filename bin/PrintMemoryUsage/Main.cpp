@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+// Builds the AST of each translation unit of a compilation database, e.g. a
+// `compile_commands.json`, one at a time, and prints the `ASTMemoryUsage` of
+// each AST to stdout as one JSON object per line. With `--compact`, the ASTs
+// are built with `CompileJobOptions::compact_ast`.
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/MemoryUsage.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/raw_ostream.h>
+#pragma GCC diagnostic pop
+
+namespace {
+
+// Return the arguments of a compilation database entry, which are either a
+// list of `arguments`, or a shell-quoted `command`.
+static pasta::ArgumentVector EntryArguments(const llvm::json::Object &entry) {
+  if (auto args = entry.getArray("arguments")) {
+    std::vector<std::string> vec;
+    for (const llvm::json::Value &arg : *args) {
+      if (auto str = arg.getAsString()) {
+        vec.emplace_back(str->str());
+      }
+    }
+    return pasta::ArgumentVector(vec);
+
+  } else if (auto command = entry.getString("command")) {
+    return pasta::ArgumentVector(command->str());
+
+  } else {
+    return pasta::ArgumentVector();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  pasta::CompileJobOptions job_options;
+  if (3 == argc && std::string_view(argv[1]) == "--compact") {
+    job_options.compact_ast = true;
+  } else if (2 != argc) {
+    std::cerr << "Usage: " << argv[0] << " [--compact] COMPILE_COMMANDS_JSON"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const char * const db_path = argv[argc - 1];
+  std::ifstream db_file(db_path);
+  if (!db_file) {
+    std::cerr << "Unable to open compilation database " << db_path
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::stringstream db_data;
+  db_data << db_file.rdbuf();
+
+  auto maybe_db = llvm::json::parse(db_data.str());
+  if (!maybe_db) {
+    std::cerr << "Unable to parse compilation database " << db_path << ": "
+              << llvm::toString(maybe_db.takeError()) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const llvm::json::Array *entries = maybe_db->getAsArray();
+  if (!entries) {
+    std::cerr << "Compilation database " << db_path
+              << " is not a JSON array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  pasta::InitPasta initializer;
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
+  auto maybe_compiler =
+      pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
+  if (!maybe_compiler.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto ret = EXIT_SUCCESS;
+
+  for (const llvm::json::Value &entry_val : *entries) {
+    const llvm::json::Object *entry = entry_val.getAsObject();
+    if (!entry) {
+      continue;
+    }
+
+    std::string dir;
+    if (auto maybe_dir = entry->getString("directory")) {
+      dir = maybe_dir->str();
+    }
+
+    std::string file;
+    if (auto maybe_file = entry->getString("file")) {
+      file = maybe_file->str();
+    }
+
+    const pasta::ArgumentVector args = EntryArguments(*entry);
+    auto maybe_command = pasta::CompileCommand::CreateFromArguments(args, dir);
+    if (!maybe_command.Succeeded()) {
+      std::cerr << file << ": " << maybe_command.TakeError() << std::endl;
+      ret = EXIT_FAILURE;
+      continue;
+    }
+
+    const auto command = maybe_command.TakeValue();
+    auto maybe_jobs = maybe_compiler->CreateJobsForCommand(command);
+    if (!maybe_jobs.Succeeded()) {
+      std::cerr << file << ": " << maybe_jobs.TakeError() << std::endl;
+      ret = EXIT_FAILURE;
+      continue;
+    }
+
+    // NOTE(pag): Each AST is dropped before the next job runs, so that the
+    //            numbers for one translation unit don't depend on the others,
+    //            except through the data and tokens of shared files.
+    for (const auto &job : maybe_jobs.TakeValue()) {
+      auto maybe_ast = job.Run(job_options);
+      if (!maybe_ast.Succeeded()) {
+        std::cerr << file << ": " << maybe_ast.TakeError() << std::endl;
+        ret = EXIT_FAILURE;
+        continue;
+      }
+
+      std::string quoted_file;
+      llvm::raw_string_ostream(quoted_file) << llvm::json::Value(file);
+
+      std::cout << "{\"file\":" << quoted_file << ",\"memory_usage\":"
+                << maybe_ast->MemoryUsage().ToJSON() << "}" << std::endl;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Statistics.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+
+int main(int argc, char *argv[]) {
+  if (2 > argc) {
+    std::cerr << "Usage: " << argv[0] << " COMPILE_COMMAND..."
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  pasta::InitPasta initializer;
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
+  auto maybe_compiler =
+      pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
+  if (!maybe_compiler.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto maybe_cwd = pasta::FileSystem::From(maybe_compiler.Value())->CurrentWorkingDirectory();
+  if (!maybe_cwd.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const pasta::ArgumentVector args(argc - 1, &argv[1]);
+  auto maybe_command = pasta::CompileCommand::CreateFromArguments(
+      args, maybe_cwd.TakeValue());
+  if (!maybe_command.Succeeded()) {
+    std::cerr << maybe_command.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto command = maybe_command.TakeValue();
+  auto maybe_jobs = maybe_compiler->CreateJobsForCommand(command);
+  if (!maybe_jobs.Succeeded()) {
+    std::cerr << maybe_jobs.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (const auto &job : maybe_jobs.TakeValue()) {
+    auto maybe_ast = job.Run();
+    if (!maybe_ast.Succeeded()) {
+      std::cerr << maybe_ast.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    } else {
+      std::cout << maybe_ast->Statistics().ToJSON() << std::endl;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
@@ -9,24 +9,153 @@
 #include <pasta/Compile/Compiler.h>
 #include <pasta/Compile/Job.h>
 #include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
+#include <pasta/Util/File.h>
 #include <pasta/Util/FileSystem.h>
 #include <pasta/Util/Init.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// What to print for each job.
+enum class OutputMode {
+  // The printed tokens of the translation unit.
+  kPrintedTokens,
+
+  // The printed tokens of the translation unit, along with their kinds.
+  kPrintedTokenKinds,
+
+  // The raw tokens of the main file.
+  kFileTokens,
+
+  // The parsed tokens of the translation unit.
+  kParsedTokens,
+
+  // The statistics of the AST, as JSON.
+  kStatistics,
+};
+
+// Parse `str` as an unsigned number.
+static bool ParseUnsigned(const char *str, unsigned &out) {
+  char *end = nullptr;
+  const auto val = std::strtoul(str, &end, 10);
+  if (!end || end == str || *end ||
+      val > std::numeric_limits<unsigned>::max()) {
+    return false;
+  }
+  out = static_cast<unsigned>(val);
+  return true;
+}
+
+// Print `data`, escaping backslashes and whitespace other than spaces, so
+// that e.g. a line splice or a `\r` stays on the token's line.
+static void PrintEscaped(std::string_view data) {
+  for (char ch : data) {
+    switch (ch) {
+      case '\\': std::cout << "\\\\"; break;
+      case '\r': std::cout << "\\r"; break;
+      case '\n': std::cout << "\\n"; break;
+      case '\t': std::cout << "\\t"; break;
+      default: std::cout << ch; break;
+    }
+  }
+}
+
+// Print a parsed token as `KIND DATA [LINE:COLUMN] [CONTEXT...]`, where each
+// context, innermost first, is printed as `KIND#INDEX`.
+static void PrintParsedToken(const pasta::Token &tok) {
+  std::cout << tok.KindName() << ' ';
+  PrintEscaped(tok.Data());
+
+  if (auto file_tok = tok.FileLocation()) {
+    std::cout << ' ' << file_tok->Line() << ':' << file_tok->Column();
+  }
+
+  for (auto context = tok.Context(); context; context = context->Parent()) {
+    std::cout << ' ' << context->KindName() << '#' << context->Index();
+  }
+
+  std::cout << std::endl;
+}
+
+static int Usage(const char *self) {
+  std::cerr << "Usage: " << self << " [--alignment-threads N] "
+            << "[--tokenizer-threads N] [--token-cache DIR] [--replay] "
+            << "[--skip-function-bodies] [--lazy-alignment] [--compact] "
+            << "[--hibernate] "
+            << "[--file-tokens | --parsed-tokens | --printed-token-kinds | "
+            << "--statistics] "
+            << "COMPILE_COMMAND..." << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
 
 
 int main(int argc, char *argv[]) {
-  if (2 > argc) {
-    std::cerr << "Usage: " << argv[0] << " COMPILE_COMMAND..."
-              << std::endl;
-    return EXIT_FAILURE;
+
+  // NOTE(pag): Options may appear anywhere, as lit's substitutions put `-x c`
+  //            or `-x c++` first. Everything else is part of the compile
+  //            command.
+  pasta::CompileJobOptions job_options;
+  OutputMode mode = OutputMode::kPrintedTokens;
+  bool hibernate = false;
+  std::vector<std::string> command_args;
+  for (auto i = 1; i < argc; ++i) {
+    const char * const arg = argv[i];
+    if (!strcmp(arg, "--alignment-threads")) {
+      if ((i + 1) >= argc ||
+          !ParseUnsigned(argv[++i], job_options.num_alignment_threads)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--tokenizer-threads")) {
+      if ((i + 1) >= argc ||
+          !ParseUnsigned(argv[++i], job_options.num_tokenizer_threads)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--token-cache")) {
+      if ((i + 1) >= argc) {
+        return Usage(argv[0]);
+      }
+      job_options.token_cache_directory = argv[++i];
+    } else if (!strcmp(arg, "--replay")) {
+      job_options.replay_preprocessed_tokens = true;
+    } else if (!strcmp(arg, "--skip-function-bodies")) {
+      job_options.skip_function_bodies = true;
+    } else if (!strcmp(arg, "--lazy-alignment")) {
+      job_options.lazy_token_alignment = true;
+    } else if (!strcmp(arg, "--compact")) {
+      job_options.compact_ast = true;
+    } else if (!strcmp(arg, "--hibernate")) {
+      hibernate = true;
+    } else if (!strcmp(arg, "--file-tokens")) {
+      mode = OutputMode::kFileTokens;
+    } else if (!strcmp(arg, "--parsed-tokens")) {
+      mode = OutputMode::kParsedTokens;
+    } else if (!strcmp(arg, "--printed-token-kinds")) {
+      mode = OutputMode::kPrintedTokenKinds;
+    } else if (!strcmp(arg, "--statistics")) {
+      mode = OutputMode::kStatistics;
+    } else {
+      command_args.emplace_back(arg);
+    }
+  }
+
+  if (command_args.empty()) {
+    return Usage(argv[0]);
   }
 
   pasta::InitPasta initializer;
-  pasta::FileManager fm(pasta::FileSystem::CreateNative());
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
   auto maybe_compiler =
       pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
   if (!maybe_compiler.Succeeded()) {
@@ -40,7 +169,7 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
-  const pasta::ArgumentVector args(argc - 1, &argv[1]);
+  const pasta::ArgumentVector args(command_args);
   auto maybe_command = pasta::CompileCommand::CreateFromArguments(
       args, maybe_cwd.TakeValue());
   if (!maybe_command.Succeeded()) {
@@ -56,10 +185,46 @@ int main(int argc, char *argv[]) {
   }
 
   for (const auto &job : maybe_jobs.TakeValue()) {
-    auto maybe_ast = job.Run();
+    auto maybe_ast = job.Run(job_options);
     if (!maybe_ast.Succeeded()) {
       std::cerr << maybe_ast.TakeError() << std::endl;
       return EXIT_FAILURE;
+    }
+
+    // Hibernate the AST so that everything below reads it back after it is
+    // rehydrated.
+    if (hibernate && !maybe_ast->Hibernate()) {
+      std::cerr << "Unable to hibernate the AST" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // One line per token: `LINE:COLUMN KIND DATA`.
+    if (mode == OutputMode::kFileTokens) {
+      for (pasta::FileToken tok : maybe_ast->MainFile().Tokens()) {
+        std::cout << tok.Line() << ':' << tok.Column() << ' '
+                  << tok.KindName() << ' ';
+        PrintEscaped(tok.Data());
+        std::cout << std::endl;
+      }
+
+    } else if (mode == OutputMode::kParsedTokens) {
+      for (pasta::Token tok : maybe_ast->Tokens()) {
+        PrintParsedToken(tok);
+      }
+
+    } else if (mode == OutputMode::kStatistics) {
+      std::cout << maybe_ast->Statistics().ToJSON() << std::endl;
+
+    // One line per token: `KIND DATA`.
+    } else if (mode == OutputMode::kPrintedTokenKinds) {
+      auto tu = maybe_ast->TranslationUnit();
+      auto tokens = pasta::PrintedTokenRange::Create(tu);
+      for (pasta::PrintedToken tok : tokens) {
+        std::cout << tok.KindName() << ' ';
+        PrintEscaped(tok.Data());
+        std::cout << std::endl;
+      }
+
     } else {
       auto tu = maybe_ast->TranslationUnit();
       auto tokens = pasta::PrintedTokenRange::Create(tu);
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/AST.h>
+#include <pasta/Compile/BatchRunner.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/CachingFileSystem.h>
+#include <pasta/Util/File.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Parse `str` as an unsigned number.
+static bool ParseUnsigned(const char *str, unsigned &out) {
+  char *end = nullptr;
+  const auto val = std::strtoul(str, &end, 10);
+  if (!end || end == str || *end ||
+      val > std::numeric_limits<unsigned>::max()) {
+    return false;
+  }
+  out = static_cast<unsigned>(val);
+  return true;
+}
+
+static int Usage(const char *self) {
+  std::cerr << "Usage: " << self << " [--threads N] [--max-live-asts N] "
+            << "COMPILE_COMMAND..." << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+// Runs the jobs of a compile command that names several source files through
+// a `BatchRunner`, and prints one line per job, in the order that the jobs
+// are reported: `FILE ok` or `FILE error`, where `FILE` is the name of the
+// job's source file. Then prints the largest number of ASTs that were seen
+// alive at once. Exits with failure if that exceeds the limit, or if a job
+// is reported twice, or is reported with the AST of another job.
+int main(int argc, char *argv[]) {
+  pasta::BatchRunnerOptions options;
+  std::vector<std::string> command_args;
+  for (auto i = 1; i < argc; ++i) {
+    const char * const arg = argv[i];
+    if (!strcmp(arg, "--threads")) {
+      if ((i + 1) >= argc || !ParseUnsigned(argv[++i], options.num_threads)) {
+        return Usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--max-live-asts")) {
+      if ((i + 1) >= argc ||
+          !ParseUnsigned(argv[++i], options.max_live_asts)) {
+        return Usage(argv[0]);
+      }
+    } else {
+      command_args.emplace_back(arg);
+    }
+  }
+
+  if (command_args.empty()) {
+    return Usage(argv[0]);
+  }
+
+  pasta::InitPasta initializer;
+  pasta::FileManager fm(
+      pasta::CachingFileSystem::Create(pasta::FileSystem::CreateNative()));
+  auto maybe_compiler =
+      pasta::Compiler::CreateHostCompiler(fm, pasta::TargetLanguage::kCXX);
+  if (!maybe_compiler.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto fs = pasta::FileSystem::From(maybe_compiler.Value());
+  auto maybe_cwd = fs->CurrentWorkingDirectory();
+  if (!maybe_cwd.Succeeded()) {
+    std::cerr << maybe_cwd.TakeError().message() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const pasta::ArgumentVector args(command_args);
+  auto maybe_command = pasta::CompileCommand::CreateFromArguments(
+      args, maybe_cwd.TakeValue());
+  if (!maybe_command.Succeeded()) {
+    std::cerr << maybe_command.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto command = maybe_command.TakeValue();
+  auto maybe_jobs = maybe_compiler->CreateJobsForCommand(command);
+  if (!maybe_jobs.Succeeded()) {
+    std::cerr << maybe_jobs.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<pasta::CompileJob> jobs = maybe_jobs.TakeValue();
+  std::set<std::string> source_files;
+  for (const pasta::CompileJob &job : jobs) {
+    if (!source_files.insert(job.SourceFile().Path().filename()).second) {
+      std::cerr << "Source file names must be unique" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The jobs whose ASTs are alive, keyed by the names of their source files.
+  //
+  // NOTE(pag): The alignment file filter is called on the thread running a
+  //            job, after the job has taken its slot, and so it tells us
+  //            that a job is building its AST. Jobs that fail before token
+  //            alignment aren't seen, and so `max_seen_live_asts` is a lower
+  //            bound on the number of ASTs that were really alive at once.
+  std::mutex lock;
+  std::set<std::string> live_asts;
+  size_t max_seen_live_asts = 0u;
+  options.job_options.alignment_file_filter =
+      [&] (const pasta::File &file) {
+        std::string name = file.Path().filename();
+        if (source_files.count(name)) {
+          std::lock_guard<std::mutex> locker(lock);
+          live_asts.insert(std::move(name));
+          max_seen_live_asts = std::max(max_seen_live_asts, live_asts.size());
+        }
+        return true;
+      };
+
+  std::set<std::string> reported;
+  bool ok = true;
+  pasta::BatchRunner runner(options);
+  runner.Run(
+      jobs,
+      [&] (const pasta::CompileJob &job,
+           pasta::Result<pasta::AST, std::string> maybe_ast) {
+        std::string name = job.SourceFile().Path().filename();
+        if (!reported.insert(name).second) {
+          std::cerr << name << " was reported more than once" << std::endl;
+          ok = false;
+        }
+
+        if (!maybe_ast.Succeeded()) {
+          std::cout << name << " error" << std::endl;
+          if (maybe_ast.TakeError().empty()) {
+            std::cerr << name << " has an empty error" << std::endl;
+            ok = false;
+          }
+
+        } else if (maybe_ast->MainFile().Path().filename() != name) {
+          std::cerr << name << " was reported with the AST of "
+                    << maybe_ast->MainFile().Path().filename() << std::endl;
+          ok = false;
+
+        } else {
+          std::cout << name << " ok" << std::endl;
+        }
+
+        // The runner lets another job start once this returns.
+        std::lock_guard<std::mutex> locker(lock);
+        live_asts.erase(name);
+      });
+
+  if (reported.size() != jobs.size()) {
+    std::cerr << "Only " << reported.size() << " of " << jobs.size()
+              << " jobs were reported" << std::endl;
+    ok = false;
+  }
+
+  const unsigned limit = options.max_live_asts ? options.max_live_asts
+                                               : options.num_threads;
+  std::cout << "max live ASTs: " << max_seen_live_asts << std::endl;
+  if (limit && max_seen_live_asts > limit) {
+    std::cerr << "More than " << limit << " ASTs were alive at once"
+              << std::endl;
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
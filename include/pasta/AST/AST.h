@@ -11,6 +11,8 @@
 
 #include "Decl.h"
 #include "Macro.h"
+#include "MemoryUsage.h"
+#include "Statistics.h"
 #include "Stmt.h"
 #include "Token.h"
 #include "Type.h"
@@ -80,6 +82,35 @@ class AST {
   // construction of this AST.
   const std::vector<::pasta::File> &ParsedFiles(void) const;
 
+  // Return the timings and counters gathered while building this AST. This
+  // wakes up a hibernating AST.
+  const ASTStatistics &Statistics(void) const;
+
+  // Return an estimate of the memory retained by this AST, broken down by
+  // the data structure retaining it. This wakes up a hibernating AST.
+  ASTMemoryUsage MemoryUsage(void) const;
+
+  // Compress the tokens, token contexts, token columns, and token data of
+  // this AST, and free the originals. They are transparently decompressed the
+  // next time that anything reads them, i.e. when calling `Tokens`, `Macros`,
+  // `TranslationUnit`, `Adopt`, `Statistics`, or `MemoryUsage`. Returns `true`
+  // if this AST is hibernating.
+  //
+  // The preprocessed code isn't compressed, as Clang's source manager points
+  // into it, and neither is the data of the parsed files, which belongs to
+  // the `FileManager`, and is shared with other ASTs.
+  //
+  // NOTE(pag): This does nothing, and returns `false`, unless this `AST` is
+  //            the only reference to the underlying AST, i.e. there are no
+  //            other copies of it, nor any `Token`s, `Decl`s, `Macro`s,
+  //            ranges, etc. derived from it. Borrowed handles, i.e.
+  //            `TokenRef`s, `TokenRefRange`s, `DeclRef`s, and
+  //            `DeclContextRange` iterators, aren't references, and so can't
+  //            be seen here. They must not be kept across a call to
+  //            `Hibernate`; `TokenRef`s and `TokenRefRange`s in particular
+  //            point at tokens that hibernation frees.
+  bool Hibernate(void) const;
+
 #ifndef PASTA_IN_BOOTSTRAP
   Token Adopt(const clang::SourceLocation &loc) const;
   Decl Adopt(const clang::Decl *decl) const;
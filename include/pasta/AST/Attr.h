@@ -408,6 +408,7 @@ class Attr {
   PASTA_DECLARE_DERIVED_OPERATORS(Attr, XRayLogArgsAttr)
   PASTA_DECLARE_DERIVED_OPERATORS(Attr, ZeroCallUsedRegsAttr)
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
   uint32_t SpellingListIndex(void) const noexcept;
   bool IsImplicit(void) const noexcept;
@@ -428,6 +429,7 @@ class Attr {
   static std::optional<::pasta::Attr> From(const TokenContext &);
 
  protected:
+  friend class AttrRef;
   friend class TokenContext;
 
   std::shared_ptr<ASTImpl> ast;
@@ -1334,6 +1336,7 @@ class LockReturnedAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, LockReturnedAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, LockReturnedAttr)
   ::pasta::Expr Argument(void) const noexcept;
+  ::pasta::StmtRef ArgumentRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(LockReturnedAttr)
@@ -1368,6 +1371,7 @@ class LoopHintAttr : public Attr {
   std::string_view Spelling(void) const noexcept;
   enum LoopHintAttrLoopHintState State(void) const noexcept;
   std::optional<::pasta::Expr> Value(void) const noexcept;
+  std::optional<::pasta::StmtRef> ValueRef(void) const noexcept;
   // ValueString: (std::string)
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(LoopHintAttr)
@@ -1690,6 +1694,7 @@ class NSErrorDomainAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, NSErrorDomainAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, NSErrorDomainAttr)
   ::pasta::VarDecl ErrorDomain(void) const noexcept;
+  ::pasta::DeclRef ErrorDomainRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(NSErrorDomainAttr)
@@ -2074,7 +2079,9 @@ class OMPAllocateDeclAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, OMPAllocateDeclAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, OMPAllocateDeclAttr)
   ::pasta::Expr Alignment(void) const noexcept;
+  ::pasta::StmtRef AlignmentRef(void) const noexcept;
   ::pasta::Expr Allocator(void) const noexcept;
+  ::pasta::StmtRef AllocatorRef(void) const noexcept;
   enum OMPAllocateDeclAttrAllocatorTypeTy AllocatorType(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
@@ -2122,6 +2129,7 @@ class OMPDeclareSimdDeclAttr : public Attr {
   // Alignments: (llvm::iterator_range<clang::Expr **>)
   enum OMPDeclareSimdDeclAttrBranchStateTy BranchState(void) const noexcept;
   ::pasta::Expr Simdlen(void) const noexcept;
+  ::pasta::StmtRef SimdlenRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
   // Linears: (llvm::iterator_range<clang::Expr **>)
   // Modifiers: (llvm::iterator_range<unsigned int *>)
@@ -2143,6 +2151,7 @@ class OMPDeclareTargetDeclAttr : public InheritableAttr {
   enum OMPDeclareTargetDeclAttrDevTypeTy DevType(void) const noexcept;
   bool Indirect(void) const noexcept;
   ::pasta::Expr IndirectExpression(void) const noexcept;
+  ::pasta::StmtRef IndirectExpressionRef(void) const noexcept;
   uint32_t Level(void) const noexcept;
   enum OMPDeclareTargetDeclAttrMapTypeTy MapType(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
@@ -2165,6 +2174,7 @@ class OMPDeclareVariantAttr : public InheritableAttr {
   std::string_view Spelling(void) const noexcept;
   // TraitInfos: (clang::OMPTraitInfo *)
   ::pasta::Expr VariantFuncReference(void) const noexcept;
+  ::pasta::StmtRef VariantFuncReferenceRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(OMPDeclareVariantAttr)
 };
@@ -2178,6 +2188,7 @@ class OMPReferencedVarAttr : public Attr {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPReferencedVarAttr)
   PASTA_DECLARE_BASE_OPERATORS(Attr, OMPReferencedVarAttr)
   ::pasta::Expr Reference(void) const noexcept;
+  ::pasta::StmtRef ReferenceRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(OMPReferencedVarAttr)
@@ -2729,6 +2740,7 @@ class OwnerAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, OwnerAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, OwnerAttr)
   ::pasta::Type DerefType(void) const noexcept;
+  ::pasta::TypeRef DerefTypeRef(void) const noexcept;
   ::pasta::Type DerefTypeToken(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
@@ -2877,6 +2889,7 @@ class PointerAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, PointerAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, PointerAttr)
   ::pasta::Type DerefType(void) const noexcept;
+  ::pasta::TypeRef DerefTypeRef(void) const noexcept;
   ::pasta::Type DerefTypeToken(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
@@ -2974,6 +2987,7 @@ class PreferredNameAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, PreferredNameAttr)
   std::string_view Spelling(void) const noexcept;
   ::pasta::Type TypedefType(void) const noexcept;
+  ::pasta::TypeRef TypedefTypeRef(void) const noexcept;
   ::pasta::Type TypedefTypeToken(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(PreferredNameAttr)
@@ -3017,6 +3031,7 @@ class PtGuardedByAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, PtGuardedByAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, PtGuardedByAttr)
   ::pasta::Expr Argument(void) const noexcept;
+  ::pasta::StmtRef ArgumentRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(PtGuardedByAttr)
@@ -3377,6 +3392,7 @@ class SharedTrylockFunctionAttr : public InheritableAttr {
   // Arguments: (llvm::iterator_range<clang::Expr **>)
   std::string_view Spelling(void) const noexcept;
   ::pasta::Expr SuccessValue(void) const noexcept;
+  ::pasta::StmtRef SuccessValueRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(SharedTrylockFunctionAttr)
 };
@@ -3880,6 +3896,7 @@ class TryAcquireCapabilityAttr : public InheritableAttr {
   enum TryAcquireCapabilityAttrSpelling SemanticSpelling(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
   ::pasta::Expr SuccessValue(void) const noexcept;
+  ::pasta::StmtRef SuccessValueRef(void) const noexcept;
   bool IsShared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(TryAcquireCapabilityAttr)
@@ -3989,6 +4006,7 @@ class TypeTagForDatatypeAttr : public InheritableAttr {
   // ArgumentKind: (clang::IdentifierInfo *)
   bool LayoutCompatible(void) const noexcept;
   ::pasta::Type MatchingCType(void) const noexcept;
+  ::pasta::TypeRef MatchingCTypeRef(void) const noexcept;
   ::pasta::Type MatchingCTypeToken(void) const noexcept;
   bool MustBeNull(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
@@ -4141,6 +4159,7 @@ class UuidAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, UuidAttr)
   std::string_view Guid(void) const noexcept;
   ::pasta::MSGuidDecl GuidDeclaration(void) const noexcept;
+  ::pasta::DeclRef GuidDeclarationRef(void) const noexcept;
   uint32_t GuidLength(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
@@ -4172,6 +4191,7 @@ class VecTypeHintAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, VecTypeHintAttr)
   std::string_view Spelling(void) const noexcept;
   ::pasta::Type TypeHint(void) const noexcept;
+  ::pasta::TypeRef TypeHintRef(void) const noexcept;
   ::pasta::Type TypeHintToken(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(VecTypeHintAttr)
@@ -4446,7 +4466,9 @@ class AMDGPUFlatWorkGroupSizeAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, AMDGPUFlatWorkGroupSizeAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, AMDGPUFlatWorkGroupSizeAttr)
   ::pasta::Expr Max(void) const noexcept;
+  ::pasta::StmtRef MaxRef(void) const noexcept;
   ::pasta::Expr Min(void) const noexcept;
+  ::pasta::StmtRef MinRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(AMDGPUFlatWorkGroupSizeAttr)
@@ -4506,7 +4528,9 @@ class AMDGPUWavesPerEUAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, AMDGPUWavesPerEUAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, AMDGPUWavesPerEUAttr)
   ::pasta::Expr Max(void) const noexcept;
+  ::pasta::StmtRef MaxRef(void) const noexcept;
   ::pasta::Expr Min(void) const noexcept;
+  ::pasta::StmtRef MinRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(AMDGPUWavesPerEUAttr)
@@ -4699,6 +4723,7 @@ class AlignValueAttr : public Attr {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AlignValueAttr)
   PASTA_DECLARE_BASE_OPERATORS(Attr, AlignValueAttr)
   ::pasta::Expr Alignment(void) const noexcept;
+  ::pasta::StmtRef AlignmentRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(AlignValueAttr)
@@ -4715,6 +4740,7 @@ class AlignedAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, AlignedAttr)
   uint32_t Alignment(void) const noexcept;
   std::optional<::pasta::Expr> AlignmentExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> AlignmentExpressionRef(void) const noexcept;
   std::optional<::pasta::Type> AlignmentType(void) const noexcept;
   enum AlignedAttrSpelling SemanticSpelling(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
@@ -5018,7 +5044,9 @@ class AssumeAlignedAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, AssumeAlignedAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, AssumeAlignedAttr)
   ::pasta::Expr Alignment(void) const noexcept;
+  ::pasta::StmtRef AlignmentRef(void) const noexcept;
   std::optional<::pasta::Expr> Offset(void) const noexcept;
+  std::optional<::pasta::StmtRef> OffsetRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(AssumeAlignedAttr)
@@ -5408,7 +5436,9 @@ class CUDALaunchBoundsAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, CUDALaunchBoundsAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, CUDALaunchBoundsAttr)
   ::pasta::Expr MaxThreads(void) const noexcept;
+  ::pasta::StmtRef MaxThreadsRef(void) const noexcept;
   ::pasta::Expr MinBlocks(void) const noexcept;
+  ::pasta::StmtRef MinBlocksRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(CUDALaunchBoundsAttr)
@@ -5530,6 +5560,7 @@ class CleanupAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, CleanupAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, CleanupAttr)
   ::pasta::FunctionDecl FunctionDeclaration(void) const noexcept;
+  ::pasta::DeclRef FunctionDeclarationRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(CleanupAttr)
@@ -5825,6 +5856,7 @@ class DiagnoseAsBuiltinAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, DiagnoseAsBuiltinAttr)
   // ArgumentIndices: (llvm::iterator_range<unsigned int *>)
   ::pasta::FunctionDecl Function(void) const noexcept;
+  ::pasta::DeclRef FunctionRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(DiagnoseAsBuiltinAttr)
@@ -5841,10 +5873,12 @@ class DiagnoseIfAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, DiagnoseIfAttr)
   bool ArgumentDependent(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   enum DiagnoseIfAttrDiagnosticType DiagnosticType(void) const noexcept;
   std::string_view Message(void) const noexcept;
   uint32_t MessageLength(void) const noexcept;
   ::pasta::NamedDecl Parent(void) const noexcept;
+  ::pasta::DeclRef ParentRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
   bool IsError(void) const noexcept;
   bool IsWarning(void) const noexcept;
@@ -5904,6 +5938,7 @@ class EnableIfAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, EnableIfAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, EnableIfAttr)
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   std::string_view Message(void) const noexcept;
   uint32_t MessageLength(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
@@ -6003,6 +6038,7 @@ class ExclusiveTrylockFunctionAttr : public InheritableAttr {
   // Arguments: (llvm::iterator_range<clang::Expr **>)
   std::string_view Spelling(void) const noexcept;
   ::pasta::Expr SuccessValue(void) const noexcept;
+  ::pasta::StmtRef SuccessValueRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(ExclusiveTrylockFunctionAttr)
 };
@@ -6169,6 +6205,7 @@ class GuardedByAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, GuardedByAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, GuardedByAttr)
   ::pasta::Expr Argument(void) const noexcept;
+  ::pasta::StmtRef ArgumentRef(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR(GuardedByAttr)
@@ -6300,6 +6337,7 @@ class IBOutletCollectionAttr : public InheritableAttr {
   PASTA_DECLARE_BASE_OPERATORS(Attr, IBOutletCollectionAttr)
   PASTA_DECLARE_BASE_OPERATORS(InheritableAttr, IBOutletCollectionAttr)
   ::pasta::Type Interface(void) const noexcept;
+  ::pasta::TypeRef InterfaceRef(void) const noexcept;
   ::pasta::Type InterfaceToken(void) const noexcept;
   std::string_view Spelling(void) const noexcept;
  protected:
@@ -6601,6 +6639,48 @@ class AlwaysInlineAttr : public DeclOrStmtAttr {
 
 static_assert(sizeof(Attr) == sizeof(AlwaysInlineAttr));
 
+// A borrowed, non-owning reference to an attribute. See `DeclRef`.
+class AttrRef {
+ public:
+  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AttrRef)
+
+  inline AttrRef(const Attr &attr) noexcept
+      : ast(attr.ast.get()),
+        attr(attr.u.Attr),
+        kind(attr.kind) {}
+
+  inline AttrKind Kind(void) const noexcept {
+    return kind;
+  }
+
+  std::string_view KindName(void) const noexcept;
+
+  inline const ::clang::Attr *RawAttr(void) const noexcept {
+    return attr;
+  }
+
+  // Return an owning version of this attribute.
+  ::pasta::Attr Owned(void) const;
+
+  inline bool operator==(const AttrRef &that) const noexcept {
+    return attr == that.attr;
+  }
+
+  inline bool operator!=(const AttrRef &that) const noexcept {
+    return attr != that.attr;
+  }
+
+ private:
+  friend class RefBuilder;
+
+  AttrRef(void) = delete;
+  explicit AttrRef(ASTImpl *ast_, const ::clang::Attr *attr_);
+
+  ASTImpl *ast;
+  const ::clang::Attr *attr;
+  AttrKind kind;
+};
+
 }  // namespace pasta
 #undef PASTA_DEFINE_DEFAULT_ATTR_CONSTRUCTOR
 #endif  // PASTA_IN_BOOTSTRAP
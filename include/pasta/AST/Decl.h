@@ -22,6 +22,7 @@
     friend class ASTImpl; \
     friend class DeclBuilder; \
     friend class DeclVisitor; \
+    template <typename> friend class DeclContextIterator; \
     friend class PrintedTokenRange; \
     base(void) = delete; \
     explicit base( \
@@ -177,17 +178,22 @@ class DeclContext {
   // ContainsDeclarationAndLoad: (bool)
   // Ddiags: (llvm::iterator_range<clang::DeclContext::ddiag_iterator>)
   std::vector<::pasta::Decl> Declarations(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::Decl> DeclarationsRange(void) const noexcept;
   enum ::pasta::DeclKind DeclarationKind(void) const noexcept;
   std::string_view DeclarationKindName(void) const noexcept;
   std::optional<::pasta::DeclContext> EnclosingNamespaceContext(void) const noexcept;
   std::optional<::pasta::LinkageSpecDecl> ExternCContext(void) const noexcept;
+  std::optional<::pasta::DeclRef> ExternCContextRef(void) const noexcept;
   std::optional<::pasta::BlockDecl> InnermostBlockDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> InnermostBlockDeclarationRef(void) const noexcept;
   std::optional<::pasta::DeclContext> LexicalParent(void) const noexcept;
   std::optional<::pasta::DeclContext> LookupParent(void) const noexcept;
   // LookupPointer: (clang::StoredDeclsMap *)
   std::optional<::pasta::Decl> NonClosureAncestor(void) const noexcept;
+  std::optional<::pasta::DeclRef> NonClosureAncestorRef(void) const noexcept;
   ::pasta::DeclContext NonTransparentContext(void) const noexcept;
   std::optional<::pasta::RecordDecl> OuterLexicalRecordContext(void) const noexcept;
+  std::optional<::pasta::DeclRef> OuterLexicalRecordContextRef(void) const noexcept;
   std::optional<::pasta::DeclContext> Parent(void) const noexcept;
   // ParentASTContext: (clang::ASTContext &)
   ::pasta::DeclContext PrimaryContext(void) const noexcept;
@@ -212,9 +218,11 @@ class DeclContext {
   // Lookup: (clang::DeclContextLookupResult)
   // Lookups: (llvm::iterator_range<clang::DeclContext::all_lookups_iterator>)
   std::vector<::pasta::Decl> AlreadyLoadedDeclarations(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::Decl> AlreadyLoadedDeclarationsRange(void) const noexcept;
   // NoloadLookups: (llvm::iterator_range<clang::DeclContext::all_lookups_iterator>)
   bool ShouldUseQualifiedLookup(void) const noexcept;
   // UsingDirectives: (llvm::iterator_range<clang::DeclContext::udir_iterator>)
+  ::pasta::DeclContextRange<::pasta::DeclRef> DeclarationRefs(void) const noexcept;
  private:
   friend class Decl;
   friend class DeclVisitor;
@@ -335,22 +343,31 @@ class Decl {
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, VarTemplateSpecializationDecl)
   std::vector<::pasta::Attr> Attributes(void) const noexcept;
+  ::pasta::AttrRange AttributesRange(void) const noexcept;
   // CanBeWeakImported: (bool)
   // ASTContext: (clang::ASTContext &)
   enum AccessSpecifier Access(void) const noexcept;
   std::optional<::pasta::FunctionDecl> AsFunction(void) const noexcept;
+  std::optional<::pasta::DeclRef> AsFunctionRef(void) const noexcept;
   // Attributes: (const llvm::SmallVector<clang::Attr *, 4> &)
   enum AvailabilityResult Availability(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Decl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::DeclContext DeclarationContext(void) const noexcept;
   std::optional<::pasta::Attr> DefiningAttribute(void) const noexcept;
+  std::optional<::pasta::AttrRef> DefiningAttributeRef(void) const noexcept;
   std::optional<::pasta::TemplateDecl> DescribedTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> DescribedTemplateRef(void) const noexcept;
   std::optional<::pasta::TemplateParameterList> DescribedTemplateParameters(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::ExternalSourceSymbolAttr> ExternalSourceSymbolAttribute(void) const noexcept;
+  std::optional<::pasta::AttrRef> ExternalSourceSymbolAttributeRef(void) const noexcept;
   enum DeclFriendObjectKind FriendObjectKind(void) const noexcept;
   std::optional<::pasta::FunctionType> FunctionType(void) const noexcept;
+  std::optional<::pasta::TypeRef> FunctionTypeRef(void) const noexcept;
   uint32_t GlobalID(void) const noexcept;
   int64_t ID(void) const noexcept;
   uint32_t IdentifierNamespace(void) const noexcept;
@@ -361,15 +378,20 @@ class Decl {
   uint32_t MaxAlignment(void) const noexcept;
   enum DeclModuleOwnershipKind ModuleOwnershipKind(void) const noexcept;
   ::pasta::Decl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::Decl> NextDeclarationInContext(void) const noexcept;
+  std::optional<::pasta::DeclRef> NextDeclarationInContextRef(void) const noexcept;
   std::optional<::pasta::Decl> NonClosureContext(void) const noexcept;
+  std::optional<::pasta::DeclRef> NonClosureContextRef(void) const noexcept;
   // OwningModule: (clang::Module *)
   // OwningModuleForLinkage: (clang::Module *)
   uint32_t OwningModuleID(void) const noexcept;
   std::optional<::pasta::DeclContext> ParentFunctionOrMethod(void) const noexcept;
   std::optional<::pasta::Decl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   uint32_t TemplateDepth(void) const noexcept;
   ::pasta::TranslationUnitDecl TranslationUnitDeclaration(void) const noexcept;
+  ::pasta::DeclRef TranslationUnitDeclarationRef(void) const noexcept;
   // VersionIntroduced: (llvm::VersionTuple)
   bool HasAttributes(void) const noexcept;
   bool HasBody(void) const noexcept;
@@ -407,6 +429,7 @@ class Decl {
   bool IsUsed(void) const noexcept;
   bool IsWeakImported(void) const noexcept;
   std::vector<::pasta::Decl> Redeclarations(void) const noexcept;
+  ::pasta::RedeclarationRange RedeclarationsRange(void) const noexcept;
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, DeclContext)
 
   inline DeclKind Kind(void) const {
@@ -423,6 +446,7 @@ class Decl {
   }
   static std::optional<::pasta::Decl> From(const TokenContext &);
  protected:
+  friend class DeclRef;
   friend class TokenContext;
 
   std::shared_ptr<ASTImpl> ast;
@@ -560,8 +584,11 @@ class ExportDecl : public Decl {
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ExportDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ExportDecl)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExportToken(void) const noexcept;
+  ::pasta::TokenRef ExportTokenRef(void) const noexcept;
   ::pasta::Token RBraceToken(void) const noexcept;
+  ::pasta::TokenRef RBraceTokenRef(void) const noexcept;
   bool HasBraces(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ExportDecl)
@@ -587,8 +614,11 @@ class FileScopeAsmDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FileScopeAsmDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, FileScopeAsmDecl)
   ::pasta::Token AssemblyToken(void) const noexcept;
+  ::pasta::TokenRef AssemblyTokenRef(void) const noexcept;
   ::pasta::StringLiteral AssemblyString(void) const noexcept;
+  ::pasta::StmtRef AssemblyStringRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FileScopeAsmDecl)
 };
@@ -601,7 +631,9 @@ class FriendDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FriendDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, FriendDecl)
   std::optional<::pasta::NamedDecl> FriendDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> FriendDeclarationRef(void) const noexcept;
   ::pasta::Token FriendToken(void) const noexcept;
+  ::pasta::TokenRef FriendTokenRef(void) const noexcept;
   std::optional<::pasta::Type> FriendType(void) const noexcept;
   uint32_t FriendTypeNumTemplateParameterLists(void) const noexcept;
   // FriendTypeTemplateParameterList: (clang::TemplateParameterList *)
@@ -619,7 +651,9 @@ class FriendTemplateDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FriendTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, FriendTemplateDecl)
   ::pasta::NamedDecl FriendDeclaration(void) const noexcept;
+  ::pasta::DeclRef FriendDeclarationRef(void) const noexcept;
   ::pasta::Token FriendToken(void) const noexcept;
+  ::pasta::TokenRef FriendTokenRef(void) const noexcept;
   ::pasta::Type FriendType(void) const noexcept;
   uint32_t NumTemplateParameters(void) const noexcept;
   // TemplateParameterList: (clang::TemplateParameterList *)
@@ -650,10 +684,12 @@ class LifetimeExtendedTemporaryDecl : public Decl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, LifetimeExtendedTemporaryDecl)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::ValueDecl ExtendingDeclaration(void) const noexcept;
+  ::pasta::DeclRef ExtendingDeclarationRef(void) const noexcept;
   uint32_t ManglingNumber(void) const noexcept;
   // OrCreateValue: (clang::APValue *)
   enum StorageDuration StorageDuration(void) const noexcept;
   ::pasta::Expr TemporaryExpression(void) const noexcept;
+  ::pasta::StmtRef TemporaryExpressionRef(void) const noexcept;
   // Value: (clang::APValue *)
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(LifetimeExtendedTemporaryDecl)
@@ -668,9 +704,12 @@ class LinkageSpecDecl : public Decl {
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, LinkageSpecDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, LinkageSpecDecl)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExternToken(void) const noexcept;
+  ::pasta::TokenRef ExternTokenRef(void) const noexcept;
   enum LinkageSpecDeclLanguageIDs Language(void) const noexcept;
   ::pasta::Token RBraceToken(void) const noexcept;
+  ::pasta::TokenRef RBraceTokenRef(void) const noexcept;
   bool HasBraces(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(LinkageSpecDecl)
@@ -764,10 +803,12 @@ class NamedDecl : public Decl {
   // LinkageAndVisibility: (clang::LinkageInfo)
   enum Linkage LinkageInternal(void) const noexcept;
   ::pasta::NamedDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::string Name(void) const noexcept;
   std::optional<enum ObjCStringFormatFamily> ObjCFStringFormattingFamily(void) const noexcept;
   std::string QualifiedNameAsString(void) const noexcept;
   ::pasta::NamedDecl UnderlyingDeclaration(void) const noexcept;
+  ::pasta::DeclRef UnderlyingDeclarationRef(void) const noexcept;
   enum Visibility Visibility(void) const noexcept;
   bool HasExternalFormalLinkage(void) const noexcept;
   bool HasLinkage(void) const noexcept;
@@ -792,13 +833,19 @@ class NamespaceAliasDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, NamespaceAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   ::pasta::Token AliasToken(void) const noexcept;
+  ::pasta::TokenRef AliasTokenRef(void) const noexcept;
   ::pasta::NamedDecl AliasedNamespace(void) const noexcept;
+  ::pasta::DeclRef AliasedNamespaceRef(void) const noexcept;
   ::pasta::NamespaceAliasDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::NamespaceDecl Namespace(void) const noexcept;
+  ::pasta::DeclRef NamespaceRef(void) const noexcept;
   ::pasta::Token NamespaceToken(void) const noexcept;
+  ::pasta::TokenRef NamespaceTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token TargetNameToken(void) const noexcept;
+  ::pasta::TokenRef TargetNameTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(NamespaceAliasDecl)
 };
@@ -814,10 +861,15 @@ class NamespaceDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, NamespaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   ::pasta::NamespaceDecl AnonymousNamespace(void) const noexcept;
+  ::pasta::DeclRef AnonymousNamespaceRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::NamespaceDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::NamespaceDecl OriginalNamespace(void) const noexcept;
+  ::pasta::DeclRef OriginalNamespaceRef(void) const noexcept;
   ::pasta::Token RBraceToken(void) const noexcept;
+  ::pasta::TokenRef RBraceTokenRef(void) const noexcept;
   bool IsAnonymousNamespace(void) const noexcept;
   bool IsInline(void) const noexcept;
   bool IsOriginalNamespace(void) const noexcept;
@@ -836,6 +888,7 @@ class ObjCCompatibleAliasDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCCompatibleAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCCompatibleAliasDecl)
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const noexcept;
+  ::pasta::DeclRef ClassInterfaceRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCCompatibleAliasDecl)
 };
@@ -859,18 +912,26 @@ class ObjCContainerDecl : public NamedDecl {
   // FindPropertyDeclaration: (clang::ObjCPropertyDecl *)
   // HasUserDeclaredSetterMethod: (bool)
   std::vector<::pasta::ObjCMethodDecl> ClassMethods(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCMethodDecl> ClassMethodsRange(void) const noexcept;
   std::vector<::pasta::ObjCPropertyDecl> ClassProperties(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> ClassPropertiesRange(void) const noexcept;
   ::pasta::TokenRange AtEndRange(void) const noexcept;
+  ::pasta::TokenRefRange AtEndRangeRef(void) const noexcept;
   ::pasta::Token AtStartToken(void) const noexcept;
+  ::pasta::TokenRef AtStartTokenRef(void) const noexcept;
   // ClassMethod: (clang::ObjCMethodDecl *)
   // InstanceMethod: (clang::ObjCMethodDecl *)
   // InstanceVariableDeclaration: (clang::ObjCIvarDecl *)
   // Method: (clang::ObjCMethodDecl *)
   // Property: (clang::ObjCPropertyDecl *)
   std::vector<::pasta::ObjCMethodDecl> InstanceMethods(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCMethodDecl> InstanceMethodsRange(void) const noexcept;
   std::vector<::pasta::ObjCPropertyDecl> InstanceProperties(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> InstancePropertiesRange(void) const noexcept;
   std::vector<::pasta::ObjCMethodDecl> Methods(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCMethodDecl> MethodsRange(void) const noexcept;
   std::vector<::pasta::ObjCPropertyDecl> Properties(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> PropertiesRange(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCContainerDecl)
 };
@@ -891,7 +952,9 @@ class ObjCImplDecl : public ObjCContainerDecl {
   // FindPropertyImplementationDeclaration: (clang::ObjCPropertyImplDecl *)
   // FindPropertyImplementationInstanceVariableDeclaration: (clang::ObjCPropertyImplDecl *)
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const noexcept;
+  ::pasta::DeclRef ClassInterfaceRef(void) const noexcept;
   std::vector<::pasta::ObjCPropertyImplDecl> PropertyImplementations(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCPropertyImplDecl> PropertyImplementationsRange(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCImplDecl)
 };
@@ -910,16 +973,21 @@ class ObjCImplementationDecl : public ObjCImplDecl {
   PASTA_DECLARE_BASE_OPERATORS(ObjCImplDecl, ObjCImplementationDecl)
   // Identifier: (clang::IdentifierInfo *)
   ::pasta::Token InstanceVariableLBraceToken(void) const noexcept;
+  ::pasta::TokenRef InstanceVariableLBraceTokenRef(void) const noexcept;
   ::pasta::Token InstanceVariableRBraceToken(void) const noexcept;
+  ::pasta::TokenRef InstanceVariableRBraceTokenRef(void) const noexcept;
   std::string Name(void) const noexcept;
   uint32_t NumInstanceVariableInitializers(void) const noexcept;
   std::string_view ObjCRuntimeNameAsString(void) const noexcept;
   ::pasta::ObjCInterfaceDecl SuperClass(void) const noexcept;
+  ::pasta::DeclRef SuperClassRef(void) const noexcept;
   ::pasta::Token SuperClassToken(void) const noexcept;
+  ::pasta::TokenRef SuperClassTokenRef(void) const noexcept;
   bool HasDestructors(void) const noexcept;
   bool HasNonZeroConstructors(void) const noexcept;
   // Initializers: (llvm::iterator_range<clang::CXXCtorInitializer *const *>)
   std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCIvarDecl> InstanceVariablesRange(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCImplementationDecl)
 };
@@ -940,20 +1008,29 @@ class ObjCInterfaceDecl : public ObjCContainerDecl {
   std::vector<::pasta::ObjCProtocolDecl> AllReferencedProtocols(void) const noexcept;
   bool DeclaresOrInheritsDesignatedInitializers(void) const noexcept;
   ::pasta::ObjCInterfaceDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   // CategoryClassMethod: (clang::ObjCMethodDecl *)
   // CategoryInstanceMethod: (clang::ObjCMethodDecl *)
   ::pasta::ObjCCategoryDecl CategoryListRaw(void) const noexcept;
+  ::pasta::DeclRef CategoryListRawRef(void) const noexcept;
   // CategoryMethod: (clang::ObjCMethodDecl *)
   ::pasta::ObjCInterfaceDecl Definition(void) const noexcept;
+  ::pasta::DeclRef DefinitionRef(void) const noexcept;
   ::pasta::Token EndOfDefinitionToken(void) const noexcept;
+  ::pasta::TokenRef EndOfDefinitionTokenRef(void) const noexcept;
   ::pasta::ObjCImplementationDecl Implementation(void) const noexcept;
+  ::pasta::DeclRef ImplementationRef(void) const noexcept;
   std::string_view ObjCRuntimeNameAsString(void) const noexcept;
   // ReferencedProtocols: (const clang::ObjCProtocolList &)
   std::optional<::pasta::ObjCInterfaceDecl> SuperClass(void) const noexcept;
+  std::optional<::pasta::DeclRef> SuperClassRef(void) const noexcept;
   ::pasta::Token SuperClassToken(void) const noexcept;
+  ::pasta::TokenRef SuperClassTokenRef(void) const noexcept;
   std::optional<::pasta::Type> SuperClassTypeInfo(void) const noexcept;
   std::optional<::pasta::ObjCObjectType> SuperClassType(void) const noexcept;
+  std::optional<::pasta::TypeRef> SuperClassTypeRef(void) const noexcept;
   ::pasta::Type TypeForDeclaration(void) const noexcept;
+  ::pasta::TypeRef TypeForDeclarationRef(void) const noexcept;
   // TypeParameterList: (clang::ObjCTypeParamList *)
   // TypeParameterListAsWritten: (clang::ObjCTypeParamList *)
   bool HasDefinition(void) const noexcept;
@@ -962,9 +1039,11 @@ class ObjCInterfaceDecl : public ObjCContainerDecl {
   // IsDesignatedInitializer: (bool)
   bool IsImplicitInterfaceDeclaration(void) const noexcept;
   ::pasta::ObjCInterfaceDecl IsObjCRequiresPropertyDefinitions(void) const noexcept;
+  ::pasta::DeclRef IsObjCRequiresPropertyDefinitionsRef(void) const noexcept;
   // IsSuperClassOf: (bool)
   bool IsThisDeclarationADefinition(void) const noexcept;
   std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCIvarDecl> InstanceVariablesRange(void) const noexcept;
   std::vector<::pasta::ObjCCategoryDecl> KnownCategories(void) const noexcept;
   std::vector<::pasta::ObjCCategoryDecl> KnownExtensions(void) const noexcept;
   // LookupClassMethod: (clang::ObjCMethodDecl *)
@@ -992,24 +1071,36 @@ class ObjCMethodDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCMethodDecl)
   bool DefinedInNSObject(void) const noexcept;
   ::pasta::ObjCPropertyDecl FindPropertyDeclaration(void) const noexcept;
+  ::pasta::DeclRef FindPropertyDeclarationRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ObjCMethodDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::ObjCCategoryDecl Category(void) const noexcept;
+  ::pasta::DeclRef CategoryRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const noexcept;
+  ::pasta::DeclRef ClassInterfaceRef(void) const noexcept;
   ::pasta::ImplicitParamDecl CommandDeclaration(void) const noexcept;
+  ::pasta::DeclRef CommandDeclarationRef(void) const noexcept;
   ::pasta::Token DeclaratorEndToken(void) const noexcept;
+  ::pasta::TokenRef DeclaratorEndTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum ObjCMethodDeclImplementationControl ImplementationControl(void) const noexcept;
   enum ObjCMethodFamily MethodFamily(void) const noexcept;
   uint32_t NumSelectorTokens(void) const noexcept;
   enum DeclObjCDeclQualifier ObjCDeclQualifier(void) const noexcept;
   // ParameterDeclaration: (const clang::ParmVarDecl *)
   ::pasta::Type ReturnType(void) const noexcept;
+  ::pasta::TypeRef ReturnTypeRef(void) const noexcept;
   ::pasta::TokenRange ReturnTypeSourceRange(void) const noexcept;
+  ::pasta::TokenRefRange ReturnTypeSourceRangeRef(void) const noexcept;
   // Selector: (clang::Selector)
   // SelectorToken: (clang::SourceLocation)
   ::pasta::Token SelectorStartToken(void) const noexcept;
+  ::pasta::TokenRef SelectorStartTokenRef(void) const noexcept;
   ::pasta::ImplicitParamDecl SelfDeclaration(void) const noexcept;
+  ::pasta::DeclRef SelfDeclarationRef(void) const noexcept;
   // SelfType: (clang::QualType)
   bool HasParameterDestroyedInCallee(void) const noexcept;
   bool HasRedeclaration(void) const noexcept;
@@ -1044,21 +1135,29 @@ class ObjCPropertyDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCPropertyDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   // DefaultSynthInstanceVariableName: (clang::IdentifierInfo *)
   ::pasta::ObjCMethodDecl GetterMethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef GetterMethodDeclarationRef(void) const noexcept;
   // GetterName: (clang::Selector)
   ::pasta::Token GetterNameToken(void) const noexcept;
+  ::pasta::TokenRef GetterNameTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   // PropertyAttributes: (clang::ObjCPropertyAttribute::Kind)
   // PropertyAttributesAsWritten: (clang::ObjCPropertyAttribute::Kind)
   enum ObjCPropertyDeclPropertyControl PropertyImplementation(void) const noexcept;
   ::pasta::ObjCIvarDecl PropertyInstanceVariableDeclaration(void) const noexcept;
+  ::pasta::DeclRef PropertyInstanceVariableDeclarationRef(void) const noexcept;
   enum ObjCPropertyQueryKind QueryKind(void) const noexcept;
   enum ObjCPropertyDeclSetterKind SetterKind(void) const noexcept;
   ::pasta::ObjCMethodDecl SetterMethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef SetterMethodDeclarationRef(void) const noexcept;
   // SetterName: (clang::Selector)
   ::pasta::Token SetterNameToken(void) const noexcept;
+  ::pasta::TokenRef SetterNameTokenRef(void) const noexcept;
   ::pasta::Type Type(void) const noexcept;
+  ::pasta::TypeRef TypeRef(void) const noexcept;
   // UsageType: (clang::QualType)
   bool IsAtomic(void) const noexcept;
   bool IsClassProperty(void) const noexcept;
@@ -1079,14 +1178,22 @@ class ObjCPropertyImplDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCPropertyImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr GetterCXXConstructor(void) const noexcept;
+  ::pasta::StmtRef GetterCXXConstructorRef(void) const noexcept;
   ::pasta::ObjCMethodDecl GetterMethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef GetterMethodDeclarationRef(void) const noexcept;
   ::pasta::ObjCPropertyDecl PropertyDeclaration(void) const noexcept;
+  ::pasta::DeclRef PropertyDeclarationRef(void) const noexcept;
   enum ObjCPropertyImplDeclKind PropertyImplementation(void) const noexcept;
   ::pasta::ObjCIvarDecl PropertyInstanceVariableDeclaration(void) const noexcept;
+  ::pasta::DeclRef PropertyInstanceVariableDeclarationRef(void) const noexcept;
   ::pasta::Token PropertyInstanceVariableDeclarationToken(void) const noexcept;
+  ::pasta::TokenRef PropertyInstanceVariableDeclarationTokenRef(void) const noexcept;
   ::pasta::Expr SetterCXXAssignment(void) const noexcept;
+  ::pasta::StmtRef SetterCXXAssignmentRef(void) const noexcept;
   ::pasta::ObjCMethodDecl SetterMethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef SetterMethodDeclarationRef(void) const noexcept;
   bool IsInstanceVariableNameSpecified(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCPropertyImplDecl)
@@ -1104,7 +1211,9 @@ class ObjCProtocolDecl : public ObjCContainerDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCProtocolDecl)
   PASTA_DECLARE_BASE_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
   ::pasta::ObjCProtocolDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::ObjCProtocolDecl Definition(void) const noexcept;
+  ::pasta::DeclRef DefinitionRef(void) const noexcept;
   std::string_view ObjCRuntimeNameAsString(void) const noexcept;
   // ReferencedProtocols: (const clang::ObjCProtocolList &)
   bool HasDefinition(void) const noexcept;
@@ -1165,8 +1274,11 @@ class StaticAssertDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StaticAssertDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, StaticAssertDecl)
   ::pasta::Expr AssertExpression(void) const noexcept;
+  ::pasta::StmtRef AssertExpressionRef(void) const noexcept;
   ::pasta::StringLiteral Message(void) const noexcept;
+  ::pasta::StmtRef MessageRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsFailed(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(StaticAssertDecl)
@@ -1191,6 +1303,7 @@ class TemplateDecl : public NamedDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(TemplateDecl, VarTemplateDecl)
   ::pasta::TemplateParameterList TemplateParameters(void) const noexcept;
   ::pasta::NamedDecl TemplatedDeclaration(void) const noexcept;
+  ::pasta::DeclRef TemplatedDeclarationRef(void) const noexcept;
   bool HasAssociatedConstraints(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateDecl)
@@ -1210,6 +1323,7 @@ class TemplateTemplateParmDecl : public TemplateDecl {
   // DefaultArgumentStorage: (const clang::DefaultArgStorage<clang::TemplateTemplateParmDecl, clang::TemplateArgumentLoc *> &)
   // DefaultArgument: (const clang::TemplateArgumentLoc &)
   ::pasta::Token DefaultArgumentToken(void) const noexcept;
+  ::pasta::TokenRef DefaultArgumentTokenRef(void) const noexcept;
   // ExpansionTemplateParameters: (clang::TemplateParameterList *)
   uint32_t NumExpansionTemplateParameters(void) const noexcept;
   bool HasDefaultArgument(void) const noexcept;
@@ -1230,6 +1344,7 @@ class TranslationUnitDecl : public Decl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, TranslationUnitDecl)
   // ASTContext: (clang::ASTContext &)
   ::pasta::NamespaceDecl AnonymousNamespace(void) const noexcept;
+  ::pasta::DeclRef AnonymousNamespaceRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TranslationUnitDecl)
 };
@@ -1256,7 +1371,9 @@ class TypeDecl : public NamedDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(TypeDecl, TypedefNameDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::optional<::pasta::Type> TypeForDeclaration(void) const noexcept;
+  std::optional<::pasta::TypeRef> TypeForDeclarationRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeDecl)
 };
@@ -1275,8 +1392,11 @@ class TypedefNameDecl : public TypeDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(TypedefNameDecl, TypeAliasDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(TypedefNameDecl, TypedefDecl)
   std::optional<::pasta::TagDecl> AnonymousDeclarationWithTypedefName(void) const noexcept;
+  std::optional<::pasta::DeclRef> AnonymousDeclarationWithTypedefNameRef(void) const noexcept;
   ::pasta::TypedefNameDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsModed(void) const noexcept;
   bool IsTransparentTag(void) const noexcept;
  protected:
@@ -1307,12 +1427,16 @@ class UnresolvedUsingTypenameDecl : public TypeDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnresolvedUsingTypenameDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   ::pasta::UnresolvedUsingTypenameDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   // NameInfo: (clang::DeclarationNameInfo)
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token TypenameToken(void) const noexcept;
+  ::pasta::TokenRef TypenameTokenRef(void) const noexcept;
   ::pasta::Token UsingToken(void) const noexcept;
+  ::pasta::TokenRef UsingTokenRef(void) const noexcept;
   bool IsPackExpansion(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UnresolvedUsingTypenameDecl)
@@ -1329,12 +1453,17 @@ class UsingDirectiveDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   ::pasta::DeclContext CommonAncestor(void) const noexcept;
   ::pasta::Token IdentifierToken(void) const noexcept;
+  ::pasta::TokenRef IdentifierTokenRef(void) const noexcept;
   ::pasta::Token NamespaceKeyToken(void) const noexcept;
+  ::pasta::TokenRef NamespaceKeyTokenRef(void) const noexcept;
   ::pasta::NamespaceDecl NominatedNamespace(void) const noexcept;
+  ::pasta::DeclRef NominatedNamespaceRef(void) const noexcept;
   ::pasta::NamedDecl NominatedNamespaceAsWritten(void) const noexcept;
+  ::pasta::DeclRef NominatedNamespaceAsWrittenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token UsingToken(void) const noexcept;
+  ::pasta::TokenRef UsingTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingDirectiveDecl)
 };
@@ -1350,7 +1479,9 @@ class UsingPackDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingPackDecl)
   std::vector<::pasta::NamedDecl> Expansions(void) const noexcept;
   ::pasta::UsingPackDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::NamedDecl InstantiatedFromUsingDeclaration(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromUsingDeclarationRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingPackDecl)
 };
@@ -1366,9 +1497,13 @@ class UsingShadowDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingShadowDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
   ::pasta::UsingShadowDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::BaseUsingDecl Introducer(void) const noexcept;
+  ::pasta::DeclRef IntroducerRef(void) const noexcept;
   std::optional<::pasta::UsingShadowDecl> NextUsingShadowDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> NextUsingShadowDeclarationRef(void) const noexcept;
   ::pasta::NamedDecl TargetDeclaration(void) const noexcept;
+  ::pasta::DeclRef TargetDeclarationRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingShadowDecl)
 };
@@ -1412,6 +1547,7 @@ class ValueDecl : public NamedDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(ValueDecl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueDecl, VarTemplateSpecializationDecl)
   ::pasta::Type Type(void) const noexcept;
+  ::pasta::TypeRef TypeRef(void) const noexcept;
   bool IsWeak(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ValueDecl)
@@ -1454,7 +1590,9 @@ class AccessSpecDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AccessSpecDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, AccessSpecDecl)
   ::pasta::Token AccessSpecifierToken(void) const noexcept;
+  ::pasta::TokenRef AccessSpecifierTokenRef(void) const noexcept;
   ::pasta::Token ColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(AccessSpecDecl)
 };
@@ -1486,8 +1624,11 @@ class BindingDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, BindingDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, BindingDecl)
   ::pasta::Expr Binding(void) const noexcept;
+  ::pasta::StmtRef BindingRef(void) const noexcept;
   ::pasta::ValueDecl DecomposedDeclaration(void) const noexcept;
+  ::pasta::DeclRef DecomposedDeclarationRef(void) const noexcept;
   ::pasta::VarDecl HoldingVariable(void) const noexcept;
+  ::pasta::DeclRef HoldingVariableRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(BindingDecl)
 };
@@ -1507,9 +1648,12 @@ class BlockDecl : public Decl {
   // CapturesVariable: (bool)
   bool DoesNotEscape(void) const noexcept;
   std::optional<::pasta::Decl> BlockManglingContextDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> BlockManglingContextDeclarationRef(void) const noexcept;
   uint32_t BlockManglingNumber(void) const noexcept;
   ::pasta::Token CaretToken(void) const noexcept;
+  ::pasta::TokenRef CaretTokenRef(void) const noexcept;
   ::pasta::CompoundStmt CompoundBody(void) const noexcept;
+  ::pasta::StmtRef CompoundBodyRef(void) const noexcept;
   uint32_t NumCaptures(void) const noexcept;
   uint32_t NumParameters(void) const noexcept;
   // ParameterDeclaration: (const clang::ParmVarDecl *)
@@ -1547,6 +1691,7 @@ class CapturedDecl : public Decl {
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CapturedDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CapturedDecl)
   ::pasta::ImplicitParamDecl ContextParameter(void) const noexcept;
+  ::pasta::DeclRef ContextParameterRef(void) const noexcept;
   uint32_t ContextParameterPosition(void) const noexcept;
   uint32_t NumParameters(void) const noexcept;
   // Parameter: (clang::ImplicitParamDecl *)
@@ -1564,6 +1709,7 @@ class ClassScopeFunctionSpecializationDecl : public Decl {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ClassScopeFunctionSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ClassScopeFunctionSpecializationDecl)
   ::pasta::CXXMethodDecl Specialization(void) const noexcept;
+  ::pasta::DeclRef SpecializationRef(void) const noexcept;
   // TemplateArgumentsAsWritten: (const clang::ASTTemplateArgumentListInfo *)
   bool HasExplicitTemplateArguments(void) const noexcept;
  protected:
@@ -1581,7 +1727,9 @@ class ConceptDecl : public TemplateDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ConceptDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, ConceptDecl)
   ::pasta::ConceptDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::Expr ConstraintExpression(void) const noexcept;
+  ::pasta::StmtRef ConstraintExpressionRef(void) const noexcept;
   bool IsTypeConcept(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ConceptDecl)
@@ -1599,11 +1747,17 @@ class ConstructorUsingShadowDecl : public UsingShadowDecl {
   PASTA_DECLARE_BASE_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
   bool ConstructsVirtualBase(void) const noexcept;
   ::pasta::CXXRecordDecl ConstructedBaseClass(void) const noexcept;
+  ::pasta::DeclRef ConstructedBaseClassRef(void) const noexcept;
   std::optional<::pasta::ConstructorUsingShadowDecl> ConstructedBaseClassShadowDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConstructedBaseClassShadowDeclarationRef(void) const noexcept;
   ::pasta::UsingDecl Introducer(void) const noexcept;
+  ::pasta::DeclRef IntroducerRef(void) const noexcept;
   ::pasta::CXXRecordDecl NominatedBaseClass(void) const noexcept;
+  ::pasta::DeclRef NominatedBaseClassRef(void) const noexcept;
   std::optional<::pasta::ConstructorUsingShadowDecl> NominatedBaseClassShadowDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> NominatedBaseClassShadowDeclarationRef(void) const noexcept;
   ::pasta::CXXRecordDecl Parent(void) const noexcept;
+  ::pasta::DeclRef ParentRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ConstructorUsingShadowDecl)
 };
@@ -1637,15 +1791,21 @@ class DeclaratorDecl : public ValueDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(DeclaratorDecl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(DeclaratorDecl, VarTemplateSpecializationDecl)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token FirstInnerToken(void) const noexcept;
+  ::pasta::TokenRef FirstInnerTokenRef(void) const noexcept;
   uint32_t NumTemplateParameterLists(void) const noexcept;
   ::pasta::Token FirstOuterToken(void) const noexcept;
+  ::pasta::TokenRef FirstOuterTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   // TemplateParameterList: (clang::TemplateParameterList *)
   std::optional<::pasta::Expr> TrailingRequiresClause(void) const noexcept;
+  std::optional<::pasta::StmtRef> TrailingRequiresClauseRef(void) const noexcept;
   ::pasta::Token TypeSpecEndToken(void) const noexcept;
+  ::pasta::TokenRef TypeSpecEndTokenRef(void) const noexcept;
   ::pasta::Token TypeSpecStartToken(void) const noexcept;
+  ::pasta::TokenRef TypeSpecStartTokenRef(void) const noexcept;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(DeclaratorDecl)
@@ -1662,7 +1822,9 @@ class EnumConstantDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, EnumConstantDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, EnumConstantDecl)
   ::pasta::EnumConstantDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::Expr> InitializerExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerExpressionRef(void) const noexcept;
   llvm::APSInt InitializerValue(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(EnumConstantDecl)
@@ -1682,13 +1844,18 @@ class FieldDecl : public DeclaratorDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(FieldDecl, ObjCAtDefsFieldDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(FieldDecl, ObjCIvarDecl)
   std::optional<::pasta::Expr> BitWidth(void) const noexcept;
+  std::optional<::pasta::StmtRef> BitWidthRef(void) const noexcept;
   uint32_t BitWidthValue(void) const noexcept;
   ::pasta::FieldDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::VariableArrayType> CapturedVLAType(void) const noexcept;
+  std::optional<::pasta::TypeRef> CapturedVLATypeRef(void) const noexcept;
   uint32_t FieldIndex(void) const noexcept;
   enum InClassInitStyle InClassInitializerStyle(void) const noexcept;
   std::optional<::pasta::Expr> InClassInitializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InClassInitializerRef(void) const noexcept;
   ::pasta::RecordDecl Parent(void) const noexcept;
+  ::pasta::DeclRef ParentRef(void) const noexcept;
   bool HasCapturedVLAType(void) const noexcept;
   bool HasInClassInitializer(void) const noexcept;
   bool IsAnonymousStructOrUnion(void) const noexcept;
@@ -1724,19 +1891,28 @@ class FunctionDecl : public DeclaratorDecl {
   bool DoesThisDeclarationHaveABody(void) const noexcept;
   uint32_t BuiltinID(void) const noexcept;
   ::pasta::Type CallResultType(void) const noexcept;
+  ::pasta::TypeRef CallResultTypeRef(void) const noexcept;
   ::pasta::FunctionDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   enum ConstexprSpecKind ConstexprKind(void) const noexcept;
   ::pasta::Type DeclaredReturnType(void) const noexcept;
+  ::pasta::TypeRef DeclaredReturnTypeRef(void) const noexcept;
   // DefaultedFunctionInfo: (clang::FunctionDecl::DefaultedFunctionInfo *)
   std::optional<::pasta::FunctionDecl> Definition(void) const noexcept;
+  std::optional<::pasta::DeclRef> DefinitionRef(void) const noexcept;
   // DependentSpecializationInfo: (clang::DependentFunctionTemplateSpecializationInfo *)
   std::optional<::pasta::FunctionTemplateDecl> DescribedFunctionTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> DescribedFunctionTemplateRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   ::pasta::TokenRange ExceptionSpecSourceRange(void) const noexcept;
+  ::pasta::TokenRefRange ExceptionSpecSourceRangeRef(void) const noexcept;
   enum ExceptionSpecificationType ExceptionSpecType(void) const noexcept;
   // FunctionTypeToken: (clang::FunctionTypeLoc)
   std::optional<::pasta::FunctionDecl> InstantiatedFromDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromDeclarationRef(void) const noexcept;
   std::optional<::pasta::FunctionDecl> InstantiatedFromMemberFunction(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromMemberFunctionRef(void) const noexcept;
   enum LanguageLinkage LanguageLinkage(void) const noexcept;
   // LiteralIdentifier: (const clang::IdentifierInfo *)
   // MemberSpecializationInfo: (clang::MemberSpecializationInfo *)
@@ -1749,12 +1925,18 @@ class FunctionDecl : public DeclaratorDecl {
   enum OverloadedOperatorKind OverloadedOperator(void) const noexcept;
   // ParameterDeclaration: (const clang::ParmVarDecl *)
   ::pasta::TokenRange ParametersSourceRange(void) const noexcept;
+  ::pasta::TokenRefRange ParametersSourceRangeRef(void) const noexcept;
   ::pasta::Token PointOfInstantiation(void) const noexcept;
+  ::pasta::TokenRef PointOfInstantiationRef(void) const noexcept;
   std::optional<::pasta::FunctionTemplateDecl> PrimaryTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> PrimaryTemplateRef(void) const noexcept;
   ::pasta::Type ReturnType(void) const noexcept;
+  ::pasta::TypeRef ReturnTypeRef(void) const noexcept;
   ::pasta::TokenRange ReturnTypeSourceRange(void) const noexcept;
+  ::pasta::TokenRefRange ReturnTypeSourceRangeRef(void) const noexcept;
   enum StorageClass StorageClass(void) const noexcept;
   std::optional<::pasta::FunctionDecl> TemplateInstantiationPattern(void) const noexcept;
+  std::optional<::pasta::DeclRef> TemplateInstantiationPatternRef(void) const noexcept;
   // TemplateSpecializationArguments: (const clang::TemplateArgumentList *)
   // TemplateSpecializationArgumentsAsWritten: (const clang::ASTTemplateArgumentListInfo *)
   // TemplateSpecializationInfo: (clang::FunctionTemplateSpecializationInfo *)
@@ -1833,9 +2015,12 @@ class IndirectFieldDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, IndirectFieldDecl)
   std::vector<::pasta::NamedDecl> Chain(void) const noexcept;
   std::optional<::pasta::FieldDecl> AnonymousField(void) const noexcept;
+  std::optional<::pasta::DeclRef> AnonymousFieldRef(void) const noexcept;
   ::pasta::IndirectFieldDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   uint32_t ChainingSize(void) const noexcept;
   std::optional<::pasta::VarDecl> VariableDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> VariableDeclarationRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(IndirectFieldDecl)
 };
@@ -1851,6 +2036,7 @@ class LabelDecl : public NamedDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, LabelDecl)
   std::string_view MSAssemblyLabel(void) const noexcept;
   ::pasta::LabelStmt Statement(void) const noexcept;
+  ::pasta::StmtRef StatementRef(void) const noexcept;
   bool IsGnuLocal(void) const noexcept;
   bool IsMSAssemblyLabel(void) const noexcept;
   bool IsResolvedMSAssemblyLabel(void) const noexcept;
@@ -1908,11 +2094,14 @@ class NonTypeTemplateParmDecl : public DeclaratorDecl {
   bool DefaultArgumentWasInherited(void) const noexcept;
   // DefaultArgumentStorage: (const clang::DefaultArgStorage<clang::NonTypeTemplateParmDecl, clang::Expr *> &)
   std::optional<::pasta::Expr> DefaultArgument(void) const noexcept;
+  std::optional<::pasta::StmtRef> DefaultArgumentRef(void) const noexcept;
   ::pasta::Token DefaultArgumentToken(void) const noexcept;
+  ::pasta::TokenRef DefaultArgumentTokenRef(void) const noexcept;
   // ExpansionType: (clang::QualType)
   // ExpansionType: (clang::TypeSourceInfo *)
   std::optional<uint32_t> NumExpansionTypes(void) const noexcept;
   std::optional<::pasta::Expr> PlaceholderTypeConstraint(void) const noexcept;
+  std::optional<::pasta::StmtRef> PlaceholderTypeConstraintRef(void) const noexcept;
   bool HasDefaultArgument(void) const noexcept;
   bool HasPlaceholderTypeConstraint(void) const noexcept;
   bool IsExpandedParameterPack(void) const noexcept;
@@ -1953,7 +2142,9 @@ class OMPDeclareMapperDecl : public OMPDeclarativeDirectiveValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, OMPDeclareMapperDecl)
   // Clauses: (llvm::iterator_range<const clang::OMPClause *const *>)
   ::pasta::Expr MapperVariableReference(void) const noexcept;
+  ::pasta::StmtRef MapperVariableReferenceRef(void) const noexcept;
   ::pasta::OMPDeclareMapperDecl PrevDeclarationInScope(void) const noexcept;
+  ::pasta::DeclRef PrevDeclarationInScopeRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclareMapperDecl)
 };
@@ -1970,13 +2161,20 @@ class OMPDeclareReductionDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, OMPDeclareReductionDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   ::pasta::Expr Combiner(void) const noexcept;
+  ::pasta::StmtRef CombinerRef(void) const noexcept;
   ::pasta::Expr CombinerIn(void) const noexcept;
+  ::pasta::StmtRef CombinerInRef(void) const noexcept;
   ::pasta::Expr CombinerOut(void) const noexcept;
+  ::pasta::StmtRef CombinerOutRef(void) const noexcept;
   ::pasta::Expr InitializerOriginal(void) const noexcept;
+  ::pasta::StmtRef InitializerOriginalRef(void) const noexcept;
   ::pasta::Expr InitializerPrivate(void) const noexcept;
+  ::pasta::StmtRef InitializerPrivateRef(void) const noexcept;
   ::pasta::Expr Initializer(void) const noexcept;
+  ::pasta::StmtRef InitializerRef(void) const noexcept;
   enum OMPDeclareReductionDeclInitKind InitializerKind(void) const noexcept;
   ::pasta::OMPDeclareReductionDecl PrevDeclarationInScope(void) const noexcept;
+  ::pasta::DeclRef PrevDeclarationInScopeRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclareReductionDecl)
 };
@@ -2039,15 +2237,23 @@ class ObjCCategoryDecl : public ObjCContainerDecl {
   PASTA_DECLARE_BASE_OPERATORS(ObjCContainerDecl, ObjCCategoryDecl)
   bool IsClassExtension(void) const noexcept;
   ::pasta::Token CategoryNameToken(void) const noexcept;
+  ::pasta::TokenRef CategoryNameTokenRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const noexcept;
+  ::pasta::DeclRef ClassInterfaceRef(void) const noexcept;
   ::pasta::ObjCCategoryImplDecl Implementation(void) const noexcept;
+  ::pasta::DeclRef ImplementationRef(void) const noexcept;
   ::pasta::Token InstanceVariableLBraceToken(void) const noexcept;
+  ::pasta::TokenRef InstanceVariableLBraceTokenRef(void) const noexcept;
   ::pasta::Token InstanceVariableRBraceToken(void) const noexcept;
+  ::pasta::TokenRef InstanceVariableRBraceTokenRef(void) const noexcept;
   ::pasta::ObjCCategoryDecl NextClassCategory(void) const noexcept;
+  ::pasta::DeclRef NextClassCategoryRef(void) const noexcept;
   ::pasta::ObjCCategoryDecl NextClassCategoryRaw(void) const noexcept;
+  ::pasta::DeclRef NextClassCategoryRawRef(void) const noexcept;
   // ReferencedProtocols: (const clang::ObjCProtocolList &)
   // TypeParameterList: (clang::ObjCTypeParamList *)
   std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::ObjCIvarDecl> InstanceVariablesRange(void) const noexcept;
   std::vector<::pasta::Token> ProtocolTokens(void) const noexcept;
   std::vector<::pasta::ObjCProtocolDecl> Protocols(void) const noexcept;
  protected:
@@ -2067,7 +2273,9 @@ class ObjCCategoryImplDecl : public ObjCImplDecl {
   PASTA_DECLARE_BASE_OPERATORS(ObjCContainerDecl, ObjCCategoryImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(ObjCImplDecl, ObjCCategoryImplDecl)
   ::pasta::ObjCCategoryDecl CategoryDeclaration(void) const noexcept;
+  ::pasta::DeclRef CategoryDeclarationRef(void) const noexcept;
   ::pasta::Token CategoryNameToken(void) const noexcept;
+  ::pasta::TokenRef CategoryNameTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCCategoryImplDecl)
 };
@@ -2087,8 +2295,11 @@ class ObjCIvarDecl : public FieldDecl {
   enum ObjCIvarDeclAccessControl AccessControl(void) const noexcept;
   enum ObjCIvarDeclAccessControl CanonicalAccessControl(void) const noexcept;
   ::pasta::ObjCIvarDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl ContainingInterface(void) const noexcept;
+  ::pasta::DeclRef ContainingInterfaceRef(void) const noexcept;
   ::pasta::ObjCIvarDecl NextInstanceVariable(void) const noexcept;
+  ::pasta::DeclRef NextInstanceVariableRef(void) const noexcept;
   bool Synthesize(void) const noexcept;
   // UsageType: (clang::QualType)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const noexcept;
@@ -2108,9 +2319,11 @@ class ObjCTypeParamDecl : public TypedefNameDecl {
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, ObjCTypeParamDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypedefNameDecl, ObjCTypeParamDecl)
   ::pasta::Token ColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonTokenRef(void) const noexcept;
   uint32_t Index(void) const noexcept;
   enum ObjCTypeParamVariance Variance(void) const noexcept;
   ::pasta::Token VarianceToken(void) const noexcept;
+  ::pasta::TokenRef VarianceTokenRef(void) const noexcept;
   bool HasExplicitBound(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCTypeParamDecl)
@@ -2131,7 +2344,9 @@ class RedeclarableTemplateDecl : public TemplateDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(RedeclarableTemplateDecl, TypeAliasTemplateDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(RedeclarableTemplateDecl, VarTemplateDecl)
   ::pasta::RedeclarableTemplateDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::RedeclarableTemplateDecl InstantiatedFromMemberTemplate(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberTemplateRef(void) const noexcept;
   bool IsMemberSpecialization(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(RedeclarableTemplateDecl)
@@ -2154,17 +2369,23 @@ class TagDecl : public TypeDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(TagDecl, EnumDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(TagDecl, RecordDecl)
   ::pasta::TokenRange BraceRange(void) const noexcept;
+  ::pasta::TokenRefRange BraceRangeRef(void) const noexcept;
   ::pasta::TagDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::TagDecl> Definition(void) const noexcept;
+  std::optional<::pasta::DeclRef> DefinitionRef(void) const noexcept;
   ::pasta::Token FirstInnerToken(void) const noexcept;
+  ::pasta::TokenRef FirstInnerTokenRef(void) const noexcept;
   std::string_view KindName(void) const noexcept;
   uint32_t NumTemplateParameterLists(void) const noexcept;
   ::pasta::Token FirstOuterToken(void) const noexcept;
+  ::pasta::TokenRef FirstOuterTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   enum TagTypeKind TagKind(void) const noexcept;
   // TemplateParameterList: (clang::TemplateParameterList *)
   std::optional<::pasta::TypedefNameDecl> TypedefNameForAnonymousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> TypedefNameForAnonymousDeclarationRef(void) const noexcept;
   bool HasNameForLinkage(void) const noexcept;
   bool IsBeingDefined(void) const noexcept;
   bool IsClass(void) const noexcept;
@@ -2196,6 +2417,7 @@ class TemplateParamObjectDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TemplateParamObjectDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, TemplateParamObjectDecl)
   ::pasta::TemplateParamObjectDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   // Value: (const clang::APValue &)
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateParamObjectDecl)
@@ -2214,8 +2436,10 @@ class TemplateTypeParmDecl : public TypeDecl {
   bool DefaultArgumentWasInherited(void) const noexcept;
   // DefaultArgumentStorage: (const clang::DefaultArgStorage<clang::TemplateTypeParmDecl, clang::TypeSourceInfo *> &)
   std::optional<::pasta::Type> DefaultArgument(void) const noexcept;
+  std::optional<::pasta::TypeRef> DefaultArgumentRef(void) const noexcept;
   std::optional<::pasta::Type> DefaultArgumentInfo(void) const noexcept;
   ::pasta::Token DefaultArgumentToken(void) const noexcept;
+  ::pasta::TokenRef DefaultArgumentTokenRef(void) const noexcept;
   uint32_t Depth(void) const noexcept;
   uint32_t Index(void) const noexcept;
   uint32_t NumExpansionParameters(void) const noexcept;
@@ -2242,6 +2466,7 @@ class TypeAliasDecl : public TypedefNameDecl {
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, TypeAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypedefNameDecl, TypeAliasDecl)
   std::optional<::pasta::TypeAliasTemplateDecl> DescribedAliasTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> DescribedAliasTemplateRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeAliasDecl)
 };
@@ -2258,9 +2483,13 @@ class TypeAliasTemplateDecl : public RedeclarableTemplateDecl {
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, TypeAliasTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, TypeAliasTemplateDecl)
   ::pasta::TypeAliasTemplateDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::TypeAliasTemplateDecl> InstantiatedFromMemberTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromMemberTemplateRef(void) const noexcept;
   std::optional<::pasta::TypeAliasTemplateDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   ::pasta::TypeAliasDecl TemplatedDeclaration(void) const noexcept;
+  ::pasta::DeclRef TemplatedDeclarationRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeAliasTemplateDecl)
 };
@@ -2306,11 +2535,14 @@ class UnresolvedUsingValueDecl : public ValueDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnresolvedUsingValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, UnresolvedUsingValueDecl)
   ::pasta::UnresolvedUsingValueDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   // NameInfo: (clang::DeclarationNameInfo)
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token UsingToken(void) const noexcept;
+  ::pasta::TokenRef UsingTokenRef(void) const noexcept;
   bool IsAccessDeclaration(void) const noexcept;
   bool IsPackExpansion(void) const noexcept;
  protected:
@@ -2328,10 +2560,12 @@ class UsingDecl : public BaseUsingDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingDecl)
   ::pasta::UsingDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   // NameInfo: (clang::DeclarationNameInfo)
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token UsingToken(void) const noexcept;
+  ::pasta::TokenRef UsingTokenRef(void) const noexcept;
   bool HasTypename(void) const noexcept;
   bool IsAccessDeclaration(void) const noexcept;
  protected:
@@ -2349,9 +2583,13 @@ class UsingEnumDecl : public BaseUsingDecl {
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingEnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
   ::pasta::UsingEnumDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::EnumDecl EnumDeclaration(void) const noexcept;
+  ::pasta::DeclRef EnumDeclarationRef(void) const noexcept;
   ::pasta::Token EnumToken(void) const noexcept;
+  ::pasta::TokenRef EnumTokenRef(void) const noexcept;
   ::pasta::Token UsingToken(void) const noexcept;
+  ::pasta::TokenRef UsingTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingEnumDecl)
 };
@@ -2378,23 +2616,31 @@ class VarDecl : public DeclaratorDecl {
   // EvaluateDestruction: (bool)
   // EvaluateValue: (clang::APValue *)
   std::optional<::pasta::VarDecl> ActingDefinition(void) const noexcept;
+  std::optional<::pasta::DeclRef> ActingDefinitionRef(void) const noexcept;
   ::pasta::VarDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::VarTemplateDecl> DescribedVariableTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> DescribedVariableTemplateRef(void) const noexcept;
   // EvaluatedStatement: (clang::EvaluatedStmt *)
   // EvaluatedValue: (clang::APValue *)
   // FlexibleArrayInitializerCharacters: (clang::CharUnits)
   std::optional<::pasta::Expr> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   enum VarDeclInitializationStyle InitializerStyle(void) const noexcept;
   std::optional<::pasta::VarDecl> InitializingDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> InitializingDeclarationRef(void) const noexcept;
   std::optional<::pasta::VarDecl> InstantiatedFromStaticDataMember(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromStaticDataMemberRef(void) const noexcept;
   enum LanguageLinkage LanguageLinkage(void) const noexcept;
   // MemberSpecializationInfo: (clang::MemberSpecializationInfo *)
   ::pasta::Token PointOfInstantiation(void) const noexcept;
+  ::pasta::TokenRef PointOfInstantiationRef(void) const noexcept;
   enum StorageClass StorageClass(void) const noexcept;
   enum StorageDuration StorageDuration(void) const noexcept;
   enum VarDeclTLSKind TLSKind(void) const noexcept;
   enum ThreadStorageClassSpecifier TSCSpec(void) const noexcept;
   std::optional<::pasta::VarDecl> TemplateInstantiationPattern(void) const noexcept;
+  std::optional<::pasta::DeclRef> TemplateInstantiationPatternRef(void) const noexcept;
   enum TemplateSpecializationKind TemplateSpecializationKind(void) const noexcept;
   enum TemplateSpecializationKind TemplateSpecializationKindForInstantiation(void) const noexcept;
   bool HasConstantInitialization(void) const noexcept;
@@ -2451,10 +2697,15 @@ class VarTemplateDecl : public RedeclarableTemplateDecl {
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, VarTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, VarTemplateDecl)
   ::pasta::VarTemplateDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::VarTemplateDecl InstantiatedFromMemberTemplate(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberTemplateRef(void) const noexcept;
   ::pasta::VarTemplateDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::VarTemplateDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   ::pasta::VarDecl TemplatedDeclaration(void) const noexcept;
+  ::pasta::DeclRef TemplatedDeclarationRef(void) const noexcept;
   bool IsThisDeclarationADefinition(void) const noexcept;
   std::vector<::pasta::VarTemplateSpecializationDecl> Specializations(void) const noexcept;
  protected:
@@ -2475,15 +2726,19 @@ class VarTemplateSpecializationDecl : public VarDecl {
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, VarTemplateSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(VarTemplateSpecializationDecl, VarTemplatePartialSpecializationDecl)
   ::pasta::Token ExternToken(void) const noexcept;
+  ::pasta::TokenRef ExternTokenRef(void) const noexcept;
   std::variant<std::monostate, ::pasta::VarTemplateDecl, ::pasta::VarTemplatePartialSpecializationDecl> InstantiatedFrom(void) const noexcept;
   ::pasta::Token PointOfInstantiation(void) const noexcept;
+  ::pasta::TokenRef PointOfInstantiationRef(void) const noexcept;
   enum TemplateSpecializationKind SpecializationKind(void) const noexcept;
   ::pasta::VarTemplateDecl SpecializedTemplate(void) const noexcept;
+  ::pasta::DeclRef SpecializedTemplateRef(void) const noexcept;
   std::variant<std::monostate, ::pasta::VarTemplateDecl, ::pasta::VarTemplatePartialSpecializationDecl> SpecializedTemplateOrPartial(void) const noexcept;
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const noexcept;
   // TemplateArgumentsInfo: (const clang::ASTTemplateArgumentListInfo *)
   std::vector<::pasta::TemplateArgument> TemplateInstantiationArguments(void) const noexcept;
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   ::pasta::Type TypeAsWritten(void) const noexcept;
   bool IsClassScopeExplicitSpecialization(void) const noexcept;
   bool IsExplicitInstantiationOrSpecialization(void) const noexcept;
@@ -2507,7 +2762,9 @@ class CXXDeductionGuideDecl : public FunctionDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, CXXDeductionGuideDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, CXXDeductionGuideDecl)
   ::pasta::CXXConstructorDecl CorrespondingConstructor(void) const noexcept;
+  ::pasta::DeclRef CorrespondingConstructorRef(void) const noexcept;
   ::pasta::TemplateDecl DeducedTemplate(void) const noexcept;
+  ::pasta::DeclRef DeducedTemplateRef(void) const noexcept;
   // ExplicitSpecifier: (const clang::ExplicitSpecifier)
   bool IsCopyDeductionCandidate(void) const noexcept;
   bool IsExplicit(void) const noexcept;
@@ -2534,15 +2791,20 @@ class CXXMethodDecl : public FunctionDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(CXXMethodDecl, CXXConversionDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(CXXMethodDecl, CXXDestructorDecl)
   ::pasta::CXXMethodDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   // CorrespondingMethodDeclaredInClass: (const clang::CXXMethodDecl *)
   // CorrespondingMethodInClass: (const clang::CXXMethodDecl *)
   // DevirtualizedMethod: (const clang::CXXMethodDecl *)
   // MethodQualifiers: (clang::Qualifiers)
   ::pasta::CXXMethodDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   ::pasta::CXXRecordDecl Parent(void) const noexcept;
+  ::pasta::DeclRef ParentRef(void) const noexcept;
   enum RefQualifierKind ReferenceQualifier(void) const noexcept;
   std::optional<::pasta::Type> ThisObjectType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ThisObjectTypeRef(void) const noexcept;
   std::optional<::pasta::Type> ThisType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ThisTypeRef(void) const noexcept;
   bool HasInlineBody(void) const noexcept;
   bool IsConst(void) const noexcept;
   bool IsCopyAssignmentOperator(void) const noexcept;
@@ -2573,10 +2835,15 @@ class ClassTemplateDecl : public RedeclarableTemplateDecl {
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, ClassTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, ClassTemplateDecl)
   ::pasta::ClassTemplateDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::ClassTemplateDecl InstantiatedFromMemberTemplate(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberTemplateRef(void) const noexcept;
   ::pasta::ClassTemplateDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::ClassTemplateDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   ::pasta::CXXRecordDecl TemplatedDeclaration(void) const noexcept;
+  ::pasta::DeclRef TemplatedDeclarationRef(void) const noexcept;
   bool IsThisDeclarationADefinition(void) const noexcept;
   std::vector<::pasta::ClassTemplateSpecializationDecl> Specializations(void) const noexcept;
  protected:
@@ -2614,19 +2881,29 @@ class EnumDecl : public TagDecl {
   PASTA_DECLARE_BASE_OPERATORS(TagDecl, EnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, EnumDecl)
   std::vector<::pasta::EnumConstantDecl> Enumerators(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::EnumConstantDecl> EnumeratorsRange(void) const noexcept;
   ::pasta::EnumDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::EnumDecl Definition(void) const noexcept;
+  ::pasta::DeclRef DefinitionRef(void) const noexcept;
   std::optional<::pasta::EnumDecl> InstantiatedFromMemberEnum(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromMemberEnumRef(void) const noexcept;
   std::optional<::pasta::Type> IntegerType(void) const noexcept;
+  std::optional<::pasta::TypeRef> IntegerTypeRef(void) const noexcept;
   ::pasta::TokenRange IntegerTypeRange(void) const noexcept;
+  ::pasta::TokenRefRange IntegerTypeRangeRef(void) const noexcept;
   // MemberSpecializationInfo: (clang::MemberSpecializationInfo *)
   ::pasta::EnumDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   uint32_t NumNegativeBits(void) const noexcept;
   uint32_t NumPositiveBits(void) const noexcept;
   std::optional<uint32_t> ODRHash(void) const noexcept;
   std::optional<::pasta::EnumDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   std::optional<::pasta::Type> PromotionType(void) const noexcept;
+  std::optional<::pasta::TypeRef> PromotionTypeRef(void) const noexcept;
   std::optional<::pasta::EnumDecl> TemplateInstantiationPattern(void) const noexcept;
+  std::optional<::pasta::DeclRef> TemplateInstantiationPatternRef(void) const noexcept;
   enum TemplateSpecializationKind TemplateSpecializationKind(void) const noexcept;
   bool IsClosed(void) const noexcept;
   bool IsClosedFlag(void) const noexcept;
@@ -2652,10 +2929,15 @@ class FunctionTemplateDecl : public RedeclarableTemplateDecl {
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, FunctionTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, FunctionTemplateDecl)
   ::pasta::FunctionTemplateDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::FunctionTemplateDecl InstantiatedFromMemberTemplate(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberTemplateRef(void) const noexcept;
   ::pasta::FunctionTemplateDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::FunctionTemplateDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   ::pasta::FunctionDecl TemplatedDeclaration(void) const noexcept;
+  ::pasta::DeclRef TemplatedDeclarationRef(void) const noexcept;
   bool IsAbbreviated(void) const noexcept;
   bool IsThisDeclarationADefinition(void) const noexcept;
   std::vector<::pasta::FunctionDecl> Specializations(void) const noexcept;
@@ -2711,12 +2993,16 @@ class ParmVarDecl : public VarDecl {
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, ParmVarDecl)
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, ParmVarDecl)
   std::optional<::pasta::Expr> DefaultArgument(void) const noexcept;
+  std::optional<::pasta::StmtRef> DefaultArgumentRef(void) const noexcept;
   ::pasta::TokenRange DefaultArgumentRange(void) const noexcept;
+  ::pasta::TokenRefRange DefaultArgumentRangeRef(void) const noexcept;
   uint32_t FunctionScopeDepth(void) const noexcept;
   uint32_t FunctionScopeIndex(void) const noexcept;
   enum DeclObjCDeclQualifier ObjCDeclQualifier(void) const noexcept;
   ::pasta::Type OriginalType(void) const noexcept;
+  ::pasta::TypeRef OriginalTypeRef(void) const noexcept;
   std::optional<::pasta::Expr> UninstantiatedDefaultArgument(void) const noexcept;
+  std::optional<::pasta::StmtRef> UninstantiatedDefaultArgumentRef(void) const noexcept;
   bool HasDefaultArgument(void) const noexcept;
   bool HasInheritedDefaultArgument(void) const noexcept;
   bool HasUninstantiatedDefaultArgument(void) const noexcept;
@@ -2746,11 +3032,16 @@ class RecordDecl : public TagDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(RecordDecl, ClassTemplateSpecializationDecl)
   bool CanPassInRegisters(void) const noexcept;
   std::vector<::pasta::FieldDecl> Fields(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::FieldDecl> FieldsRange(void) const noexcept;
   std::optional<::pasta::FieldDecl> FirstNamedDataMember(void) const noexcept;
+  std::optional<::pasta::DeclRef> FirstNamedDataMemberRef(void) const noexcept;
   enum RecordDeclArgPassingKind ArgumentPassingRestrictions(void) const noexcept;
   std::optional<::pasta::RecordDecl> Definition(void) const noexcept;
+  std::optional<::pasta::DeclRef> DefinitionRef(void) const noexcept;
   ::pasta::RecordDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::RecordDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   bool HasFlexibleArrayMember(void) const noexcept;
   bool HasLoadedFieldsFromExternalStorage(void) const noexcept;
   bool HasNonTrivialToPrimitiveCopyCUnion(void) const noexcept;
@@ -2789,6 +3080,7 @@ class VarTemplatePartialSpecializationDecl : public VarTemplateSpecializationDec
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(VarTemplateSpecializationDecl, VarTemplatePartialSpecializationDecl)
   ::pasta::VarTemplatePartialSpecializationDecl InstantiatedFromMember(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberRef(void) const noexcept;
   // TemplateArgumentsAsWritten: (const clang::ASTTemplateArgumentListInfo *)
   ::pasta::TemplateParameterList TemplateParameters(void) const noexcept;
   bool HasAssociatedConstraints(void) const noexcept;
@@ -2812,10 +3104,12 @@ class CXXConstructorDecl : public CXXMethodDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, CXXConstructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, CXXConstructorDecl)
   ::pasta::CXXConstructorDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   // ExplicitSpecifier: (const clang::ExplicitSpecifier)
   // InheritedConstructor: (clang::InheritedConstructor)
   uint32_t NumConstructorInitializers(void) const noexcept;
   std::optional<::pasta::CXXConstructorDecl> TargetConstructor(void) const noexcept;
+  std::optional<::pasta::DeclRef> TargetConstructorRef(void) const noexcept;
   // Initializers: (llvm::iterator_range<clang::CXXCtorInitializer *const *>)
   bool IsConvertingConstructor(bool) const noexcept;
   bool IsDefaultConstructor(void) const noexcept;
@@ -2844,7 +3138,9 @@ class CXXConversionDecl : public CXXMethodDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, CXXConversionDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, CXXConversionDecl)
   ::pasta::CXXConversionDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   ::pasta::Type ConversionType(void) const noexcept;
+  ::pasta::TypeRef ConversionTypeRef(void) const noexcept;
   // ExplicitSpecifier: (const clang::ExplicitSpecifier)
   bool IsExplicit(void) const noexcept;
   bool IsLambdaToBlockPointerConversion(void) const noexcept;
@@ -2869,8 +3165,11 @@ class CXXDestructorDecl : public CXXMethodDecl {
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, CXXDestructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, CXXDestructorDecl)
   ::pasta::CXXDestructorDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::FunctionDecl> OperatorDelete(void) const noexcept;
+  std::optional<::pasta::DeclRef> OperatorDeleteRef(void) const noexcept;
   std::optional<::pasta::Expr> OperatorDeleteThisArgument(void) const noexcept;
+  std::optional<::pasta::StmtRef> OperatorDeleteThisArgumentRef(void) const noexcept;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const noexcept;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const noexcept;
  protected:
@@ -2897,6 +3196,7 @@ class CXXRecordDecl : public RecordDecl {
   std::optional<enum MSInheritanceModel> CalculateInheritanceModel(void) const noexcept;
   // Captures: (llvm::iterator_range<const clang::LambdaCapture *>)
   std::vector<::pasta::CXXConstructorDecl> Constructors(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::CXXConstructorDecl> ConstructorsRange(void) const noexcept;
   std::optional<bool> DefaultedCopyConstructorIsDeleted(void) const noexcept;
   std::optional<bool> DefaultedDefaultConstructorIsConstexpr(void) const noexcept;
   std::optional<bool> DefaultedDestructorIsConstexpr(void) const noexcept;
@@ -2905,16 +3205,24 @@ class CXXRecordDecl : public RecordDecl {
   // ForallBases: (bool)
   std::optional<std::vector<::pasta::FriendDecl>> Friends(void) const noexcept;
   ::pasta::CXXRecordDecl CanonicalDeclaration(void) const noexcept;
+  ::pasta::DeclRef CanonicalDeclarationRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> Definition(void) const noexcept;
+  std::optional<::pasta::DeclRef> DefinitionRef(void) const noexcept;
   std::optional<::pasta::FunctionTemplateDecl> DependentLambdaCallOperator(void) const noexcept;
+  std::optional<::pasta::DeclRef> DependentLambdaCallOperatorRef(void) const noexcept;
   std::optional<::pasta::ClassTemplateDecl> DescribedClassTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> DescribedClassTemplateRef(void) const noexcept;
   std::optional<::pasta::CXXDestructorDecl> Destructor(void) const noexcept;
+  std::optional<::pasta::DeclRef> DestructorRef(void) const noexcept;
   uint32_t DeviceLambdaManglingNumber(void) const noexcept;
   std::optional<::pasta::TemplateParameterList> GenericLambdaTemplateParameterList(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> InstantiatedFromMemberClass(void) const noexcept;
+  std::optional<::pasta::DeclRef> InstantiatedFromMemberClassRef(void) const noexcept;
   std::optional<::pasta::CXXMethodDecl> LambdaCallOperator(void) const noexcept;
+  std::optional<::pasta::DeclRef> LambdaCallOperatorRef(void) const noexcept;
   std::optional<enum LambdaCaptureDefault> LambdaCaptureDefault(void) const noexcept;
   std::optional<::pasta::Decl> LambdaContextDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> LambdaContextDeclarationRef(void) const noexcept;
   uint32_t LambdaDependencyKind(void) const noexcept;
   std::optional<std::vector<::pasta::NamedDecl>> LambdaExplicitTemplateParameters(void) const noexcept;
   std::optional<uint32_t> LambdaManglingNumber(void) const noexcept;
@@ -2923,12 +3231,16 @@ class CXXRecordDecl : public RecordDecl {
   enum MSVtorDispMode MSVtorDispMode(void) const noexcept;
   // MemberSpecializationInfo: (clang::MemberSpecializationInfo *)
   ::pasta::CXXRecordDecl MostRecentDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentDeclarationRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> MostRecentNonInjectedDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> MostRecentNonInjectedDeclarationRef(void) const noexcept;
   std::optional<uint32_t> NumBases(void) const noexcept;
   std::optional<uint32_t> NumVirtualBases(void) const noexcept;
   std::optional<uint32_t> ODRHash(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> PreviousDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PreviousDeclarationRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> TemplateInstantiationPattern(void) const noexcept;
+  std::optional<::pasta::DeclRef> TemplateInstantiationPatternRef(void) const noexcept;
   enum TemplateSpecializationKind TemplateSpecializationKind(void) const noexcept;
   // VisibleConversionFunctions: (llvm::iterator_range<clang::UnresolvedSetIterator>)
   std::optional<bool> HasAnyDependentBases(void) const noexcept;
@@ -3004,6 +3316,7 @@ class CXXRecordDecl : public RecordDecl {
   bool IsLambda(void) const noexcept;
   std::optional<bool> IsLiteral(void) const noexcept;
   std::optional<::pasta::FunctionDecl> IsLocalClass(void) const noexcept;
+  std::optional<::pasta::DeclRef> IsLocalClassRef(void) const noexcept;
   bool IsNeverDependentLambda(void) const noexcept;
   std::optional<bool> IsPOD(void) const noexcept;
   std::optional<bool> IsParsingBaseSpecifiers(void) const noexcept;
@@ -3020,6 +3333,7 @@ class CXXRecordDecl : public RecordDecl {
   std::optional<bool> MayBeDynamicClass(void) const noexcept;
   std::optional<bool> MayBeNonDynamicClass(void) const noexcept;
   std::optional<std::vector<::pasta::CXXMethodDecl>> Methods(void) const noexcept;
+  ::pasta::DeclContextRange<::pasta::CXXMethodDecl> MethodsRange(void) const noexcept;
   std::optional<bool> NeedsImplicitCopyAssignment(void) const noexcept;
   std::optional<bool> NeedsImplicitCopyConstructor(void) const noexcept;
   std::optional<bool> NeedsImplicitDefaultConstructor(void) const noexcept;
@@ -3054,14 +3368,18 @@ class ClassTemplateSpecializationDecl : public CXXRecordDecl {
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, ClassTemplateSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(ClassTemplateSpecializationDecl, ClassTemplatePartialSpecializationDecl)
   ::pasta::Token ExternToken(void) const noexcept;
+  ::pasta::TokenRef ExternTokenRef(void) const noexcept;
   std::variant<std::monostate, ::pasta::ClassTemplateDecl, ::pasta::ClassTemplatePartialSpecializationDecl> InstantiatedFrom(void) const noexcept;
   ::pasta::Token PointOfInstantiation(void) const noexcept;
+  ::pasta::TokenRef PointOfInstantiationRef(void) const noexcept;
   enum TemplateSpecializationKind SpecializationKind(void) const noexcept;
   ::pasta::ClassTemplateDecl SpecializedTemplate(void) const noexcept;
+  ::pasta::DeclRef SpecializedTemplateRef(void) const noexcept;
   std::variant<std::monostate, ::pasta::ClassTemplateDecl, ::pasta::ClassTemplatePartialSpecializationDecl> SpecializedTemplateOrPartial(void) const noexcept;
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const noexcept;
   std::vector<::pasta::TemplateArgument> TemplateInstantiationArguments(void) const noexcept;
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   std::optional<::pasta::Type> TypeAsWritten(void) const noexcept;
   bool IsClassScopeExplicitSpecialization(void) const noexcept;
   bool IsExplicitInstantiationOrSpecialization(void) const noexcept;
@@ -3087,8 +3405,11 @@ class ClassTemplatePartialSpecializationDecl : public ClassTemplateSpecializatio
   PASTA_DECLARE_BASE_OPERATORS(TagDecl, ClassTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, ClassTemplatePartialSpecializationDecl)
   ::pasta::Type InjectedSpecializationType(void) const noexcept;
+  ::pasta::TypeRef InjectedSpecializationTypeRef(void) const noexcept;
   ::pasta::ClassTemplatePartialSpecializationDecl InstantiatedFromMember(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberRef(void) const noexcept;
   ::pasta::ClassTemplatePartialSpecializationDecl InstantiatedFromMemberTemplate(void) const noexcept;
+  ::pasta::DeclRef InstantiatedFromMemberTemplateRef(void) const noexcept;
   // TemplateArgumentsAsWritten: (const clang::ASTTemplateArgumentListInfo *)
   ::pasta::TemplateParameterList TemplateParameters(void) const noexcept;
   bool HasAssociatedConstraints(void) const noexcept;
@@ -3099,6 +3420,59 @@ class ClassTemplatePartialSpecializationDecl : public ClassTemplateSpecializatio
 
 static_assert(sizeof(Decl) == sizeof(ClassTemplatePartialSpecializationDecl));
 
+// A borrowed, non-owning reference to a declaration. Unlike a `Decl`, a
+// `DeclRef` does not keep its `AST` alive, and so copying one involves no
+// reference counting. A `DeclRef` is only valid while some owner of its
+// `AST` is alive. Use `Owned` to get back to the full `Decl` API.
+//
+// NOTE(pag): Every generated method that returns a single declaration,
+//            statement, type, attribute, token, or token range has a
+//            borrowed variant with a `Ref` suffix, e.g.
+//            `VarDecl::InitializerRef`. Methods returning lists only
+//            have owning or lazy `Range` variants.
+class DeclRef {
+ public:
+  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeclRef)
+
+  inline DeclRef(const Decl &decl) noexcept
+      : ast(decl.ast.get()),
+        decl(decl.u.Decl),
+        kind(decl.kind) {}
+
+  inline DeclKind Kind(void) const noexcept {
+    return kind;
+  }
+
+  std::string_view KindName(void) const noexcept;
+
+  inline const ::clang::Decl *RawDecl(void) const noexcept {
+    return decl;
+  }
+
+  // Return an owning version of this declaration.
+  ::pasta::Decl Owned(void) const;
+
+  inline bool operator==(const DeclRef &that) const noexcept {
+    return decl == that.decl;
+  }
+
+  inline bool operator!=(const DeclRef &that) const noexcept {
+    return decl != that.decl;
+  }
+
+ private:
+  friend class DeclContext;
+  friend class RefBuilder;
+  template <typename> friend class DeclContextIterator;
+
+  DeclRef(void) = delete;
+  explicit DeclRef(ASTImpl *ast_, const ::clang::Decl *decl_);
+
+  ASTImpl *ast;
+  const ::clang::Decl *decl;
+  DeclKind kind;
+};
+
 }  // namespace pasta
 #undef PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR
 #endif  // PASTA_IN_BOOTSTRAP
@@ -4,13 +4,18 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <type_traits>
 
 #include "Forward.h"
 
 namespace clang {
 class CXXBaseSpecifier;
+class Decl;
 class TemplateArgument;
 class TemplateParameterList;
 }  // namespace clang
@@ -26,6 +31,7 @@ class CXXDestructorDecl;
 class CXXMethodDecl;
 class CXXRecordDecl;
 class Decl;
+class DeclRef;
 class DecompositionDecl;
 class Designator;
 class EnumDecl;
@@ -36,6 +42,7 @@ class OMPCapturedExprDecl;
 class ParmVarDecl;
 class PrintedTokenRange;
 class RecordDecl;
+class Stmt;
 class Token;
 class VarTemplatePartialSpecializationDecl;
 
@@ -273,4 +280,247 @@ class TemplateParameterList {
 #endif  // PASTA_IN_BOOTSTRAP
 };
 
+#ifndef PASTA_IN_BOOTSTRAP
+
+// Predicate used to filter the declarations visited by a `DeclContextRange`.
+// A null filter accepts every declaration.
+using DeclFilter = bool (*)(const clang::Decl *);
+
+// Returns the next declaration after `decl` in its declaration context that
+// is accepted by `filter`, or `nullptr` if there isn't one.
+const clang::Decl *NextDeclInContext(const clang::Decl *decl,
+                                     DeclFilter filter) noexcept;
+
+// Returns an owning reference to `ast`, which must be owned by something.
+std::shared_ptr<ASTImpl> SharedAST(ASTImpl *ast) noexcept;
+
+template <typename T>
+class DeclContextRange;
+
+// Forward iterator over the declarations of a `DeclContextRange`. The
+// `Decl`-derived object for a declaration is only made when the iterator is
+// dereferenced.
+template <typename T>
+class DeclContextIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = T;
+
+  DeclContextIterator(void) = default;
+
+  inline bool operator==(const DeclContextIterator<T> &that) const noexcept {
+    return decl == that.decl;
+  }
+
+  inline bool operator!=(const DeclContextIterator<T> &that) const noexcept {
+    return decl != that.decl;
+  }
+
+  inline T operator*(void) const noexcept {
+    if constexpr (std::is_same_v<T, DeclRef>) {
+      return T(ast, decl);
+    } else {
+      return T(SharedAST(ast), decl);
+    }
+  }
+
+  inline DeclContextIterator<T> &operator++(void) noexcept {
+    decl = NextDeclInContext(decl, filter);
+    return *this;
+  }
+
+  inline DeclContextIterator<T> operator++(int) noexcept {
+    DeclContextIterator<T> ret = *this;
+    decl = NextDeclInContext(decl, filter);
+    return ret;
+  }
+
+ private:
+  friend class DeclContextRange<T>;
+
+  inline explicit DeclContextIterator(ASTImpl *ast_,
+                                      const clang::Decl *decl_,
+                                      DeclFilter filter_) noexcept
+      : ast(ast_),
+        decl(decl_),
+        filter(filter_) {}
+
+  // NOTE(pag): This is a raw pointer, so that copying and advancing
+  //            iterators does no reference counting. The iterator is valid
+  //            for as long as the AST is alive, even if the range that
+  //            produced it isn't.
+  ASTImpl *ast{nullptr};
+  const clang::Decl *decl{nullptr};
+  DeclFilter filter{nullptr};
+};
+
+// A lazy, forward-iterable range over the declarations in a declaration
+// context. Unlike the `std::vector`-returning accessors, this walks Clang's
+// own list of declarations, and allocates nothing up-front. Iterators are
+// valid while the AST is alive, e.g. while any `Decl` from it is alive, and
+// may outlive the range that produced them.
+template <typename T>
+class DeclContextRange {
+ public:
+  using iterator = DeclContextIterator<T>;
+  using const_iterator = DeclContextIterator<T>;
+
+  inline explicit DeclContextRange(std::shared_ptr<ASTImpl> ast_,
+                                   const clang::Decl *first_,
+                                   DeclFilter filter_) noexcept
+      : ast(std::move(ast_)),
+        first(first_),
+        filter(filter_) {}
+
+  inline iterator begin(void) const noexcept {
+    return iterator(ast.get(), first, filter);
+  }
+
+  inline iterator end(void) const noexcept {
+    return iterator(ast.get(), nullptr, filter);
+  }
+
+  inline bool empty(void) const noexcept {
+    return !first;
+  }
+
+ private:
+  std::shared_ptr<ASTImpl> ast;
+  const clang::Decl *first;
+  DeclFilter filter;
+};
+
+// Position of a `LazyIterator`. This holds the state of the Clang iterator
+// being wrapped, e.g. a pointer into an array, and what it means is up to the
+// `Traits` of the range.
+struct LazyCursor {
+  const void *pos{nullptr};
+  const void *aux{nullptr};
+  uintptr_t extra{0u};
+};
+
+template <typename Traits>
+class LazyRange;
+
+// Forward iterator over a `LazyRange`. `Traits` says how to advance and
+// compare cursors, and how to make the `Traits::value_type` object that a
+// cursor refers to, which is only done when the iterator is dereferenced.
+template <typename Traits>
+class LazyIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename Traits::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+
+  LazyIterator(void) = default;
+
+  inline bool operator==(const LazyIterator<Traits> &that) const noexcept {
+    return Traits::Equal(cursor, that.cursor);
+  }
+
+  inline bool operator!=(const LazyIterator<Traits> &that) const noexcept {
+    return !Traits::Equal(cursor, that.cursor);
+  }
+
+  inline value_type operator*(void) const noexcept {
+    return Traits::Dereference(ast, cursor);
+  }
+
+  inline LazyIterator<Traits> &operator++(void) noexcept {
+    Traits::Advance(cursor);
+    return *this;
+  }
+
+  inline LazyIterator<Traits> operator++(int) noexcept {
+    LazyIterator<Traits> ret = *this;
+    Traits::Advance(cursor);
+    return ret;
+  }
+
+ private:
+  friend class LazyRange<Traits>;
+
+  inline explicit LazyIterator(ASTImpl *ast_,
+                               const LazyCursor &cursor_) noexcept
+      : ast(ast_),
+        cursor(cursor_) {}
+
+  // Like in `DeclContextIterator`, this is a raw pointer, and the iterator is
+  // valid for as long as the AST is alive.
+  ASTImpl *ast{nullptr};
+  LazyCursor cursor;
+};
+
+// A lazy, forward-iterable range over one of Clang's own lists, e.g. the
+// attributes or redeclarations of a declaration, or the children of a
+// statement. Unlike the `std::vector`-returning accessors, this allocates
+// nothing up-front. Iterators are valid while the AST is alive, and may
+// outlive the range that produced them.
+template <typename Traits>
+class LazyRange {
+ public:
+  using iterator = LazyIterator<Traits>;
+  using const_iterator = LazyIterator<Traits>;
+
+  inline explicit LazyRange(std::shared_ptr<ASTImpl> ast_,
+                            const LazyCursor &first_,
+                            const LazyCursor &after_last_) noexcept
+      : ast(std::move(ast_)),
+        first(first_),
+        after_last(after_last_) {}
+
+  inline iterator begin(void) const noexcept {
+    return iterator(ast.get(), first);
+  }
+
+  inline iterator end(void) const noexcept {
+    return iterator(ast.get(), after_last);
+  }
+
+  inline bool empty(void) const noexcept {
+    return Traits::Equal(first, after_last);
+  }
+
+ private:
+  std::shared_ptr<ASTImpl> ast;
+  LazyCursor first;
+  LazyCursor after_last;
+};
+
+// The attributes of a declaration, i.e. `Decl::AttributesRange`.
+struct AttrRangeTraits {
+  using value_type = Attr;
+  static Attr Dereference(ASTImpl *ast, const LazyCursor &cursor) noexcept;
+  static void Advance(LazyCursor &cursor) noexcept;
+  static bool Equal(const LazyCursor &a, const LazyCursor &b) noexcept;
+};
+
+// The redeclarations of a declaration, starting with the declaration itself,
+// i.e. `Decl::RedeclarationsRange`.
+struct RedeclarationRangeTraits {
+  using value_type = Decl;
+  static Decl Dereference(ASTImpl *ast, const LazyCursor &cursor) noexcept;
+  static void Advance(LazyCursor &cursor) noexcept;
+  static bool Equal(const LazyCursor &a, const LazyCursor &b) noexcept;
+};
+
+// The non-null children of a statement, i.e. `Stmt::ChildrenRange`.
+struct StmtChildRangeTraits {
+  using value_type = Stmt;
+  static Stmt Dereference(ASTImpl *ast, const LazyCursor &cursor) noexcept;
+  static void Advance(LazyCursor &cursor) noexcept;
+  static bool Equal(const LazyCursor &a, const LazyCursor &b) noexcept;
+};
+
+using AttrRange = LazyRange<AttrRangeTraits>;
+using RedeclarationRange = LazyRange<RedeclarationRangeTraits>;
+using StmtChildRange = LazyRange<StmtChildRangeTraits>;
+
+#endif  // PASTA_IN_BOOTSTRAP
+
 }  // namespace pasta
@@ -805,8 +805,13 @@ using OMPDeclarativeDirectiveValueDecl = ValueDecl;
 namespace pasta {
 class AST;
 class ASTImpl;
+class AttrRef;
 class DeclBuilder;
+class DeclRef;
+class RefBuilder;
+class StmtRef;
 class TypeBuilder;
+class TypeRef;
 
 #define PASTA_FOR_EACH_DECL_IMPL(m, a) \
     a(OMPDeclarativeDirectiveDecl) \
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace pasta {
+
+// Approximate number of bytes retained by an `AST`, broken down by the data
+// structure retaining them. Containers are measured by their capacity, not
+// their size, and hash tables by their buckets and nodes, so these numbers
+// are estimates of what the allocator handed out, not exact heap usage.
+struct ASTMemoryUsage {
+  // Parsed tokens, their columnar mirror, and their file locations.
+  uint64_t tokens{0u};
+  uint64_t token_columns{0u};
+  uint64_t token_file_locations{0u};
+
+  // Token contexts.
+  uint64_t contexts{0u};
+
+  // Backing data of the parsed tokens.
+  uint64_t preprocessed_code{0u};
+  uint64_t backup_token_data{0u};
+
+  // Macro nodes, macro tokens, and the node lists of the root macro node.
+  uint64_t macro_nodes{0u};
+  uint64_t macro_tokens{0u};
+  uint64_t macro_node_lists{0u};
+
+  // Declaration bounds, both lazily computed and precomputed.
+  uint64_t decl_bounds{0u};
+
+  // Matching braces, parentheses, etc.
+  uint64_t matching{0u};
+
+  // Lexically containing declarations.
+  uint64_t lexically_containing_decl{0u};
+
+  // State kept for lazy token alignment.
+  uint64_t lazy_alignment{0u};
+
+  // Data and raw-lexed tokens of the parsed files.
+  //
+  // NOTE(pag): Files are owned by the `FileManager`, and are shared by all
+  //            ASTs built from compilers using that file manager, so these
+  //            are not freed when the `AST` is.
+  uint64_t file_data{0u};
+  uint64_t file_tokens{0u};
+
+  // Clang's AST nodes and side tables, as reported by the `ASTContext`.
+  uint64_t clang_ast_context{0u};
+
+  // Clang's source manager, i.e. its content caches, tables, and memory
+  // buffers.
+  uint64_t clang_source_manager{0u};
+
+  // Clang's preprocessor, i.e. its macro info and other allocations.
+  uint64_t clang_preprocessor{0u};
+
+  // Total of all of the above, except for `file_data` and `file_tokens`,
+  // which aren't owned by the `AST`.
+  uint64_t Total(void) const noexcept;
+
+  // Render this breakdown as a JSON object.
+  std::string ToJSON(void) const;
+};
+
+}  // namespace pasta
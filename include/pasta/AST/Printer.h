@@ -50,6 +50,9 @@ class PrintedToken {
   // Kind of this token.
   TokenKind Kind(void) const;
 
+  // Return the printable kind of this token.
+  const char *KindName(void) const;
+
   // Number of leading new lines (before any indentation spaces).
   unsigned NumLeadingNewLines(void) const;
 
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pasta {
+
+// Timing of one phase of building an `AST`.
+struct ASTPhaseTiming {
+  // Name of the phase, e.g. `"preprocess"`.
+  std::string_view name;
+
+  // Start of the phase, in microseconds since the job started running.
+  uint64_t start_us{0u};
+
+  // Wall-clock duration of the phase, in microseconds.
+  uint64_t wall_us{0u};
+
+  // CPU time used by the whole process during the phase, in microseconds.
+  // This includes alignment worker threads, but also any other threads, e.g.
+  // ones running concurrent jobs.
+  uint64_t cpu_us{0u};
+};
+
+// Timings and counters gathered while running a `CompileJob`.
+struct ASTStatistics {
+  // Phases of the job, in the order in which they ran.
+  std::vector<ASTPhaseTiming> phases;
+
+  // Number of parsed tokens, and the number of parsed tokens of each role,
+  // indexed by the `TokenRole`.
+  uint64_t num_tokens{0u};
+  std::vector<uint64_t> num_tokens_by_role;
+
+  // Number of token contexts, and number of parsed files.
+  uint64_t num_contexts{0u};
+  uint64_t num_parsed_files{0u};
+
+  // Number of macro nodes, by kind.
+  uint64_t num_macro_directives{0u};
+  uint64_t num_macro_expansions{0u};
+  uint64_t num_macro_arguments{0u};
+  uint64_t num_macro_parameters{0u};
+  uint64_t num_macro_substitutions{0u};
+  uint64_t num_macro_tokens{0u};
+
+  // Number of top-level declaration groups that were printed and aligned,
+  // the number that were skipped because they printed no tokens or had
+  // no parsed bounds, and the number that were skipped because none of their
+  // tokens were in files accepted by the alignment file filter.
+  uint64_t num_tld_groups_aligned{0u};
+  uint64_t num_tld_groups_skipped{0u};
+  uint64_t num_tld_groups_filtered{0u};
+
+  // Number of times that multi-threaded alignment had to wait for all
+  // in-flight groups to finish because the next group overlapped them.
+  uint64_t num_alignment_drains{0u};
+
+  // Number of parsed files whose raw tokens were, or weren't, loaded from the
+  // token cache. Both are zero if there is no token cache. See
+  // `CompileJobOptions::token_cache_directory`.
+  uint64_t num_token_cache_hits{0u};
+  uint64_t num_token_cache_misses{0u};
+
+  // Render these statistics as JSON in the Chrome trace event format. The
+  // phases are complete (`"X"`) events, and the counters are in `otherData`.
+  // The result can be loaded by `chrome://tracing` or Perfetto.
+  std::string ToJSON(void) const;
+};
+
+}  // namespace pasta
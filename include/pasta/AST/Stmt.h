@@ -538,18 +538,26 @@ class Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, ValueStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, WhileStmt)
   ::pasta::Stmt IgnoreContainers(void) const noexcept;
+  ::pasta::StmtRef IgnoreContainersRef(void) const noexcept;
   std::vector<::pasta::Stmt> Children(void) const noexcept;
+  ::pasta::StmtChildRange ChildrenRange(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   int64_t ID(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::StmtKind Kind(void) const noexcept;
   std::string_view KindName(void) const noexcept;
   ::pasta::Stmt StripLabelLikeStatements(void) const noexcept;
+  ::pasta::StmtRef StripLabelLikeStatementsRef(void) const noexcept;
   inline bool operator==(const Stmt &that) const noexcept {
     return u.opaque == that.u.opaque;
   }
  protected:
+  friend class StmtRef;
+
   std::shared_ptr<ASTImpl> ast;
   union {
     const ::clang::AbstractConditionalOperator *AbstractConditionalOperator;
@@ -824,11 +832,17 @@ class SwitchCase : public Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(SwitchCase, CaseStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token ColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token KeywordToken(void) const noexcept;
+  ::pasta::TokenRef KeywordTokenRef(void) const noexcept;
   std::optional<::pasta::SwitchCase> NextSwitchCase(void) const noexcept;
+  std::optional<::pasta::StmtRef> NextSwitchCaseRef(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SwitchCase)
 };
@@ -842,16 +856,27 @@ class SwitchStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SwitchStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   std::optional<::pasta::VarDecl> ConditionVariable(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConditionVariableRef(void) const noexcept;
   std::optional<::pasta::DeclStmt> ConditionVariableDeclarationStatement(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConditionVariableDeclarationStatementRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Stmt> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   std::optional<::pasta::SwitchCase> FirstSwitchCase(void) const noexcept;
+  std::optional<::pasta::StmtRef> FirstSwitchCaseRef(void) const noexcept;
   ::pasta::Token SwitchToken(void) const noexcept;
+  ::pasta::TokenRef SwitchTokenRef(void) const noexcept;
   bool HasInitializerStorage(void) const noexcept;
   bool HasVariableStorage(void) const noexcept;
   bool IsAllEnumCasesCovered(void) const noexcept;
@@ -1000,6 +1025,7 @@ class ValueStmt : public Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, UserDefinedLiteral)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, VAArgExpr)
   std::optional<::pasta::Expr> ExpressionStatement(void) const noexcept;
+  std::optional<::pasta::StmtRef> ExpressionStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ValueStmt)
 };
@@ -1013,14 +1039,23 @@ class WhileStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, WhileStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   std::optional<::pasta::VarDecl> ConditionVariable(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConditionVariableRef(void) const noexcept;
   std::optional<::pasta::DeclStmt> ConditionVariableDeclarationStatement(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConditionVariableDeclarationStatementRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Token WhileToken(void) const noexcept;
+  ::pasta::TokenRef WhileTokenRef(void) const noexcept;
   bool HasVariableStorage(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(WhileStmt)
@@ -1038,9 +1073,12 @@ class AsmStmt : public Stmt {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   std::string GenerateAssemblyString(void) const noexcept;
   ::pasta::Token AssemblyToken(void) const noexcept;
+  ::pasta::TokenRef AssemblyTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // Clobber: (llvm::StringRef)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // InputConstraint: (llvm::StringRef)
   // InputExpression: (const clang::Expr *)
   uint32_t NumClobbers(void) const noexcept;
@@ -1074,10 +1112,14 @@ class AttributedStmt : public ValueStmt {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AttributedStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AttributeToken(void) const noexcept;
+  ::pasta::TokenRef AttributeTokenRef(void) const noexcept;
   std::vector<::pasta::Attr> Attributes(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AttributedStmt)
 };
@@ -1091,8 +1133,11 @@ class BreakStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BreakStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BreakToken(void) const noexcept;
+  ::pasta::TokenRef BreakTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BreakStmt)
 };
@@ -1106,11 +1151,17 @@ class CXXCatchStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXCatchStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token CatchToken(void) const noexcept;
+  ::pasta::TokenRef CatchTokenRef(void) const noexcept;
   ::pasta::Type CaughtType(void) const noexcept;
+  ::pasta::TypeRef CaughtTypeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::VarDecl> ExceptionDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> ExceptionDeclarationRef(void) const noexcept;
   ::pasta::Stmt HandlerBlock(void) const noexcept;
+  ::pasta::StmtRef HandlerBlockRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXCatchStmt)
 };
@@ -1124,21 +1175,37 @@ class CXXForRangeStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXForRangeStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::DeclStmt BeginStatement(void) const noexcept;
+  ::pasta::StmtRef BeginStatementRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Token CoawaitToken(void) const noexcept;
+  ::pasta::TokenRef CoawaitTokenRef(void) const noexcept;
   ::pasta::Token ColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonTokenRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::DeclStmt EndStatement(void) const noexcept;
+  ::pasta::StmtRef EndStatementRef(void) const noexcept;
   ::pasta::Token ForToken(void) const noexcept;
+  ::pasta::TokenRef ForTokenRef(void) const noexcept;
   ::pasta::Expr Increment(void) const noexcept;
+  ::pasta::StmtRef IncrementRef(void) const noexcept;
   std::optional<::pasta::Stmt> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   ::pasta::DeclStmt LoopVariableStatement(void) const noexcept;
+  ::pasta::StmtRef LoopVariableStatementRef(void) const noexcept;
   ::pasta::VarDecl LoopVariable(void) const noexcept;
+  ::pasta::DeclRef LoopVariableRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr RangeInitializer(void) const noexcept;
+  ::pasta::StmtRef RangeInitializerRef(void) const noexcept;
   ::pasta::DeclStmt RangeStatement(void) const noexcept;
+  ::pasta::StmtRef RangeStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXForRangeStmt)
 };
@@ -1152,11 +1219,15 @@ class CXXTryStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXTryStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Handler: (const clang::CXXCatchStmt *)
   uint32_t NumHandlers(void) const noexcept;
   ::pasta::CompoundStmt TryBlock(void) const noexcept;
+  ::pasta::StmtRef TryBlockRef(void) const noexcept;
   ::pasta::Token TryToken(void) const noexcept;
+  ::pasta::TokenRef TryTokenRef(void) const noexcept;
   std::vector<::pasta::CXXCatchStmt> Handlers(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXTryStmt)
@@ -1174,12 +1245,18 @@ class CapturedStmt : public Stmt {
   // CapturesVariable: (bool)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::CapturedDecl CapturedDeclaration(void) const noexcept;
+  ::pasta::DeclRef CapturedDeclarationRef(void) const noexcept;
   ::pasta::RecordDecl CapturedRecordDeclaration(void) const noexcept;
+  ::pasta::DeclRef CapturedRecordDeclarationRef(void) const noexcept;
   enum CapturedRegionKind CapturedRegionKind(void) const noexcept;
   ::pasta::Stmt CapturedStatement(void) const noexcept;
+  ::pasta::StmtRef CapturedStatementRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CapturedStmt)
 };
@@ -1196,12 +1273,19 @@ class CaseStmt : public SwitchCase {
   bool CaseStatementIsGNURange(void) const noexcept;
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token CaseToken(void) const noexcept;
+  ::pasta::TokenRef CaseTokenRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   std::optional<::pasta::Expr> RHS(void) const noexcept;
+  std::optional<::pasta::StmtRef> RHSRef(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CaseStmt)
 };
@@ -1216,10 +1300,15 @@ class CompoundStmt : public Stmt {
   // Body: (llvm::iterator_range<clang::Stmt *const *>)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LeftBraceToken(void) const noexcept;
+  ::pasta::TokenRef LeftBraceTokenRef(void) const noexcept;
   ::pasta::Token RightBraceToken(void) const noexcept;
+  ::pasta::TokenRef RightBraceTokenRef(void) const noexcept;
   std::optional<::pasta::Stmt> StatementExpressionResult(void) const noexcept;
+  std::optional<::pasta::StmtRef> StatementExpressionResultRef(void) const noexcept;
   // StoredFPFeatures: (clang::FPOptionsOverride)
   bool HasStoredFPFeatures(void) const noexcept;
   uint32_t Size(void) const noexcept;
@@ -1236,8 +1325,11 @@ class ContinueStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ContinueStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token ContinueToken(void) const noexcept;
+  ::pasta::TokenRef ContinueTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ContinueStmt)
 };
@@ -1251,10 +1343,15 @@ class CoreturnStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoreturnStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token KeywordToken(void) const noexcept;
+  ::pasta::TokenRef KeywordTokenRef(void) const noexcept;
   ::pasta::Expr Operand(void) const noexcept;
+  ::pasta::StmtRef OperandRef(void) const noexcept;
   ::pasta::Expr PromiseCall(void) const noexcept;
+  ::pasta::StmtRef PromiseCallRef(void) const noexcept;
   bool IsImplicit(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoreturnStmt)
@@ -1269,21 +1366,36 @@ class CoroutineBodyStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoroutineBodyStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Allocate(void) const noexcept;
+  ::pasta::StmtRef AllocateRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr Deallocate(void) const noexcept;
+  ::pasta::StmtRef DeallocateRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt ExceptionHandler(void) const noexcept;
+  ::pasta::StmtRef ExceptionHandlerRef(void) const noexcept;
   ::pasta::Stmt FallthroughHandler(void) const noexcept;
+  ::pasta::StmtRef FallthroughHandlerRef(void) const noexcept;
   ::pasta::Stmt FinalSuspendStatement(void) const noexcept;
+  ::pasta::StmtRef FinalSuspendStatementRef(void) const noexcept;
   ::pasta::Stmt InitializerSuspendStatement(void) const noexcept;
+  ::pasta::StmtRef InitializerSuspendStatementRef(void) const noexcept;
   std::vector<::pasta::Stmt> ParameterMoves(void) const noexcept;
   ::pasta::VarDecl PromiseDeclaration(void) const noexcept;
+  ::pasta::DeclRef PromiseDeclarationRef(void) const noexcept;
   ::pasta::Stmt PromiseDeclarationStatement(void) const noexcept;
+  ::pasta::StmtRef PromiseDeclarationStatementRef(void) const noexcept;
   ::pasta::Stmt ReturnStatement(void) const noexcept;
+  ::pasta::StmtRef ReturnStatementRef(void) const noexcept;
   ::pasta::Stmt ReturnStatementOnAllocFailure(void) const noexcept;
+  ::pasta::StmtRef ReturnStatementOnAllocFailureRef(void) const noexcept;
   ::pasta::Expr ReturnValue(void) const noexcept;
+  ::pasta::StmtRef ReturnValueRef(void) const noexcept;
   ::pasta::Expr ReturnValueInitializer(void) const noexcept;
+  ::pasta::StmtRef ReturnValueInitializerRef(void) const noexcept;
   bool HasDependentPromiseType(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoroutineBodyStmt)
@@ -1299,9 +1411,12 @@ class DeclStmt : public Stmt {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   std::vector<::pasta::Decl> Declarations(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // DeclarationGroup: (const clang::DeclGroupRef)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Decl> SingleDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> SingleDeclarationRef(void) const noexcept;
   bool IsSingleDeclaration(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DeclStmt)
@@ -1318,9 +1433,13 @@ class DefaultStmt : public SwitchCase {
   PASTA_DECLARE_BASE_OPERATORS(SwitchCase, DefaultStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token DefaultToken(void) const noexcept;
+  ::pasta::TokenRef DefaultTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DefaultStmt)
 };
@@ -1334,12 +1453,19 @@ class DoStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DoStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Token DoToken(void) const noexcept;
+  ::pasta::TokenRef DoTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Token WhileToken(void) const noexcept;
+  ::pasta::TokenRef WhileTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DoStmt)
 };
@@ -1499,31 +1625,49 @@ class Expr : public ValueStmt {
   // EvaluateWithSubstitution: (bool)
   bool HasSideEffects(void) const noexcept;
   ::pasta::Expr IgnoreCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreConversionOperatorSingleStep(void) const noexcept;
+  ::pasta::StmtRef IgnoreConversionOperatorSingleStepRef(void) const noexcept;
   ::pasta::Expr IgnoreImplicitCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreImplicitCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreImplicit(void) const noexcept;
+  ::pasta::StmtRef IgnoreImplicitRef(void) const noexcept;
   ::pasta::Expr IgnoreImplicitAsWritten(void) const noexcept;
+  ::pasta::StmtRef IgnoreImplicitAsWrittenRef(void) const noexcept;
   ::pasta::Expr IgnoreParenthesisBaseCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreParenthesisBaseCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreParenthesisCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreParenthesisCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreParenthesisImplicitCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreParenthesisImplicitCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreParenthesisLValueCasts(void) const noexcept;
+  ::pasta::StmtRef IgnoreParenthesisLValueCastsRef(void) const noexcept;
   ::pasta::Expr IgnoreParenthesisNoopCasts(void) const noexcept;
   ::pasta::Expr IgnoreParentheses(void) const noexcept;
+  ::pasta::StmtRef IgnoreParenthesesRef(void) const noexcept;
   ::pasta::Expr IgnoreUnlessSpelledInSource(void) const noexcept;
+  ::pasta::StmtRef IgnoreUnlessSpelledInSourceRef(void) const noexcept;
   bool ContainsErrors(void) const noexcept;
   bool ContainsUnexpandedParameterPack(void) const noexcept;
   std::optional<::pasta::ValueDecl> AsBuiltinConstantDeclarationReference(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> BestDynamicClassType(void) const noexcept;
+  std::optional<::pasta::DeclRef> BestDynamicClassTypeRef(void) const noexcept;
   ::pasta::Expr BestDynamicClassTypeExpression(void) const noexcept;
+  ::pasta::StmtRef BestDynamicClassTypeExpressionRef(void) const noexcept;
   // Dependence: (clang::ExprDependenceScope::ExprDependence)
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   // FPFeaturesInEffect: (clang::FPOptions)
   // IntegerConstantExpression: (llvm::Optional<llvm::APSInt>)
   std::optional<::pasta::ObjCPropertyRefExpr> ObjCProperty(void) const noexcept;
+  std::optional<::pasta::StmtRef> ObjCPropertyRef(void) const noexcept;
   enum ExprObjectKind ObjectKind(void) const noexcept;
   std::optional<::pasta::Decl> ReferencedDeclarationOfCallee(void) const noexcept;
+  std::optional<::pasta::DeclRef> ReferencedDeclarationOfCalleeRef(void) const noexcept;
   std::optional<::pasta::FieldDecl> SourceBitField(void) const noexcept;
+  std::optional<::pasta::DeclRef> SourceBitFieldRef(void) const noexcept;
   std::optional<::pasta::Type> Type(void) const noexcept;
+  std::optional<::pasta::TypeRef> TypeRef(void) const noexcept;
   enum ExprValueKind ValueKind(void) const noexcept;
   bool HasNonTrivialCall(void) const noexcept;
   bool IsBoundMemberFunction(void) const noexcept;
@@ -1572,8 +1716,11 @@ class ExpressionTraitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ExpressionTraitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr QueriedExpression(void) const noexcept;
+  ::pasta::StmtRef QueriedExpressionRef(void) const noexcept;
   enum ExpressionTrait Trait(void) const noexcept;
   bool Value(void) const noexcept;
  protected:
@@ -1594,9 +1741,13 @@ class ExtVectorElementExpr : public Expr {
   bool ContainsDuplicateElements(void) const noexcept;
   // Accessor: (clang::IdentifierInfo &)
   ::pasta::Token AccessorToken(void) const noexcept;
+  ::pasta::TokenRef AccessorTokenRef(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumElements(void) const noexcept;
   bool IsArrow(void) const noexcept;
  protected:
@@ -1615,8 +1766,11 @@ class FixedPointLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FixedPointLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   uint32_t Scale(void) const noexcept;
   // ValueAsString: (std::string)
  protected:
@@ -1635,8 +1789,11 @@ class FloatingLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FloatingLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   // RawSemantics: (llvm::APFloatBase::Semantics)
   // Semantics: (const llvm::fltSemantics &)
   // Value: (llvm::APFloat)
@@ -1655,16 +1812,27 @@ class ForStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ForStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   std::optional<::pasta::Expr> Condition(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConditionRef(void) const noexcept;
   std::optional<::pasta::VarDecl> ConditionVariable(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConditionVariableRef(void) const noexcept;
   std::optional<::pasta::DeclStmt> ConditionVariableDeclarationStatement(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConditionVariableDeclarationStatementRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ForToken(void) const noexcept;
+  ::pasta::TokenRef ForTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> Increment(void) const noexcept;
+  std::optional<::pasta::StmtRef> IncrementRef(void) const noexcept;
   std::optional<::pasta::Stmt> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ForStmt)
 };
@@ -1682,6 +1850,7 @@ class FullExpr : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(FullExpr, ConstantExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(FullExpr, ExprWithCleanups)
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FullExpr)
 };
@@ -1698,11 +1867,15 @@ class FunctionParmPackExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FunctionParmPackExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Expansion: (clang::VarDecl *)
   uint32_t NumExpansions(void) const noexcept;
   ::pasta::VarDecl ParameterPack(void) const noexcept;
+  ::pasta::DeclRef ParameterPackRef(void) const noexcept;
   ::pasta::Token ParameterPackToken(void) const noexcept;
+  ::pasta::TokenRef ParameterPackTokenRef(void) const noexcept;
   std::vector<::pasta::VarDecl> Expansions(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FunctionParmPackExpr)
@@ -1720,10 +1893,13 @@ class GCCAsmStmt : public AsmStmt {
   // AnalyzeAssemblyString: (unsigned int)
   std::string GenerateAssemblyString(void) const noexcept;
   ::pasta::StringLiteral AssemblyString(void) const noexcept;
+  ::pasta::StmtRef AssemblyStringRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // Clobber: (llvm::StringRef)
   // ClobberStringLiteral: (const clang::StringLiteral *)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // InputConstraint: (llvm::StringRef)
   // InputConstraintLiteral: (const clang::StringLiteral *)
   // InputExpression: (const clang::Expr *)
@@ -1740,6 +1916,7 @@ class GCCAsmStmt : public AsmStmt {
   // OutputIdentifier: (clang::IdentifierInfo *)
   // OutputName: (llvm::StringRef)
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsAssemblyGoto(void) const noexcept;
   std::vector<::pasta::AddrLabelExpr> Labels(void) const noexcept;
   std::vector<std::string_view> OutputConstraints(void) const noexcept;
@@ -1773,8 +1950,11 @@ class GNUNullExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, GNUNullExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token TokenToken(void) const noexcept;
+  ::pasta::TokenRef TokenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GNUNullExpr)
 };
@@ -1795,13 +1975,20 @@ class GenericSelectionExpr : public Expr {
   // AssociationTypes: (llvm::ArrayRef<clang::TypeSourceInfo *>)
   // Association: (clang::GenericSelectionExpr::AssociationTy<true>)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr ControllingExpression(void) const noexcept;
+  ::pasta::StmtRef ControllingExpressionRef(void) const noexcept;
   ::pasta::Token DefaultToken(void) const noexcept;
+  ::pasta::TokenRef DefaultTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token GenericToken(void) const noexcept;
+  ::pasta::TokenRef GenericTokenRef(void) const noexcept;
   uint32_t NumAssociations(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr ResultExpression(void) const noexcept;
+  ::pasta::StmtRef ResultExpressionRef(void) const noexcept;
   uint32_t ResultIndex(void) const noexcept;
   bool IsResultDependent(void) const noexcept;
  protected:
@@ -1817,10 +2004,15 @@ class GotoStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, GotoStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token GotoToken(void) const noexcept;
+  ::pasta::TokenRef GotoTokenRef(void) const noexcept;
   ::pasta::LabelDecl Label(void) const noexcept;
+  ::pasta::DeclRef LabelRef(void) const noexcept;
   ::pasta::Token LabelToken(void) const noexcept;
+  ::pasta::TokenRef LabelTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GotoStmt)
 };
@@ -1834,19 +2026,31 @@ class IfStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, IfStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   std::optional<::pasta::VarDecl> ConditionVariable(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConditionVariableRef(void) const noexcept;
   std::optional<::pasta::DeclStmt> ConditionVariableDeclarationStatement(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConditionVariableDeclarationStatementRef(void) const noexcept;
   std::optional<::pasta::Stmt> Else(void) const noexcept;
+  std::optional<::pasta::StmtRef> ElseRef(void) const noexcept;
   ::pasta::Token ElseToken(void) const noexcept;
+  ::pasta::TokenRef ElseTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token IfToken(void) const noexcept;
+  ::pasta::TokenRef IfTokenRef(void) const noexcept;
   std::optional<::pasta::Stmt> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   // NondiscardedCase: (llvm::Optional<const clang::Stmt *>)
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   enum IfStatementKind StatementKind(void) const noexcept;
   ::pasta::Stmt Then(void) const noexcept;
+  ::pasta::StmtRef ThenRef(void) const noexcept;
   bool HasElseStorage(void) const noexcept;
   bool HasInitializerStorage(void) const noexcept;
   bool HasVariableStorage(void) const noexcept;
@@ -1871,8 +2075,11 @@ class ImaginaryLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ImaginaryLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImaginaryLiteral)
 };
@@ -1889,7 +2096,9 @@ class ImplicitValueInitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ImplicitValueInitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImplicitValueInitExpr)
 };
@@ -1903,11 +2112,17 @@ class IndirectGotoStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, IndirectGotoStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::optional<::pasta::LabelDecl> ConstantTarget(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConstantTargetRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token GotoToken(void) const noexcept;
+  ::pasta::TokenRef GotoTokenRef(void) const noexcept;
   ::pasta::Token StarToken(void) const noexcept;
+  ::pasta::TokenRef StarTokenRef(void) const noexcept;
   ::pasta::Expr Target(void) const noexcept;
+  ::pasta::StmtRef TargetRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(IndirectGotoStmt)
 };
@@ -1924,16 +2139,24 @@ class InitListExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, InitListExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   std::optional<::pasta::Expr> ArrayFiller(void) const noexcept;
+  std::optional<::pasta::StmtRef> ArrayFillerRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Initializer: (const clang::Expr *)
   std::optional<::pasta::FieldDecl> InitializedFieldInUnion(void) const noexcept;
+  std::optional<::pasta::DeclRef> InitializedFieldInUnionRef(void) const noexcept;
   // Initializers: (clang::Expr *const *)
   ::pasta::Token LBraceToken(void) const noexcept;
+  ::pasta::TokenRef LBraceTokenRef(void) const noexcept;
   uint32_t NumInitializers(void) const noexcept;
   ::pasta::Token RBraceToken(void) const noexcept;
+  ::pasta::TokenRef RBraceTokenRef(void) const noexcept;
   std::optional<::pasta::InitListExpr> SemanticForm(void) const noexcept;
+  std::optional<::pasta::StmtRef> SemanticFormRef(void) const noexcept;
   std::optional<::pasta::InitListExpr> SyntacticForm(void) const noexcept;
+  std::optional<::pasta::StmtRef> SyntacticFormRef(void) const noexcept;
   bool HadArrayRangeDesignator(void) const noexcept;
   bool HasArrayFiller(void) const noexcept;
   std::vector<::pasta::Expr> Initializers(void) const noexcept;
@@ -1959,8 +2182,11 @@ class IntegerLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, IntegerLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(IntegerLiteral)
 };
@@ -1976,11 +2202,16 @@ class LabelStmt : public ValueStmt {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, LabelStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::LabelDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token IdentifierToken(void) const noexcept;
+  ::pasta::TokenRef IdentifierTokenRef(void) const noexcept;
   std::string_view Name(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
   bool IsSideEntry(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(LabelStmt)
@@ -2001,18 +2232,28 @@ class LambdaExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // ExplicitCaptures: (llvm::iterator_range<const clang::LambdaCapture *>)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::CXXMethodDecl CallOperator(void) const noexcept;
+  ::pasta::DeclRef CallOperatorRef(void) const noexcept;
   enum LambdaCaptureDefault CaptureDefault(void) const noexcept;
   ::pasta::Token CaptureDefaultToken(void) const noexcept;
+  ::pasta::TokenRef CaptureDefaultTokenRef(void) const noexcept;
   ::pasta::CompoundStmt CompoundStatementBody(void) const noexcept;
+  ::pasta::StmtRef CompoundStatementBodyRef(void) const noexcept;
   std::optional<::pasta::FunctionTemplateDecl> DependentCallOperator(void) const noexcept;
+  std::optional<::pasta::DeclRef> DependentCallOperatorRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::vector<::pasta::NamedDecl> ExplicitTemplateParameters(void) const noexcept;
   ::pasta::TokenRange IntroducerRange(void) const noexcept;
+  ::pasta::TokenRefRange IntroducerRangeRef(void) const noexcept;
   ::pasta::CXXRecordDecl LambdaClass(void) const noexcept;
+  ::pasta::DeclRef LambdaClassRef(void) const noexcept;
   std::optional<::pasta::TemplateParameterList> TemplateParameterList(void) const noexcept;
   std::optional<::pasta::Expr> TrailingRequiresClause(void) const noexcept;
+  std::optional<::pasta::StmtRef> TrailingRequiresClauseRef(void) const noexcept;
   bool HasExplicitParameters(void) const noexcept;
   bool HasExplicitResultType(void) const noexcept;
   // ImplicitCaptures: (llvm::iterator_range<const clang::LambdaCapture *>)
@@ -2038,12 +2279,15 @@ class MSAsmStmt : public AsmStmt {
   std::vector<::pasta::Expr> AllExpressions(void) const noexcept;
   std::string_view AssemblyString(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // Clobber: (llvm::StringRef)
   std::vector<std::string_view> Clobbers(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // InputConstraint: (llvm::StringRef)
   // InputExpression: (const clang::Expr *)
   ::pasta::Token LBraceToken(void) const noexcept;
+  ::pasta::TokenRef LBraceTokenRef(void) const noexcept;
   // OutputConstraint: (llvm::StringRef)
   // OutputExpression: (const clang::Expr *)
   bool HasBraces(void) const noexcept;
@@ -2064,11 +2308,15 @@ class MSDependentExistsStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MSDependentExistsStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token KeywordToken(void) const noexcept;
+  ::pasta::TokenRef KeywordTokenRef(void) const noexcept;
   // NameInfo: (clang::DeclarationNameInfo)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::CompoundStmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
   bool IsIfExists(void) const noexcept;
   bool IsIfNotExists(void) const noexcept;
  protected:
@@ -2087,12 +2335,18 @@ class MSPropertyRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MSPropertyRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr BaseExpression(void) const noexcept;
+  ::pasta::StmtRef BaseExpressionRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token MemberToken(void) const noexcept;
+  ::pasta::TokenRef MemberTokenRef(void) const noexcept;
   ::pasta::MSPropertyDecl PropertyDeclaration(void) const noexcept;
+  ::pasta::DeclRef PropertyDeclarationRef(void) const noexcept;
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   bool IsArrow(void) const noexcept;
   bool IsImplicitAccess(void) const noexcept;
  protected:
@@ -2111,11 +2365,17 @@ class MSPropertySubscriptExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MSPropertySubscriptExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr Index(void) const noexcept;
+  ::pasta::StmtRef IndexRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MSPropertySubscriptExpr)
 };
@@ -2132,13 +2392,18 @@ class MaterializeTemporaryExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MaterializeTemporaryExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::ValueDecl> ExtendingDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> ExtendingDeclarationRef(void) const noexcept;
   std::optional<::pasta::LifetimeExtendedTemporaryDecl> LifetimeExtendedTemporaryDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> LifetimeExtendedTemporaryDeclarationRef(void) const noexcept;
   uint32_t ManglingNumber(void) const noexcept;
   // OrCreateValue: (clang::APValue *)
   enum StorageDuration StorageDuration(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   bool IsBoundToLvalueReference(void) const noexcept;
   bool IsUsableInConstantExpressions(void) const noexcept;
  protected:
@@ -2157,12 +2422,19 @@ class MatrixSubscriptExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MatrixSubscriptExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr ColumnIndex(void) const noexcept;
+  ::pasta::StmtRef ColumnIndexRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   ::pasta::Expr RowIndex(void) const noexcept;
+  ::pasta::StmtRef RowIndexRef(void) const noexcept;
   bool IsIncomplete(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MatrixSubscriptExpr)
@@ -2180,21 +2452,31 @@ class MemberExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MemberExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   // FoundDeclaration: (clang::DeclAccessPair)
   ::pasta::Token LAngleToken(void) const noexcept;
+  ::pasta::TokenRef LAngleTokenRef(void) const noexcept;
   ::pasta::ValueDecl MemberDeclaration(void) const noexcept;
+  ::pasta::DeclRef MemberDeclarationRef(void) const noexcept;
   ::pasta::Token MemberToken(void) const noexcept;
+  ::pasta::TokenRef MemberTokenRef(void) const noexcept;
   // MemberNameInfo: (clang::DeclarationNameInfo)
   uint32_t NumTemplateArguments(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token RAngleToken(void) const noexcept;
+  ::pasta::TokenRef RAngleTokenRef(void) const noexcept;
   // TemplateArguments: (const clang::TemplateArgumentLoc *)
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   bool HadMultipleCandidates(void) const noexcept;
   bool HasExplicitTemplateArguments(void) const noexcept;
   bool HasQualifier(void) const noexcept;
@@ -2220,7 +2502,9 @@ class NoInitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, NoInitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(NoInitExpr)
 };
@@ -2234,8 +2518,11 @@ class NullStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, NullStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token SemiToken(void) const noexcept;
+  ::pasta::TokenRef SemiTokenRef(void) const noexcept;
   bool HasLeadingEmptyMacro(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(NullStmt)
@@ -2253,15 +2540,25 @@ class OMPArraySectionExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OMPArraySectionExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token FirstColonToken(void) const noexcept;
+  ::pasta::TokenRef FirstColonTokenRef(void) const noexcept;
   ::pasta::Token SecondColonToken(void) const noexcept;
+  ::pasta::TokenRef SecondColonTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr Length(void) const noexcept;
+  ::pasta::StmtRef LengthRef(void) const noexcept;
   ::pasta::Expr LowerBound(void) const noexcept;
+  ::pasta::StmtRef LowerBoundRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   ::pasta::Expr Stride(void) const noexcept;
+  ::pasta::StmtRef StrideRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPArraySectionExpr)
 };
@@ -2278,12 +2575,17 @@ class OMPArrayShapingExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OMPArrayShapingExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::vector<::pasta::TokenRange> BracketsRanges(void) const noexcept;
   std::vector<::pasta::Expr> Dimensions(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPArrayShapingExpr)
 };
@@ -2297,11 +2599,17 @@ class OMPCanonicalLoop : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPCanonicalLoop)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::CapturedStmt DistanceFunc(void) const noexcept;
+  ::pasta::StmtRef DistanceFuncRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt LoopStatement(void) const noexcept;
+  ::pasta::StmtRef LoopStatementRef(void) const noexcept;
   ::pasta::CapturedStmt LoopVariableFunc(void) const noexcept;
+  ::pasta::StmtRef LoopVariableFuncRef(void) const noexcept;
   ::pasta::DeclRefExpr LoopVariableReference(void) const noexcept;
+  ::pasta::StmtRef LoopVariableReferenceRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPCanonicalLoop)
 };
@@ -2389,15 +2697,21 @@ class OMPExecutableDirective : public Stmt {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // Clauses: (llvm::ArrayRef<clang::OMPClause *>)
   ::pasta::Stmt AssociatedStatement(void) const noexcept;
+  ::pasta::StmtRef AssociatedStatementRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // CapturedStatement: (const clang::CapturedStmt *)
   // Clause: (clang::OMPClause *)
   // DirectiveKind: (llvm::omp::Directive)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::CapturedStmt InnermostCapturedStatement(void) const noexcept;
+  ::pasta::StmtRef InnermostCapturedStatementRef(void) const noexcept;
   uint32_t NumClauses(void) const noexcept;
   ::pasta::Stmt RawStatement(void) const noexcept;
+  ::pasta::StmtRef RawStatementRef(void) const noexcept;
   ::pasta::Stmt StructuredBlock(void) const noexcept;
+  ::pasta::StmtRef StructuredBlockRef(void) const noexcept;
   bool HasAssociatedStatement(void) const noexcept;
   bool IsStandaloneDirective(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
@@ -2446,14 +2760,19 @@ class OMPIteratorExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // AssignToken: (clang::SourceLocation)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // ColonToken: (clang::SourceLocation)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Helper: (const clang::OMPIteratorHelperData &)
   // IteratorDeclaration: (const clang::Decl *)
   ::pasta::Token IteratorKwToken(void) const noexcept;
+  ::pasta::TokenRef IteratorKwTokenRef(void) const noexcept;
   // IteratorRange: (const clang::OMPIteratorExpr::IteratorRange)
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   // SecondColonToken: (clang::SourceLocation)
   uint32_t NumOfIterators(void) const noexcept;
  protected:
@@ -2565,35 +2884,65 @@ class OMPLoopDirective : public OMPLoopBasedDirective {
   std::vector<::pasta::Expr> Finals(void) const noexcept;
   std::vector<::pasta::Expr> FinalsConditions(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr CalculateLastIteration(void) const noexcept;
+  ::pasta::StmtRef CalculateLastIterationRef(void) const noexcept;
   ::pasta::Expr CombinedCondition(void) const noexcept;
+  ::pasta::StmtRef CombinedConditionRef(void) const noexcept;
   ::pasta::Expr CombinedDistanceCondition(void) const noexcept;
+  ::pasta::StmtRef CombinedDistanceConditionRef(void) const noexcept;
   ::pasta::Expr CombinedEnsureUpperBound(void) const noexcept;
+  ::pasta::StmtRef CombinedEnsureUpperBoundRef(void) const noexcept;
   ::pasta::Expr CombinedInitializer(void) const noexcept;
+  ::pasta::StmtRef CombinedInitializerRef(void) const noexcept;
   ::pasta::Expr CombinedLowerBoundVariable(void) const noexcept;
+  ::pasta::StmtRef CombinedLowerBoundVariableRef(void) const noexcept;
   ::pasta::Expr CombinedNextLowerBound(void) const noexcept;
+  ::pasta::StmtRef CombinedNextLowerBoundRef(void) const noexcept;
   ::pasta::Expr CombinedNextUpperBound(void) const noexcept;
+  ::pasta::StmtRef CombinedNextUpperBoundRef(void) const noexcept;
   ::pasta::Expr CombinedParallelForInDistanceCondition(void) const noexcept;
+  ::pasta::StmtRef CombinedParallelForInDistanceConditionRef(void) const noexcept;
   ::pasta::Expr CombinedUpperBoundVariable(void) const noexcept;
+  ::pasta::StmtRef CombinedUpperBoundVariableRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Expr DistanceIncrement(void) const noexcept;
+  ::pasta::StmtRef DistanceIncrementRef(void) const noexcept;
   ::pasta::Expr EnsureUpperBound(void) const noexcept;
+  ::pasta::StmtRef EnsureUpperBoundRef(void) const noexcept;
   ::pasta::Expr Increment(void) const noexcept;
+  ::pasta::StmtRef IncrementRef(void) const noexcept;
   ::pasta::Expr Initializer(void) const noexcept;
+  ::pasta::StmtRef InitializerRef(void) const noexcept;
   ::pasta::Expr IsLastIterationVariable(void) const noexcept;
+  ::pasta::StmtRef IsLastIterationVariableRef(void) const noexcept;
   ::pasta::Expr IterationVariable(void) const noexcept;
+  ::pasta::StmtRef IterationVariableRef(void) const noexcept;
   ::pasta::Expr LastIteration(void) const noexcept;
+  ::pasta::StmtRef LastIterationRef(void) const noexcept;
   ::pasta::Expr LowerBoundVariable(void) const noexcept;
+  ::pasta::StmtRef LowerBoundVariableRef(void) const noexcept;
   ::pasta::Expr NextLowerBound(void) const noexcept;
+  ::pasta::StmtRef NextLowerBoundRef(void) const noexcept;
   ::pasta::Expr NextUpperBound(void) const noexcept;
+  ::pasta::StmtRef NextUpperBoundRef(void) const noexcept;
   ::pasta::Expr NumIterations(void) const noexcept;
+  ::pasta::StmtRef NumIterationsRef(void) const noexcept;
   ::pasta::Expr PreCondition(void) const noexcept;
+  ::pasta::StmtRef PreConditionRef(void) const noexcept;
   ::pasta::Stmt PreInitializers(void) const noexcept;
+  ::pasta::StmtRef PreInitializersRef(void) const noexcept;
   ::pasta::Expr PrevEnsureUpperBound(void) const noexcept;
+  ::pasta::StmtRef PrevEnsureUpperBoundRef(void) const noexcept;
   ::pasta::Expr PrevLowerBoundVariable(void) const noexcept;
+  ::pasta::StmtRef PrevLowerBoundVariableRef(void) const noexcept;
   ::pasta::Expr PrevUpperBoundVariable(void) const noexcept;
+  ::pasta::StmtRef PrevUpperBoundVariableRef(void) const noexcept;
   ::pasta::Expr StrideVariable(void) const noexcept;
+  ::pasta::StmtRef StrideVariableRef(void) const noexcept;
   ::pasta::Expr UpperBoundVariable(void) const noexcept;
+  ::pasta::StmtRef UpperBoundVariableRef(void) const noexcept;
   std::vector<::pasta::Expr> Initializers(void) const noexcept;
   std::vector<::pasta::Expr> PrivateCounters(void) const noexcept;
   std::vector<::pasta::Expr> Updates(void) const noexcept;
@@ -2616,7 +2965,9 @@ class OMPLoopTransformationDirective : public OMPLoopBasedDirective {
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopTransformationDirective, OMPUnrollDirective)
   uint32_t NumAssociatedLoops(void) const noexcept;
   ::pasta::Stmt PreInitializers(void) const noexcept;
+  ::pasta::StmtRef PreInitializersRef(void) const noexcept;
   ::pasta::Stmt TransformedStatement(void) const noexcept;
+  ::pasta::StmtRef TransformedStatementRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPLoopTransformationDirective)
@@ -2726,6 +3077,7 @@ class OMPMetaDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMetaDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMetaDirective)
   ::pasta::Stmt IfStatement(void) const noexcept;
+  ::pasta::StmtRef IfStatementRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMetaDirective)
@@ -2755,6 +3107,7 @@ class OMPParallelDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -2773,6 +3126,7 @@ class OMPParallelForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -2821,6 +3175,7 @@ class OMPParallelMaskedDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMaskedDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMaskedDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMaskedDirective)
@@ -2869,6 +3224,7 @@ class OMPParallelMasterDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMasterDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMasterDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMasterDirective)
@@ -2917,6 +3273,7 @@ class OMPParallelSectionsDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelSectionsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelSectionsDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -2962,6 +3319,7 @@ class OMPSectionsDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPSectionsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPSectionsDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -3064,6 +3422,7 @@ class OMPTargetParallelDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetParallelDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetParallelDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -3082,6 +3441,7 @@ class OMPTargetParallelForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetParallelForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -3178,6 +3538,7 @@ class OMPTargetTeamsDistributeParallelForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsDistributeParallelForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -3304,6 +3665,7 @@ class OMPTaskgroupDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskgroupDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskgroupDirective)
   ::pasta::Expr ReductionReference(void) const noexcept;
+  ::pasta::StmtRef ReductionReferenceRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskgroupDirective)
@@ -3379,6 +3741,7 @@ class OMPTeamsDistributeParallelForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsDistributeParallelForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -3445,7 +3808,9 @@ class OMPTileDirective : public OMPLoopTransformationDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopTransformationDirective, OMPTileDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTileDirective)
   ::pasta::Stmt PreInitializers(void) const noexcept;
+  ::pasta::StmtRef PreInitializersRef(void) const noexcept;
   ::pasta::Stmt TransformedStatement(void) const noexcept;
+  ::pasta::StmtRef TransformedStatementRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTileDirective)
@@ -3463,7 +3828,9 @@ class OMPUnrollDirective : public OMPLoopTransformationDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopTransformationDirective, OMPUnrollDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPUnrollDirective)
   ::pasta::Stmt PreInitializers(void) const noexcept;
+  ::pasta::StmtRef PreInitializersRef(void) const noexcept;
   ::pasta::Stmt TransformedStatement(void) const noexcept;
+  ::pasta::StmtRef TransformedStatementRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPUnrollDirective)
@@ -3481,12 +3848,16 @@ class ObjCArrayLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCArrayLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::ObjCMethodDecl ArrayWithObjectsMethod(void) const noexcept;
+  ::pasta::DeclRef ArrayWithObjectsMethodRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // Element: (const clang::Expr *)
   // Elements: (const clang::Expr *const *)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumElements(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   std::vector<::pasta::Expr> Elements(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCArrayLiteral)
@@ -3501,11 +3872,17 @@ class ObjCAtCatchStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtCatchStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtCatchToken(void) const noexcept;
+  ::pasta::TokenRef AtCatchTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt CatchBody(void) const noexcept;
+  ::pasta::StmtRef CatchBodyRef(void) const noexcept;
   ::pasta::VarDecl CatchParameterDeclaration(void) const noexcept;
+  ::pasta::DeclRef CatchParameterDeclarationRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool HasEllipsis(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtCatchStmt)
@@ -3520,9 +3897,13 @@ class ObjCAtFinallyStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtFinallyStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtFinallyToken(void) const noexcept;
+  ::pasta::TokenRef AtFinallyTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt FinallyBody(void) const noexcept;
+  ::pasta::StmtRef FinallyBodyRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtFinallyStmt)
 };
@@ -3536,10 +3917,15 @@ class ObjCAtSynchronizedStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtSynchronizedStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtSynchronizedToken(void) const noexcept;
+  ::pasta::TokenRef AtSynchronizedTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::CompoundStmt SynchBody(void) const noexcept;
+  ::pasta::StmtRef SynchBodyRef(void) const noexcept;
   ::pasta::Expr SynchExpression(void) const noexcept;
+  ::pasta::StmtRef SynchExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtSynchronizedStmt)
 };
@@ -3553,9 +3939,13 @@ class ObjCAtThrowStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtThrowStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr ThrowExpression(void) const noexcept;
+  ::pasta::StmtRef ThrowExpressionRef(void) const noexcept;
   ::pasta::Token ThrowToken(void) const noexcept;
+  ::pasta::TokenRef ThrowTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtThrowStmt)
 };
@@ -3570,12 +3960,17 @@ class ObjCAtTryStmt : public Stmt {
   // CatchStatements: (llvm::iterator_range<clang::Stmt::CastIterator<clang::ObjCAtCatchStmt, const clang::ObjCAtCatchStmt *const, const clang::Stmt *const>>)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtTryToken(void) const noexcept;
+  ::pasta::TokenRef AtTryTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // CatchStatement: (const clang::ObjCAtCatchStmt *)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::ObjCAtFinallyStmt FinallyStatement(void) const noexcept;
+  ::pasta::StmtRef FinallyStatementRef(void) const noexcept;
   uint32_t NumCatchStatements(void) const noexcept;
   ::pasta::Stmt TryBody(void) const noexcept;
+  ::pasta::StmtRef TryBodyRef(void) const noexcept;
   std::vector<::pasta::ObjCAtCatchStmt> CatchStatements(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtTryStmt)
@@ -3590,9 +3985,13 @@ class ObjCAutoreleasePoolStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAutoreleasePoolStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Stmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAutoreleasePoolStmt)
 };
@@ -3609,8 +4008,11 @@ class ObjCAvailabilityCheckExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCAvailabilityCheckExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   // Version: (llvm::VersionTuple)
   bool HasVersion(void) const noexcept;
  protected:
@@ -3629,8 +4031,11 @@ class ObjCBoolLiteralExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCBoolLiteralExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   bool Value(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBoolLiteralExpr)
@@ -3648,11 +4053,17 @@ class ObjCBoxedExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCBoxedExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ObjCMethodDecl BoxingMethod(void) const noexcept;
+  ::pasta::DeclRef BoxingMethodRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   bool IsExpressibleAsConstantInitializer(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBoxedExpr)
@@ -3670,11 +4081,15 @@ class ObjCDictionaryLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCDictionaryLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ObjCMethodDecl DictionaryWithObjectsMethod(void) const noexcept;
+  ::pasta::DeclRef DictionaryWithObjectsMethodRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // KeyValueElement: (clang::ObjCDictionaryElement)
   uint32_t NumElements(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCDictionaryLiteral)
 };
@@ -3691,10 +4106,15 @@ class ObjCEncodeExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCEncodeExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Type EncodedType(void) const noexcept;
+  ::pasta::TypeRef EncodedTypeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCEncodeExpr)
 };
@@ -3708,12 +4128,19 @@ class ObjCForCollectionStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCForCollectionStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Expr Collection(void) const noexcept;
+  ::pasta::StmtRef CollectionRef(void) const noexcept;
   ::pasta::Stmt Element(void) const noexcept;
+  ::pasta::StmtRef ElementRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ForToken(void) const noexcept;
+  ::pasta::TokenRef ForTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCForCollectionStmt)
 };
@@ -3730,9 +4157,13 @@ class ObjCIndirectCopyRestoreExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIndirectCopyRestoreExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   bool ShouldCopy(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCIndirectCopyRestoreExpr)
@@ -3750,12 +4181,19 @@ class ObjCIsaExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIsaExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BaseTokenEnd(void) const noexcept;
+  ::pasta::TokenRef BaseTokenEndRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Token IsaMemberToken(void) const noexcept;
+  ::pasta::TokenRef IsaMemberTokenRef(void) const noexcept;
   ::pasta::Token OperationToken(void) const noexcept;
+  ::pasta::TokenRef OperationTokenRef(void) const noexcept;
   bool IsArrow(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCIsaExpr)
@@ -3773,11 +4211,17 @@ class ObjCIvarRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIvarRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ObjCIvarDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   ::pasta::Token OperationToken(void) const noexcept;
+  ::pasta::TokenRef OperationTokenRef(void) const noexcept;
   bool IsArrow(void) const noexcept;
   bool IsFreeInstanceVariable(void) const noexcept;
  protected:
@@ -3799,26 +4243,39 @@ class ObjCMessageExpr : public Expr {
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Type CallReturnType(void) const noexcept;
   ::pasta::Type ClassReceiver(void) const noexcept;
+  ::pasta::TypeRef ClassReceiverRef(void) const noexcept;
   ::pasta::Type ClassReceiverType(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr InstanceReceiver(void) const noexcept;
+  ::pasta::StmtRef InstanceReceiverRef(void) const noexcept;
   ::pasta::Token LeftToken(void) const noexcept;
+  ::pasta::TokenRef LeftTokenRef(void) const noexcept;
   ::pasta::ObjCMethodDecl MethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef MethodDeclarationRef(void) const noexcept;
   enum ObjCMethodFamily MethodFamily(void) const noexcept;
   uint32_t NumArguments(void) const noexcept;
   uint32_t NumSelectorTokens(void) const noexcept;
   ::pasta::ObjCInterfaceDecl ReceiverInterface(void) const noexcept;
+  ::pasta::DeclRef ReceiverInterfaceRef(void) const noexcept;
   enum ObjCMessageExprReceiverKind ReceiverKind(void) const noexcept;
   ::pasta::TokenRange ReceiverRange(void) const noexcept;
+  ::pasta::TokenRefRange ReceiverRangeRef(void) const noexcept;
   ::pasta::Type ReceiverType(void) const noexcept;
+  ::pasta::TypeRef ReceiverTypeRef(void) const noexcept;
   ::pasta::Token RightToken(void) const noexcept;
+  ::pasta::TokenRef RightTokenRef(void) const noexcept;
   // Selector: (clang::Selector)
   // SelectorToken: (clang::SourceLocation)
   ::pasta::Token SelectorStartToken(void) const noexcept;
+  ::pasta::TokenRef SelectorStartTokenRef(void) const noexcept;
   ::pasta::Token SuperToken(void) const noexcept;
+  ::pasta::TokenRef SuperTokenRef(void) const noexcept;
   ::pasta::Type SuperType(void) const noexcept;
+  ::pasta::TypeRef SuperTypeRef(void) const noexcept;
   bool IsClassMessage(void) const noexcept;
   bool IsDelegateInitializerCall(void) const noexcept;
   bool IsImplicit(void) const noexcept;
@@ -3840,18 +4297,28 @@ class ObjCPropertyRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCPropertyRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl ClassReceiver(void) const noexcept;
+  ::pasta::DeclRef ClassReceiverRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::ObjCPropertyDecl ExplicitProperty(void) const noexcept;
+  ::pasta::DeclRef ExplicitPropertyRef(void) const noexcept;
   // GetterSelector: (clang::Selector)
   ::pasta::ObjCMethodDecl ImplicitPropertyGetter(void) const noexcept;
+  ::pasta::DeclRef ImplicitPropertyGetterRef(void) const noexcept;
   ::pasta::ObjCMethodDecl ImplicitPropertySetter(void) const noexcept;
+  ::pasta::DeclRef ImplicitPropertySetterRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   ::pasta::Token ReceiverToken(void) const noexcept;
+  ::pasta::TokenRef ReceiverTokenRef(void) const noexcept;
   ::pasta::Type ReceiverType(void) const noexcept;
   // SetterSelector: (clang::Selector)
   ::pasta::Type SuperReceiverType(void) const noexcept;
+  ::pasta::TypeRef SuperReceiverTypeRef(void) const noexcept;
   bool IsClassReceiver(void) const noexcept;
   bool IsExplicitProperty(void) const noexcept;
   bool IsImplicitProperty(void) const noexcept;
@@ -3875,11 +4342,17 @@ class ObjCProtocolExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCProtocolExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::ObjCProtocolDecl Protocol(void) const noexcept;
+  ::pasta::DeclRef ProtocolRef(void) const noexcept;
   ::pasta::Token ProtocolIdToken(void) const noexcept;
+  ::pasta::TokenRef ProtocolIdTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCProtocolExpr)
 };
@@ -3896,10 +4369,14 @@ class ObjCSelectorExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCSelectorExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumArguments(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   // Selector: (clang::Selector)
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCSelectorExpr)
@@ -3917,9 +4394,13 @@ class ObjCStringLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCStringLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AtToken(void) const noexcept;
+  ::pasta::TokenRef AtTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::StringLiteral String(void) const noexcept;
+  ::pasta::StmtRef StringRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCStringLiteral)
 };
@@ -3936,11 +4417,17 @@ class ObjCSubscriptRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCSubscriptRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::ObjCMethodDecl AtIndexMethodDeclaration(void) const noexcept;
+  ::pasta::DeclRef AtIndexMethodDeclarationRef(void) const noexcept;
   ::pasta::Expr BaseExpression(void) const noexcept;
+  ::pasta::StmtRef BaseExpressionRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr KeyExpression(void) const noexcept;
+  ::pasta::StmtRef KeyExpressionRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   bool IsArraySubscriptReferenceExpression(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCSubscriptRefExpr)
@@ -3958,13 +4445,17 @@ class OffsetOfExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OffsetOfExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // Component: (const clang::OffsetOfNode &)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // IndexExpression: (const clang::Expr *)
   uint32_t NumComponents(void) const noexcept;
   uint32_t NumExpressions(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   // !!! Component getNumComponents getComponent (empty ret type = (const clang::OffsetOfNode &))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OffsetOfExpr)
@@ -3982,10 +4473,15 @@ class OpaqueValueExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OpaqueValueExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   ::pasta::Expr SourceExpression(void) const noexcept;
+  ::pasta::StmtRef SourceExpressionRef(void) const noexcept;
   bool IsUnique(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OpaqueValueExpr)
@@ -4005,17 +4501,22 @@ class OverloadExpr : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(OverloadExpr, UnresolvedMemberExpr)
   // Declarations: (llvm::iterator_range<clang::UnresolvedSetIterator>)
   ::pasta::Token LAngleToken(void) const noexcept;
+  ::pasta::TokenRef LAngleTokenRef(void) const noexcept;
   // Name: (clang::DeclarationName)
   // NameInfo: (const clang::DeclarationNameInfo &)
   ::pasta::Token NameToken(void) const noexcept;
+  ::pasta::TokenRef NameTokenRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> NamingClass(void) const noexcept;
+  std::optional<::pasta::DeclRef> NamingClassRef(void) const noexcept;
   uint32_t NumDeclarations(void) const noexcept;
   uint32_t NumTemplateArguments(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token RAngleToken(void) const noexcept;
+  ::pasta::TokenRef RAngleTokenRef(void) const noexcept;
   // TemplateArguments: (const clang::TemplateArgumentLoc *)
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   bool HasExplicitTemplateArguments(void) const noexcept;
   bool HasTemplateKeyword(void) const noexcept;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
@@ -4035,10 +4536,14 @@ class PackExpansionExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PackExpansionExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<unsigned> NumExpansions(void) const noexcept;
   ::pasta::Expr Pattern(void) const noexcept;
+  ::pasta::StmtRef PatternRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(PackExpansionExpr)
 };
@@ -4055,10 +4560,15 @@ class ParenExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ParenExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ParenExpr)
 };
@@ -4075,11 +4585,15 @@ class ParenListExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ParenListExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Expression: (const clang::Expr *)
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   uint32_t NumExpressions(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   std::vector<::pasta::Expr> Expressions(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ParenListExpr)
@@ -4097,11 +4611,15 @@ class PredefinedExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PredefinedExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::StringLiteral FunctionName(void) const noexcept;
+  ::pasta::StmtRef FunctionNameRef(void) const noexcept;
   enum PredefinedExprIdentKind IdentifierKind(void) const noexcept;
   std::string_view IdentifierKindName(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(PredefinedExpr)
 };
@@ -4118,13 +4636,18 @@ class PseudoObjectExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PseudoObjectExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   uint32_t NumSemanticExpressions(void) const noexcept;
   ::pasta::Expr ResultExpression(void) const noexcept;
+  ::pasta::StmtRef ResultExpressionRef(void) const noexcept;
   uint32_t ResultExpressionIndex(void) const noexcept;
   // SemanticExpression: (const clang::Expr *)
   ::pasta::Expr SyntacticForm(void) const noexcept;
+  ::pasta::StmtRef SyntacticFormRef(void) const noexcept;
   std::vector<::pasta::Expr> Semantics(void) const noexcept;
   std::vector<::pasta::Expr> SemanticExpressions(void) const noexcept;
  protected:
@@ -4142,7 +4665,9 @@ class RecoveryExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, RecoveryExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, RecoveryExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::vector<::pasta::Expr> SubExpressions(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(RecoveryExpr)
@@ -4160,12 +4685,17 @@ class RequiresExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, RequiresExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::RequiresExprBodyDecl Body(void) const noexcept;
+  ::pasta::DeclRef BodyRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::vector<::pasta::ParmVarDecl> LocalParameters(void) const noexcept;
   ::pasta::Token RBraceToken(void) const noexcept;
+  ::pasta::TokenRef RBraceTokenRef(void) const noexcept;
   // Requirements: (llvm::ArrayRef<clang::concepts::Requirement *>)
   ::pasta::Token RequiresKeywordToken(void) const noexcept;
+  ::pasta::TokenRef RequiresKeywordTokenRef(void) const noexcept;
   bool IsSatisfied(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(RequiresExpr)
@@ -4180,10 +4710,15 @@ class ReturnStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ReturnStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::VarDecl> NRVOCandidate(void) const noexcept;
+  std::optional<::pasta::DeclRef> NRVOCandidateRef(void) const noexcept;
   std::optional<::pasta::Expr> ReturnValue(void) const noexcept;
+  std::optional<::pasta::StmtRef> ReturnValueRef(void) const noexcept;
   ::pasta::Token ReturnToken(void) const noexcept;
+  ::pasta::TokenRef ReturnTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ReturnStmt)
 };
@@ -4197,10 +4732,15 @@ class SEHExceptStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHExceptStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::CompoundStmt Block(void) const noexcept;
+  ::pasta::StmtRef BlockRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExceptToken(void) const noexcept;
+  ::pasta::TokenRef ExceptTokenRef(void) const noexcept;
   ::pasta::Expr FilterExpression(void) const noexcept;
+  ::pasta::StmtRef FilterExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHExceptStmt)
 };
@@ -4214,9 +4754,13 @@ class SEHFinallyStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHFinallyStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::CompoundStmt Block(void) const noexcept;
+  ::pasta::StmtRef BlockRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token FinallyToken(void) const noexcept;
+  ::pasta::TokenRef FinallyTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHFinallyStmt)
 };
@@ -4230,8 +4774,11 @@ class SEHLeaveStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHLeaveStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LeaveToken(void) const noexcept;
+  ::pasta::TokenRef LeaveTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHLeaveStmt)
 };
@@ -4245,13 +4792,20 @@ class SEHTryStmt : public Stmt {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHTryStmt)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::SEHExceptStmt ExceptHandler(void) const noexcept;
+  ::pasta::StmtRef ExceptHandlerRef(void) const noexcept;
   ::pasta::SEHFinallyStmt FinallyHandler(void) const noexcept;
+  ::pasta::StmtRef FinallyHandlerRef(void) const noexcept;
   ::pasta::Stmt Handler(void) const noexcept;
+  ::pasta::StmtRef HandlerRef(void) const noexcept;
   bool IsCXXTry(void) const noexcept;
   ::pasta::CompoundStmt TryBlock(void) const noexcept;
+  ::pasta::StmtRef TryBlockRef(void) const noexcept;
   ::pasta::Token TryToken(void) const noexcept;
+  ::pasta::TokenRef TryTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHTryStmt)
 };
@@ -4269,10 +4823,15 @@ class SYCLUniqueStableNameExpr : public Expr {
   std::string ComputeName(void) const noexcept;
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SYCLUniqueStableNameExpr)
 };
@@ -4289,11 +4848,15 @@ class ShuffleVectorExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ShuffleVectorExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Expression: (const clang::Expr *)
   uint32_t NumSubExpressions(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   // ShuffleMaskIndex: (llvm::APSInt)
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ShuffleVectorExpr)
@@ -4311,13 +4874,19 @@ class SizeOfPackExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SizeOfPackExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::NamedDecl Pack(void) const noexcept;
+  ::pasta::DeclRef PackRef(void) const noexcept;
   std::optional<uint32_t> PackLength(void) const noexcept;
   ::pasta::Token PackToken(void) const noexcept;
+  ::pasta::TokenRef PackTokenRef(void) const noexcept;
   std::optional<std::vector<::pasta::TemplateArgument>> PartialArguments(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsPartiallySubstituted(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SizeOfPackExpr)
@@ -4336,10 +4905,13 @@ class SourceLocExpr : public Expr {
   // EvaluateInContext: (clang::APValue)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::string_view BuiltinString(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum SourceLocExprIdentKind IdentifierKind(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   ::pasta::DeclContext ParentContext(void) const noexcept;
   bool IsIntType(void) const noexcept;
  protected:
@@ -4358,10 +4930,15 @@ class StmtExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, StmtExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::CompoundStmt SubStatement(void) const noexcept;
+  ::pasta::StmtRef SubStatementRef(void) const noexcept;
   uint32_t TemplateDepth(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(StmtExpr)
@@ -4381,11 +4958,13 @@ class StringLiteral : public Expr {
   std::optional<bool> ContainsNonAscii(void) const noexcept;
   std::optional<bool> ContainsNonAsciiOrNull(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   uint32_t ByteLength(void) const noexcept;
   std::string_view Bytes(void) const noexcept;
   uint32_t CharacterByteWidth(void) const noexcept;
   // CodeUnit: (unsigned int)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum StringLiteralStringKind Kind(void) const noexcept;
   uint32_t Length(void) const noexcept;
   // TokenOfByte: (clang::SourceLocation)
@@ -4414,11 +4993,16 @@ class SubstNonTypeTemplateParmExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SubstNonTypeTemplateParmExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token NameToken(void) const noexcept;
+  ::pasta::TokenRef NameTokenRef(void) const noexcept;
   ::pasta::NonTypeTemplateParmDecl Parameter(void) const noexcept;
+  ::pasta::DeclRef ParameterRef(void) const noexcept;
   ::pasta::Type ParameterType(void) const noexcept;
   ::pasta::Expr Replacement(void) const noexcept;
+  ::pasta::StmtRef ReplacementRef(void) const noexcept;
   bool IsReferenceParameter(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SubstNonTypeTemplateParmExpr)
@@ -4437,9 +5021,13 @@ class SubstNonTypeTemplateParmPackExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // ArgumentPack: (clang::TemplateArgument)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::NonTypeTemplateParmDecl ParameterPack(void) const noexcept;
+  ::pasta::DeclRef ParameterPackRef(void) const noexcept;
   ::pasta::Token ParameterPackToken(void) const noexcept;
+  ::pasta::TokenRef ParameterPackTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SubstNonTypeTemplateParmPackExpr)
 };
@@ -4458,7 +5046,9 @@ class TypeTraitExpr : public Expr {
   // Argument: (clang::TypeSourceInfo *)
   // Arguments: (llvm::ArrayRef<clang::TypeSourceInfo *>)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumArguments(void) const noexcept;
   enum TypeTrait Trait(void) const noexcept;
   std::optional<bool> Value(void) const noexcept;
@@ -4479,7 +5069,9 @@ class TypoExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, TypoExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(TypoExpr)
 };
@@ -4496,13 +5088,20 @@ class UnaryExprOrTypeTraitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnaryExprOrTypeTraitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   std::optional<::pasta::Expr> ArgumentExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> ArgumentExpressionRef(void) const noexcept;
   std::optional<::pasta::Type> ArgumentType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ArgumentTypeRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum UnaryExprOrTypeTrait Kind(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Type TypeOfArgument(void) const noexcept;
+  ::pasta::TypeRef TypeOfArgumentRef(void) const noexcept;
   bool IsArgumentType(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UnaryExprOrTypeTraitExpr)
@@ -4521,14 +5120,19 @@ class UnaryOperator : public Expr {
   bool CanOverflow(void) const noexcept;
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   // FPFeaturesInEffect: (clang::FPOptions)
   // FPOptionsOverride: (clang::FPOptionsOverride)
   enum UnaryOperatorKind Opcode(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   // StoredFPFeatures: (clang::FPOptionsOverride)
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   bool HasStoredFPFeatures(void) const noexcept;
   bool IsArithmeticOperation(void) const noexcept;
   bool IsDecrementOperation(void) const noexcept;
@@ -4555,8 +5159,11 @@ class UnresolvedLookupExpr : public OverloadExpr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnresolvedLookupExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> NamingClass(void) const noexcept;
+  std::optional<::pasta::DeclRef> NamingClassRef(void) const noexcept;
   bool IsOverloaded(void) const noexcept;
   bool RequiresADL(void) const noexcept;
  protected:
@@ -4576,15 +5183,23 @@ class UnresolvedMemberExpr : public OverloadExpr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnresolvedMemberExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Type BaseType(void) const noexcept;
+  ::pasta::TypeRef BaseTypeRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Token MemberToken(void) const noexcept;
+  ::pasta::TokenRef MemberTokenRef(void) const noexcept;
   // MemberName: (clang::DeclarationName)
   // MemberNameInfo: (const clang::DeclarationNameInfo &)
   ::pasta::CXXRecordDecl NamingClass(void) const noexcept;
+  ::pasta::DeclRef NamingClassRef(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   bool HasUnresolvedUsing(void) const noexcept;
   bool IsArrow(void) const noexcept;
   bool IsImplicitAccess(void) const noexcept;
@@ -4604,10 +5219,15 @@ class VAArgExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, VAArgExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   ::pasta::Type WrittenType(void) const noexcept;
   bool IsMicrosoftABI(void) const noexcept;
  protected:
@@ -4627,10 +5247,15 @@ class AbstractConditionalOperator : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(AbstractConditionalOperator, BinaryConditionalOperator)
   PASTA_DECLARE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   ::pasta::Token ColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonTokenRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Expr FalseExpression(void) const noexcept;
+  ::pasta::StmtRef FalseExpressionRef(void) const noexcept;
   ::pasta::Token QuestionToken(void) const noexcept;
+  ::pasta::TokenRef QuestionTokenRef(void) const noexcept;
   ::pasta::Expr TrueExpression(void) const noexcept;
+  ::pasta::StmtRef TrueExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AbstractConditionalOperator)
 };
@@ -4647,10 +5272,15 @@ class AddrLabelExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AddrLabelExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token AmpAmpToken(void) const noexcept;
+  ::pasta::TokenRef AmpAmpTokenRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::LabelDecl Label(void) const noexcept;
+  ::pasta::DeclRef LabelRef(void) const noexcept;
   ::pasta::Token LabelToken(void) const noexcept;
+  ::pasta::TokenRef LabelTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AddrLabelExpr)
 };
@@ -4667,7 +5297,9 @@ class ArrayInitIndexExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArrayInitIndexExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArrayInitIndexExpr)
 };
@@ -4685,9 +5317,13 @@ class ArrayInitLoopExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   llvm::APInt ArraySize(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::OpaqueValueExpr CommonExpression(void) const noexcept;
+  ::pasta::StmtRef CommonExpressionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArrayInitLoopExpr)
 };
@@ -4704,13 +5340,21 @@ class ArraySubscriptExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArraySubscriptExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr Index(void) const noexcept;
+  ::pasta::StmtRef IndexRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArraySubscriptExpr)
 };
@@ -4727,9 +5371,13 @@ class ArrayTypeTraitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArrayTypeTraitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr DimensionExpression(void) const noexcept;
+  ::pasta::StmtRef DimensionExpressionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Type QueriedType(void) const noexcept;
+  ::pasta::TypeRef QueriedTypeRef(void) const noexcept;
   enum ArrayTypeTrait Trait(void) const noexcept;
   uint64_t Value(void) const noexcept;
  protected:
@@ -4748,10 +5396,15 @@ class AsTypeExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AsTypeExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr SrcExpression(void) const noexcept;
+  ::pasta::StmtRef SrcExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AsTypeExpr)
 };
@@ -4768,21 +5421,33 @@ class AtomicExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AtomicExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumSubExpressions(void) const noexcept;
   enum AtomicExprAtomicOp Operation(void) const noexcept;
   ::pasta::Expr Order(void) const noexcept;
+  ::pasta::StmtRef OrderRef(void) const noexcept;
   std::optional<::pasta::Expr> OrderFail(void) const noexcept;
+  std::optional<::pasta::StmtRef> OrderFailRef(void) const noexcept;
   ::pasta::Expr Pointer(void) const noexcept;
+  ::pasta::StmtRef PointerRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> Scope(void) const noexcept;
+  std::optional<::pasta::StmtRef> ScopeRef(void) const noexcept;
   // ScopeModel: (std::unique_ptr<clang::AtomicScopeModel, std::default_delete<clang::AtomicScopeModel>>)
   // SubExpressions: (const clang::Expr *const *)
   std::optional<::pasta::Expr> Value1(void) const noexcept;
+  std::optional<::pasta::StmtRef> Value1Ref(void) const noexcept;
   std::optional<::pasta::Expr> Value2(void) const noexcept;
+  std::optional<::pasta::StmtRef> Value2Ref(void) const noexcept;
   ::pasta::Type ValueType(void) const noexcept;
+  ::pasta::TypeRef ValueTypeRef(void) const noexcept;
   std::optional<::pasta::Expr> Weak(void) const noexcept;
+  std::optional<::pasta::StmtRef> WeakRef(void) const noexcept;
   bool IsCmpXChg(void) const noexcept;
   bool IsOpenCL(void) const noexcept;
   bool IsVolatile(void) const noexcept;
@@ -4804,12 +5469,19 @@ class BinaryConditionalOperator : public AbstractConditionalOperator {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BinaryConditionalOperator)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr Common(void) const noexcept;
+  ::pasta::StmtRef CommonRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr FalseExpression(void) const noexcept;
+  ::pasta::StmtRef FalseExpressionRef(void) const noexcept;
   ::pasta::OpaqueValueExpr OpaqueValue(void) const noexcept;
+  ::pasta::StmtRef OpaqueValueRef(void) const noexcept;
   ::pasta::Expr TrueExpression(void) const noexcept;
+  ::pasta::StmtRef TrueExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BinaryConditionalOperator)
 };
@@ -4827,15 +5499,21 @@ class BinaryOperator : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(BinaryOperator, CompoundAssignOperator)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   // FPFeatures: (clang::FPOptionsOverride)
   // FPFeaturesInEffect: (clang::FPOptions)
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   enum BinaryOperatorKind Opcode(void) const noexcept;
   std::string_view OpcodeString(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
   // StoredFPFeatures: (clang::FPOptionsOverride)
   bool HasStoredFPFeatures(void) const noexcept;
   bool IsAdditiveOperation(void) const noexcept;
@@ -4869,11 +5547,17 @@ class BlockExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BlockExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::BlockDecl BlockDeclaration(void) const noexcept;
+  ::pasta::DeclRef BlockDeclarationRef(void) const noexcept;
   ::pasta::Stmt Body(void) const noexcept;
+  ::pasta::StmtRef BodyRef(void) const noexcept;
   ::pasta::Token CaretToken(void) const noexcept;
+  ::pasta::TokenRef CaretTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::FunctionProtoType FunctionType(void) const noexcept;
+  ::pasta::TypeRef FunctionTypeRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BlockExpr)
 };
@@ -4890,8 +5574,11 @@ class CXXBindTemporaryExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXBindTemporaryExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   // Temporary: (const clang::CXXTemporary *)
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXBindTemporaryExpr)
@@ -4909,8 +5596,11 @@ class CXXBoolLiteralExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXBoolLiteralExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   bool Value(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXBoolLiteralExpr)
@@ -4932,12 +5622,17 @@ class CXXConstructExpr : public Expr {
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   enum CXXConstructExprConstructionKind ConstructionKind(void) const noexcept;
   ::pasta::CXXConstructorDecl Constructor(void) const noexcept;
+  ::pasta::DeclRef ConstructorRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   uint32_t NumArguments(void) const noexcept;
   ::pasta::TokenRange ParenthesisOrBraceRange(void) const noexcept;
+  ::pasta::TokenRefRange ParenthesisOrBraceRangeRef(void) const noexcept;
   bool HadMultipleCandidates(void) const noexcept;
   bool IsElidable(void) const noexcept;
   bool IsListInitialization(void) const noexcept;
@@ -4959,12 +5654,18 @@ class CXXDefaultArgExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDefaultArgExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr Expression(void) const noexcept;
+  ::pasta::StmtRef ExpressionRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::ParmVarDecl Parameter(void) const noexcept;
+  ::pasta::DeclRef ParameterRef(void) const noexcept;
   ::pasta::DeclContext UsedContext(void) const noexcept;
   ::pasta::Token UsedToken(void) const noexcept;
+  ::pasta::TokenRef UsedTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDefaultArgExpr)
 };
@@ -4981,11 +5682,16 @@ class CXXDefaultInitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDefaultInitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> Expression(void) const noexcept;
+  std::optional<::pasta::StmtRef> ExpressionRef(void) const noexcept;
   ::pasta::FieldDecl Field(void) const noexcept;
+  ::pasta::DeclRef FieldRef(void) const noexcept;
   ::pasta::DeclContext UsedContext(void) const noexcept;
   ::pasta::Token UsedToken(void) const noexcept;
+  ::pasta::TokenRef UsedTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDefaultInitExpr)
 };
@@ -5003,10 +5709,15 @@ class CXXDeleteExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   bool DoesUsualArrayDeleteWantSize(void) const noexcept;
   ::pasta::Expr Argument(void) const noexcept;
+  ::pasta::StmtRef ArgumentRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Type DestroyedType(void) const noexcept;
+  ::pasta::TypeRef DestroyedTypeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::FunctionDecl OperatorDelete(void) const noexcept;
+  ::pasta::DeclRef OperatorDeleteRef(void) const noexcept;
   bool IsArrayForm(void) const noexcept;
   bool IsArrayFormAsWritten(void) const noexcept;
   bool IsGlobalDelete(void) const noexcept;
@@ -5026,21 +5737,31 @@ class CXXDependentScopeMemberExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDependentScopeMemberExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   std::optional<::pasta::Expr> Base(void) const noexcept;
+  std::optional<::pasta::StmtRef> BaseRef(void) const noexcept;
   ::pasta::Type BaseType(void) const noexcept;
+  ::pasta::TypeRef BaseTypeRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::NamedDecl> FirstQualifierFoundInScope(void) const noexcept;
+  std::optional<::pasta::DeclRef> FirstQualifierFoundInScopeRef(void) const noexcept;
   ::pasta::Token LAngleToken(void) const noexcept;
+  ::pasta::TokenRef LAngleTokenRef(void) const noexcept;
   // Member: (clang::DeclarationName)
   ::pasta::Token MemberToken(void) const noexcept;
+  ::pasta::TokenRef MemberTokenRef(void) const noexcept;
   // MemberNameInfo: (const clang::DeclarationNameInfo &)
   uint32_t NumTemplateArguments(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token RAngleToken(void) const noexcept;
+  ::pasta::TokenRef RAngleTokenRef(void) const noexcept;
   // TemplateArguments: (const clang::TemplateArgumentLoc *)
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   bool HasExplicitTemplateArguments(void) const noexcept;
   bool HasTemplateKeyword(void) const noexcept;
   bool IsArrow(void) const noexcept;
@@ -5062,17 +5783,27 @@ class CXXFoldExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXFoldExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::UnresolvedLookupExpr Callee(void) const noexcept;
+  ::pasta::StmtRef CalleeRef(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr Initializer(void) const noexcept;
+  ::pasta::StmtRef InitializerRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   std::optional<unsigned> NumExpansions(void) const noexcept;
   enum BinaryOperatorKind Operator(void) const noexcept;
   ::pasta::Expr Pattern(void) const noexcept;
+  ::pasta::StmtRef PatternRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsLeftFold(void) const noexcept;
   bool IsRightFold(void) const noexcept;
  protected:
@@ -5092,10 +5823,14 @@ class CXXInheritedCtorInitExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   bool ConstructsVirtualBase(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   enum CXXConstructExprConstructionKind ConstructionKind(void) const noexcept;
   ::pasta::CXXConstructorDecl Constructor(void) const noexcept;
+  ::pasta::DeclRef ConstructorRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   bool InheritedFromVirtualBase(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXInheritedCtorInitExpr)
@@ -5114,19 +5849,29 @@ class CXXNewExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   bool DoesUsualArrayDeleteWantSize(void) const noexcept;
   ::pasta::Type AllocatedType(void) const noexcept;
+  ::pasta::TypeRef AllocatedTypeRef(void) const noexcept;
   std::optional<::pasta::Expr> ArraySize(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::optional<::pasta::CXXConstructExpr> ConstructExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> ConstructExpressionRef(void) const noexcept;
   ::pasta::TokenRange DirectInitializerRange(void) const noexcept;
+  ::pasta::TokenRefRange DirectInitializerRangeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum CXXNewExprInitializationStyle InitializationStyle(void) const noexcept;
   std::optional<::pasta::Expr> Initializer(void) const noexcept;
+  std::optional<::pasta::StmtRef> InitializerRef(void) const noexcept;
   uint32_t NumPlacementArguments(void) const noexcept;
   ::pasta::FunctionDecl OperatorDelete(void) const noexcept;
+  ::pasta::DeclRef OperatorDeleteRef(void) const noexcept;
   ::pasta::FunctionDecl OperatorNew(void) const noexcept;
+  ::pasta::DeclRef OperatorNewRef(void) const noexcept;
   // PlacementArgument: (const clang::Expr *)
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::TokenRange TypeIdParentheses(void) const noexcept;
+  ::pasta::TokenRefRange TypeIdParenthesesRef(void) const noexcept;
   bool HasInitializer(void) const noexcept;
   bool IsArray(void) const noexcept;
   bool IsGlobalNew(void) const noexcept;
@@ -5150,9 +5895,13 @@ class CXXNoexceptExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXNoexceptExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr Operand(void) const noexcept;
+  ::pasta::StmtRef OperandRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   bool Value(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNoexceptExpr)
@@ -5170,8 +5919,11 @@ class CXXNullPtrLiteralExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXNullPtrLiteralExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNullPtrLiteralExpr)
 };
@@ -5188,17 +5940,25 @@ class CXXPseudoDestructorExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXPseudoDestructorExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token ColonColonToken(void) const noexcept;
+  ::pasta::TokenRef ColonColonTokenRef(void) const noexcept;
   ::pasta::Type DestroyedType(void) const noexcept;
+  ::pasta::TypeRef DestroyedTypeRef(void) const noexcept;
   // DestroyedTypeIdentifier: (clang::IdentifierInfo *)
   ::pasta::Token DestroyedTypeToken(void) const noexcept;
+  ::pasta::TokenRef DestroyedTypeTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   std::optional<::pasta::Type> ScopeType(void) const noexcept;
   ::pasta::Token TildeToken(void) const noexcept;
+  ::pasta::TokenRef TildeTokenRef(void) const noexcept;
   bool HasQualifier(void) const noexcept;
   bool IsArrow(void) const noexcept;
  protected:
@@ -5216,17 +5976,25 @@ class CXXRewrittenBinaryOperator : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXRewrittenBinaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // DecomposedForm: (clang::CXXRewrittenBinaryOperator::DecomposedForm)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   enum BinaryOperatorKind Opcode(void) const noexcept;
   std::string_view OpcodeString(void) const noexcept;
   enum BinaryOperatorKind Operator(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
   ::pasta::Expr SemanticForm(void) const noexcept;
+  ::pasta::StmtRef SemanticFormRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   bool IsAssignmentOperation(void) const noexcept;
   bool IsComparisonOperation(void) const noexcept;
   bool IsReversed(void) const noexcept;
@@ -5246,8 +6014,11 @@ class CXXScalarValueInitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXScalarValueInitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXScalarValueInitExpr)
 };
@@ -5264,9 +6035,13 @@ class CXXStdInitializerListExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXStdInitializerListExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXStdInitializerListExpr)
 };
@@ -5283,7 +6058,9 @@ class CXXTemporaryObjectExpr : public CXXConstructExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXTemporaryObjectExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXTemporaryObjectExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::vector<::pasta::Expr> Arguments(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXTemporaryObjectExpr)
@@ -5301,8 +6078,11 @@ class CXXThisExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXThisExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   bool IsImplicit(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXThisExpr)
@@ -5320,9 +6100,13 @@ class CXXThrowExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXThrowExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> SubExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> SubExpressionRef(void) const noexcept;
   ::pasta::Token ThrowToken(void) const noexcept;
+  ::pasta::TokenRef ThrowTokenRef(void) const noexcept;
   bool IsThrownVariableInScope(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXThrowExpr)
@@ -5340,9 +6124,13 @@ class CXXTypeidExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXTypeidExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> ExpressionOperand(void) const noexcept;
+  std::optional<::pasta::StmtRef> ExpressionOperandRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::Type TypeOperand(void) const noexcept;
   ::pasta::Type TypeOperandSourceInfo(void) const noexcept;
   std::optional<bool> IsMostDerived(void) const noexcept;
@@ -5366,11 +6154,16 @@ class CXXUnresolvedConstructExpr : public Expr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // Argument: (const clang::Expr *)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   uint32_t NumArguments(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Type TypeAsWritten(void) const noexcept;
+  ::pasta::TypeRef TypeAsWrittenRef(void) const noexcept;
   bool IsListInitialization(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXUnresolvedConstructExpr)
@@ -5388,10 +6181,15 @@ class CXXUuidofExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXUuidofExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   std::optional<::pasta::Expr> ExpressionOperand(void) const noexcept;
+  std::optional<::pasta::StmtRef> ExpressionOperandRef(void) const noexcept;
   ::pasta::MSGuidDecl GuidDeclaration(void) const noexcept;
+  ::pasta::DeclRef GuidDeclarationRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   ::pasta::Type TypeOperand(void) const noexcept;
   ::pasta::Type TypeOperandSourceInfo(void) const noexcept;
   bool IsTypeOperand(void) const noexcept;
@@ -5419,17 +6217,23 @@ class CallExpr : public Expr {
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   uint32_t BuiltinCallee(void) const noexcept;
   ::pasta::Type CallReturnType(void) const noexcept;
   ::pasta::Expr Callee(void) const noexcept;
+  ::pasta::StmtRef CalleeRef(void) const noexcept;
   std::optional<::pasta::Decl> CalleeDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> CalleeDeclarationRef(void) const noexcept;
   std::optional<::pasta::FunctionDecl> DirectCallee(void) const noexcept;
+  std::optional<::pasta::DeclRef> DirectCalleeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // FPFeatures: (clang::FPOptionsOverride)
   // FPFeaturesInEffect: (clang::FPOptions)
   uint32_t NumArguments(void) const noexcept;
   uint32_t NumCommas(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   // StoredFPFeatures: (clang::FPOptionsOverride)
   std::optional<::pasta::Attr> UnusedResultAttribute(void) const noexcept;
   bool HasStoredFPFeatures(void) const noexcept;
@@ -5468,12 +6272,16 @@ class CastExpr : public Expr {
   enum CastKind CastKind(void) const noexcept;
   std::string_view CastKindName(void) const noexcept;
   std::optional<::pasta::NamedDecl> ConversionFunction(void) const noexcept;
+  std::optional<::pasta::DeclRef> ConversionFunctionRef(void) const noexcept;
   // FPFeatures: (clang::FPOptionsOverride)
   // FPFeaturesInEffect: (clang::FPOptions)
   // StoredFPFeatures: (clang::FPOptionsOverride)
   ::pasta::Expr SubExpression(void) const noexcept;
+  ::pasta::StmtRef SubExpressionRef(void) const noexcept;
   ::pasta::Expr SubExpressionAsWritten(void) const noexcept;
+  ::pasta::StmtRef SubExpressionAsWrittenRef(void) const noexcept;
   std::optional<::pasta::FieldDecl> TargetUnionField(void) const noexcept;
+  std::optional<::pasta::DeclRef> TargetUnionFieldRef(void) const noexcept;
   bool HasStoredFPFeatures(void) const noexcept;
   // Path: (llvm::iterator_range<const clang::CXXBaseSpecifier *const *>)
  protected:
@@ -5492,9 +6300,12 @@ class CharacterLiteral : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CharacterLiteral)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum CharacterLiteralCharacterKind Kind(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
+  ::pasta::TokenRef TokenRef(void) const noexcept;
   uint32_t Value(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CharacterLiteral)
@@ -5512,13 +6323,21 @@ class ChooseExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ChooseExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Expr ChosenSubExpression(void) const noexcept;
+  ::pasta::StmtRef ChosenSubExpressionRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsConditionDependent(void) const noexcept;
   bool IsConditionTrue(void) const noexcept;
  protected:
@@ -5537,7 +6356,9 @@ class CompoundAssignOperator : public BinaryOperator {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CompoundAssignOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CompoundAssignOperator)
   ::pasta::Type ComputationLHSType(void) const noexcept;
+  ::pasta::TypeRef ComputationLHSTypeRef(void) const noexcept;
   ::pasta::Type ComputationResultType(void) const noexcept;
+  ::pasta::TypeRef ComputationResultTypeRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CompoundAssignOperator)
 };
@@ -5554,9 +6375,13 @@ class CompoundLiteralExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CompoundLiteralExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr Initializer(void) const noexcept;
+  ::pasta::StmtRef InitializerRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   bool IsFileScope(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CompoundLiteralExpr)
@@ -5574,7 +6399,9 @@ class ConceptSpecializationExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConceptSpecializationExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // Satisfaction: (const clang::ASTConstraintSatisfaction &)
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const noexcept;
   bool IsSatisfied(void) const noexcept;
@@ -5595,12 +6422,19 @@ class ConditionalOperator : public AbstractConditionalOperator {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConditionalOperator)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr Condition(void) const noexcept;
+  ::pasta::StmtRef ConditionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Expr FalseExpression(void) const noexcept;
+  ::pasta::StmtRef FalseExpressionRef(void) const noexcept;
   ::pasta::Expr LHS(void) const noexcept;
+  ::pasta::StmtRef LHSRef(void) const noexcept;
   ::pasta::Expr RHS(void) const noexcept;
+  ::pasta::StmtRef RHSRef(void) const noexcept;
   ::pasta::Expr TrueExpression(void) const noexcept;
+  ::pasta::StmtRef TrueExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConditionalOperator)
 };
@@ -5619,7 +6453,9 @@ class ConstantExpr : public FullExpr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   // APValueResult: (clang::APValue)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   // ResultAPValueKind: (clang::APValue::ValueKind)
   llvm::APSInt ResultAsAPSInt(void) const noexcept;
   // ResultAsAPValue: (clang::APValue &)
@@ -5642,10 +6478,15 @@ class ConvertVectorExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConvertVectorExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BuiltinToken(void) const noexcept;
+  ::pasta::TokenRef BuiltinTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   ::pasta::Expr SrcExpression(void) const noexcept;
+  ::pasta::StmtRef SrcExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConvertVectorExpr)
 };
@@ -5664,14 +6505,23 @@ class CoroutineSuspendExpr : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(CoroutineSuspendExpr, CoyieldExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr CommonExpression(void) const noexcept;
+  ::pasta::StmtRef CommonExpressionRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token KeywordToken(void) const noexcept;
+  ::pasta::TokenRef KeywordTokenRef(void) const noexcept;
   ::pasta::OpaqueValueExpr OpaqueValue(void) const noexcept;
+  ::pasta::StmtRef OpaqueValueRef(void) const noexcept;
   ::pasta::Expr Operand(void) const noexcept;
+  ::pasta::StmtRef OperandRef(void) const noexcept;
   ::pasta::Expr ReadyExpression(void) const noexcept;
+  ::pasta::StmtRef ReadyExpressionRef(void) const noexcept;
   ::pasta::Expr ResumeExpression(void) const noexcept;
+  ::pasta::StmtRef ResumeExpressionRef(void) const noexcept;
   ::pasta::Expr SuspendExpression(void) const noexcept;
+  ::pasta::StmtRef SuspendExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoroutineSuspendExpr)
 };
@@ -5703,17 +6553,24 @@ class DeclRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DeclRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::ValueDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::NamedDecl FoundDeclaration(void) const noexcept;
+  ::pasta::DeclRef FoundDeclarationRef(void) const noexcept;
   ::pasta::Token LAngleToken(void) const noexcept;
+  ::pasta::TokenRef LAngleTokenRef(void) const noexcept;
   // NameInfo: (clang::DeclarationNameInfo)
   uint32_t NumTemplateArguments(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token RAngleToken(void) const noexcept;
+  ::pasta::TokenRef RAngleTokenRef(void) const noexcept;
   // TemplateArguments: (const clang::TemplateArgumentLoc *)
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   bool HadMultipleCandidates(void) const noexcept;
   bool HasExplicitTemplateArguments(void) const noexcept;
   bool HasQualifier(void) const noexcept;
@@ -5738,10 +6595,15 @@ class DependentCoawaitExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DependentCoawaitExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token KeywordToken(void) const noexcept;
+  ::pasta::TokenRef KeywordTokenRef(void) const noexcept;
   ::pasta::Expr Operand(void) const noexcept;
+  ::pasta::StmtRef OperandRef(void) const noexcept;
   ::pasta::UnresolvedLookupExpr OperatorCoawaitLookup(void) const noexcept;
+  ::pasta::StmtRef OperatorCoawaitLookupRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DependentCoawaitExpr)
 };
@@ -5758,16 +6620,21 @@ class DependentScopeDeclRefExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DependentScopeDeclRefExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   // DeclarationName: (clang::DeclarationName)
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LAngleToken(void) const noexcept;
+  ::pasta::TokenRef LAngleTokenRef(void) const noexcept;
   // NameInfo: (const clang::DeclarationNameInfo &)
   uint32_t NumTemplateArguments(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token RAngleToken(void) const noexcept;
+  ::pasta::TokenRef RAngleTokenRef(void) const noexcept;
   // TemplateArguments: (const clang::TemplateArgumentLoc *)
   ::pasta::Token TemplateKeywordToken(void) const noexcept;
+  ::pasta::TokenRef TemplateKeywordTokenRef(void) const noexcept;
   bool HasExplicitTemplateArguments(void) const noexcept;
   bool HasTemplateKeyword(void) const noexcept;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
@@ -5791,11 +6658,16 @@ class DesignatedInitExpr : public Expr {
   // ArrayRangeEnd: (clang::Expr *)
   // ArrayRangeStart: (clang::Expr *)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::optional<::pasta::Designator> Designator(unsigned int) const noexcept;
   ::pasta::TokenRange DesignatorsSourceRange(void) const noexcept;
+  ::pasta::TokenRefRange DesignatorsSourceRangeRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token EqualOrColonToken(void) const noexcept;
+  ::pasta::TokenRef EqualOrColonTokenRef(void) const noexcept;
   ::pasta::Expr Initializer(void) const noexcept;
+  ::pasta::StmtRef InitializerRef(void) const noexcept;
   uint32_t NumSubExpressions(void) const noexcept;
   // SubExpression: (clang::Expr *)
   bool IsDirectInitializer(void) const noexcept;
@@ -5818,9 +6690,13 @@ class DesignatedInitUpdateExpr : public Expr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DesignatedInitUpdateExpr)
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   ::pasta::Expr Base(void) const noexcept;
+  ::pasta::StmtRef BaseRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::InitListExpr Updater(void) const noexcept;
+  ::pasta::StmtRef UpdaterRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DesignatedInitUpdateExpr)
 };
@@ -5847,6 +6723,7 @@ class ExplicitCastExpr : public CastExpr {
   PASTA_DECLARE_DERIVED_OPERATORS(ExplicitCastExpr, CXXStaticCastExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(ExplicitCastExpr, ObjCBridgedCastExpr)
   ::pasta::Type TypeAsWritten(void) const noexcept;
+  ::pasta::TypeRef TypeAsWrittenRef(void) const noexcept;
   ::pasta::Type TypeInfoAsWritten(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ExplicitCastExpr)
@@ -5866,7 +6743,9 @@ class ExprWithCleanups : public FullExpr {
   std::vector<::pasta::Stmt> Children(void) const noexcept;
   bool CleanupsHaveSideEffects(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   uint32_t NumObjects(void) const noexcept;
   // Object: (llvm::PointerUnion<clang::BlockDecl *, clang::CompoundLiteralExpr *>)
   // Objects: (llvm::ArrayRef<llvm::PointerUnion<clang::BlockDecl *, clang::CompoundLiteralExpr *>>)
@@ -5887,7 +6766,9 @@ class ImplicitCastExpr : public CastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ImplicitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ImplicitCastExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   bool IsPartOfExplicitCast(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImplicitCastExpr)
@@ -5903,12 +6784,19 @@ class OMPAtomicDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPAtomicDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   ::pasta::Expr ConditionExpression(void) const noexcept;
+  ::pasta::StmtRef ConditionExpressionRef(void) const noexcept;
   ::pasta::Expr D(void) const noexcept;
+  ::pasta::StmtRef DRef(void) const noexcept;
   ::pasta::Expr Expression(void) const noexcept;
+  ::pasta::StmtRef ExpressionRef(void) const noexcept;
   ::pasta::Expr R(void) const noexcept;
+  ::pasta::StmtRef RRef(void) const noexcept;
   ::pasta::Expr UpdateExpression(void) const noexcept;
+  ::pasta::StmtRef UpdateExpressionRef(void) const noexcept;
   ::pasta::Expr V(void) const noexcept;
+  ::pasta::StmtRef VRef(void) const noexcept;
   ::pasta::Expr X(void) const noexcept;
+  ::pasta::StmtRef XRef(void) const noexcept;
   bool IsFailOnly(void) const noexcept;
   bool IsPostfixUpdate(void) const noexcept;
   bool IsXLHSInRHSPart(void) const noexcept;
@@ -6000,6 +6888,7 @@ class OMPDispatchDirective : public OMPExecutableDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDispatchDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDispatchDirective)
   ::pasta::Token TargetCallToken(void) const noexcept;
+  ::pasta::TokenRef TargetCallTokenRef(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDispatchDirective)
@@ -6033,6 +6922,7 @@ class OMPDistributeParallelForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDistributeParallelForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -6083,6 +6973,7 @@ class OMPForDirective : public OMPLoopDirective {
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPForDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPForDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const noexcept;
+  ::pasta::StmtRef TaskReductionReferenceExpressionRef(void) const noexcept;
   bool HasCancel(void) const noexcept;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
  protected:
@@ -6134,11 +7025,15 @@ class ObjCBridgedCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCBridgedCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCBridgedCastExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token BridgeKeywordToken(void) const noexcept;
+  ::pasta::TokenRef BridgeKeywordTokenRef(void) const noexcept;
   enum ObjCBridgeCastKind BridgeKind(void) const noexcept;
   std::string_view BridgeKindName(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBridgedCastExpr)
 };
@@ -6155,11 +7050,15 @@ class UserDefinedLiteral : public CallExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UserDefinedLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UserDefinedLiteral)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Expr CookedLiteral(void) const noexcept;
+  ::pasta::StmtRef CookedLiteralRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   enum UserDefinedLiteralLiteralOperatorKind LiteralOperatorKind(void) const noexcept;
   // UDSuffix: (const clang::IdentifierInfo *)
   ::pasta::Token UDSuffixToken(void) const noexcept;
+  ::pasta::TokenRef UDSuffixTokenRef(void) const noexcept;
   std::vector<::pasta::Expr> Arguments(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UserDefinedLiteral)
@@ -6178,7 +7077,9 @@ class BuiltinBitCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BuiltinBitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BuiltinBitCastExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BuiltinBitCastExpr)
 };
@@ -6196,9 +7097,13 @@ class CStyleCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CStyleCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CStyleCastExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CStyleCastExpr)
 };
@@ -6215,6 +7120,7 @@ class CUDAKernelCallExpr : public CallExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CUDAKernelCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CUDAKernelCallExpr)
   ::pasta::CallExpr Config(void) const noexcept;
+  ::pasta::StmtRef ConfigRef(void) const noexcept;
   std::vector<::pasta::Expr> Arguments(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CUDAKernelCallExpr)
@@ -6233,9 +7139,13 @@ class CXXFunctionalCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXFunctionalCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXFunctionalCastExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token LParenToken(void) const noexcept;
+  ::pasta::TokenRef LParenTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
   bool IsListInitialization(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXFunctionalCastExpr)
@@ -6253,10 +7163,15 @@ class CXXMemberCallExpr : public CallExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXMemberCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXMemberCallExpr)
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   ::pasta::Expr ImplicitObjectArgument(void) const noexcept;
+  ::pasta::StmtRef ImplicitObjectArgumentRef(void) const noexcept;
   std::optional<::pasta::CXXMethodDecl> MethodDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> MethodDeclarationRef(void) const noexcept;
   ::pasta::Type ObjectType(void) const noexcept;
+  ::pasta::TypeRef ObjectTypeRef(void) const noexcept;
   ::pasta::CXXRecordDecl RecordDeclaration(void) const noexcept;
+  ::pasta::DeclRef RecordDeclarationRef(void) const noexcept;
   std::vector<::pasta::Expr> Arguments(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXMemberCallExpr)
@@ -6280,11 +7195,16 @@ class CXXNamedCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_DERIVED_OPERATORS(CXXNamedCastExpr, CXXReinterpretCastExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CXXNamedCastExpr, CXXStaticCastExpr)
   ::pasta::TokenRange AngleBrackets(void) const noexcept;
+  ::pasta::TokenRefRange AngleBracketsRef(void) const noexcept;
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   std::string_view CastName(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::Token RParenToken(void) const noexcept;
+  ::pasta::TokenRef RParenTokenRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNamedCastExpr)
 };
@@ -6301,11 +7221,16 @@ class CXXOperatorCallExpr : public CallExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXOperatorCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXOperatorCallExpr)
   ::pasta::Token BeginToken(void) const noexcept;
+  ::pasta::TokenRef BeginTokenRef(void) const noexcept;
   ::pasta::Token EndToken(void) const noexcept;
+  ::pasta::TokenRef EndTokenRef(void) const noexcept;
   ::pasta::Token ExpressionToken(void) const noexcept;
+  ::pasta::TokenRef ExpressionTokenRef(void) const noexcept;
   enum OverloadedOperatorKind Operator(void) const noexcept;
   ::pasta::Token OperatorToken(void) const noexcept;
+  ::pasta::TokenRef OperatorTokenRef(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  ::pasta::TokenRefRange TokensRef(void) const noexcept;
   bool IsAssignmentOperation(void) const noexcept;
   bool IsComparisonOperation(void) const noexcept;
   bool IsInfixBinaryOperation(void) const noexcept;
@@ -6418,6 +7343,48 @@ class CXXDynamicCastExpr : public CXXNamedCastExpr {
 
 static_assert(sizeof(Stmt) == sizeof(CXXDynamicCastExpr));
 
+// A borrowed, non-owning reference to a statement. See `DeclRef`.
+class StmtRef {
+ public:
+  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StmtRef)
+
+  inline StmtRef(const Stmt &stmt) noexcept
+      : ast(stmt.ast.get()),
+        stmt(stmt.u.Stmt),
+        kind(stmt.kind) {}
+
+  inline StmtKind Kind(void) const noexcept {
+    return kind;
+  }
+
+  std::string_view KindName(void) const noexcept;
+
+  inline const ::clang::Stmt *RawStmt(void) const noexcept {
+    return stmt;
+  }
+
+  // Return an owning version of this statement.
+  ::pasta::Stmt Owned(void) const;
+
+  inline bool operator==(const StmtRef &that) const noexcept {
+    return stmt == that.stmt;
+  }
+
+  inline bool operator!=(const StmtRef &that) const noexcept {
+    return stmt != that.stmt;
+  }
+
+ private:
+  friend class RefBuilder;
+
+  StmtRef(void) = delete;
+  explicit StmtRef(ASTImpl *ast_, const ::clang::Stmt *stmt_);
+
+  ASTImpl *ast;
+  const ::clang::Stmt *stmt;
+  StmtKind kind;
+};
+
 }  // namespace pasta
 #undef PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR
 #endif  // PASTA_IN_BOOTSTRAP
@@ -49,6 +49,8 @@ class TokenIterator;
 class TokenPrinterContext;
 class TokenImpl;
 class TokenRange;
+class TokenRef;
+class TokenRefRange;
 
 enum class TokenKind : unsigned short;
 enum class TokenRole : std::underlying_type_t<TokenKind> {
@@ -139,6 +141,7 @@ class TokenContext {
   friend class TemplateArgument;
   friend class TemplateParameterList;
   friend class Token;
+  friend class TokenRef;
   friend class Type;
 
   TokenContext(void) = delete;
@@ -239,6 +242,7 @@ class Token {
   friend class TokenIterator;
   friend class TokenPrinterContext;
   friend class TokenRange;
+  friend class TokenRef;
 
   Token(void) = delete;
 
@@ -364,6 +368,23 @@ class TokenRange {
   // Unsafe indexed access into the token range.
   Token operator[](size_t index) const;
 
+  // Return the first token in this range whose kind is `kind`, if any.
+  std::optional<Token> FindFirst(TokenKind kind) const noexcept;
+
+  // Return the first token in this range whose role is `role`, if any.
+  std::optional<Token> FindFirst(TokenRole role) const noexcept;
+
+  // Number of tokens in this range whose kind is `kind`.
+  size_t Count(TokenKind kind) const noexcept;
+
+  // Return a borrowed view of this range. The view does not keep the `AST`
+  // alive, and so must not outlive this range.
+  TokenRefRange Borrow(void) const noexcept;
+
+  // Locations in files of the tokens in this range, one per token. This is
+  // equivalent to calling `Token::FileLocation` on each token, but cheaper.
+  std::vector<std::optional<FileToken>> FileLocations(void) const;
+
   // Is this token range valid?
   inline operator bool(void) const noexcept {
     return first && after_last;
@@ -390,6 +411,242 @@ class TokenRange {
         after_last(end_) {}
 };
 
+// A borrowed, non-owning reference to a token. Unlike a `Token`, a `TokenRef`
+// does not keep its `AST` alive, and so copying one, or iterating over a
+// `TokenRefRange`, involves no reference counting. A `TokenRef` is only valid
+// while some owner of its `AST` (e.g. an `AST`, `Token`, or `Decl`) is alive.
+//
+// NOTE(pag): Generated methods returning a token or token range have a `Ref`
+//            variant returning a `TokenRef` or `TokenRefRange`. See `DeclRef`.
+//
+// NOTE(pag): A `TokenRef` points at a token of its `AST`, which
+//            `AST::Hibernate` frees. Borrowed tokens must not be kept across
+//            `AST::Hibernate`, which can't tell that they exist.
+class TokenRef {
+ private:
+  ASTImpl *ast;
+  const TokenImpl *impl;
+
+ public:
+  TokenRef(const TokenRef &) = default;
+  TokenRef(TokenRef &&) noexcept = default;
+  TokenRef &operator=(const TokenRef &) = default;
+  TokenRef &operator=(TokenRef &&) noexcept = default;
+
+  inline TokenRef(const Token &tok) noexcept
+      : ast(tok.ast.get()),
+        impl(tok.impl) {}
+
+  inline const void *RawToken(void) const noexcept {
+    return impl;
+  }
+
+  // Return an owning version of this token.
+  ::pasta::Token Owned(void) const;
+
+  // Return the data associated with this token.
+  std::string_view Data(void) const;
+
+  // Index of this token in the AST's token list.
+  uint64_t Index(void) const;
+
+  // Kind of this token.
+  TokenKind Kind(void) const noexcept;
+
+  // Return the role of this token.
+  TokenRole Role(void) const noexcept;
+
+  // Return the printable kind of this token.
+  const char *KindName(void) const noexcept;
+
+  inline operator bool(void) const noexcept {
+    return !!impl;
+  }
+
+  // Return this token's context, or a null context.
+  std::optional<TokenContext> Context(void) const noexcept;
+
+  inline uint64_t Hash(void) const noexcept {
+    return std::hash<const TokenImpl *>{}(impl);
+  }
+
+  inline bool operator==(const TokenRef &that) const noexcept {
+    return impl == that.impl;
+  }
+
+  inline bool operator<(const TokenRef &that) const noexcept {
+    return impl < that.impl;
+  }
+
+ private:
+  friend class RefBuilder;
+  friend class TokenRefIterator;
+  friend class TokenRefRange;
+
+  TokenRef(void) = delete;
+
+  inline explicit TokenRef(ASTImpl *ast_, const TokenImpl *impl_)
+      : ast(ast_),
+        impl(impl_) {}
+};
+
+// A bi-directional, random-access iterator over borrowed tokens.
+class TokenRefIterator {
+ private:
+  TokenRef token;
+
+ public:
+  typedef TokenRef value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const TokenRef *pointer;
+  typedef const TokenRef &reference;
+  typedef std::random_access_iterator_tag iterator_category;
+
+  TokenRefIterator(const TokenRefIterator &) = default;
+  TokenRefIterator(TokenRefIterator &&) noexcept = default;
+  TokenRefIterator &operator=(const TokenRefIterator &) = default;
+  TokenRefIterator &operator=(TokenRefIterator &&) noexcept = default;
+
+  inline const TokenRef &operator*(void) const noexcept {
+    return token;
+  }
+
+  inline const TokenRef *operator->(void) const noexcept {
+    return &token;
+  }
+
+  inline TokenRefIterator &operator++(void) noexcept {
+    ++token.impl;
+    return *this;
+  }
+
+  inline TokenRefIterator operator++(int) noexcept {
+    auto ret = *this;
+    ++token.impl;
+    return ret;
+  }
+
+  inline TokenRefIterator &operator--(void) noexcept {
+    --token.impl;
+    return *this;
+  }
+
+  inline TokenRefIterator operator--(int) noexcept {
+    auto ret = *this;
+    --token.impl;
+    return ret;
+  }
+
+  inline TokenRefIterator operator+(size_t offset) const noexcept {
+    return TokenRefIterator(token.ast, token.impl + offset);
+  }
+
+  inline TokenRefIterator operator-(size_t offset) const noexcept {
+    return TokenRefIterator(token.ast, token.impl - offset);
+  }
+
+  inline TokenRefIterator &operator+=(size_t offset) noexcept {
+    token.impl += offset;
+    return *this;
+  }
+
+  inline TokenRefIterator &operator-=(size_t offset) noexcept {
+    token.impl -= offset;
+    return *this;
+  }
+
+  inline TokenRef operator[](size_t offset) const noexcept {
+    return TokenRef(token.ast, &(token.impl[offset]));
+  }
+
+  inline ptrdiff_t operator-(const TokenRefIterator &that) const noexcept {
+    return token.impl - that.token.impl;
+  }
+
+  inline bool operator!=(const TokenRefIterator &that) const noexcept {
+    return token.impl != that.token.impl;
+  }
+
+  inline bool operator==(const TokenRefIterator &that) const noexcept {
+    return token.impl == that.token.impl;
+  }
+
+  inline bool operator<=(const TokenRefIterator &that) const noexcept {
+    return token.impl <= that.token.impl;
+  }
+
+  inline bool operator>=(const TokenRefIterator &that) const noexcept {
+    return token.impl >= that.token.impl;
+  }
+
+  inline bool operator<(const TokenRefIterator &that) const noexcept {
+    return token.impl < that.token.impl;
+  }
+
+  inline bool operator>(const TokenRefIterator &that) const noexcept {
+    return token.impl > that.token.impl;
+  }
+
+ private:
+  friend class TokenRefRange;
+
+  TokenRefIterator(void) = delete;
+
+  inline explicit TokenRefIterator(ASTImpl *ast_, const TokenImpl *it_)
+      : token(ast_, it_) {}
+};
+
+// Borrowed range of tokens. See `TokenRef`.
+class TokenRefRange {
+ private:
+  ASTImpl *ast;
+  const TokenImpl *first;
+  const TokenImpl *after_last;
+
+ public:
+  TokenRefRange(const TokenRefRange &) = default;
+  TokenRefRange(TokenRefRange &&) noexcept = default;
+  TokenRefRange &operator=(const TokenRefRange &) = default;
+  TokenRefRange &operator=(TokenRefRange &&) noexcept = default;
+
+  inline TokenRefIterator begin(void) const noexcept {
+    return TokenRefIterator(ast, first);
+  }
+
+  inline TokenRefIterator end(void) const noexcept {
+    return TokenRefIterator(ast, after_last);
+  }
+
+  inline size_t size(void) const noexcept {
+    return static_cast<size_t>(after_last - first);
+  }
+
+  inline bool empty(void) const noexcept {
+    return first == after_last;
+  }
+
+  // Unsafe indexed access into the token range.
+  inline TokenRef operator[](size_t index) const noexcept {
+    return TokenRef(ast, &(first[index]));
+  }
+
+  inline operator bool(void) const noexcept {
+    return first && after_last;
+  }
+
+ private:
+  friend class RefBuilder;
+  friend class TokenRange;
+
+  TokenRefRange(void) = delete;
+
+  inline explicit TokenRefRange(ASTImpl *ast_, const TokenImpl *begin_,
+                                const TokenImpl *end_)
+      : ast(ast_),
+        first(begin_),
+        after_last(end_) {}
+};
+
 }  // namespace pasta
 namespace std {
 
@@ -400,6 +657,13 @@ struct hash<::pasta::Token> {
   }
 };
 
+template <>
+struct hash<::pasta::TokenRef> {
+  uintptr_t operator()(const ::pasta::TokenRef &tok) const noexcept {
+    return tok.Hash();
+  }
+};
+
 template <>
 struct hash<::pasta::TokenContext> {
   uintptr_t operator()(const ::pasta::TokenContext &ctx) const noexcept {
@@ -108,6 +108,7 @@ class TypeVisitor {
 class Type {
  protected:
   friend class TypeBuilder;
+  friend class TypeRef;
   friend class PrintedTokenRange;
 
   friend class TokenContext;
@@ -287,37 +288,58 @@ class Type {
   bool ContainsErrors(void) const noexcept;
   bool ContainsUnexpandedParameterPack(void) const noexcept;
   std::optional<::pasta::Type> ArrayElementTypeNoTypeQualified(void) const noexcept;
+  std::optional<::pasta::TypeRef> ArrayElementTypeNoTypeQualifiedRef(void) const noexcept;
   std::optional<::pasta::CXXRecordDecl> AsCXXRecordDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> AsCXXRecordDeclarationRef(void) const noexcept;
   std::optional<::pasta::ComplexType> AsComplexIntegerType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsComplexIntegerTypeRef(void) const noexcept;
   std::optional<::pasta::ObjCObjectPointerType> AsObjCInterfacePointerType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsObjCInterfacePointerTypeRef(void) const noexcept;
   std::optional<::pasta::ObjCObjectType> AsObjCInterfaceType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsObjCInterfaceTypeRef(void) const noexcept;
   std::optional<::pasta::ObjCObjectPointerType> AsObjCQualifiedClassType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsObjCQualifiedClassTypeRef(void) const noexcept;
   std::optional<::pasta::ObjCObjectPointerType> AsObjCQualifiedIdType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsObjCQualifiedIdTypeRef(void) const noexcept;
   std::optional<::pasta::ObjCObjectType> AsObjCQualifiedInterfaceType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsObjCQualifiedInterfaceTypeRef(void) const noexcept;
   std::optional<::pasta::BuiltinType> AsPlaceholderType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsPlaceholderTypeRef(void) const noexcept;
   std::optional<::pasta::RecordDecl> AsRecordDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> AsRecordDeclarationRef(void) const noexcept;
   std::optional<::pasta::RecordType> AsStructureType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsStructureTypeRef(void) const noexcept;
   std::optional<::pasta::TagDecl> AsTagDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> AsTagDeclarationRef(void) const noexcept;
   std::optional<::pasta::RecordType> AsUnionType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AsUnionTypeRef(void) const noexcept;
   ::pasta::Type CanonicalTypeInternal(void) const noexcept;
+  ::pasta::TypeRef CanonicalTypeInternalRef(void) const noexcept;
   // CanonicalTypeUnqualified: (clang::CanQual<clang::Type>)
   std::optional<::pasta::AutoType> ContainedAutoType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ContainedAutoTypeRef(void) const noexcept;
   std::optional<::pasta::DeducedType> ContainedDeducedType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ContainedDeducedTypeRef(void) const noexcept;
   // Dependence: (clang::TypeDependenceScope::TypeDependence)
   enum Linkage Linkage(void) const noexcept;
   // LinkageAndVisibility: (clang::LinkageInfo)
   ::pasta::Type LocallyUnqualifiedSingleStepDesugaredType(void) const noexcept;
+  ::pasta::TypeRef LocallyUnqualifiedSingleStepDesugaredTypeRef(void) const noexcept;
   std::optional<::pasta::NullabilityKind> Nullability(void) const noexcept;
   // ObjCARCImplicitLifetime: (clang::Qualifiers::ObjCLifetime)
   // ObjCSubstitutions: (llvm::Optional<llvm::ArrayRef<clang::QualType>>)
   std::optional<::pasta::CXXRecordDecl> PointeeCXXRecordDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> PointeeCXXRecordDeclarationRef(void) const noexcept;
   std::optional<::pasta::Type> PointeeOrArrayElementType(void) const noexcept;
+  std::optional<::pasta::TypeRef> PointeeOrArrayElementTypeRef(void) const noexcept;
   std::optional<::pasta::Type> PointeeType(void) const noexcept;
+  std::optional<::pasta::TypeRef> PointeeTypeRef(void) const noexcept;
   std::optional<enum TypeScalarTypeKind> ScalarTypeKind(void) const noexcept;
   std::optional<::pasta::Type> SveElementType(void) const noexcept;
   ::pasta::TypeKind Kind(void) const noexcept;
   std::string_view KindName(void) const noexcept;
   ::pasta::Type UnqualifiedDesugaredType(void) const noexcept;
+  ::pasta::TypeRef UnqualifiedDesugaredTypeRef(void) const noexcept;
   enum Visibility Visibility(void) const noexcept;
   // HasAttribute: (bool)
   bool HasAutoForTrailingReturnType(void) const noexcept;
@@ -532,7 +554,9 @@ class TypeOfExprType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeOfExprType)
   PASTA_DECLARE_BASE_OPERATORS(Type, TypeOfExprType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Expr UnderlyingExpression(void) const noexcept;
+  ::pasta::StmtRef UnderlyingExpressionRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypeOfExprType)
@@ -546,7 +570,9 @@ class TypeOfType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeOfType)
   PASTA_DECLARE_BASE_OPERATORS(Type, TypeOfType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypeOfType)
@@ -560,7 +586,9 @@ class TypedefType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypedefType)
   PASTA_DECLARE_BASE_OPERATORS(Type, TypedefType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::TypedefNameDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypedefType)
@@ -574,9 +602,12 @@ class UnaryTransformType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnaryTransformType)
   PASTA_DECLARE_BASE_OPERATORS(Type, UnaryTransformType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type BaseType(void) const noexcept;
+  ::pasta::TypeRef BaseTypeRef(void) const noexcept;
   enum UnaryTransformTypeUTTKind UTTKind(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UnaryTransformType)
@@ -590,7 +621,9 @@ class UnresolvedUsingType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedUsingType)
   PASTA_DECLARE_BASE_OPERATORS(Type, UnresolvedUsingType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::UnresolvedUsingTypenameDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UnresolvedUsingType)
@@ -604,8 +637,11 @@ class UsingType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingType)
   PASTA_DECLARE_BASE_OPERATORS(Type, UsingType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::UsingShadowDecl FoundDeclaration(void) const noexcept;
+  ::pasta::DeclRef FoundDeclarationRef(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UsingType)
@@ -620,7 +656,9 @@ class VectorType : public Type {
   PASTA_DECLARE_BASE_OPERATORS(Type, VectorType)
   PASTA_DECLARE_DERIVED_OPERATORS(VectorType, ExtVectorType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   uint32_t NumElements(void) const noexcept;
   enum VectorTypeVectorKind VectorKind(void) const noexcept;
   bool IsSugared(void) const noexcept;
@@ -652,8 +690,11 @@ class AdjustedType : public Type {
   PASTA_DECLARE_BASE_OPERATORS(Type, AdjustedType)
   PASTA_DECLARE_DERIVED_OPERATORS(AdjustedType, DecayedType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ResolvedType(void) const noexcept;
+  ::pasta::TypeRef ResolvedTypeRef(void) const noexcept;
   ::pasta::Type OriginalType(void) const noexcept;
+  ::pasta::TypeRef OriginalTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AdjustedType)
@@ -671,6 +712,7 @@ class ArrayType : public Type {
   PASTA_DECLARE_DERIVED_OPERATORS(ArrayType, IncompleteArrayType)
   PASTA_DECLARE_DERIVED_OPERATORS(ArrayType, VariableArrayType)
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   uint32_t IndexTypeCVRQualifiers(void) const noexcept;
   // IndexTypeQualifiers: (clang::Qualifiers)
   enum ArrayTypeArraySizeModifier SizeModifier(void) const noexcept;
@@ -686,7 +728,9 @@ class AtomicType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AtomicType)
   PASTA_DECLARE_BASE_OPERATORS(Type, AtomicType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ValueType(void) const noexcept;
+  ::pasta::TypeRef ValueTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AtomicType)
@@ -700,10 +744,13 @@ class AttributedType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AttributedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, AttributedType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   enum ::pasta::AttrKind AttributeKind(void) const noexcept;
   ::pasta::Type EquivalentType(void) const noexcept;
+  ::pasta::TypeRef EquivalentTypeRef(void) const noexcept;
   std::optional<::pasta::NullabilityKind> ImmediateNullability(void) const noexcept;
   ::pasta::Type ModifiedType(void) const noexcept;
+  ::pasta::TypeRef ModifiedTypeRef(void) const noexcept;
   bool IsCallingConv(void) const noexcept;
   bool IsMSTypeSpec(void) const noexcept;
   bool IsQualifier(void) const noexcept;
@@ -720,8 +767,11 @@ class BTFTagAttributedType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BTFTagAttributedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, BTFTagAttributedType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::BTFTypeTagAttr Attribute(void) const noexcept;
+  ::pasta::AttrRef AttributeRef(void) const noexcept;
   ::pasta::Type WrappedType(void) const noexcept;
+  ::pasta::TypeRef WrappedTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BTFTagAttributedType)
@@ -735,6 +785,7 @@ class BitIntType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BitIntType)
   PASTA_DECLARE_BASE_OPERATORS(Type, BitIntType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   uint32_t NumBits(void) const noexcept;
   bool IsSigned(void) const noexcept;
   bool IsSugared(void) const noexcept;
@@ -751,7 +802,9 @@ class BlockPointerType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BlockPointerType)
   PASTA_DECLARE_BASE_OPERATORS(Type, BlockPointerType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BlockPointerType)
@@ -765,6 +818,7 @@ class BuiltinType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BuiltinType)
   PASTA_DECLARE_BASE_OPERATORS(Type, BuiltinType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::BuiltinTypeKind Kind(void) const noexcept;
   // Name: (llvm::StringRef)
   // NameAsCString: (const char *)
@@ -788,7 +842,9 @@ class ComplexType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ComplexType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ComplexType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ComplexType)
@@ -804,8 +860,10 @@ class ConstantArrayType : public ArrayType {
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, ConstantArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ConstantArrayType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   llvm::APInt Size(void) const noexcept;
   std::optional<::pasta::Expr> SizeExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> SizeExpressionRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ConstantArrayType)
@@ -821,7 +879,9 @@ class DecayedType : public AdjustedType {
   PASTA_DECLARE_BASE_OPERATORS(AdjustedType, DecayedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DecayedType)
   ::pasta::Type ResolvedType(void) const noexcept;
+  ::pasta::TypeRef ResolvedTypeRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DecayedType)
 };
@@ -834,8 +894,11 @@ class DecltypeType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DecltypeType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DecltypeType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Expr UnderlyingExpression(void) const noexcept;
+  ::pasta::StmtRef UnderlyingExpressionRef(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DecltypeType)
@@ -851,7 +914,9 @@ class DeducedType : public Type {
   PASTA_DECLARE_DERIVED_OPERATORS(DeducedType, AutoType)
   PASTA_DECLARE_DERIVED_OPERATORS(DeducedType, DeducedTemplateSpecializationType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   std::optional<::pasta::Type> ResolvedType(void) const noexcept;
+  std::optional<::pasta::TypeRef> ResolvedTypeRef(void) const noexcept;
   bool IsDeduced(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
@@ -866,9 +931,13 @@ class DependentAddressSpaceType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentAddressSpaceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Expr AddressSpaceExpression(void) const noexcept;
+  ::pasta::StmtRef AddressSpaceExpressionRef(void) const noexcept;
   ::pasta::Token AttributeToken(void) const noexcept;
+  ::pasta::TokenRef AttributeTokenRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentAddressSpaceType)
@@ -882,7 +951,9 @@ class DependentBitIntType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentBitIntType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentBitIntType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Expr NumBitsExpression(void) const noexcept;
+  ::pasta::StmtRef NumBitsExpressionRef(void) const noexcept;
   bool IsSigned(void) const noexcept;
   bool IsSugared(void) const noexcept;
   bool IsUnsigned(void) const noexcept;
@@ -900,6 +971,7 @@ class DependentNameType : public TypeWithKeyword {
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentNameType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, DependentNameType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   // Identifier: (const clang::IdentifierInfo *)
   // Qualifier: (clang::NestedNameSpecifier *)
   bool IsSugared(void) const noexcept;
@@ -917,10 +989,15 @@ class DependentSizedArrayType : public ArrayType {
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, DependentSizedArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedArrayType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::TokenRange BracketsRange(void) const noexcept;
+  ::pasta::TokenRefRange BracketsRangeRef(void) const noexcept;
   ::pasta::Token LBracketToken(void) const noexcept;
+  ::pasta::TokenRef LBracketTokenRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   ::pasta::Expr SizeExpression(void) const noexcept;
+  ::pasta::StmtRef SizeExpressionRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedArrayType)
@@ -934,9 +1011,13 @@ class DependentSizedExtVectorType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentSizedExtVectorType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Token AttributeToken(void) const noexcept;
+  ::pasta::TokenRef AttributeTokenRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   ::pasta::Expr SizeExpression(void) const noexcept;
+  ::pasta::StmtRef SizeExpressionRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedExtVectorType)
@@ -952,6 +1033,7 @@ class DependentTemplateSpecializationType : public TypeWithKeyword {
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentTemplateSpecializationType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, DependentTemplateSpecializationType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   // Argument: (const clang::TemplateArgument &)
   // Arguments: (const clang::TemplateArgument *)
   // Identifier: (const clang::IdentifierInfo *)
@@ -972,9 +1054,13 @@ class DependentVectorType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentVectorType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentVectorType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Token AttributeToken(void) const noexcept;
+  ::pasta::TokenRef AttributeTokenRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   ::pasta::Expr SizeExpression(void) const noexcept;
+  ::pasta::StmtRef SizeExpressionRef(void) const noexcept;
   enum VectorTypeVectorKind VectorKind(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
@@ -991,8 +1077,11 @@ class ElaboratedType : public TypeWithKeyword {
   PASTA_DECLARE_BASE_OPERATORS(Type, ElaboratedType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, ElaboratedType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type NamedType(void) const noexcept;
+  ::pasta::TypeRef NamedTypeRef(void) const noexcept;
   std::optional<::pasta::TagDecl> OwnedTagDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> OwnedTagDeclarationRef(void) const noexcept;
   // Qualifier: (clang::NestedNameSpecifier *)
   bool IsSugared(void) const noexcept;
  protected:
@@ -1009,6 +1098,7 @@ class ExtVectorType : public VectorType {
   PASTA_DECLARE_BASE_OPERATORS(Type, ExtVectorType)
   PASTA_DECLARE_BASE_OPERATORS(VectorType, ExtVectorType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   // IsAccessorWithinNumElements: (bool)
   bool IsSugared(void) const noexcept;
  protected:
@@ -1032,6 +1122,7 @@ class FunctionType : public Type {
   bool NoReturnAttribute(void) const noexcept;
   uint32_t RegParmType(void) const noexcept;
   ::pasta::Type ReturnType(void) const noexcept;
+  ::pasta::TypeRef ReturnTypeRef(void) const noexcept;
   bool IsConst(void) const noexcept;
   bool IsRestrict(void) const noexcept;
   bool IsVolatile(void) const noexcept;
@@ -1049,6 +1140,7 @@ class IncompleteArrayType : public ArrayType {
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, IncompleteArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, IncompleteArrayType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(IncompleteArrayType)
@@ -1062,9 +1154,13 @@ class InjectedClassNameType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(InjectedClassNameType)
   PASTA_DECLARE_BASE_OPERATORS(Type, InjectedClassNameType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::CXXRecordDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   ::pasta::Type InjectedSpecializationType(void) const noexcept;
+  ::pasta::TypeRef InjectedSpecializationTypeRef(void) const noexcept;
   ::pasta::TemplateSpecializationType InjectedTST(void) const noexcept;
+  ::pasta::TypeRef InjectedTSTRef(void) const noexcept;
   // TemplateName: (clang::TemplateName)
   bool IsSugared(void) const noexcept;
  protected:
@@ -1079,9 +1175,12 @@ class MacroQualifiedType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MacroQualifiedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, MacroQualifiedType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   // MacroIdentifier: (const clang::IdentifierInfo *)
   ::pasta::Type ModifiedType(void) const noexcept;
+  ::pasta::TypeRef ModifiedTypeRef(void) const noexcept;
   ::pasta::Type UnderlyingType(void) const noexcept;
+  ::pasta::TypeRef UnderlyingTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(MacroQualifiedType)
@@ -1097,7 +1196,9 @@ class MatrixType : public Type {
   PASTA_DECLARE_DERIVED_OPERATORS(MatrixType, ConstantMatrixType)
   PASTA_DECLARE_DERIVED_OPERATORS(MatrixType, DependentSizedMatrixType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(MatrixType)
@@ -1111,9 +1212,13 @@ class MemberPointerType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MemberPointerType)
   PASTA_DECLARE_BASE_OPERATORS(Type, MemberPointerType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type Class(void) const noexcept;
+  ::pasta::TypeRef ClassRef(void) const noexcept;
   ::pasta::CXXRecordDecl MostRecentCXXRecordDeclaration(void) const noexcept;
+  ::pasta::DeclRef MostRecentCXXRecordDeclarationRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   bool IsMemberDataPointer(void) const noexcept;
   bool IsMemberFunctionPointer(void) const noexcept;
   bool IsSugared(void) const noexcept;
@@ -1129,13 +1234,19 @@ class ObjCObjectPointerType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCObjectPointerType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCObjectPointerType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl InterfaceDeclaration(void) const noexcept;
+  ::pasta::DeclRef InterfaceDeclarationRef(void) const noexcept;
   ::pasta::ObjCInterfaceType InterfaceType(void) const noexcept;
+  ::pasta::TypeRef InterfaceTypeRef(void) const noexcept;
   uint32_t NumProtocols(void) const noexcept;
   ::pasta::ObjCObjectType ObjectType(void) const noexcept;
+  ::pasta::TypeRef ObjectTypeRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   // Protocol: (clang::ObjCProtocolDecl *)
   ::pasta::Type SuperClassType(void) const noexcept;
+  ::pasta::TypeRef SuperClassTypeRef(void) const noexcept;
   std::vector<::pasta::Type> TypeArguments(void) const noexcept;
   std::vector<::pasta::Type> TypeArgumentsAsWritten(void) const noexcept;
   bool IsKindOfType(void) const noexcept;
@@ -1165,9 +1276,13 @@ class ObjCObjectType : public Type {
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCObjectType)
   PASTA_DECLARE_DERIVED_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type BaseType(void) const noexcept;
+  ::pasta::TypeRef BaseTypeRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl Interface(void) const noexcept;
+  ::pasta::DeclRef InterfaceRef(void) const noexcept;
   std::optional<::pasta::Type> SuperClassType(void) const noexcept;
+  std::optional<::pasta::TypeRef> SuperClassTypeRef(void) const noexcept;
   std::vector<::pasta::Type> TypeArguments(void) const noexcept;
   std::vector<::pasta::Type> TypeArgumentsAsWritten(void) const noexcept;
   bool IsKindOfType(void) const noexcept;
@@ -1197,7 +1312,9 @@ class ObjCTypeParamType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCTypeParamType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCTypeParamType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::ObjCTypeParamDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCTypeParamType)
@@ -1211,8 +1328,10 @@ class PackExpansionType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PackExpansionType)
   PASTA_DECLARE_BASE_OPERATORS(Type, PackExpansionType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   std::optional<unsigned> NumExpansions(void) const noexcept;
   ::pasta::Type Pattern(void) const noexcept;
+  ::pasta::TypeRef PatternRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(PackExpansionType)
@@ -1226,7 +1345,9 @@ class ParenType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ParenType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ParenType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type InnerType(void) const noexcept;
+  ::pasta::TypeRef InnerTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ParenType)
@@ -1240,7 +1361,9 @@ class PipeType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PipeType)
   PASTA_DECLARE_BASE_OPERATORS(Type, PipeType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type ElementType(void) const noexcept;
+  ::pasta::TypeRef ElementTypeRef(void) const noexcept;
   bool IsReadOnly(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
@@ -1255,7 +1378,9 @@ class PointerType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PointerType)
   PASTA_DECLARE_BASE_OPERATORS(Type, PointerType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(PointerType)
@@ -1269,23 +1394,32 @@ class QualifiedType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(QualifiedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, QualifiedType)
   ::pasta::Type IgnoreParentheses(void) const noexcept;
+  ::pasta::TypeRef IgnoreParenthesesRef(void) const noexcept;
   enum LangAS AddressSpace(void) const noexcept;
   ::pasta::Type AtomicUnqualifiedType(void) const noexcept;
+  ::pasta::TypeRef AtomicUnqualifiedTypeRef(void) const noexcept;
   // BaseTypeIdentifier: (const clang::IdentifierInfo *)
   uint32_t CVRQualifiers(void) const noexcept;
   ::pasta::Type CanonicalType(void) const noexcept;
+  ::pasta::TypeRef CanonicalTypeRef(void) const noexcept;
   ::pasta::Type DesugaredType(void) const noexcept;
+  ::pasta::TypeRef DesugaredTypeRef(void) const noexcept;
   uint32_t LocalCVRQualifiers(void) const noexcept;
   uint32_t LocalFastQualifiers(void) const noexcept;
   // LocalQualifiers: (clang::Qualifiers)
   ::pasta::Type LocalUnqualifiedType(void) const noexcept;
+  ::pasta::TypeRef LocalUnqualifiedTypeRef(void) const noexcept;
   ::pasta::Type NonLValueExpressionType(void) const noexcept;
+  ::pasta::TypeRef NonLValueExpressionTypeRef(void) const noexcept;
   ::pasta::Type NonPackExpansionType(void) const noexcept;
+  ::pasta::TypeRef NonPackExpansionTypeRef(void) const noexcept;
   ::pasta::Type NonReferenceType(void) const noexcept;
+  ::pasta::TypeRef NonReferenceTypeRef(void) const noexcept;
   // ObjCGCAttr: (clang::Qualifiers::GC)
   // ObjCLifetime: (clang::Qualifiers::ObjCLifetime)
   // Qualifiers: (clang::Qualifiers)
   ::pasta::Type SingleStepDesugaredType(void) const noexcept;
+  ::pasta::TypeRef SingleStepDesugaredTypeRef(void) const noexcept;
   // SplitDesugaredType: (clang::SplitQualType)
   // SplitUnqualifiedType: (clang::SplitQualType)
   bool HasAddressSpace(void) const noexcept;
@@ -1329,15 +1463,20 @@ class QualifiedType : public Type {
   // Split: (clang::SplitQualType)
   // Stream: (clang::QualType::StreamedQualTypeHelper)
   ::pasta::Type StripObjCKindOfType(void) const noexcept;
+  ::pasta::TypeRef StripObjCKindOfTypeRef(void) const noexcept;
   // SubstObjCMemberType: (clang::QualType)
   // SubstObjCTypeArguments: (clang::QualType)
   // WithCVRQualifiers: (clang::QualType)
   ::pasta::Type WithConst(void) const noexcept;
+  ::pasta::TypeRef WithConstRef(void) const noexcept;
   // WithExactLocalFastQualifiers: (clang::QualType)
   // WithFastQualifiers: (clang::QualType)
   ::pasta::Type WithRestrict(void) const noexcept;
+  ::pasta::TypeRef WithRestrictRef(void) const noexcept;
   ::pasta::Type WithVolatile(void) const noexcept;
+  ::pasta::TypeRef WithVolatileRef(void) const noexcept;
   ::pasta::Type WithoutLocalFastQualifiers(void) const noexcept;
+  ::pasta::TypeRef WithoutLocalFastQualifiersRef(void) const noexcept;
 
   /* QualType methods */
  protected:
@@ -1354,7 +1493,9 @@ class ReferenceType : public Type {
   PASTA_DECLARE_DERIVED_OPERATORS(ReferenceType, LValueReferenceType)
   PASTA_DECLARE_DERIVED_OPERATORS(ReferenceType, RValueReferenceType)
   ::pasta::Type PointeeType(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeRef(void) const noexcept;
   ::pasta::Type PointeeTypeAsWritten(void) const noexcept;
+  ::pasta::TypeRef PointeeTypeAsWrittenRef(void) const noexcept;
   bool IsInnerReference(void) const noexcept;
   bool IsSpelledAsLValue(void) const noexcept;
  protected:
@@ -1369,10 +1510,12 @@ class SubstTemplateTypeParmPackType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstTemplateTypeParmPackType)
   PASTA_DECLARE_BASE_OPERATORS(Type, SubstTemplateTypeParmPackType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   // ArgumentPack: (clang::TemplateArgument)
   // Identifier: (clang::IdentifierInfo *)
   uint32_t NumArguments(void) const noexcept;
   ::pasta::TemplateTypeParmType ReplacedParameter(void) const noexcept;
+  ::pasta::TypeRef ReplacedParameterRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(SubstTemplateTypeParmPackType)
@@ -1386,8 +1529,11 @@ class SubstTemplateTypeParmType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstTemplateTypeParmType)
   PASTA_DECLARE_BASE_OPERATORS(Type, SubstTemplateTypeParmType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::TemplateTypeParmType ReplacedParameter(void) const noexcept;
+  ::pasta::TypeRef ReplacedParameterRef(void) const noexcept;
   ::pasta::Type ReplacementType(void) const noexcept;
+  ::pasta::TypeRef ReplacementTypeRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(SubstTemplateTypeParmType)
@@ -1403,6 +1549,7 @@ class TagType : public Type {
   PASTA_DECLARE_DERIVED_OPERATORS(TagType, EnumType)
   PASTA_DECLARE_DERIVED_OPERATORS(TagType, RecordType)
   ::pasta::TagDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsBeingDefined(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TagType)
@@ -1416,7 +1563,9 @@ class TemplateSpecializationType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateSpecializationType)
   PASTA_DECLARE_BASE_OPERATORS(Type, TemplateSpecializationType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   std::optional<::pasta::Type> AliasedType(void) const noexcept;
+  std::optional<::pasta::TypeRef> AliasedTypeRef(void) const noexcept;
   // Argument: (const clang::TemplateArgument &)
   // Arguments: (const clang::TemplateArgument *)
   uint32_t NumArguments(void) const noexcept;
@@ -1438,7 +1587,9 @@ class TemplateTypeParmType : public Type {
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateTypeParmType)
   PASTA_DECLARE_BASE_OPERATORS(Type, TemplateTypeParmType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   std::optional<::pasta::TemplateTypeParmDecl> Declaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> DeclarationRef(void) const noexcept;
   uint32_t Depth(void) const noexcept;
   // Identifier: (clang::IdentifierInfo *)
   uint32_t Index(void) const noexcept;
@@ -1458,10 +1609,15 @@ class VariableArrayType : public ArrayType {
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, VariableArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, VariableArrayType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::TokenRange BracketsRange(void) const noexcept;
+  ::pasta::TokenRefRange BracketsRangeRef(void) const noexcept;
   ::pasta::Token LBracketToken(void) const noexcept;
+  ::pasta::TokenRef LBracketTokenRef(void) const noexcept;
   ::pasta::Token RBracketToken(void) const noexcept;
+  ::pasta::TokenRef RBracketTokenRef(void) const noexcept;
   ::pasta::Expr SizeExpression(void) const noexcept;
+  ::pasta::StmtRef SizeExpressionRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(VariableArrayType)
@@ -1482,6 +1638,7 @@ class AutoType : public DeducedType {
   uint32_t NumArguments(void) const noexcept;
   std::vector<::pasta::TemplateArgument> TypeConstraintArguments(void) const noexcept;
   std::optional<::pasta::ConceptDecl> TypeConstraintConcept(void) const noexcept;
+  std::optional<::pasta::DeclRef> TypeConstraintConceptRef(void) const noexcept;
   bool IsConstrained(void) const noexcept;
   bool IsDecltypeAuto(void) const noexcept;
   bool IsGNUAutoType(void) const noexcept;
@@ -1530,8 +1687,11 @@ class DependentSizedMatrixType : public MatrixType {
   PASTA_DECLARE_BASE_OPERATORS(MatrixType, DependentSizedMatrixType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedMatrixType)
   ::pasta::Token AttributeToken(void) const noexcept;
+  ::pasta::TokenRef AttributeTokenRef(void) const noexcept;
   ::pasta::Expr ColumnExpression(void) const noexcept;
+  ::pasta::StmtRef ColumnExpressionRef(void) const noexcept;
   ::pasta::Expr RowExpression(void) const noexcept;
+  ::pasta::StmtRef RowExpressionRef(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedMatrixType)
 };
@@ -1546,7 +1706,9 @@ class EnumType : public TagType {
   PASTA_DECLARE_BASE_OPERATORS(TagType, EnumType)
   PASTA_DECLARE_BASE_OPERATORS(Type, EnumType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::EnumDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(EnumType)
@@ -1562,6 +1724,7 @@ class FunctionNoProtoType : public FunctionType {
   PASTA_DECLARE_BASE_OPERATORS(FunctionType, FunctionNoProtoType)
   PASTA_DECLARE_BASE_OPERATORS(Type, FunctionNoProtoType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(FunctionNoProtoType)
@@ -1579,11 +1742,15 @@ class FunctionProtoType : public FunctionType {
   PASTA_DECLARE_BASE_OPERATORS(Type, FunctionProtoType)
   std::optional<enum CanThrowResult> CanThrow(void) const noexcept;
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   std::vector<::pasta::Type> Exceptions(void) const noexcept;
   ::pasta::Token EllipsisToken(void) const noexcept;
+  ::pasta::TokenRef EllipsisTokenRef(void) const noexcept;
   std::optional<::pasta::FunctionDecl> ExceptionSpecDeclaration(void) const noexcept;
+  std::optional<::pasta::DeclRef> ExceptionSpecDeclarationRef(void) const noexcept;
   // ExceptionSpecInfo: (clang::FunctionProtoType::ExceptionSpecInfo)
   std::optional<::pasta::FunctionDecl> ExceptionSpecTemplate(void) const noexcept;
+  std::optional<::pasta::DeclRef> ExceptionSpecTemplateRef(void) const noexcept;
   enum ExceptionSpecificationType ExceptionSpecType(void) const noexcept;
   // ExceptionType: (clang::QualType)
   // ExtParameterInfo: (clang::FunctionType::ExtParameterInfo)
@@ -1592,6 +1759,7 @@ class FunctionProtoType : public FunctionType {
   // ExtProtoInfo: (clang::FunctionProtoType::ExtProtoInfo)
   // MethodQualifiers: (clang::Qualifiers)
   std::optional<::pasta::Expr> NoexceptExpression(void) const noexcept;
+  std::optional<::pasta::StmtRef> NoexceptExpressionRef(void) const noexcept;
   uint32_t NumExceptions(void) const noexcept;
   uint32_t NumParameters(void) const noexcept;
   // ParameterType: (clang::QualType)
@@ -1626,6 +1794,7 @@ class LValueReferenceType : public ReferenceType {
   PASTA_DECLARE_BASE_OPERATORS(ReferenceType, LValueReferenceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, LValueReferenceType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(LValueReferenceType)
@@ -1641,7 +1810,9 @@ class ObjCInterfaceType : public ObjCObjectType {
   PASTA_DECLARE_BASE_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCInterfaceType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::ObjCInterfaceDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCInterfaceType)
@@ -1657,6 +1828,7 @@ class RValueReferenceType : public ReferenceType {
   PASTA_DECLARE_BASE_OPERATORS(ReferenceType, RValueReferenceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, RValueReferenceType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(RValueReferenceType)
@@ -1672,7 +1844,9 @@ class RecordType : public TagType {
   PASTA_DECLARE_BASE_OPERATORS(TagType, RecordType)
   PASTA_DECLARE_BASE_OPERATORS(Type, RecordType)
   ::pasta::Type Desugar(void) const noexcept;
+  ::pasta::TypeRef DesugarRef(void) const noexcept;
   ::pasta::RecordDecl Declaration(void) const noexcept;
+  ::pasta::DeclRef DeclarationRef(void) const noexcept;
   bool HasConstFields(void) const noexcept;
   bool IsSugared(void) const noexcept;
  protected:
@@ -1680,6 +1854,56 @@ class RecordType : public TagType {
 };
 static_assert(sizeof(Type) == sizeof(RecordType));
 
+// A borrowed, non-owning reference to a type, including its qualifiers. See
+// `DeclRef`.
+class TypeRef {
+ public:
+  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeRef)
+
+  inline TypeRef(const Type &type) noexcept
+      : ast(type.ast.get()),
+        type(type.u.Type),
+        kind(type.kind),
+        qualifiers(type.qualifiers) {}
+
+  inline TypeKind Kind(void) const noexcept {
+    return kind;
+  }
+
+  std::string_view KindName(void) const noexcept;
+
+  inline const ::clang::Type *RawType(void) const noexcept {
+    return type;
+  }
+
+  inline uint32_t RawQualifiers(void) const noexcept {
+    return qualifiers;
+  }
+
+  // Return an owning version of this type.
+  ::pasta::Type Owned(void) const;
+
+  inline bool operator==(const TypeRef &that) const noexcept {
+    return type == that.type && qualifiers == that.qualifiers;
+  }
+
+  inline bool operator!=(const TypeRef &that) const noexcept {
+    return type != that.type || qualifiers != that.qualifiers;
+  }
+
+ private:
+  friend class RefBuilder;
+
+  TypeRef(void) = delete;
+  explicit TypeRef(ASTImpl *ast_, const ::clang::Type *type_,
+                   uint32_t qualifiers_);
+
+  ASTImpl *ast;
+  const ::clang::Type *type;
+  TypeKind kind;
+  uint32_t qualifiers;
+};
+
 }  // namespace pasta
 #undef PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR
 #endif  // !PASTA_IN_BOOTSTRAP
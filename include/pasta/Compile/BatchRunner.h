@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <pasta/Util/Result.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Job.h"
+
+namespace pasta {
+
+class AST;
+
+// Options that control how a `BatchRunner` schedules its jobs.
+struct BatchRunnerOptions {
+  // Number of jobs to run concurrently. A value of `0` means to use one
+  // thread per hardware thread.
+  unsigned num_threads{0u};
+
+  // Maximum number of ASTs that can be alive at once, counting the ASTs that
+  // are being built, and the ASTs that are waiting to be handed to, or are
+  // being processed by, the callback. A value of `0` means `num_threads`.
+  unsigned max_live_asts{0u};
+
+  // Options passed along to each `CompileJob::Run`.
+  CompileJobOptions job_options;
+};
+
+// Runs many compile jobs concurrently. The jobs share whatever `FileManager`
+// their `Compiler` was created with, and so jobs created from compilers
+// sharing one `FileManager` will share its cache of opened files, their data,
+// and their raw-lexed tokens.
+class BatchRunner {
+ public:
+  // Invoked once per job, on the thread that called `BatchRunner::Run`, in the
+  // order that jobs finish.
+  using Callback = std::function<void(const CompileJob &,
+                                      Result<AST, std::string>)>;
+
+  explicit BatchRunner(BatchRunnerOptions options_ = {});
+
+  BatchRunner(const BatchRunner &) = default;
+  BatchRunner &operator=(const BatchRunner &) = default;
+  BatchRunner(BatchRunner &&) noexcept = default;
+  BatchRunner &operator=(BatchRunner &&) noexcept = default;
+
+  // Run all of `jobs`, and stream the AST or the first error of each job back
+  // through `callback`. Returns once all jobs have been reported.
+  //
+  // NOTE(pag): A job's AST stops counting against `max_live_asts` once the
+  //            callback returns. Callers that retain ASTs beyond the callback
+  //            are responsible for bounding them.
+  void Run(const std::vector<CompileJob> &jobs,
+           const Callback &callback) const;
+
+ private:
+  BatchRunnerOptions options;
+};
+
+}  // namespace pasta
@@ -8,6 +8,7 @@
 #include <pasta/Util/StdFileSystem.h>
 #include <pasta/Util/File.h>
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -18,6 +19,93 @@ class ArgumentVector;
 class CompileCommand;
 class CompileJobImpl;
 
+// Options that control how a `CompileJob` builds an `AST`.
+struct CompileJobOptions {
+  // Number of threads used to align printed tokens with parsed tokens. Top-
+  // level declaration groups are printed on the calling thread, and aligned
+  // on a pool of this many workers. A value of `0` or `1` means that all
+  // alignment happens on the calling thread. The resulting `AST` is the same
+  // regardless of the number of threads.
+  unsigned num_alignment_threads{1u};
+
+  // Directory of the persistent cache of raw-lexed file tokens. If non-empty,
+  // then the raw tokens of each parsed file are looked up in this directory
+  // (keyed by a hash of the file's contents and of the language options)
+  // before being lexed, and are saved into it after being lexed. The cache
+  // can be shared across concurrent jobs and processes.
+  std::filesystem::path token_cache_directory;
+
+  // Number of threads used to raw lex the files entered during preprocessing.
+  // A value of `0` means that each file is lexed on the calling thread as it
+  // is entered. Otherwise, lexing of files overlaps with preprocessing, and
+  // all lexing finishes before preprocessing does.
+  unsigned num_tokenizer_threads{0u};
+
+  // If `true`, then the parser is fed tokens formed directly from the already
+  // preprocessed tokens, rather than having Clang re-lex and re-preprocess
+  // the one-token-per-line rendering of the preprocessed code. Translation
+  // units containing `#pragma`s always take the re-lexing path, as pragmas
+  // need to go through Clang's pragma handlers.
+  //
+  // NOTE(pag): This only saves the second lex. The one-token-per-line
+  //            rendering is still built, as it is the fallback, and as the
+  //            replayed tokens are located at the start of their lines in
+  //            it, just like the re-lexed ones, which is what maps parsed
+  //            locations back to tokens. Locations don't encode token indices
+  //            directly. The replayed tokens are still preprocessed, so that
+  //            predefined macros expand just as they would when re-lexing.
+  bool replay_preprocessed_tokens{false};
+
+  // If `true`, then the resulting `AST` also keeps a structure-of-arrays copy
+  // of the token kinds and roles. This costs four bytes per token, and speeds
+  // up kind and role searches over token ranges, e.g. `TokenRange::FindFirst`.
+  bool columnar_tokens{false};
+
+  // If `true`, then the token bounds of every declaration are computed
+  // up-front into a dense table. This makes `Run` slower, but makes later
+  // `Decl::Tokens` calls lock-free, which helps when many threads query the
+  // same `AST`.
+  bool precompute_decl_bounds{false};
+
+  // If `true`, then the parser skips over the bodies of function definitions,
+  // as with `-fsyntax-only -skip-function-bodies`, and so the `AST` has no
+  // statements or expressions from function bodies, nor declarations local
+  // to them. The body tokens are still parsed tokens with their file and
+  // macro locations, but their token context is that of the enclosing
+  // `FunctionDecl`. This speeds up parsing and token alignment for users
+  // that only need declarations and types.
+  bool skip_function_bodies{false};
+
+  // If set, then only top-level declaration groups with at least one parsed
+  // token from a file accepted by this predicate are printed and aligned,
+  // e.g. to ignore everything in system headers. The tokens of the other
+  // groups are still in the `AST`, but have no token contexts. The predicate
+  // is called at most once per parsed file, on the thread running the job.
+  std::function<bool(const File &)> alignment_file_filter;
+
+  // If `true`, then `Run` only forms the top-level declaration groups, and
+  // each group is printed and aligned the first time that the context of one
+  // of its tokens is requested, e.g. via `Token::Context` or `Decl::Tokens`.
+  // This returns an `AST` sooner, and is a win for users that only look at a
+  // few declarations. Groups are aligned at most once, one at a time, and
+  // on whichever thread first needs them. `num_alignment_threads` is ignored.
+  //
+  // Printing a group uses Clang's `ASTContext`, which isn't thread-safe, and
+  // so code that uses `AST::UnderlyingAST` directly must not run while token
+  // contexts are being requested on other threads. The tokens of a group that
+  // fails to align have no token contexts.
+  bool lazy_token_alignment{false};
+
+  // If `true`, then `Run` finishes by releasing the state that is only needed
+  // while building the `AST`, e.g. Clang's `Sema` and PASTA's scratch maps,
+  // and by shrinking the token, token context, and token data buffers to
+  // fit. This is for users that keep many ASTs alive at once. PASTA itself
+  // doesn't use `clang::Sema` once `Run` returns. Code that uses
+  // `AST::UnderlyingAST` or `AST::UnderlyingPP` directly must not rely on
+  // semantic analysis, e.g. via `clang::Sema`, as it is gone.
+  bool compact_ast{false};
+};
+
 // A single backend compilation job. There is a one to many relationship
 // between `CompileCommand`s and `CompilerJob`s, as a single compile command
 // may actually reference multiple source files, whereas a compilation job
@@ -59,6 +147,10 @@ class CompileJob {
   // Run a backend compilation job and returns the AST or the first error.
   Result<AST, std::string> Run(void) const;
 
+  // Run a backend compilation job with some specific options, and returns
+  // the AST or the first error.
+  Result<AST, std::string> Run(const CompileJobOptions &options) const;
+
  private:
   friend class Compiler;
 
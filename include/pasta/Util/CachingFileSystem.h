@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "FileSystem.h"
+
+namespace pasta {
+
+// A file system that wraps another file system, and memoizes the results of
+// `Stat` and `ListDirectory`, including failed and negative (i.e. not found)
+// lookups. A caching file system is safe to share between concurrently
+// running compile jobs. File contents are not cached here; that is the job
+// of the `FileManager`.
+//
+// NOTE(pag): The cache is never implicitly invalidated. If files are created,
+//            removed, or renamed while the cache is in use, then `Invalidate`
+//            or `InvalidateAll` must be called.
+class CachingFileSystem final : public FileSystem {
+ public:
+  virtual ~CachingFileSystem(void);
+
+  explicit CachingFileSystem(std::shared_ptr<FileSystem> next_);
+
+  // Create a caching file system that wraps `next`.
+  static std::shared_ptr<CachingFileSystem> Create(
+      std::shared_ptr<FileSystem> next);
+
+  // Return the file system wrapped by this caching file system.
+  inline const std::shared_ptr<FileSystem> &UnderlyingFileSystem(void) const {
+    return next;
+  }
+
+  // Forget anything cached about `path`, as well as the listing of its
+  // parent directory. `path` is interpreted relative to `cwd`.
+  void Invalidate(std::filesystem::path path, std::filesystem::path cwd);
+
+  // Forget everything cached.
+  void InvalidateAll(void);
+
+  using FileSystem::ListDirectory;
+  using FileSystem::ReadFile;
+
+  // Tells us what kind of file system path to use.
+  ::pasta::PathKind PathKind(void) const final;
+
+  // Try to read the contents of a file, given the result of a `Stat` call.
+  Result<std::string, std::error_code> ReadFile(::pasta::Stat stat) final;
+
+  // Try to map the contents of a file into memory.
+  Result<std::shared_ptr<const FileBuffer>, std::error_code>
+  MapFile(::pasta::Stat stat) final;
+
+  // Return the root directory of `path`, possibly within the context of `cwd`.
+  Result<std::filesystem::path, std::error_code>
+  RootDirectory(std::filesystem::path path, std::filesystem::path cwd) final;
+
+  // Return the current working directory of the process.
+  Result<std::filesystem::path, std::error_code>
+  CurrentWorkingDirectory(void) final;
+
+  // Get information about a file path.
+  Result<::pasta::Stat, std::error_code>
+  Stat(std::filesystem::path path, std::filesystem::path cwd) final;
+
+  // List out the files in a directory.
+  Result<std::vector<std::filesystem::path>, std::error_code>
+  ListDirectory(::pasta::Stat stat) final;
+
+ private:
+  CachingFileSystem(void) = delete;
+
+  using StatOrError = std::variant<::pasta::Stat, std::error_code>;
+  using ListingOrError = std::variant<std::vector<std::filesystem::path>,
+                                      std::error_code>;
+
+  const std::shared_ptr<FileSystem> next;
+
+  // Protects `stats` and `listings`.
+  mutable std::shared_mutex cache_lock;
+
+  // Maps the normalized, absolute path of a `Stat` query to its result.
+  std::unordered_map<std::string, StatOrError> stats;
+
+  // Maps the real path of a directory to its listing.
+  std::unordered_map<std::string, ListingOrError> listings;
+};
+
+}  // namespace pasta
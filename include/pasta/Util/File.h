@@ -47,6 +47,7 @@ class FileToken {
   friend class FileTokenIterator;
   friend class FileTokenRange;
   friend class Token;
+  friend class TokenRange;
 
   FileToken(void) = delete;
 
@@ -256,6 +257,7 @@ class File {
   friend class FileManagerImpl;
   friend class ParsedFileTracker;
   friend class Token;
+  friend class TokenRange;
 
   File(void) = delete;
 
@@ -8,6 +8,7 @@
 #include <optional>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "StdFileSystem.h"
@@ -81,6 +82,15 @@ struct Stat {
   }
 };
 
+// Read-only contents of a file, e.g. backed by a shared memory mapping. The
+// bytes of `Data()` are always followed by a NUL byte.
+class FileBuffer {
+ public:
+  virtual ~FileBuffer(void);
+
+  virtual std::string_view Data(void) const noexcept = 0;
+};
+
 // Virtual interface to a file system.
 class FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
@@ -116,6 +126,11 @@ class FileSystem : public std::enable_shared_from_this<FileSystem> {
   // Try to read the contents of a file, given the result of a `Stat` call.
   virtual Result<std::string, std::error_code> ReadFile(::pasta::Stat) = 0;
 
+  // Try to map the contents of a file into memory, given the result of a
+  // `Stat` call. By default this is implemented with `ReadFile`.
+  virtual Result<std::shared_ptr<const FileBuffer>, std::error_code>
+  MapFile(::pasta::Stat stat);
+
   // Return the root directory of `path`, possibly within the context of `cwd`.
   virtual Result<std::filesystem::path, std::error_code>
   RootDirectory(std::filesystem::path path, std::filesystem::path cwd) = 0;
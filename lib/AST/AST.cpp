@@ -6,12 +6,16 @@
 
 #include <pasta/AST/Decl.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <new>
 
 #include "Builder.h"
+#include "Hibernation.h"
+#include "LazyAlignment.h"
 #include "Token.h"
+#include "../Util/FileManager.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wimplicit-int-conversion"
@@ -111,6 +115,7 @@ std::string_view AST::PreprocessedCode(void) const {
 
 // Return all lexed tokens.
 TokenRange AST::Tokens(void) const {
+  impl->Rehydrate();
   const auto first = impl->tokens.data();
   return TokenRange(impl, first, &(first[impl->tokens.size()]));
 }
@@ -118,9 +123,10 @@ TokenRange AST::Tokens(void) const {
 // Return all top-level macro nodes (expansions, directives, substitutions,
 // etc.).
 MacroRange AST::Macros(void) const {
-  const auto first = impl->root_macro_node.nodes.data();
-  return MacroRange(
-      impl, first, &(first[impl->root_macro_node.nodes.size()]));
+  impl->Rehydrate();
+  const RootMacroNode &root = impl->root_macro_node;
+  const auto first = root.Nodes(root.nodes).data();
+  return MacroRange(impl, first, &(first[root.nodes.size()]));
 }
 
 // Try to return the file token at the specified location.
@@ -140,6 +146,95 @@ std::optional<FileToken> ASTImpl::FileTokenAt(clang::SourceLocation loc) {
   }
 }
 
+// Return the file location of the `tok_index`th token of `tokens`, or
+// `nullptr` if it has none. Builds `token_file_locations` on first use.
+const TokenFileLocation *ASTImpl::FileLocationOf(size_t tok_index) {
+  std::call_once(token_file_locations_once, [this] (void) {
+    const clang::SourceManager &sm = ci->getSourceManager();
+    const size_t num_tokens = tokens.size();
+    token_file_locations.resize(num_tokens);
+
+    // The index into `token_location_files`, and the tokens, of each file
+    // we've seen. A file's `tokens_lock` is taken once, the first time that
+    // we see the file, as its `tokens` aren't resized once filled in.
+    struct FileInfo {
+      uint32_t index;
+      const FileTokenImpl *tokens;
+      const FileTokenImpl *end_tokens;
+    };
+
+    std::unordered_map<unsigned, FileInfo> file_infos;
+    unsigned last_file_id = 0u;
+    const FileInfo *last_file = nullptr;
+
+    for (size_t i = 0u; i < num_tokens; ++i) {
+      const TokenImpl &tok = tokens[i];
+      const clang::SourceLocation loc = tok.Location();
+      if (loc.isInvalid()) {
+        continue;
+
+      // Macro tokens are derived from earlier tokens, whose locations we've
+      // already found.
+      } else if (loc.isMacroID()) {
+        if (tok.derived_index < i) {
+          token_file_locations[i] = token_file_locations[tok.derived_index];
+        }
+        continue;
+      }
+
+      const auto [file_id, file_offset] = sm.getDecomposedLoc(loc);
+      if (!last_file || file_id.getHashValue() != last_file_id) {
+        auto info_it = file_infos.find(file_id.getHashValue());
+        if (info_it == file_infos.end()) {
+          auto file_it = id_to_file.find(file_id.getHashValue());
+          if (file_it == id_to_file.end()) {
+            continue;
+          }
+
+          FileImpl *file = file_it->second.impl.get();
+          std::unique_lock<std::mutex> locker(file->tokens_lock);
+          file->WaitForTokens(locker);
+
+          FileInfo info;
+          info.index = static_cast<uint32_t>(token_location_files.size());
+          info.tokens = file->tokens.data();
+          info.end_tokens = &(info.tokens[file->tokens.size()]);
+          info_it = file_infos.emplace(file_id.getHashValue(), info).first;
+          token_location_files.push_back(file_it->second);
+        }
+
+        last_file_id = file_id.getHashValue();
+        last_file = &(info_it->second);
+      }
+
+      const FileTokenImpl *file_tokens = last_file->tokens;
+      const FileTokenImpl *end_file_tokens = last_file->end_tokens;
+      auto file_tok = std::lower_bound(
+          file_tokens, end_file_tokens, file_offset,
+          [] (const FileTokenImpl &a, unsigned offset) {
+            return a.data_offset < offset;
+          });
+
+      if (file_tok < end_file_tokens) {
+        assert(file_tok->data_offset == file_offset);
+        TokenFileLocation &tfl = token_file_locations[i];
+        tfl.file_index = last_file->index;
+        tfl.file_token_index = static_cast<uint32_t>(file_tok - file_tokens);
+      }
+    }
+
+    has_token_file_locations.store(true, std::memory_order_release);
+  });
+
+  if (tok_index < token_file_locations.size()) {
+    const TokenFileLocation &tfl = token_file_locations[tok_index];
+    if (tfl.file_index != TokenFileLocation::kInvalidFileIndex) {
+      return &tfl;
+    }
+  }
+  return nullptr;
+}
+
 // Try to return the token at the specified location.
 TokenImpl *ASTImpl::RawTokenAt(clang::SourceLocation loc) {
   if (loc.isInvalid()) {
@@ -219,6 +314,7 @@ clang::Preprocessor &AST::UnderlyingPP(void) const {
 #ifndef PASTA_IN_BOOTSTRAP
 // Returns the top-level translation unit decl inside of this AST.
 TranslationUnitDecl AST::TranslationUnit(void) const {
+  impl->Rehydrate();
   return TranslationUnitDecl(impl, impl->tu);
 }
 #endif
@@ -234,16 +330,40 @@ const std::vector<::pasta::File> &AST::ParsedFiles(void) const {
   return impl->parsed_files;
 }
 
+// Return the timings and counters gathered while building this AST.
+const ASTStatistics &AST::Statistics(void) const {
+  impl->Rehydrate();
+  return impl->statistics;
+}
+
+// Return an estimate of the memory retained by this AST, broken down by the
+// data structure retaining it.
+ASTMemoryUsage AST::MemoryUsage(void) const {
+  return impl->MemoryUsage();
+}
+
+// Compress the tokens, token contexts, and token data of this AST, and free
+// the originals.
+bool AST::Hibernate(void) const {
+  if (impl.use_count() != 1) {
+    return false;
+  }
+  return impl->Hibernate();
+}
+
 #ifndef PASTA_IN_BOOTSTRAP
 Token AST::Adopt(const clang::SourceLocation &loc) const {
+  impl->Rehydrate();
   return impl->TokenAt(loc);
 }
 
 Decl AST::Adopt(const clang::Decl *decl) const {
+  impl->Rehydrate();
   return Decl(impl, decl);
 }
 
 Stmt AST::Adopt(const clang::Stmt *stmt) const {
+  impl->Rehydrate();
   return Stmt(impl, stmt);
 }
 
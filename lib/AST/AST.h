@@ -5,6 +5,8 @@
 #pragma once
 
 #include <pasta/AST/AST.h>
+#include <pasta/AST/MemoryUsage.h>
+#include <pasta/AST/Statistics.h>
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wimplicit-int-conversion"
@@ -21,13 +23,17 @@
 #include <pasta/Util/FileManager.h>
 #include <pasta/Util/File.h>
 #include <pasta/Util/Result.h>
+#include <atomic>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <variant>
 #include <mutex>
 
 #include "Macro.h"
+#include "Printer/PointerMap.h"
 #include "Token.h"
+#include "TokenColumns.h"
 
 namespace clang {
 class CompilerInstance;
@@ -43,8 +49,19 @@ class OverlayFileSystem;
 }  // namespace llvm
 namespace pasta {
 
+class Hibernation;
+class LazyAlignment;
 class RootMacroNode;
 
+// Location of a parsed token in a file, as an index into
+// `ASTImpl::token_location_files`, and an index of a token in that file.
+struct TokenFileLocation {
+  static constexpr uint32_t kInvalidFileIndex = ~0u;
+
+  uint32_t file_index{kInvalidFileIndex};
+  uint32_t file_token_index{0u};
+};
+
 class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
  public:
   explicit ASTImpl(File main_source_file_);
@@ -53,6 +70,12 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Try to return the file token at the specified location.
   std::optional<FileToken> FileTokenAt(clang::SourceLocation loc);
 
+  // Return the file location of the `tok_index`th token of `tokens`, or
+  // `nullptr` if it has none. Builds `token_file_locations` on first use,
+  // waiting for the tokens of each file in `token_location_files`, so that
+  // callers can then read those tokens without taking `tokens_lock`.
+  const TokenFileLocation *FileLocationOf(size_t tok_index);
+
   // Try to return the token at the specified location.
   TokenImpl *RawTokenAt(clang::SourceLocation loc);
 
@@ -87,6 +110,14 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   std::mutex bounds_mutex;
   std::unordered_map<void *, std::pair<TokenImpl *, TokenImpl *>> bounds;
 
+  // Dense, read-only table of the bounds returned by `DeclTokenRange`, indexed
+  // by a per-AST declaration ordinal. Filled in by `PrecomputeDeclBounds`
+  // before the `AST` is handed out, and never modified afterward, so lookups
+  // don't need to hold `bounds_mutex`. Declarations without an ordinal go
+  // through the locked path.
+  PointerMap<uint32_t> decl_ordinals;
+  std::vector<std::pair<TokenImpl *, TokenImpl *>> dense_decl_bounds;
+
   // Remapped declarations (for the sake of bounds checks).
   std::unordered_map<clang::Decl *, clang::Decl *> remapped_decls;
 
@@ -107,6 +138,20 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Mapping of Clang source manager file IDs to offsets within `parsed_files`.
   std::unordered_map<unsigned  /* clang::FileID */, ::pasta::File> id_to_file;
 
+  // Dense table mapping each index in `tokens` to the file token from which
+  // it was derived, i.e. what `Token::FileLocation` computes by following
+  // `TokenImpl::derived_index`. Built once, the first time it's needed, and
+  // read-only afterward, so lookups don't take any locks.
+  std::once_flag token_file_locations_once;
+  std::vector<TokenFileLocation> token_file_locations;
+
+  // Set once `token_file_locations` is built. `std::once_flag` can't be
+  // queried, and things like `MemoryUsage` must not build the table.
+  std::atomic<bool> has_token_file_locations{false};
+
+  // The files referenced by `TokenFileLocation::file_index`.
+  std::vector<::pasta::File> token_location_files;
+
   // List of macro directives.
   RootMacroNode root_macro_node;
 
@@ -119,6 +164,15 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // TODO(pag): Better abstraction for these types of modifications.
   std::vector<TokenImpl> tokens;
 
+  // Bumped whenever the kinds or roles of `tokens` change in place, so that
+  // `token_columns` can tell that it no longer mirrors `tokens`.
+  uint32_t tokens_version{0u};
+
+  // Optional structure-of-arrays mirror of `tokens`. If it mirrors `tokens`,
+  // then kind and role scans over token ranges use it instead of `tokens`.
+  // See `CompileJobOptions::columnar_tokens`.
+  TokenColumns token_columns;
+
   // Maps from tokens with `TokenImpl::is_macro_name` set to the macro node
   // associated with the define macro directive.
   std::unordered_map<uint32_t, Node> tokens_to_macro_definitions;
@@ -143,6 +197,15 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   //            aliases the `ASTImpl`s lifetime.
   std::vector<TokenContextImpl> contexts;
 
+  // If non-null, then token alignment is lazy, and this holds the top-level
+  // declaration groups to align on demand.
+  //
+  // NOTE(pag): Lazily aligned groups append to `contexts`, which is reserved
+  //            up-front so that it is never reallocated; running out of that
+  //            room is a fatal error. Readers that don't hold the lazy lock
+  //            must bound indices by `LazyAlignment::num_contexts`.
+  std::unique_ptr<LazyAlignment> lazy_alignment;
+
   // Huge "file" containing one token per line. Sometimes some lines are empty.
   // This represents all code after pre-processing, and the relationship is that
   // there is one line per token in `tokens` above.
@@ -159,6 +222,13 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Useful for when we want to print tokens of decls and such.
   std::unique_ptr<clang::PrintingPolicy> printing_policy;
 
+  // While hibernating, `tokens`, `contexts`, `token_columns`, and
+  // `backup_token_data` are empty, and their compressed contents are in
+  // `hibernation`. `hibernation_lock` guards `hibernation`.
+  std::mutex hibernation_lock;
+  std::atomic<bool> is_hibernating{false};
+  std::unique_ptr<Hibernation> hibernation;
+
   // Where we expect the next macro use end location to be.
   clang::SourceLocation macro_use_end_loc;
 
@@ -166,6 +236,9 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   std::vector<clang::Builtin::Info> target_specific_records;
   std::vector<clang::Builtin::Info> aux_target_specific_records;
 
+  // Timings and counters gathered while building this AST.
+  ASTStatistics statistics;
+
   // Append a marker token to the parsed token list.
   void AppendMarker(clang::SourceLocation loc, TokenRole role);
 
@@ -187,9 +260,19 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   std::pair<TokenImpl *, TokenImpl *> PartitionDeclContext(
       clang::DeclContext *dc);
 
+  // Return the inclusive bounds of a declaration as used by `DeclTokenRange`,
+  // falling back on the template of a specialization. Returns a pair of
+  // `nullptr`s if the bounds are unknown. Requires `bounds_mutex` to be held
+  // once the `AST` is shared.
+  std::pair<TokenImpl *, TokenImpl *> DeclTokenBounds(clang::Decl *decl);
+
   // Return a token range for the bounds of a declaration.
   TokenRange DeclTokenRange(const clang::Decl *decl);
 
+  // Compute the bounds of every lexically nested declaration into
+  // `dense_decl_bounds`. See `CompileJobOptions::precompute_decl_bounds`.
+  void PrecomputeDeclBounds(void);
+
   // Try to align parsed tokens with printed tokens. See `AlignTokens.cpp`.
   static Result<std::monostate, std::string> AlignTokens(
       const std::shared_ptr<ASTImpl> &ast_,
@@ -197,7 +280,33 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
       PrintedTokenRangeImpl &range, TokenContextIndex decl_context_id);
 
   // Try to align parsed tokens with printed tokens. See `AlignTokens.cpp`.
-  static Result<AST, std::string> AlignTokens(std::shared_ptr<ASTImpl> ast);
+  // If `num_threads` is greater than one, then top-level declaration groups
+  // are aligned concurrently on a pool of `num_threads` workers. If
+  // `file_filter` is set, then groups without any tokens from a file that it
+  // accepts are skipped. If `lazy` is `true`, then the groups are only formed,
+  // and are aligned later by `AlignTokensOnDemand`.
+  static Result<AST, std::string> AlignTokens(
+      std::shared_ptr<ASTImpl> ast, unsigned num_threads,
+      const std::function<bool(const File &)> &file_filter, bool lazy);
+
+  // If alignment is lazy, then align the top-level declaration groups
+  // containing any of the tokens in `[first, last]` that aren't yet aligned.
+  // Safe to call from any thread.
+  inline void AlignTokensOnDemand(const TokenImpl *first,
+                                  const TokenImpl *last) {
+    if (lazy_alignment) {
+      AlignTokensLazily(first, last);
+    }
+  }
+
+  void AlignTokensLazily(const TokenImpl *first, const TokenImpl *last);
+
+  // Return the context of `tok`, or `nullptr`, after aligning its group if
+  // alignment is lazy. Safe to call from any thread.
+  inline const TokenContextImpl *TokenContextOf(const TokenImpl *tok) {
+    AlignTokensOnDemand(tok, tok);
+    return tok->Context(*this, contexts);
+  }
 
   // Mark tokens as being part of macros.
   void MarkMacroTokens(void);
@@ -206,6 +315,32 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // contexts of tokens with macro roles.
   void LinkMacroTokenContexts(void);
 
+  // Fill in the token, context, and macro counters of `statistics`.
+  void CollectStatistics(void);
+
+  // Release build-only state, and shrink what remains. See `Compact.cpp`.
+  void Compact(void);
+
+  // Fix up the pointers into `tokens` after it moved from `old_tokens`.
+  void RebaseTokenPointers(uintptr_t old_tokens);
+
+  // Compress the token buffers and free the originals. See `Hibernation.cpp`.
+  bool Hibernate(void);
+
+  // If hibernating, then decompress the token buffers. Safe to call from any
+  // thread. This must be called before handing out anything that can reach
+  // the token buffers, e.g. a `Token` or a `Decl`.
+  inline void Rehydrate(void) {
+    if (is_hibernating.load(std::memory_order_acquire)) {
+      RehydrateBuffers();
+    }
+  }
+
+  void RehydrateBuffers(void);
+
+  // Measure the memory retained by this AST. See `MemoryUsage.cpp`.
+  ASTMemoryUsage MemoryUsage(void);
+
  private:
   ASTImpl(void) = delete;
 };
@@ -14,16 +14,23 @@
 #include <clang/AST/DeclTemplate.h>
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Lex/Token.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
 #pragma clang diagnostic pop
 
 
+#include <algorithm>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <sstream>
 
 #include "Builder.h"
+#include "LazyAlignment.h"
 #include "Printer/DeclStmtPrinter.h"
 #include "Util.h"
 
@@ -598,6 +605,7 @@ class Matcher {
   bool MergeBackward(TokenImpl *parsed, PrintedTokenImpl *printed, bool &changed);
 
   void FixContexts(Region *parsed, std::vector<TokenContextIndex> &stack);
+  void FixSkippedBodyContexts(void);
 };
 
 // Organize the tokens into a tree, grouped by brace/bracket/paren-enclosed
@@ -1496,6 +1504,87 @@ void Matcher::FixContexts(
   stack.pop_back();
 }
 
+// Returns `true` if the parser skipped the body of any redeclaration of `fd`.
+static bool HasSkippedBody(const clang::FunctionDecl *fd) {
+  for (const clang::FunctionDecl *redecl : fd->redecls()) {
+    if (redecl->hasSkippedBody()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// The parser skipped the bodies of some functions (see
+// `CompileJobOptions::skip_function_bodies`), and so the printer only printed
+// their braces. Give every parsed token of such a body, and of any constructor
+// initializers skipped along with it, the context of the function.
+void Matcher::FixSkippedBodyContexts(void) {
+
+  // Is `tok`'s context `fn_context`, or nested inside of it?
+  auto is_within = [this] (const TokenImpl *tok,
+                           const TokenContextImpl *fn_context) {
+    if (!TokenHasLocationAndContext(tok)) {
+      return false;
+    }
+    for (auto context = &(range.contexts[tok->context_index]); context;
+         context = context->Parent(range.contexts)) {
+      if (context == fn_context) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (TokenImpl *tok = first_parsed; tok <= last_parsed; ++tok) {
+    if (tok->Kind() != clang::tok::l_brace ||
+        !TokenHasLocationAndContext(tok)) {
+      continue;
+    }
+
+    const TokenContextIndex fn_index = tok->context_index;
+    const TokenContextImpl *fn_context = &(range.contexts[fn_index]);
+    if (fn_context->kind != TokenContextKind::kDecl) {
+      continue;
+    }
+
+    auto fd = clang::dyn_cast<clang::FunctionDecl>(
+        reinterpret_cast<const clang::Decl *>(fn_context->data));
+    if (!fd || !HasSkippedBody(fd)) {
+      continue;
+    }
+
+    // Walk back over the skipped constructor initializers, if any, to the
+    // end of the function's declarator.
+    for (TokenImpl *prev = tok; prev != first_parsed; ) {
+      --prev;
+      if (!TokenCanBeAssignedContext(prev)) {
+        continue;
+      }
+      if (prev->Kind() == clang::tok::semi || is_within(prev, fn_context)) {
+        break;
+      }
+      prev->context_index = fn_index;
+    }
+
+    // Walk forward over the body, up to and including its closing brace.
+    unsigned depth = 0u;
+    for (TokenImpl *next = tok; next <= last_parsed; ++next) {
+      if (!TokenCanBeAssignedContext(next)) {
+        continue;
+      }
+      if (!is_within(next, fn_context)) {
+        next->context_index = fn_index;
+      }
+      if (next->Kind() == clang::tok::l_brace) {
+        ++depth;
+      } else if (next->Kind() == clang::tok::r_brace && !--depth) {
+        tok = next;
+        break;
+      }
+    }
+  }
+}
+
 static bool HasNotBeenMatched(Region *r) {
   return !r->matched_with;
 }
@@ -1569,6 +1658,185 @@ static TokenContextIndex MigrateContexts(
   return ret_id;
 }
 
+// A printed top-level declaration group, waiting to be aligned against the
+// parsed tokens in the inclusive range `[parsed_first, parsed_last]`.
+struct TLDGroupAlignment {
+  inline explicit TLDGroupAlignment(clang::ASTContext &ast_context)
+      : range(ast_context) {}
+
+  PrintedTokenRangeImpl range;
+  TokenImpl *parsed_first{nullptr};
+  TokenImpl *parsed_last{nullptr};
+  TokenContextIndex decl_context_id{kInvalidTokenContextIndex};
+
+  // Clear out this group so that it can be reused for the next group, while
+  // keeping the memory of its printed token range.
+  void Reset(void) {
+    range.Reset();
+    parsed_first = nullptr;
+    parsed_last = nullptr;
+    decl_context_id = kInvalidTokenContextIndex;
+    done = {};
+  }
+
+  // Result of aligning this group.
+  Result<std::monostate, std::string> result;
+
+  // Signalled when a worker thread finishes aligning this group.
+  std::shared_future<void> done;
+};
+
+// Clear out the old token contexts of a group, then align it. This only
+// touches the group's own parsed token slice and printed token range, and so
+// it is safe to run concurrently with other non-overlapping groups.
+static void AlignGroup(const std::shared_ptr<ASTImpl> &ast,
+                       TLDGroupAlignment &group) {
+
+  // We'll possibly detect issues here.
+  for (TokenImpl *t = group.parsed_first; t <= group.parsed_last; ++t) {
+    assert(t->context_index == kInvalidTokenContextIndex);
+    t->context_index = kInvalidTokenContextIndex;
+  }
+
+  group.result = ASTImpl::AlignTokens(
+      ast, group.parsed_first, &(group.parsed_last[1]), group.range,
+      group.decl_context_id);
+}
+
+// Prints top-level declaration groups into printed token ranges.
+//
+// NOTE(pag): Printing touches Clang's `ASTContext`, `SourceManager`, and
+//            the identifier table of `orig_source_pp`, none of which are
+//            thread-safe, and so only one group may be printed at a time.
+class TLDGroupPrinter {
+ public:
+  inline TLDGroupPrinter(void)
+      : out(data, 0) {}
+
+  // Print `tld_group`, whose first declaration lexically contains the others,
+  // into `group.range`. Returns `false` if nothing was printed.
+  bool Print(const std::shared_ptr<ASTImpl> &ast,
+             const std::vector<clang::Decl *> &tld_group,
+             TLDGroupAlignment &group);
+
+ private:
+  std::vector<const clang::Decl *> parentage;
+  std::vector<TokenPrinterContext> context_stack;
+  std::string data;
+  raw_string_ostream out;
+};
+
+bool TLDGroupPrinter::Print(const std::shared_ptr<ASTImpl> &ast,
+                            const std::vector<clang::Decl *> &tld_group,
+                            TLDGroupAlignment &group) {
+  assert(1u <= tld_group.size());
+  clang::Decl * const containing_decl = tld_group.front();
+  auto &ast_context = ast->tu->getASTContext();
+
+  // Go find the parentage of the containing decl. It is the path of lexical
+  // declaration contexts down to the one containing the `containing_decl`
+  // for this TLD group.
+  parentage.clear();
+  context_stack.clear();
+  parentage.push_back(containing_decl);
+  for (auto dc = containing_decl->getLexicalDeclContext(); dc;
+       dc = dc->getLexicalParent()) {
+    if (auto dc_decl = clang::dyn_cast<clang::Decl>(dc)) {
+      parentage.push_back(dc_decl);
+    }
+  }
+
+  // Initialize a new printed token range.
+  out.flush();
+  data.clear();
+  out.printed_defs.clear();
+
+  PrintedTokenRangeImpl &range = group.range;
+  range.ast = ast;
+
+  clang::PrintingPolicy pp = *(ast->printing_policy);
+  DeclPrinter printer(out, pp, ast_context, range);
+
+  // Build up a stack of the parentage for these decls. There should at least
+  // be the translation unit. This mimicks the call stack initialization of
+  // the printers.
+  const auto num_parents = parentage.size();
+  assert(1u <= num_parents);
+  context_stack.reserve(num_parents);
+  for (auto pit = parentage.rbegin(), pend = parentage.rend();
+      pit != pend; ++pit) {
+    const clang::Decl *dc_decl = *pit;
+    (void) context_stack.emplace_back(out, dc_decl, range);
+  }
+
+  // Force our current top of stack to be the canonical version of the
+  // first decl in our decl group.
+  assert(!context_stack.empty());
+  group.decl_context_id = context_stack.back().context_index;
+  assert(group.decl_context_id != kInvalidTokenContextIndex);
+  assert(group.decl_context_id < range.contexts.size());
+
+  for (clang::Decl *tld_decl : tld_group) {
+    printer.Visit(tld_decl);
+  }
+
+  // Unwind the tokenizer contexts (just in case the destructors still have
+  // work to do).
+  while (!context_stack.empty()) {
+    context_stack.pop_back();
+  }
+
+  return !range.tokens.empty();
+}
+
+// Migrate the token contexts of an aligned group into the AST. This will
+// migrate only the contexts that were actually propagated into the parsed
+// tokens, as opposed to all token contexts.
+//
+// NOTE(pag): This mutates `ast.contexts`, and so must happen on one thread,
+//            and in the order that groups were printed, so that the context
+//            indices are independent of the number of alignment threads.
+//
+// Returns `false`, having migrated nothing, if lazy alignment has run out of
+// reserved contexts.
+static bool MigrateGroup(
+    ASTImpl &ast, TLDGroupAlignment &group,
+    std::unordered_multimap<const void *, TokenContextIndex> &data_to_context,
+    std::vector<TokenContextIndex> &context_map) {
+  // Lazy alignment hands out pointers into `ast.contexts` while it migrates
+  // groups, and so `ast.contexts` must never be reallocated. Each printed
+  // context is migrated into at most one new context.
+  if (ast.lazy_alignment &&
+      (ast.contexts.capacity() - ast.contexts.size()) <
+          group.range.contexts.size()) {
+    return false;
+  }
+
+  context_map.clear();
+  context_map.resize(group.range.contexts.size());
+  for (TokenImpl *t = group.parsed_first; t <= group.parsed_last; ++t) {
+    t->context_index = MigrateContexts(
+        t->context_index, group.range.contexts, ast.contexts,
+        data_to_context, context_map);
+    assert(t->context_index != kInvalidTokenContextIndex);
+  }
+  return true;
+}
+
+// Does `tok` have a context that is really stored in the macro token list?
+// See `ASTImpl::LinkMacroTokenContexts`.
+static bool IsLinkedMacroToken(const TokenImpl &tok) {
+  switch (tok.Role()) {
+    case TokenRole::kInitialMacroUseToken:
+    case TokenRole::kIntermediateMacroExpansionToken:
+    case TokenRole::kFinalMacroExpansionToken:
+    case TokenRole::kEndOfInternalMacroEventMarker:
+      return tok.context_index != kInvalidTokenContextIndex;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
 Result<std::monostate, std::string> ASTImpl::AlignTokens(
@@ -1582,7 +1850,6 @@ Result<std::monostate, std::string> ASTImpl::AlignTokens(
   auto printed_end = &(printed_begin[range.tokens.size()]);
   assert(parsed_begin < parsed_end);
   assert(printed_begin < printed_end);
-  assert(parsed_end <= &(ast->tokens.back()));
 
   std::stringstream err;
   std::vector<std::unique_ptr<Region>> parsed_regions;
@@ -1884,6 +2151,7 @@ Result<std::monostate, std::string> ASTImpl::AlignTokens(
   std::vector<TokenContextIndex> context_stack;
   context_stack.push_back(decl_context_id);
   matcher.FixContexts(parsed_tree, context_stack);
+  matcher.FixSkippedBodyContexts();
 
 #if PASTA_DEBUG_ALIGN
   std::ofstream parsed_os("/tmp/tree.parsed", std::ios_base::trunc | std::ios_base::out);
@@ -1923,7 +2191,9 @@ Result<std::monostate, std::string> ASTImpl::AlignTokens(
 }
 
 // Try to align parsed tokens with printed tokens. See `AlignTokens.cpp`.
-Result<AST, std::string> ASTImpl::AlignTokens(std::shared_ptr<ASTImpl> ast) {
+Result<AST, std::string> ASTImpl::AlignTokens(
+    std::shared_ptr<ASTImpl> ast, unsigned num_threads,
+    const std::function<bool(const File &)> &file_filter, bool lazy) {
   std::vector<clang::Decl *> work_list;
   std::vector<clang::Decl *> tlds;
   std::unordered_set<const clang::Decl *> ignore_decls;
@@ -2044,11 +2314,21 @@ Result<AST, std::string> ASTImpl::AlignTokens(std::shared_ptr<ASTImpl> ast) {
 
   tlds.erase(std::unique(tlds.begin(), tlds.end()), tlds.end());
 
+  // Sort by the bounds of each TLD. The bounds are looked up once, rather
+  // than twice per comparison.
+  using TLDSortKey = std::pair<std::pair<TokenImpl *, TokenImpl *>,
+                               clang::Decl *>;
+  std::vector<TLDSortKey> tld_keys;
+  tld_keys.reserve(tlds.size());
+  for (clang::Decl *decl : tlds) {
+    tld_keys.emplace_back(ast->DeclBounds(decl), decl);
+  }
+
   std::stable_sort(
-      tlds.begin(), tlds.end(),
-      [ast = ast.get()] (clang::Decl *a, clang::Decl *b) {
-        auto a_bounds = ast->DeclBounds(a);
-        auto b_bounds = ast->DeclBounds(b);
+      tld_keys.begin(), tld_keys.end(),
+      [] (const TLDSortKey &a, const TLDSortKey &b) {
+        const auto &a_bounds = a.first;
+        const auto &b_bounds = b.first;
 
         // If `a` starts first, put it first.
         if (a_bounds.first < b_bounds.first) {
@@ -2071,15 +2351,75 @@ Result<AST, std::string> ASTImpl::AlignTokens(std::shared_ptr<ASTImpl> ast) {
         }
       });
 
+  for (size_t i = 0u, max_i = tlds.size(); i < max_i; ++i) {
+    tlds[i] = tld_keys[i].second;
+  }
+
   std::unordered_multimap<const void *, TokenContextIndex> data_to_context;
   std::vector<TokenContextIndex> context_map;
   std::vector<clang::Decl *> tld_group;
-  std::vector<const clang::Decl *> parentage;
-  std::vector<TokenPrinterContext> context_stack;
-  std::string data;
+  TLDGroupPrinter printer;
   auto &ast_context = ast->tu->getASTContext();
 
-  for (auto tld_it = tlds.begin(), tld_end = tlds.end(); tld_it != tld_end; ) {
+  // Retired groups, kept around so that their printed token ranges can be
+  // reused by later groups. At most `max_in_flight + 1` groups are ever live.
+  std::vector<std::unique_ptr<TLDGroupAlignment>> free_groups;
+  auto recycle_group = [&free_groups] (
+      std::unique_ptr<TLDGroupAlignment> group) {
+    free_groups.emplace_back(std::move(group));
+  };
+
+  // Results of `file_filter`, keyed by Clang file IDs. The last lookup is
+  // cached, as runs of tokens tend to come from the same file.
+  std::unordered_map<unsigned, bool> file_id_accepted;
+  unsigned last_file_id = 0u;
+  bool last_file_accepted = false;
+  const clang::SourceManager &sm = ast->ci->getSourceManager();
+
+  auto file_id_is_accepted = [&] (clang::FileID file_id) -> bool {
+    const unsigned id = file_id.getHashValue();
+    if (id == last_file_id) {
+      return last_file_accepted;
+    }
+
+    auto [it, added] = file_id_accepted.emplace(id, true);
+    if (added) {
+      auto file_it = ast->id_to_file.find(id);
+      if (file_it != ast->id_to_file.end()) {
+        it->second = file_filter(file_it->second);
+      }
+    }
+
+    last_file_id = id;
+    last_file_accepted = it->second;
+    return last_file_accepted;
+  };
+
+  // Returns `true` if any parsed token in `[first, last]` is from a file
+  // accepted by `file_filter`. Macro tokens are ignored, as the file tokens
+  // of their uses are also in the range. If the range has no file tokens,
+  // then we conservatively accept it.
+  auto tokens_are_accepted = [&] (TokenImpl *first, TokenImpl *last) -> bool {
+    auto saw_file_token = false;
+    for (TokenImpl *tok = first; tok <= last; ++tok) {
+      const clang::SourceLocation loc = tok->Location();
+      if (loc.isInvalid() || !loc.isFileID()) {
+        continue;
+      }
+      saw_file_token = true;
+      if (file_id_is_accepted(sm.getFileID(loc))) {
+        return true;
+      }
+    }
+    return !saw_file_token;
+  };
+
+  // Form the next TLD group starting at `tld_it` into `tld_group`, and advance
+  // `tld_it` past the group. Returns the parsed bounds of the group, or a pair
+  // of `nullptr`s if there is nothing to align.
+  using TLDIterator = std::vector<clang::Decl *>::iterator;
+  auto form_next_group = [&] (TLDIterator &tld_it, TLDIterator tld_end)
+      -> std::pair<TokenImpl *, TokenImpl *> {
     clang::Decl *decl = *tld_it;
     clang::Decl *&containing_decl = ast->lexically_containing_decl[decl];
     if (!containing_decl) {
@@ -2101,156 +2441,209 @@ Result<AST, std::string> ASTImpl::AlignTokens(std::shared_ptr<ASTImpl> ast) {
 
     assert(1u <= tld_group.size());
 
-    // Go find the parentage of the containing decl. It is the path of lexical
-    // declaration contexts down to the one containing the `containing_decl`
-    // for this TLD group.
-    parentage.clear();
-    context_stack.clear();
-    parentage.push_back(containing_decl);
-    for (auto dc = containing_decl->getLexicalDeclContext(); dc;
-         dc = dc->getLexicalParent()) {
-      if (auto dc_decl = clang::dyn_cast<clang::Decl>(dc)) {
-        parentage.push_back(dc_decl);
-      }
+    // Figure out the parsed bounds. If we don't have bounds then we are
+    // probably dealing with something like a namespace / linkage spec /
+    // extern C, or an implicit declaration.
+    auto decl_bounds = ast->DeclBounds(decl);
+    if (!decl_bounds.first) {
+      ast->statistics.num_tld_groups_skipped += 1u;
+      return {};
     }
 
-    // Initialize a new printed token range.
-    data.clear();
-    raw_string_ostream out(data, 0);
-    PrintedTokenRangeImpl range(ast_context);
-    range.ast = ast;
+    assert(decl_bounds.second < &(ast->tokens.back()));
 
-    clang::PrintingPolicy pp = *(ast->printing_policy);
-    DeclPrinter printer(out, pp, ast_context, range);
-
-    // Build up a stack of the parentage for these decls. There should at least
-    // be the translation unit. This mimicks the call stack initialization of
-    // the printers.
-    const auto num_parents = parentage.size();
-    assert(1u <= num_parents);
-    context_stack.reserve(num_parents);
-    for (auto pit = parentage.rbegin(), pend = parentage.rend();
-        pit != pend; ++pit) {
-      const clang::Decl *dc_decl = *pit;
-      (void) context_stack.emplace_back(out, dc_decl, range);
+    // Don't bother printing groups that the user doesn't care about.
+    if (file_filter &&
+        !tokens_are_accepted(decl_bounds.first, decl_bounds.second)) {
+      ast->statistics.num_tld_groups_filtered += 1u;
+      return {};
     }
 
-    // Force our current top of stack to be the canonical version of the
-    // first decl in our decl group.
-    assert(!context_stack.empty());
-    const TokenContextIndex decl_context_id = context_stack.back().context_index;
-    assert(decl_context_id != kInvalidTokenContextIndex);
-    assert(decl_context_id < range.contexts.size());
+    return decl_bounds;
+  };
 
-    for (clang::Decl *tld_decl : tld_group) {
-      printer.Visit(tld_decl);
+  // Form the next TLD group starting at `tld_it`, print it, and advance
+  // `tld_it` past the group. Returns `nullptr` if there is nothing to align.
+  //
+  // NOTE(pag): Printing isn't thread-safe, and so this must only ever run on
+  //            one thread.
+  auto print_next_group = [&] (TLDIterator &tld_it, TLDIterator tld_end)
+      -> std::unique_ptr<TLDGroupAlignment> {
+    auto [parsed_first, parsed_last] = form_next_group(tld_it, tld_end);
+    if (!parsed_first) {
+      return nullptr;
+    }
+
+    // Initialize a new printed token range, reusing a retired one if
+    // possible.
+    std::unique_ptr<TLDGroupAlignment> group;
+    if (free_groups.empty()) {
+      group = std::make_unique<TLDGroupAlignment>(ast_context);
+    } else {
+      group = std::move(free_groups.back());
+      free_groups.pop_back();
+      group->Reset();
     }
 
-    // Unwind the tokenizer contexts (just in case the destructors still have
-    // work to do).
-    while (!context_stack.empty()) {
-      context_stack.pop_back();
+    if (!printer.Print(ast, tld_group, *group)) {
+      ast->statistics.num_tld_groups_skipped += 1u;
+      recycle_group(std::move(group));
+      return nullptr;
     }
 
-    if (range.tokens.empty()) {
-      continue;
+    group->parsed_first = parsed_first;
+    group->parsed_last = parsed_last;
+    return group;
+  };
+
+  // Migrate the token contexts of a group into the AST, in print order.
+  auto migrate_group = [&] (TLDGroupAlignment &group) {
+    ast->statistics.num_tld_groups_aligned += 1u;
+    (void) MigrateGroup(*ast, group, data_to_context, context_map);
+  };
+
+  // Form the groups, and leave their printing and alignment until someone
+  // asks for the contexts of their tokens. See `AlignTokensLazily`.
+  if (lazy) {
+    auto lazy_alignment = std::make_unique<LazyAlignment>();
+    for (auto tld_it = tlds.begin(), tld_end = tlds.end();
+         tld_it != tld_end; ) {
+      auto [parsed_first, parsed_last] = form_next_group(tld_it, tld_end);
+      if (!parsed_first) {
+        continue;
+      }
+
+      const auto group_index =
+          static_cast<uint32_t>(lazy_alignment->groups.size());
+      LazyAlignment::Group &group = lazy_alignment->groups.emplace_back();
+      group.decls = tld_group;
+      group.parsed_first = parsed_first;
+      group.parsed_last = parsed_last;
+
+      // Extend the last cluster if this group overlaps it.
+      auto &clusters = lazy_alignment->clusters;
+      if (!clusters.empty() &&
+          parsed_first <= clusters.back().parsed_last) {
+        LazyAlignment::Cluster &cluster = clusters.back();
+        cluster.parsed_last = std::max(cluster.parsed_last, parsed_last);
+        cluster.groups_end = group_index + 1u;
+
+      } else {
+        LazyAlignment::Cluster &cluster = clusters.emplace_back();
+        cluster.parsed_first = parsed_first;
+        cluster.parsed_last = parsed_last;
+        cluster.groups_begin = group_index;
+        cluster.groups_end = group_index + 1u;
+      }
     }
 
-//      // Figure out the context for the declaration itself.
-//      TokenContextIndex decl_context_id = kInvalidTokenContextIndex;
-//
-//      // Go find the context ID of the primary declaration for our first
-//      // top-level decl in this group.
-//      auto cdecl = Canonicalize(containing_decl);
-//      for (auto [dc_context_it, dc_context_end] = data_to_context.equal_range(cdecl);
-//           dc_context_it != dc_context_end; ++dc_context_it) {
-//        TokenContextIndex cid = dc_context_it->second;
-//        const auto &c = ast->contexts[cid];
-//
-//        // Make sure we find the right instance of this decl, at the right
-//        // depth. It can easily happen that we find a version of this decl
-//        // at a depth related to some internal usage.
-//        if (c.data == cdecl && c.kind == TokenContextKind::kDecl &&
-//            c.depth == (num_parents + 1u)) {
-//          decl_context_id = cid;
-//          break;
-//        }
-//      }
+    // Remember the kinds of the macro tokens before linking them, as
+    // alignment looks at the kinds of the macro tokens that are parsed.
+    lazy_alignment->unlinked_macro_token_kinds.reserve(
+        ast->root_macro_node.tokens.size());
+    for (const MacroTokenImpl &mt : ast->root_macro_node.tokens) {
+      lazy_alignment->unlinked_macro_token_kinds.push_back(
+          ast->tokens[mt.token_offset].kind);
+    }
 
-//      if (decl_context_id == kInvalidTokenContextIndex) {
-//        assert(false);
-//        decl_context_id = kTranslationUnitTokenContextIndex;
-//      }
-//
-//      assert(decl_context_id != kInvalidTokenContextIndex);
+    ast->LinkMacroTokenContexts();
+    lazy_alignment->num_contexts.store(ast->contexts.size(),
+                                       std::memory_order_release);
+    ast->lazy_alignment = std::move(lazy_alignment);
+    return AST(std::move(ast));
+  }
 
+  if (num_threads <= 1u) {
+    for (auto tld_it = tlds.begin(), tld_end = tlds.end(); tld_it != tld_end; ) {
+      std::unique_ptr<TLDGroupAlignment> group =
+          print_next_group(tld_it, tld_end);
+      if (!group) {
+        continue;
+      }
 
-//    if (auto tdecl = clang::dyn_cast<clang::ClassTemplateSpecializationDecl>(containing_decl);
-//        tdecl && tdecl->getNameAsString() == "pair" &&
-//        tdecl->isThisDeclarationADefinition()) {
-//      log = true;
-//    }
+      AlignGroup(ast, *group);
+      if (!group->result.Succeeded()) {
+        return group->result.TakeError();
+      }
 
-    // Figure out the parsed bounds. If we don't have bounds then we are
-    // probably dealing with something like a namespace / linkage spec /
-    // extern C, or an implicit declaration.
-    auto decl_bounds = ast->DeclBounds(decl);
-    if (!decl_bounds.first) {
-      continue;
+      migrate_group(*group);
+      recycle_group(std::move(group));
     }
 
-//    auto first_tok = &(ast->tokens.front());
-//    auto begin_offset = decl_bounds.first - first_tok;
-//    auto end_offset = decl_bounds.second - first_tok;
-//    auto num = (decl_bounds.second - decl_bounds.first) + 1;
+  // Print groups on this thread, align them on a pool of workers, and then
+  // retire them on this thread in print order. Each group aligns into a
+  // disjoint slice of `ast->tokens`, and into its own `range.contexts`.
+  } else {
+    std::deque<std::unique_ptr<TLDGroupAlignment>> in_flight;
+    std::optional<std::string> error;
+
+    // NOTE(pag): Declared after `in_flight` so that it is destroyed first, and
+    //            so its destructor waits for any workers still referencing the
+    //            groups in `in_flight`.
+    llvm::ThreadPool pool(llvm::hardware_concurrency(num_threads));
+
+    // Bound how many printed, but not yet retired, groups we keep around.
+    const size_t max_in_flight = num_threads * 4u;
+
+    // The last parsed token of any group that is currently in flight. If the
+    // next group overlaps with an in-flight group then we need to wait.
+    TokenImpl *in_flight_last = nullptr;
+
+    auto retire_oldest_group = [&] (void) {
+      std::unique_ptr<TLDGroupAlignment> group = std::move(in_flight.front());
+      in_flight.pop_front();
+      group->done.wait();
+      if (error) {
+        return;
+      } else if (!group->result.Succeeded()) {
+        error.emplace(group->result.TakeError());
+      } else {
+        migrate_group(*group);
+        recycle_group(std::move(group));
+      }
+    };
+
+    for (auto tld_it = tlds.begin(), tld_end = tlds.end();
+         !error && tld_it != tld_end; ) {
+      std::unique_ptr<TLDGroupAlignment> group =
+          print_next_group(tld_it, tld_end);
+      if (!group) {
+        continue;
+      }
 
-//    pasta::Token ft(ast, ast->RawTokenAt(containing_decl->getLocation()));
-//    if (auto fl = ft.FileLocation()) {
-//      auto f = pasta::File::Containing(*fl);
-//      std::cerr << f.Path().generic_string() << ':' << fl->Line() << ':' << fl->Column() << ": ";
-//    }
-//
-//    std::cerr
-//        << reinterpret_cast<const void *>(containing_decl)
-//        << " [" << begin_offset << ", " << end_offset << "] (size="
-//        << num << ") group=" << tld_group.size() << "\n";
-
-    // Clear out the old token contexts. We'll possibly detect issues here.
-    for (TokenImpl *t = decl_bounds.first; t <= decl_bounds.second; ++t) {
-//      if (t->context_index != kInvalidTokenContextIndex) {
-//        for (auto tt = decl_bounds.first; tt <= decl_bounds.second; ++tt) {
-//          if (tt->Kind() == clang::tok::string_literal) {
-//            std::cerr << "\"str\"";
-//          } else {
-//            std::cerr << tt->Data(*ast);
-//          }
-//          if (tt->context_index != kInvalidTokenContextIndex) {
-//            std::cerr << "  <<<< " << tt->context_index;
-//          }
-//          std::cerr << '\n';
-//        }
-//        assert(false);
-//      }
-      assert(t->context_index == kInvalidTokenContextIndex);
-      t->context_index = kInvalidTokenContextIndex;
+      // NOTE(pag): The serial path asserts that TLD groups don't overlap. If
+      //            they do, then fall back to aligning them one at a time.
+      if (in_flight_last && group->parsed_first <= in_flight_last) {
+        if (!in_flight.empty()) {
+          ast->statistics.num_alignment_drains += 1u;
+        }
+        while (!in_flight.empty()) {
+          retire_oldest_group();
+        }
+        in_flight_last = nullptr;
+      }
+
+      while (!error && in_flight.size() >= max_in_flight) {
+        retire_oldest_group();
+      }
+
+      if (!in_flight_last || in_flight_last < group->parsed_last) {
+        in_flight_last = group->parsed_last;
+      }
+
+      TLDGroupAlignment *group_ptr = group.get();
+      group->done = pool.async([&ast, group_ptr] (void) {
+        AlignGroup(ast, *group_ptr);
+      });
+      in_flight.emplace_back(std::move(group));
     }
 
-    auto res = AlignTokens(ast, decl_bounds.first, &(decl_bounds.second[1]),
-                           range, decl_context_id);
-    if (!res.Succeeded()) {
-      return res.TakeError();
+    while (!in_flight.empty()) {
+      retire_oldest_group();
     }
 
-    // Migrate the token contexts into the AST. This will migrate only the
-    // contexts that were actually propagated into the parsed tokens, as
-    // opposed to all token contexts.
-    context_map.clear();
-    context_map.resize(range.contexts.size());
-    for (TokenImpl *t = decl_bounds.first; t <= decl_bounds.second; ++t) {
-      t->context_index = MigrateContexts(
-          t->context_index, range.contexts, ast->contexts,
-          data_to_context, context_map);
-      assert(t->context_index != kInvalidTokenContextIndex);
+    if (error) {
+      return error.value();
     }
   }
 
@@ -2272,4 +2665,109 @@ Result<AST, std::string> ASTImpl::AlignTokens(std::shared_ptr<ASTImpl> ast) {
   return AST(std::move(ast));
 }
 
+// Align the clusters of top-level declaration groups that contain any of the
+// tokens in `[first, last]`, and that aren't yet aligned.
+//
+// NOTE(pag): Clusters are printed and aligned one at a time, under
+//            `LazyAlignment::lock`. The cluster's tokens are copied, so that
+//            the macro tokens can be put back into the state in which eager
+//            alignment sees them, aligned, and then published. Readers go
+//            through here first, and so never see unaligned tokens of an
+//            aligned cluster.
+void ASTImpl::AlignTokensLazily(const TokenImpl *first,
+                                const TokenImpl *last) {
+  LazyAlignment &lazy = *lazy_alignment;
+  auto &clusters = lazy.clusters;
+
+  // Find the first cluster that doesn't end before `first`.
+  auto it = std::lower_bound(
+      clusters.begin(), clusters.end(), first,
+      [] (const LazyAlignment::Cluster &cluster, const TokenImpl *tok) {
+        return cluster.parsed_last < tok;
+      });
+
+  std::shared_ptr<ASTImpl> self;
+  for (auto end = clusters.end(); it != end && it->parsed_first <= last;
+       ++it) {
+    LazyAlignment::Cluster &cluster = *it;
+    if (cluster.is_aligned.load(std::memory_order_acquire)) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> locker(lazy.lock);
+    if (cluster.is_aligned.load(std::memory_order_relaxed)) {
+      continue;
+    }
+
+    if (!self) {
+      self = shared_from_this();
+    }
+
+    const auto first_index =
+        static_cast<size_t>(cluster.parsed_first - tokens.data());
+    const auto num_tokens =
+        static_cast<size_t>(cluster.parsed_last - cluster.parsed_first) + 1u;
+
+    // Copy the cluster's tokens, plus the token after them. Undo
+    // `LinkMacroTokenContexts` on the copies of the macro tokens.
+    std::vector<TokenImpl> &scratch = lazy.scratch_tokens;
+    scratch.assign(cluster.parsed_first, &(cluster.parsed_last[2]));
+    for (TokenImpl &tok : scratch) {
+      if (IsLinkedMacroToken(tok)) {
+        tok.kind = lazy.unlinked_macro_token_kinds[tok.context_index];
+        tok.context_index = kInvalidTokenContextIndex;
+      }
+    }
+
+    TokenImpl * const scratch_first = scratch.data();
+    TLDGroupPrinter printer;
+
+    for (auto i = cluster.groups_begin; i < cluster.groups_end; ++i) {
+      const LazyAlignment::Group &lazy_group = lazy.groups[i];
+      TLDGroupAlignment group(tu->getASTContext());
+      if (!printer.Print(self, lazy_group.decls, group)) {
+        continue;
+      }
+
+      group.parsed_first = &(scratch_first[
+          lazy_group.parsed_first - cluster.parsed_first]);
+      group.parsed_last = &(scratch_first[
+          lazy_group.parsed_last - cluster.parsed_first]);
+
+      // NOTE(pag): Unlike eager alignment, we can't report a failure, and so
+      //            the tokens of a group that fails to align, or whose contexts
+      //            don't fit in what `AlignTokens` reserved, have no contexts.
+      AlignGroup(self, group);
+      if (!group.result.Succeeded() ||
+          !MigrateGroup(*this, group, lazy.data_to_context,
+                        lazy.context_map)) {
+        for (TokenImpl *t = group.parsed_first; t <= group.parsed_last; ++t) {
+          t->context_index = kInvalidTokenContextIndex;
+        }
+      }
+    }
+
+    // Publish the contexts. Readers of a token's context index will see the
+    // context count at least as big as that index, as they acquire
+    // `is_aligned` below.
+    lazy.num_contexts.store(contexts.size(), std::memory_order_release);
+    for (size_t i = 0u; i < num_tokens; ++i) {
+      const TokenContextIndex context_index = scratch[i].context_index;
+      if (context_index == kInvalidTokenContextIndex) {
+        continue;
+      }
+
+      TokenImpl &tok = tokens[first_index + i];
+      if (IsLinkedMacroToken(tok)) {
+        root_macro_node.tokens[tok.context_index].token_context =
+            context_index;
+      } else {
+        tok.context_index = context_index;
+      }
+    }
+
+    cluster.is_aligned.store(true, std::memory_order_release);
+  }
+}
+
 }  // namespace pasta
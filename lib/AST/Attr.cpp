@@ -78,6 +78,20 @@ std::string_view Attr::KindName(void) const noexcept {
   return ast->TokenRangeFrom(u.Attr->getRange());
 }
 
+AttrRef::AttrRef(ASTImpl *ast_, const ::clang::Attr *attr_)
+    : ast(ast_),
+      attr(attr_),
+      kind(KindOfAttr(attr_)) {}
+
+std::string_view AttrRef::KindName(void) const noexcept {
+  return kAttrNames[static_cast<unsigned>(kind)];
+}
+
+::pasta::Attr AttrRef::Owned(void) const {
+  return AttrBuilder::Create<::pasta::Attr>(
+      ast->shared_from_this(), attr);
+}
+
 Attr::Attr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Attr *attr_)    : Attr(std::move(ast_), attr_, KindOfAttr(attr_)) {}
@@ -454,6 +468,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(Attr, ZeroCallUsedRegsAttr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Attr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Attr *>(u.Attr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string_view Attr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::Attr *>(u.Attr);
   decltype(auto) val = self.getSpelling();
@@ -1148,6 +1169,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, LockReturnedAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LockReturnedAttr::ArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::LockReturnedAttr *>(u.LockReturnedAttr);
+  decltype(auto) val = self.getArg();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LockReturnedAttr::ArgumentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view LockReturnedAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::LockReturnedAttr *>(u.LockReturnedAttr);
   decltype(auto) val = self.getSpelling();
@@ -1237,6 +1268,18 @@ std::optional<::pasta::Expr> LoopHintAttr::Value(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> LoopHintAttr::ValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::LoopHintAttr *>(u.LoopHintAttr);
+  decltype(auto) val = self.getValue();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 1: LoopHintAttr::ValueString
 M68kInterruptAttr::M68kInterruptAttr(
     std::shared_ptr<ASTImpl> ast_,
@@ -1761,6 +1804,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, NSErrorDomainAttr)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NSErrorDomainAttr::ErrorDomainRef(void) const noexcept {
+  auto &self = *const_cast<clang::NSErrorDomainAttr *>(u.NSErrorDomainAttr);
+  decltype(auto) val = self.getErrorDomain();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NSErrorDomainAttr::ErrorDomainRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view NSErrorDomainAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::NSErrorDomainAttr *>(u.NSErrorDomainAttr);
   decltype(auto) val = self.getSpelling();
@@ -2331,6 +2384,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, OMPAllocateDeclAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAllocateDeclAttr::AlignmentRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAllocateDeclAttr *>(u.OMPAllocateDeclAttr);
+  decltype(auto) val = self.getAlignment();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAllocateDeclAttr::AlignmentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAllocateDeclAttr::Allocator(void) const noexcept {
   auto &self = *const_cast<clang::OMPAllocateDeclAttr *>(u.OMPAllocateDeclAttr);
   decltype(auto) val = self.getAllocator();
@@ -2341,6 +2404,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, OMPAllocateDeclAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAllocateDeclAttr::AllocatorRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAllocateDeclAttr *>(u.OMPAllocateDeclAttr);
+  decltype(auto) val = self.getAllocator();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAllocateDeclAttr::AllocatorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum OMPAllocateDeclAttrAllocatorTypeTy OMPAllocateDeclAttr::AllocatorType(void) const noexcept {
   auto &self = *const_cast<clang::OMPAllocateDeclAttr *>(u.OMPAllocateDeclAttr);
   decltype(auto) val = self.getAllocatorType();
@@ -2439,6 +2512,16 @@ enum OMPDeclareSimdDeclAttrBranchStateTy OMPDeclareSimdDeclAttr::BranchState(voi
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareSimdDeclAttr::SimdlenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareSimdDeclAttr *>(u.OMPDeclareSimdDeclAttr);
+  decltype(auto) val = self.getSimdlen();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareSimdDeclAttr::SimdlenRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view OMPDeclareSimdDeclAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareSimdDeclAttr *>(u.OMPDeclareSimdDeclAttr);
   decltype(auto) val = self.getSpelling();
@@ -2499,6 +2582,16 @@ bool OMPDeclareTargetDeclAttr::Indirect(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareTargetDeclAttr::IndirectExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareTargetDeclAttr *>(u.OMPDeclareTargetDeclAttr);
+  decltype(auto) val = self.getIndirectExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareTargetDeclAttr::IndirectExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t OMPDeclareTargetDeclAttr::Level(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareTargetDeclAttr *>(u.OMPDeclareTargetDeclAttr);
   decltype(auto) val = self.getLevel();
@@ -2568,6 +2661,16 @@ std::string_view OMPDeclareVariantAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareVariantAttr::VariantFuncReferenceRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareVariantAttr *>(u.OMPDeclareVariantAttr);
+  decltype(auto) val = self.getVariantFuncRef();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareVariantAttr::VariantFuncReferenceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPReferencedVarAttr::OMPReferencedVarAttr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Attr *attr_)
@@ -2585,6 +2688,16 @@ PASTA_DEFINE_BASE_OPERATORS(Attr, OMPReferencedVarAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPReferencedVarAttr::ReferenceRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPReferencedVarAttr *>(u.OMPReferencedVarAttr);
+  decltype(auto) val = self.getRef();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPReferencedVarAttr::ReferenceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view OMPReferencedVarAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::OMPReferencedVarAttr *>(u.OMPReferencedVarAttr);
   decltype(auto) val = self.getSpelling();
@@ -3429,6 +3542,14 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, OwnerAttr)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef OwnerAttr::DerefTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::OwnerAttr *>(u.OwnerAttr);
+  decltype(auto) val = self.getDerefType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type OwnerAttr::DerefTypeToken(void) const noexcept {
   auto &self = *const_cast<clang::OwnerAttr *>(u.OwnerAttr);
   decltype(auto) val = self.getDerefTypeLoc();
@@ -3702,6 +3823,14 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, PointerAttr)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PointerAttr::DerefTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::PointerAttr *>(u.PointerAttr);
+  decltype(auto) val = self.getDerefType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type PointerAttr::DerefTypeToken(void) const noexcept {
   auto &self = *const_cast<clang::PointerAttr *>(u.PointerAttr);
   decltype(auto) val = self.getDerefTypeLoc();
@@ -3940,6 +4069,14 @@ std::string_view PreferredNameAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PreferredNameAttr::TypedefTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::PreferredNameAttr *>(u.PreferredNameAttr);
+  decltype(auto) val = self.getTypedefType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type PreferredNameAttr::TypedefTypeToken(void) const noexcept {
   auto &self = *const_cast<clang::PreferredNameAttr *>(u.PreferredNameAttr);
   decltype(auto) val = self.getTypedefTypeLoc();
@@ -4006,6 +4143,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, PtGuardedByAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef PtGuardedByAttr::ArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::PtGuardedByAttr *>(u.PtGuardedByAttr);
+  decltype(auto) val = self.getArg();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "PtGuardedByAttr::ArgumentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view PtGuardedByAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::PtGuardedByAttr *>(u.PtGuardedByAttr);
   decltype(auto) val = self.getSpelling();
@@ -4649,6 +4796,16 @@ std::string_view SharedTrylockFunctionAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SharedTrylockFunctionAttr::SuccessValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::SharedTrylockFunctionAttr *>(u.SharedTrylockFunctionAttr);
+  decltype(auto) val = self.getSuccessValue();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SharedTrylockFunctionAttr::SuccessValueRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 SpeculativeLoadHardeningAttr::SpeculativeLoadHardeningAttr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Attr *attr_)
@@ -5516,6 +5673,16 @@ std::string_view TryAcquireCapabilityAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef TryAcquireCapabilityAttr::SuccessValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::TryAcquireCapabilityAttr *>(u.TryAcquireCapabilityAttr);
+  decltype(auto) val = self.getSuccessValue();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TryAcquireCapabilityAttr::SuccessValueRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool TryAcquireCapabilityAttr::IsShared(void) const noexcept {
   auto &self = *const_cast<clang::TryAcquireCapabilityAttr *>(u.TryAcquireCapabilityAttr);
   decltype(auto) val = self.isShared();
@@ -5657,6 +5824,14 @@ bool TypeTagForDatatypeAttr::LayoutCompatible(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TypeTagForDatatypeAttr::MatchingCTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeTagForDatatypeAttr *>(u.TypeTagForDatatypeAttr);
+  decltype(auto) val = self.getMatchingCType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type TypeTagForDatatypeAttr::MatchingCTypeToken(void) const noexcept {
   auto &self = *const_cast<clang::TypeTagForDatatypeAttr *>(u.TypeTagForDatatypeAttr);
   decltype(auto) val = self.getMatchingCTypeLoc();
@@ -5951,6 +6126,16 @@ std::string_view UuidAttr::Guid(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UuidAttr::GuidDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UuidAttr *>(u.UuidAttr);
+  decltype(auto) val = self.getGuidDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UuidAttr::GuidDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t UuidAttr::GuidLength(void) const noexcept {
   auto &self = *const_cast<clang::UuidAttr *>(u.UuidAttr);
   decltype(auto) val = self.getGuidLength();
@@ -6018,6 +6203,14 @@ std::string_view VecTypeHintAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef VecTypeHintAttr::TypeHintRef(void) const noexcept {
+  auto &self = *const_cast<clang::VecTypeHintAttr *>(u.VecTypeHintAttr);
+  decltype(auto) val = self.getTypeHint();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type VecTypeHintAttr::TypeHintToken(void) const noexcept {
   auto &self = *const_cast<clang::VecTypeHintAttr *>(u.VecTypeHintAttr);
   decltype(auto) val = self.getTypeHintLoc();
@@ -6551,6 +6744,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, AMDGPUFlatWorkGroupSizeAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AMDGPUFlatWorkGroupSizeAttr::MaxRef(void) const noexcept {
+  auto &self = *const_cast<clang::AMDGPUFlatWorkGroupSizeAttr *>(u.AMDGPUFlatWorkGroupSizeAttr);
+  decltype(auto) val = self.getMax();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AMDGPUFlatWorkGroupSizeAttr::MaxRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AMDGPUFlatWorkGroupSizeAttr::Min(void) const noexcept {
   auto &self = *const_cast<clang::AMDGPUFlatWorkGroupSizeAttr *>(u.AMDGPUFlatWorkGroupSizeAttr);
   decltype(auto) val = self.getMin();
@@ -6561,6 +6764,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, AMDGPUFlatWorkGroupSizeAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AMDGPUFlatWorkGroupSizeAttr::MinRef(void) const noexcept {
+  auto &self = *const_cast<clang::AMDGPUFlatWorkGroupSizeAttr *>(u.AMDGPUFlatWorkGroupSizeAttr);
+  decltype(auto) val = self.getMin();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AMDGPUFlatWorkGroupSizeAttr::MinRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view AMDGPUFlatWorkGroupSizeAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::AMDGPUFlatWorkGroupSizeAttr *>(u.AMDGPUFlatWorkGroupSizeAttr);
   decltype(auto) val = self.getSpelling();
@@ -6665,6 +6878,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, AMDGPUWavesPerEUAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AMDGPUWavesPerEUAttr::MaxRef(void) const noexcept {
+  auto &self = *const_cast<clang::AMDGPUWavesPerEUAttr *>(u.AMDGPUWavesPerEUAttr);
+  decltype(auto) val = self.getMax();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AMDGPUWavesPerEUAttr::MaxRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AMDGPUWavesPerEUAttr::Min(void) const noexcept {
   auto &self = *const_cast<clang::AMDGPUWavesPerEUAttr *>(u.AMDGPUWavesPerEUAttr);
   decltype(auto) val = self.getMin();
@@ -6675,6 +6898,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, AMDGPUWavesPerEUAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AMDGPUWavesPerEUAttr::MinRef(void) const noexcept {
+  auto &self = *const_cast<clang::AMDGPUWavesPerEUAttr *>(u.AMDGPUWavesPerEUAttr);
+  decltype(auto) val = self.getMin();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AMDGPUWavesPerEUAttr::MinRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view AMDGPUWavesPerEUAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::AMDGPUWavesPerEUAttr *>(u.AMDGPUWavesPerEUAttr);
   decltype(auto) val = self.getSpelling();
@@ -7016,6 +7249,16 @@ PASTA_DEFINE_BASE_OPERATORS(Attr, AlignValueAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AlignValueAttr::AlignmentRef(void) const noexcept {
+  auto &self = *const_cast<clang::AlignValueAttr *>(u.AlignValueAttr);
+  decltype(auto) val = self.getAlignment();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AlignValueAttr::AlignmentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view AlignValueAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::AlignValueAttr *>(u.AlignValueAttr);
   decltype(auto) val = self.getSpelling();
@@ -7058,6 +7301,21 @@ std::optional<::pasta::Expr> AlignedAttr::AlignmentExpression(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AlignedAttr::AlignmentExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::AlignedAttr *>(u.AlignedAttr);
+  if (!self.isAlignmentExpr()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getAlignmentExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> AlignedAttr::AlignmentType(void) const noexcept {
   auto &self = *const_cast<clang::AlignedAttr *>(u.AlignedAttr);
   if (self.isAlignmentExpr()) {
@@ -7643,6 +7901,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, AssumeAlignedAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AssumeAlignedAttr::AlignmentRef(void) const noexcept {
+  auto &self = *const_cast<clang::AssumeAlignedAttr *>(u.AssumeAlignedAttr);
+  decltype(auto) val = self.getAlignment();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AssumeAlignedAttr::AlignmentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> AssumeAlignedAttr::Offset(void) const noexcept {
   auto &self = *const_cast<clang::AssumeAlignedAttr *>(u.AssumeAlignedAttr);
   decltype(auto) val = self.getOffset();
@@ -7655,6 +7923,18 @@ std::optional<::pasta::Expr> AssumeAlignedAttr::Offset(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AssumeAlignedAttr::OffsetRef(void) const noexcept {
+  auto &self = *const_cast<clang::AssumeAlignedAttr *>(u.AssumeAlignedAttr);
+  decltype(auto) val = self.getOffset();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::string_view AssumeAlignedAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::AssumeAlignedAttr *>(u.AssumeAlignedAttr);
   decltype(auto) val = self.getSpelling();
@@ -8325,6 +8605,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, CUDALaunchBoundsAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CUDALaunchBoundsAttr::MaxThreadsRef(void) const noexcept {
+  auto &self = *const_cast<clang::CUDALaunchBoundsAttr *>(u.CUDALaunchBoundsAttr);
+  decltype(auto) val = self.getMaxThreads();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CUDALaunchBoundsAttr::MaxThreadsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CUDALaunchBoundsAttr::MinBlocks(void) const noexcept {
   auto &self = *const_cast<clang::CUDALaunchBoundsAttr *>(u.CUDALaunchBoundsAttr);
   decltype(auto) val = self.getMinBlocks();
@@ -8335,6 +8625,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, CUDALaunchBoundsAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CUDALaunchBoundsAttr::MinBlocksRef(void) const noexcept {
+  auto &self = *const_cast<clang::CUDALaunchBoundsAttr *>(u.CUDALaunchBoundsAttr);
+  decltype(auto) val = self.getMinBlocks();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CUDALaunchBoundsAttr::MinBlocksRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view CUDALaunchBoundsAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::CUDALaunchBoundsAttr *>(u.CUDALaunchBoundsAttr);
   decltype(auto) val = self.getSpelling();
@@ -8553,6 +8853,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, CleanupAttr)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CleanupAttr::FunctionDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CleanupAttr *>(u.CleanupAttr);
+  decltype(auto) val = self.getFunctionDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CleanupAttr::FunctionDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view CleanupAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::CleanupAttr *>(u.CleanupAttr);
   decltype(auto) val = self.getSpelling();
@@ -9034,6 +9344,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, DiagnoseAsBuiltinAttr)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef DiagnoseAsBuiltinAttr::FunctionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DiagnoseAsBuiltinAttr *>(u.DiagnoseAsBuiltinAttr);
+  decltype(auto) val = self.getFunction();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DiagnoseAsBuiltinAttr::FunctionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view DiagnoseAsBuiltinAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::DiagnoseAsBuiltinAttr *>(u.DiagnoseAsBuiltinAttr);
   decltype(auto) val = self.getSpelling();
@@ -9071,6 +9391,16 @@ bool DiagnoseIfAttr::ArgumentDependent(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DiagnoseIfAttr::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DiagnoseIfAttr *>(u.DiagnoseIfAttr);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DiagnoseIfAttr::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum DiagnoseIfAttrDiagnosticType DiagnoseIfAttr::DiagnosticType(void) const noexcept {
   auto &self = *const_cast<clang::DiagnoseIfAttr *>(u.DiagnoseIfAttr);
   decltype(auto) val = self.getDiagnosticType();
@@ -9106,6 +9436,16 @@ uint32_t DiagnoseIfAttr::MessageLength(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef DiagnoseIfAttr::ParentRef(void) const noexcept {
+  auto &self = *const_cast<clang::DiagnoseIfAttr *>(u.DiagnoseIfAttr);
+  decltype(auto) val = self.getParent();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DiagnoseIfAttr::ParentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view DiagnoseIfAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::DiagnoseIfAttr *>(u.DiagnoseIfAttr);
   decltype(auto) val = self.getSpelling();
@@ -9210,6 +9550,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, EnableIfAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef EnableIfAttr::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnableIfAttr *>(u.EnableIfAttr);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "EnableIfAttr::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view EnableIfAttr::Message(void) const noexcept {
   auto &self = *const_cast<clang::EnableIfAttr *>(u.EnableIfAttr);
   decltype(auto) val = self.getMessage();
@@ -9456,6 +9806,16 @@ std::string_view ExclusiveTrylockFunctionAttr::Spelling(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ExclusiveTrylockFunctionAttr::SuccessValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExclusiveTrylockFunctionAttr *>(u.ExclusiveTrylockFunctionAttr);
+  decltype(auto) val = self.getSuccessValue();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ExclusiveTrylockFunctionAttr::SuccessValueRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ExternalSourceSymbolAttr::ExternalSourceSymbolAttr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Attr *attr_)
@@ -9742,6 +10102,16 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, GuardedByAttr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef GuardedByAttr::ArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::GuardedByAttr *>(u.GuardedByAttr);
+  decltype(auto) val = self.getArg();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "GuardedByAttr::ArgumentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view GuardedByAttr::Spelling(void) const noexcept {
   auto &self = *const_cast<clang::GuardedByAttr *>(u.GuardedByAttr);
   decltype(auto) val = self.getSpelling();
@@ -9940,6 +10310,14 @@ PASTA_DEFINE_BASE_OPERATORS(InheritableAttr, IBOutletCollectionAttr)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef IBOutletCollectionAttr::InterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::IBOutletCollectionAttr *>(u.IBOutletCollectionAttr);
+  decltype(auto) val = self.getInterface();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type IBOutletCollectionAttr::InterfaceToken(void) const noexcept {
   auto &self = *const_cast<clang::IBOutletCollectionAttr *>(u.IBOutletCollectionAttr);
   decltype(auto) val = self.getInterfaceLoc();
@@ -2006,13 +2006,11 @@ std::pair<TokenImpl *, TokenImpl *> ASTImpl::DeclBounds(clang::Decl *decl) {
   return ret;
 }
 
-// Return a token range for the bounds of a declaration.
-TokenRange ASTImpl::DeclTokenRange(const clang::Decl *decl_) {
-  std::unique_lock<std::mutex> locker(bounds_mutex);
-
-  auto decl = const_cast<clang::Decl *>(decl_);
+// Return the inclusive bounds of a declaration as used by `DeclTokenRange`.
+std::pair<TokenImpl *, TokenImpl *> ASTImpl::DeclTokenBounds(
+    clang::Decl *decl) {
   if (auto [first, last] = DeclBounds(decl); first && first <= last) {
-    return TokenRange(this->shared_from_this(), first, &(last[1]));
+    return {first, last};
   }
 
   // We might be asking for the bounds of a template specialization, so go
@@ -2020,10 +2018,63 @@ TokenRange ASTImpl::DeclTokenRange(const clang::Decl *decl_) {
   if (auto remapped_decl = RemapDecl(decl);
       remapped_decl && remapped_decl != decl) {
     bounds[decl] = DeclBounds(remapped_decl);
-    return DeclTokenRange(remapped_decl);
+    return DeclTokenBounds(remapped_decl);
+  }
+
+  return {nullptr, nullptr};
+}
+
+// Return a token range for the bounds of a declaration.
+TokenRange ASTImpl::DeclTokenRange(const clang::Decl *decl_) {
+  Rehydrate();
+  auto decl = const_cast<clang::Decl *>(decl_);
+  std::pair<TokenImpl *, TokenImpl *> decl_bounds;
+
+  if (auto ordinal = decl_ordinals.Find(decl)) {
+    decl_bounds = dense_decl_bounds[*ordinal];
+  } else {
+    std::unique_lock<std::mutex> locker(bounds_mutex);
+    decl_bounds = DeclTokenBounds(decl);
+  }
+
+  if (auto [first, last] = decl_bounds; first) {
+    AlignTokensOnDemand(first, last);
+    return TokenRange(this->shared_from_this(), first, &(last[1]));
   }
 
   return TokenRange(this->shared_from_this());
 }
 
+// Compute the bounds of every lexically nested declaration into
+// `dense_decl_bounds`.
+//
+// NOTE(pag): This must run before the `AST` is shared with other threads, as
+//            `DeclTokenRange` reads `decl_ordinals` and `dense_decl_bounds`
+//            without holding `bounds_mutex`.
+void ASTImpl::PrecomputeDeclBounds(void) {
+  std::vector<clang::DeclContext *> work_list;
+
+  decl_ordinals.Emplace(tu, 0u);
+  dense_decl_bounds.emplace_back(DeclTokenBounds(tu));
+  work_list.push_back(tu);
+
+  while (!work_list.empty()) {
+    clang::DeclContext *dc = work_list.back();
+    work_list.pop_back();
+
+    for (clang::Decl *decl : dc->decls()) {
+      const auto ordinal = static_cast<uint32_t>(dense_decl_bounds.size());
+      assert(ordinal == dense_decl_bounds.size());
+      if (!decl_ordinals.Emplace(decl, ordinal).second) {
+        continue;
+      }
+
+      dense_decl_bounds.emplace_back(DeclTokenBounds(decl));
+      if (auto sub_dc = clang::dyn_cast<clang::DeclContext>(decl)) {
+        work_list.push_back(sub_dc);
+      }
+    }
+  }
+}
+
 }  // namespace pasta
@@ -22,6 +22,55 @@ Type TypeBuilder::Build(std::shared_ptr<ASTImpl> ast_, clang::QualType type) {
   assert(false && "`type` is a null type.");
   abort();
 }
+
+DeclRef RefBuilder::Create(ASTImpl &ast_, const clang::Decl *decl_) {
+  return DeclRef(&ast_, decl_);
+}
+
+StmtRef RefBuilder::Create(ASTImpl &ast_, const clang::Stmt *stmt_) {
+  return StmtRef(&ast_, stmt_);
+}
+
+TypeRef RefBuilder::Create(ASTImpl &ast_, const clang::Type *type_) {
+  return TypeRef(&ast_, type_, 0);
+}
+
+TypeRef RefBuilder::Create(ASTImpl &ast_, clang::QualType type_) {
+  if (auto type_ptr = type_.getTypePtrOrNull();
+      4095ul < reinterpret_cast<uintptr_t>(type_ptr)) {
+    return TypeRef(&ast_, type_ptr,
+                   type_.getQualifiers().getAsOpaqueValue());
+  }
+  assert(false && "`type_` is a null type.");
+  abort();
+}
+
+AttrRef RefBuilder::Create(ASTImpl &ast_, const clang::Attr *attr_) {
+  return AttrRef(&ast_, attr_);
+}
+
+TokenRef RefBuilder::Create(ASTImpl &ast_, clang::SourceLocation loc_) {
+  return TokenRef(&ast_, ast_.RawTokenAt(loc_));
+}
+
+// Mirrors `ASTImpl::TokenRangeFrom`.
+TokenRefRange RefBuilder::Create(ASTImpl &ast_, clang::SourceRange range_) {
+  const TokenImpl *begin = ast_.RawTokenAt(range_.getBegin());
+  const TokenImpl *end = ast_.RawTokenAt(range_.getEnd());
+  if (begin && end) {
+    if (begin <= end) {
+      return TokenRefRange(&ast_, begin, &(end[1]));
+    } else {
+      return TokenRefRange(&ast_, end, &(begin[1]));
+    }
+  } else if (begin) {
+    return TokenRefRange(&ast_, begin, &(begin[1]));
+  } else if (end) {
+    return TokenRefRange(&ast_, end, &(end[1]));
+  } else {
+    return TokenRefRange(&ast_, nullptr, nullptr);
+  }
+}
 #endif
 
 }  // namespace pasta
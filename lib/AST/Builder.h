@@ -72,4 +72,37 @@ class TypeBuilder {
 #endif
 };
 
+#ifndef PASTA_IN_BOOTSTRAP
+// Makes the lazy ranges returned by e.g. `Decl::AttributesRange` from the
+// Clang list that they walk. See `DeclHead.cpp`.
+class RangeBuilder {
+ public:
+  static AttrRange Create(
+      std::shared_ptr<ASTImpl> ast_, const clang::Decl &decl_,
+      llvm::iterator_range<clang::Attr *const *> attrs_);
+
+  static RedeclarationRange Create(
+      std::shared_ptr<ASTImpl> ast_, const clang::Decl &decl_,
+      llvm::iterator_range<clang::Decl::redecl_iterator> redecls_);
+
+  static StmtChildRange Create(
+      std::shared_ptr<ASTImpl> ast_, const clang::Stmt &stmt_,
+      llvm::iterator_range<clang::StmtIterator> children_);
+};
+
+// Makes the borrowed handles returned by the `Ref` variants of generated
+// methods, e.g. `VarDecl::InitializerRef`. These don't touch the reference
+// count of `ast_`.
+class RefBuilder {
+ public:
+  static DeclRef Create(ASTImpl &ast_, const clang::Decl *decl_);
+  static StmtRef Create(ASTImpl &ast_, const clang::Stmt *stmt_);
+  static TypeRef Create(ASTImpl &ast_, const clang::Type *type_);
+  static TypeRef Create(ASTImpl &ast_, clang::QualType type_);
+  static AttrRef Create(ASTImpl &ast_, const clang::Attr *attr_);
+  static TokenRef Create(ASTImpl &ast_, clang::SourceLocation loc_);
+  static TokenRefRange Create(ASTImpl &ast_, clang::SourceRange range_);
+};
+#endif
+
 }  // namespace pasta
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Sema/Sema.h>
+#pragma GCC diagnostic pop
+
+#include "AST.h"
+#include "LazyAlignment.h"
+
+namespace pasta {
+
+// Release the state that is only needed while building this AST, and shrink
+// what remains to fit. See `CompileJobOptions::compact_ast`.
+//
+// NOTE(pag): This must run before the `AST` is shared, as it moves `tokens`,
+//            `contexts`, and `backup_token_data`, which `Token`s, `Decl`s,
+//            etc. point into.
+void ASTImpl::Compact(void) {
+
+  // The parser is gone (see `CompileJob::Run`), and nothing in PASTA asks
+  // Clang to do semantic analysis, so drop `Sema` and its lookup tables. The
+  // `ASTContext` and both preprocessors stay alive: declarations and types
+  // live in the former, the printer looks up keywords in `orig_source_pp`,
+  // and macro nodes point to `clang::MacroInfo`s allocated by it.
+  if (ci->hasSema()) {
+    ci->setSema(nullptr);
+  }
+
+  // These are only read when forming top-level declaration groups, which
+  // alignment has already done, or are caches that are refilled on demand.
+  //
+  // NOTE(pag): `remapped_decls` looks similar, but isn't refilled for decl
+  //            contexts whose bounds are already in `bounds`, so it stays.
+  lexically_containing_decl = {};
+  matching = {};
+
+  // Move `tokens` into a right-sized buffer, then fix up everything that
+  // points into it.
+  const auto old_tokens = reinterpret_cast<uintptr_t>(tokens.data());
+  tokens.shrink_to_fit();
+  RebaseTokenPointers(old_tokens);
+
+  // Alignment reserves room for many more contexts than it usually makes.
+  // Lazy alignment still needs that room, as it relies on `contexts` never
+  // moving once the `AST` is shared.
+  if (!lazy_alignment) {
+    contexts.shrink_to_fit();
+  }
+
+  // NOTE(pag): `preprocessed_code` can't move, as Clang's source manager
+  //            has a memory buffer pointing into it.
+  backup_token_data.shrink_to_fit();
+
+  dense_decl_bounds.shrink_to_fit();
+  parsed_files.shrink_to_fit();
+  root_macro_node.token_nodes.shrink_to_fit();
+}
+
+// Fix up the pointers into `tokens` after it moved from `old_tokens`.
+//
+// NOTE(pag): `old_tokens` is an address rather than a pointer, as the old
+//            tokens are usually freed by now.
+void ASTImpl::RebaseTokenPointers(uintptr_t old_tokens) {
+  TokenImpl * const new_tokens = tokens.data();
+  if (reinterpret_cast<uintptr_t>(new_tokens) == old_tokens) {
+    return;
+  }
+
+  auto rebase = [=] (TokenImpl *&tok) {
+    if (tok) {
+      const auto offset = reinterpret_cast<uintptr_t>(tok) - old_tokens;
+      tok = &(new_tokens[offset / sizeof(TokenImpl)]);
+    }
+  };
+
+  for (auto &[data, decl_bounds] : bounds) {
+    rebase(decl_bounds.first);
+    rebase(decl_bounds.second);
+  }
+
+  for (auto &decl_bounds : dense_decl_bounds) {
+    rebase(decl_bounds.first);
+    rebase(decl_bounds.second);
+  }
+
+  // NOTE(pag): The matching tokens are a cache, and are cheaper to refill
+  //            than to rebase.
+  matching = {};
+
+  if (lazy_alignment) {
+    for (LazyAlignment::Group &group : lazy_alignment->groups) {
+      rebase(group.parsed_first);
+      rebase(group.parsed_last);
+    }
+    for (LazyAlignment::Cluster &cluster : lazy_alignment->clusters) {
+      rebase(cluster.parsed_first);
+      rebase(cluster.parsed_last);
+    }
+  }
+}
+
+}  // namespace pasta
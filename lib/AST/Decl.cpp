@@ -581,6 +581,30 @@ std::string_view Decl::KindName(void) const noexcept {
   return ast->TokenAt(loc);
 }
 
+DeclRef::DeclRef(ASTImpl *ast_, const ::clang::Decl *decl_)
+    : ast(ast_),
+      decl(decl_),
+      kind(KindOfDecl(decl_)) {}
+
+std::string_view DeclRef::KindName(void) const noexcept {
+  return kKindNames[static_cast<unsigned>(kind)];
+}
+
+::pasta::Decl DeclRef::Owned(void) const {
+  return DeclBuilder::Create<::pasta::Decl>(
+      ast->shared_from_this(), decl);
+}
+
+::pasta::DeclContextRange<::pasta::DeclRef> DeclContext::DeclarationRefs(void) const noexcept {
+  decltype(auto) val = u.DeclContext->decls();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::DeclRef>(
+      ast, first, nullptr);
+}
+
 // 1: DeclContext::Encloses
 // 1: DeclContext::Equals
 // 1: DeclContext::InEnclosingNamespaceSetOf
@@ -600,6 +624,17 @@ std::vector<::pasta::Decl> DeclContext::Declarations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::Decl> DeclContext::DeclarationsRange(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.decls();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::Decl>(
+      ast, first, nullptr);
+}
+
 // 0: DeclContext::
 // 0: DeclContext::
 // 0: DeclContext::
@@ -646,6 +681,18 @@ std::optional<::pasta::LinkageSpecDecl> DeclContext::ExternCContext(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> DeclContext::ExternCContextRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.getExternCContext();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::BlockDecl> DeclContext::InnermostBlockDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.getInnermostBlockDecl();
@@ -658,6 +705,18 @@ std::optional<::pasta::BlockDecl> DeclContext::InnermostBlockDeclaration(void) c
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> DeclContext::InnermostBlockDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.getInnermostBlockDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclContext> DeclContext::LexicalParent(void) const noexcept {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.getLexicalParent();
@@ -695,6 +754,18 @@ std::optional<::pasta::Decl> DeclContext::NonClosureAncestor(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> DeclContext::NonClosureAncestorRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.getNonClosureAncestor();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::DeclContext DeclContext::NonTransparentContext(void) const noexcept {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.getNonTransparentContext();
@@ -717,6 +788,18 @@ std::optional<::pasta::RecordDecl> DeclContext::OuterLexicalRecordContext(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> DeclContext::OuterLexicalRecordContextRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.getOuterLexicalRecordContext();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclContext> DeclContext::Parent(void) const noexcept {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.getParent();
@@ -880,6 +963,17 @@ std::vector<::pasta::Decl> DeclContext::AlreadyLoadedDeclarations(void) const no
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::Decl> DeclContext::AlreadyLoadedDeclarationsRange(void) const noexcept {
+  auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
+  decltype(auto) val = self.noload_decls();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::Decl>(
+      ast, first, nullptr);
+}
+
 // 0: DeclContext::
 // 0: DeclContext::
 // 1: DeclContext::NoloadLookups
@@ -1010,6 +1104,12 @@ std::vector<::pasta::Attr> Decl::Attributes(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::AttrRange Decl::AttributesRange(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.attrs();
+  return RangeBuilder::Create(ast, self, val);
+}
+
 // 1: Decl::CanBeWeakImported
 // 0: Decl::ASTContext
 enum AccessSpecifier Decl::Access(void) const noexcept {
@@ -1031,6 +1131,18 @@ std::optional<::pasta::FunctionDecl> Decl::AsFunction(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Decl::AsFunctionRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getAsFunction();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: Decl::Attributes
 enum AvailabilityResult Decl::Availability(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
@@ -1046,6 +1158,13 @@ enum AvailabilityResult Decl::Availability(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Decl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Decl Decl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -1056,6 +1175,16 @@ enum AvailabilityResult Decl::Availability(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef Decl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Decl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::DeclContext Decl::DeclarationContext(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getDeclContext();
@@ -1078,6 +1207,18 @@ std::optional<::pasta::Attr> Decl::DefiningAttribute(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::AttrRef> Decl::DefiningAttributeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getDefiningAttr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TemplateDecl> Decl::DescribedTemplate(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getDescribedTemplate();
@@ -1090,6 +1231,18 @@ std::optional<::pasta::TemplateDecl> Decl::DescribedTemplate(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Decl::DescribedTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getDescribedTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TemplateParameterList> Decl::DescribedTemplateParameters(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getDescribedTemplateParams();
@@ -1107,6 +1260,13 @@ std::optional<::pasta::TemplateParameterList> Decl::DescribedTemplateParameters(
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Decl::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ExternalSourceSymbolAttr> Decl::ExternalSourceSymbolAttribute(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getExternalSourceSymbolAttr();
@@ -1119,6 +1279,18 @@ std::optional<::pasta::ExternalSourceSymbolAttr> Decl::ExternalSourceSymbolAttri
   __builtin_unreachable();
 }
 
+std::optional<::pasta::AttrRef> Decl::ExternalSourceSymbolAttributeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getExternalSourceSymbolAttr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum DeclFriendObjectKind Decl::FriendObjectKind(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getFriendObjectKind();
@@ -1138,6 +1310,18 @@ std::optional<::pasta::FunctionType> Decl::FunctionType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Decl::FunctionTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getFunctionType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t Decl::GlobalID(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getGlobalID();
@@ -1196,6 +1380,16 @@ enum DeclModuleOwnershipKind Decl::ModuleOwnershipKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef Decl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Decl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Decl> Decl::NextDeclarationInContext(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getNextDeclInContext();
@@ -1208,6 +1402,18 @@ std::optional<::pasta::Decl> Decl::NextDeclarationInContext(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Decl::NextDeclarationInContextRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getNextDeclInContext();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Decl> Decl::NonClosureContext(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getNonClosureContext();
@@ -1220,6 +1426,18 @@ std::optional<::pasta::Decl> Decl::NonClosureContext(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Decl::NonClosureContextRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getNonClosureContext();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: Decl::OwningModule
 // 0: Decl::OwningModuleForLinkage
 uint32_t Decl::OwningModuleID(void) const noexcept {
@@ -1253,6 +1471,18 @@ std::optional<::pasta::Decl> Decl::PreviousDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Decl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t Decl::TemplateDepth(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.getTemplateDepth();
@@ -1270,6 +1500,16 @@ uint32_t Decl::TemplateDepth(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef Decl::TranslationUnitDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.getTranslationUnitDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Decl::TranslationUnitDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: Decl::VersionIntroduced
 bool Decl::HasAttributes(void) const noexcept {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
@@ -1516,6 +1756,12 @@ std::vector<::pasta::Decl> Decl::Redeclarations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::RedeclarationRange Decl::RedeclarationsRange(void) const noexcept {
+  auto &self = *const_cast<clang::Decl *>(u.Decl);
+  decltype(auto) val = self.redecls();
+  return RangeBuilder::Create(ast, self, val);
+}
+
 // 0: Decl::
 // 0: Decl::
 EmptyDecl::EmptyDecl(
@@ -1538,6 +1784,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ExportDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExportDecl::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExportDecl::ExportToken(void) const noexcept {
   auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
   decltype(auto) val = self.getExportLoc();
@@ -1545,6 +1798,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ExportDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExportDecl::ExportTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
+  decltype(auto) val = self.getExportLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExportDecl::RBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
   decltype(auto) val = self.getRBraceLoc();
@@ -1552,6 +1812,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ExportDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExportDecl::RBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
+  decltype(auto) val = self.getRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ExportDecl::HasBraces(void) const noexcept {
   auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
   decltype(auto) val = self.hasBraces();
@@ -1579,6 +1846,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, FileScopeAsmDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FileScopeAsmDecl::AssemblyTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl);
+  decltype(auto) val = self.getAsmLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::StringLiteral FileScopeAsmDecl::AssemblyString(void) const noexcept {
   auto &self = *const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl);
   decltype(auto) val = self.getAsmString();
@@ -1589,6 +1863,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, FileScopeAsmDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef FileScopeAsmDecl::AssemblyStringRef(void) const noexcept {
+  auto &self = *const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl);
+  decltype(auto) val = self.getAsmString();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FileScopeAsmDecl::AssemblyStringRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token FileScopeAsmDecl::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl);
   decltype(auto) val = self.getRParenLoc();
@@ -1596,6 +1880,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, FileScopeAsmDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FileScopeAsmDecl::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 FriendDecl::FriendDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -1614,6 +1905,18 @@ std::optional<::pasta::NamedDecl> FriendDecl::FriendDeclaration(void) const noex
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FriendDecl::FriendDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FriendDecl *>(u.FriendDecl);
+  decltype(auto) val = self.getFriendDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token FriendDecl::FriendToken(void) const noexcept {
   auto &self = *const_cast<clang::FriendDecl *>(u.FriendDecl);
   decltype(auto) val = self.getFriendLoc();
@@ -1621,6 +1924,13 @@ std::optional<::pasta::NamedDecl> FriendDecl::FriendDeclaration(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FriendDecl::FriendTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FriendDecl *>(u.FriendDecl);
+  decltype(auto) val = self.getFriendLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> FriendDecl::FriendType(void) const noexcept {
   auto &self = *const_cast<clang::FriendDecl *>(u.FriendDecl);
   if (!self.getFriendType()) {
@@ -1678,6 +1988,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, FriendTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FriendTemplateDecl::FriendDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FriendTemplateDecl *>(u.FriendTemplateDecl);
+  decltype(auto) val = self.getFriendDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FriendTemplateDecl::FriendDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token FriendTemplateDecl::FriendToken(void) const noexcept {
   auto &self = *const_cast<clang::FriendTemplateDecl *>(u.FriendTemplateDecl);
   decltype(auto) val = self.getFriendLoc();
@@ -1685,6 +2005,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, FriendTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FriendTemplateDecl::FriendTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FriendTemplateDecl *>(u.FriendTemplateDecl);
+  decltype(auto) val = self.getFriendLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type FriendTemplateDecl::FriendType(void) const noexcept {
   auto &self = *const_cast<clang::FriendTemplateDecl *>(u.FriendTemplateDecl);
   decltype(auto) val = self.getFriendType();
@@ -1761,6 +2088,16 @@ std::vector<::pasta::Stmt> LifetimeExtendedTemporaryDecl::Children(void) const n
   __builtin_unreachable();
 }
 
+::pasta::DeclRef LifetimeExtendedTemporaryDecl::ExtendingDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::LifetimeExtendedTemporaryDecl *>(u.LifetimeExtendedTemporaryDecl);
+  decltype(auto) val = self.getExtendingDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LifetimeExtendedTemporaryDecl::ExtendingDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t LifetimeExtendedTemporaryDecl::ManglingNumber(void) const noexcept {
   auto &self = *const_cast<clang::LifetimeExtendedTemporaryDecl *>(u.LifetimeExtendedTemporaryDecl);
   decltype(auto) val = self.getManglingNumber();
@@ -1786,6 +2123,16 @@ enum StorageDuration LifetimeExtendedTemporaryDecl::StorageDuration(void) const
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LifetimeExtendedTemporaryDecl::TemporaryExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::LifetimeExtendedTemporaryDecl *>(u.LifetimeExtendedTemporaryDecl);
+  decltype(auto) val = self.getTemporaryExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LifetimeExtendedTemporaryDecl::TemporaryExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: LifetimeExtendedTemporaryDecl::Value
 LinkageSpecDecl::LinkageSpecDecl(
     std::shared_ptr<ASTImpl> ast_,
@@ -1801,6 +2148,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, LinkageSpecDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LinkageSpecDecl::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token LinkageSpecDecl::ExternToken(void) const noexcept {
   auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
   decltype(auto) val = self.getExternLoc();
@@ -1808,6 +2162,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, LinkageSpecDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LinkageSpecDecl::ExternTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
+  decltype(auto) val = self.getExternLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum LinkageSpecDeclLanguageIDs LinkageSpecDecl::Language(void) const noexcept {
   auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
   decltype(auto) val = self.getLanguage();
@@ -1822,6 +2183,13 @@ enum LinkageSpecDeclLanguageIDs LinkageSpecDecl::Language(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LinkageSpecDecl::RBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
+  decltype(auto) val = self.getRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool LinkageSpecDecl::HasBraces(void) const noexcept {
   auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
   decltype(auto) val = self.hasBraces();
@@ -1937,6 +2305,16 @@ enum Linkage NamedDecl::LinkageInternal(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamedDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamedDecl *>(u.NamedDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamedDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string NamedDecl::Name(void) const noexcept {
   auto &self = *const_cast<clang::NamedDecl *>(u.NamedDecl);
   decltype(auto) val = self.getNameAsString();
@@ -1971,6 +2349,16 @@ std::string NamedDecl::QualifiedNameAsString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamedDecl::UnderlyingDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamedDecl *>(u.NamedDecl);
+  decltype(auto) val = self.getUnderlyingDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamedDecl::UnderlyingDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum Visibility NamedDecl::Visibility(void) const noexcept {
   auto &self = *const_cast<clang::NamedDecl *>(u.NamedDecl);
   decltype(auto) val = self.getVisibility();
@@ -2049,6 +2437,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NamespaceAliasDecl::AliasTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getAliasLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl NamespaceAliasDecl::AliasedNamespace(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
   decltype(auto) val = self.getAliasedNamespace();
@@ -2059,6 +2454,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceAliasDecl::AliasedNamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getAliasedNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceAliasDecl::AliasedNamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::NamespaceAliasDecl NamespaceAliasDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -2069,6 +2474,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceAliasDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceAliasDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::NamespaceDecl NamespaceAliasDecl::Namespace(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
   decltype(auto) val = self.getNamespace();
@@ -2079,6 +2494,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceAliasDecl::NamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceAliasDecl::NamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token NamespaceAliasDecl::NamespaceToken(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
   decltype(auto) val = self.getNamespaceLoc();
@@ -2086,6 +2511,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NamespaceAliasDecl::NamespaceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getNamespaceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: NamespaceAliasDecl::Qualifier
 // 0: NamespaceAliasDecl::QualifierToken
 ::pasta::Token NamespaceAliasDecl::TargetNameToken(void) const noexcept {
@@ -2095,6 +2527,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NamespaceAliasDecl::TargetNameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl);
+  decltype(auto) val = self.getTargetNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 NamespaceDecl::NamespaceDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -2113,6 +2552,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceDecl::AnonymousNamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
+  decltype(auto) val = self.getAnonymousNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceDecl::AnonymousNamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token NamespaceDecl::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
   decltype(auto) val = self.getBeginLoc();
@@ -2120,6 +2569,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NamespaceDecl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NamespaceDecl NamespaceDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -2130,6 +2586,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::NamespaceDecl NamespaceDecl::OriginalNamespace(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
   decltype(auto) val = self.getOriginalNamespace();
@@ -2140,6 +2606,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef NamespaceDecl::OriginalNamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
+  decltype(auto) val = self.getOriginalNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "NamespaceDecl::OriginalNamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token NamespaceDecl::RBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
   decltype(auto) val = self.getRBraceLoc();
@@ -2147,6 +2623,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NamespaceDecl::RBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
+  decltype(auto) val = self.getRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool NamespaceDecl::IsAnonymousNamespace(void) const noexcept {
   auto &self = *const_cast<clang::NamespaceDecl *>(u.NamespaceDecl);
   decltype(auto) val = self.isAnonymousNamespace();
@@ -2186,6 +2669,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCCompatibleAliasDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCompatibleAliasDecl::ClassInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCompatibleAliasDecl *>(u.ObjCCompatibleAliasDecl);
+  decltype(auto) val = self.getClassInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCompatibleAliasDecl::ClassInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCContainerDecl::ObjCContainerDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -2215,6 +2708,20 @@ std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::ClassMethods(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::ClassMethodsRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.class_methods();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCMethodDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    auto cls_decl = clang::dyn_cast<clang::ObjCMethodDecl>(decl);
+    return cls_decl && cls_decl->isClassMethod();
+  });
+}
+
 std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void) const noexcept {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.class_properties();
@@ -2228,6 +2735,20 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void)
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassPropertiesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.class_properties();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    auto cls_decl = clang::dyn_cast<clang::ObjCPropertyDecl>(decl);
+    return cls_decl && cls_decl->isClassProperty();
+  });
+}
+
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
@@ -2239,6 +2760,13 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCContainerDecl::AtEndRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.getAtEndRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCContainerDecl::AtStartToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.getAtStartLoc();
@@ -2246,6 +2774,13 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCContainerDecl::AtStartTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.getAtStartLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCContainerDecl::ClassMethod
 // 1: ObjCContainerDecl::InstanceMethod
 // 1: ObjCContainerDecl::InstanceVariableDeclaration
@@ -2264,6 +2799,20 @@ std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::InstanceMethods(void) co
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::InstanceMethodsRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.instance_methods();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCMethodDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    auto cls_decl = clang::dyn_cast<clang::ObjCMethodDecl>(decl);
+    return cls_decl && cls_decl->isInstanceMethod();
+  });
+}
+
 std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstanceProperties(void) const noexcept {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.instance_properties();
@@ -2277,6 +2826,20 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstanceProperties(voi
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstancePropertiesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.instance_properties();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    auto cls_decl = clang::dyn_cast<clang::ObjCPropertyDecl>(decl);
+    return cls_decl && cls_decl->isInstanceProperty();
+  });
+}
+
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
@@ -2296,6 +2859,19 @@ std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::Methods(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::MethodsRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.methods();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCMethodDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCMethodDecl>(decl);
+  });
+}
+
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
 std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::Properties(void) const noexcept {
@@ -2311,6 +2887,19 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::Properties(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::PropertiesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
+  decltype(auto) val = self.properties();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCPropertyDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCPropertyDecl>(decl);
+  });
+}
+
 ObjCImplDecl::ObjCImplDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -2334,6 +2923,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCImplDecl, ObjCImplementationDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCImplDecl::ClassInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplDecl *>(u.ObjCImplDecl);
+  decltype(auto) val = self.getClassInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCImplDecl::ClassInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::ObjCPropertyImplDecl> ObjCImplDecl::PropertyImplementations(void) const noexcept {
   auto &self = *const_cast<clang::ObjCImplDecl *>(u.ObjCImplDecl);
   decltype(auto) val = self.property_impls();
@@ -2347,6 +2946,19 @@ std::vector<::pasta::ObjCPropertyImplDecl> ObjCImplDecl::PropertyImplementations
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCPropertyImplDecl> ObjCImplDecl::PropertyImplementationsRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplDecl *>(u.ObjCImplDecl);
+  decltype(auto) val = self.property_impls();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCPropertyImplDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCPropertyImplDecl>(decl);
+  });
+}
+
 // 0: ObjCImplDecl::
 // 0: ObjCImplDecl::
 ObjCImplementationDecl::ObjCImplementationDecl(
@@ -2367,6 +2979,13 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCImplDecl, ObjCImplementationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCImplementationDecl::InstanceVariableLBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
+  decltype(auto) val = self.getIvarLBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCImplementationDecl::InstanceVariableRBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
   decltype(auto) val = self.getIvarRBraceLoc();
@@ -2374,6 +2993,13 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCImplDecl, ObjCImplementationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCImplementationDecl::InstanceVariableRBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
+  decltype(auto) val = self.getIvarRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string ObjCImplementationDecl::Name(void) const noexcept {
   auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
   decltype(auto) val = self.getNameAsString();
@@ -2409,6 +3035,16 @@ std::string_view ObjCImplementationDecl::ObjCRuntimeNameAsString(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCImplementationDecl::SuperClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
+  decltype(auto) val = self.getSuperClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCImplementationDecl::SuperClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCImplementationDecl::SuperClassToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
   decltype(auto) val = self.getSuperClassLoc();
@@ -2416,6 +3052,13 @@ std::string_view ObjCImplementationDecl::ObjCRuntimeNameAsString(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCImplementationDecl::SuperClassTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
+  decltype(auto) val = self.getSuperClassLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCImplementationDecl::HasDestructors(void) const noexcept {
   auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
   decltype(auto) val = self.hasDestructors();
@@ -2450,6 +3093,19 @@ std::vector<::pasta::ObjCIvarDecl> ObjCImplementationDecl::InstanceVariables(voi
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCIvarDecl> ObjCImplementationDecl::InstanceVariablesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
+  decltype(auto) val = self.ivars();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCIvarDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCIvarDecl>(decl);
+  });
+}
+
 ObjCInterfaceDecl::ObjCInterfaceDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -2494,6 +3150,16 @@ bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 1: ObjCInterfaceDecl::CategoryClassMethod
 // 1: ObjCInterfaceDecl::CategoryInstanceMethod
 ::pasta::ObjCCategoryDecl ObjCInterfaceDecl::CategoryListRaw(void) const noexcept {
@@ -2506,6 +3172,16 @@ bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceDecl::CategoryListRawRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getCategoryListRaw();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::CategoryListRawRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 2: CategoryMethod
 ::pasta::ObjCInterfaceDecl ObjCInterfaceDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
@@ -2517,6 +3193,16 @@ bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getDefinition();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::DefinitionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCInterfaceDecl::EndOfDefinitionToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getEndOfDefinitionLoc();
@@ -2524,6 +3210,13 @@ bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCInterfaceDecl::EndOfDefinitionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getEndOfDefinitionLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCImplementationDecl ObjCInterfaceDecl::Implementation(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getImplementation();
@@ -2534,6 +3227,16 @@ bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceDecl::ImplementationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getImplementation();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::ImplementationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view ObjCInterfaceDecl::ObjCRuntimeNameAsString(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getObjCRuntimeNameAsString();
@@ -2558,6 +3261,18 @@ std::optional<::pasta::ObjCInterfaceDecl> ObjCInterfaceDecl::SuperClass(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ObjCInterfaceDecl::SuperClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getSuperClass();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCInterfaceDecl::SuperClassToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getSuperClassLoc();
@@ -2565,6 +3280,13 @@ std::optional<::pasta::ObjCInterfaceDecl> ObjCInterfaceDecl::SuperClass(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCInterfaceDecl::SuperClassTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getSuperClassLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> ObjCInterfaceDecl::SuperClassTypeInfo(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getSuperClassTInfo();
@@ -2587,6 +3309,18 @@ std::optional<::pasta::ObjCObjectType> ObjCInterfaceDecl::SuperClassType(void) c
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> ObjCInterfaceDecl::SuperClassTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getSuperClassType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCInterfaceDecl::TypeForDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.getTypeForDecl();
@@ -2597,6 +3331,16 @@ std::optional<::pasta::ObjCObjectType> ObjCInterfaceDecl::SuperClassType(void) c
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCInterfaceDecl::TypeForDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.getTypeForDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::TypeForDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ObjCInterfaceDecl::TypeParameterList
 // 0: ObjCInterfaceDecl::TypeParameterListAsWritten
 bool ObjCInterfaceDecl::HasDefinition(void) const noexcept {
@@ -2638,6 +3382,16 @@ bool ObjCInterfaceDecl::IsImplicitInterfaceDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceDecl::IsObjCRequiresPropertyDefinitionsRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.isObjCRequiresPropertyDefs();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceDecl::IsObjCRequiresPropertyDefinitionsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 1: ObjCInterfaceDecl::IsSuperClassOf
 bool ObjCInterfaceDecl::IsThisDeclarationADefinition(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
@@ -2663,6 +3417,19 @@ std::vector<::pasta::ObjCIvarDecl> ObjCInterfaceDecl::InstanceVariables(void) co
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCIvarDecl> ObjCInterfaceDecl::InstanceVariablesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
+  decltype(auto) val = self.ivars();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCIvarDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCIvarDecl>(decl);
+  });
+}
+
 std::vector<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::KnownCategories(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.known_categories();
@@ -2787,13 +3554,30 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token ObjCMethodDecl::BeginToken(void) const noexcept {
+::pasta::DeclRef ObjCMethodDecl::FindPropertyDeclarationRef(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
-  decltype(auto) val = self.getBeginLoc();
+  decltype(auto) val = self.findPropertyDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::FindPropertyDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::Token ObjCMethodDecl::BeginToken(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getBeginLoc();
   return ast->TokenAt(val);
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMethodDecl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCMethodDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -2804,6 +3588,16 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMethodDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCCategoryDecl ObjCMethodDecl::Category(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getCategory();
@@ -2814,6 +3608,16 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMethodDecl::CategoryRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getCategory();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::CategoryRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCMethodDecl::ClassInterface(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getClassInterface();
@@ -2824,6 +3628,16 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMethodDecl::ClassInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getClassInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::ClassInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ImplicitParamDecl ObjCMethodDecl::CommandDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getCmdDecl();
@@ -2834,6 +3648,16 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMethodDecl::CommandDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getCmdDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::CommandDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCMethodDecl::DeclaratorEndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getDeclaratorEndLoc();
@@ -2841,6 +3665,13 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMethodDecl::DeclaratorEndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getDeclaratorEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCMethodDecl::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getEndLoc();
@@ -2848,6 +3679,13 @@ bool ObjCMethodDecl::DefinedInNSObject(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMethodDecl::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ObjCMethodDeclImplementationControl ObjCMethodDecl::ImplementationControl(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getImplementationControl();
@@ -2885,6 +3723,14 @@ enum DeclObjCDeclQualifier ObjCMethodDecl::ObjCDeclQualifier(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCMethodDecl::ReturnTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getReturnType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange ObjCMethodDecl::ReturnTypeSourceRange(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getReturnTypeSourceRange();
@@ -2892,6 +3738,13 @@ enum DeclObjCDeclQualifier ObjCMethodDecl::ObjCDeclQualifier(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCMethodDecl::ReturnTypeSourceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getReturnTypeSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCMethodDecl::Selector
 // 1: ObjCMethodDecl::SelectorToken
 ::pasta::Token ObjCMethodDecl::SelectorStartToken(void) const noexcept {
@@ -2901,6 +3754,13 @@ enum DeclObjCDeclQualifier ObjCMethodDecl::ObjCDeclQualifier(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMethodDecl::SelectorStartTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getSelectorStartLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ImplicitParamDecl ObjCMethodDecl::SelfDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.getSelfDecl();
@@ -2911,6 +3771,16 @@ enum DeclObjCDeclQualifier ObjCMethodDecl::ObjCDeclQualifier(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMethodDecl::SelfDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
+  decltype(auto) val = self.getSelfDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMethodDecl::SelfDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 4: ObjCMethodDecl::SelfType
 bool ObjCMethodDecl::HasParameterDestroyedInCallee(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
@@ -3077,6 +3947,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyDecl::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCPropertyDecl::DefaultSynthInstanceVariableName
 ::pasta::ObjCMethodDecl ObjCPropertyDecl::GetterMethodDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
@@ -3088,6 +3965,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyDecl::GetterMethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getGetterMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyDecl::GetterMethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ObjCPropertyDecl::GetterName
 ::pasta::Token ObjCPropertyDecl::GetterNameToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
@@ -3096,6 +3983,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyDecl::GetterNameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getGetterNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyDecl::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
   decltype(auto) val = self.getLParenLoc();
@@ -3103,6 +3997,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyDecl::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCPropertyDecl::PropertyAttributes
 // 0: ObjCPropertyDecl::PropertyAttributesAsWritten
 enum ObjCPropertyDeclPropertyControl ObjCPropertyDecl::PropertyImplementation(void) const noexcept {
@@ -3122,6 +4023,16 @@ enum ObjCPropertyDeclPropertyControl ObjCPropertyDecl::PropertyImplementation(vo
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyDecl::PropertyInstanceVariableDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getPropertyIvarDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyDecl::PropertyInstanceVariableDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ObjCPropertyQueryKind ObjCPropertyDecl::QueryKind(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
   decltype(auto) val = self.getQueryKind();
@@ -3146,6 +4057,16 @@ enum ObjCPropertyDeclSetterKind ObjCPropertyDecl::SetterKind(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyDecl::SetterMethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getSetterMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyDecl::SetterMethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ObjCPropertyDecl::SetterName
 ::pasta::Token ObjCPropertyDecl::SetterNameToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
@@ -3154,6 +4075,13 @@ enum ObjCPropertyDeclSetterKind ObjCPropertyDecl::SetterKind(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyDecl::SetterNameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getSetterNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCPropertyDecl::Type(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
   decltype(auto) val = self.getType();
@@ -3162,6 +4090,14 @@ enum ObjCPropertyDeclSetterKind ObjCPropertyDecl::SetterKind(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCPropertyDecl::TypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl);
+  decltype(auto) val = self.getType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCPropertyDecl::
 // 1: ObjCPropertyDecl::UsageType
 bool ObjCPropertyDecl::IsAtomic(void) const noexcept {
@@ -3226,6 +4162,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyImplDecl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCPropertyImplDecl::GetterCXXConstructor(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getGetterCXXConstructor();
@@ -3236,6 +4179,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCPropertyImplDecl::GetterCXXConstructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getGetterCXXConstructor();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::GetterCXXConstructorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCPropertyImplDecl::GetterMethodDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getGetterMethodDecl();
@@ -3246,6 +4199,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyImplDecl::GetterMethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getGetterMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::GetterMethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCPropertyDecl ObjCPropertyImplDecl::PropertyDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getPropertyDecl();
@@ -3256,6 +4219,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyImplDecl::PropertyDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getPropertyDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::PropertyDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ObjCPropertyImplDeclKind ObjCPropertyImplDecl::PropertyImplementation(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getPropertyImplementation();
@@ -3273,6 +4246,16 @@ enum ObjCPropertyImplDeclKind ObjCPropertyImplDecl::PropertyImplementation(void)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyImplDecl::PropertyInstanceVariableDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getPropertyIvarDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::PropertyInstanceVariableDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyImplDecl::PropertyInstanceVariableDeclarationToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getPropertyIvarDeclLoc();
@@ -3280,6 +4263,13 @@ enum ObjCPropertyImplDeclKind ObjCPropertyImplDecl::PropertyImplementation(void)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyImplDecl::PropertyInstanceVariableDeclarationTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getPropertyIvarDeclLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCPropertyImplDecl::SetterCXXAssignment(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getSetterCXXAssignment();
@@ -3290,6 +4280,16 @@ enum ObjCPropertyImplDeclKind ObjCPropertyImplDecl::PropertyImplementation(void)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCPropertyImplDecl::SetterCXXAssignmentRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getSetterCXXAssignment();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::SetterCXXAssignmentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCPropertyImplDecl::SetterMethodDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.getSetterMethodDecl();
@@ -3300,6 +4300,16 @@ enum ObjCPropertyImplDeclKind ObjCPropertyImplDecl::PropertyImplementation(void)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyImplDecl::SetterMethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
+  decltype(auto) val = self.getSetterMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyImplDecl::SetterMethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCPropertyImplDecl::IsInstanceVariableNameSpecified(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl);
   decltype(auto) val = self.isIvarNameSpecified();
@@ -3326,6 +4336,16 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCProtocolDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolDecl *>(u.ObjCProtocolDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCProtocolDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCProtocolDecl ObjCProtocolDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolDecl *>(u.ObjCProtocolDecl);
   decltype(auto) val = self.getDefinition();
@@ -3336,6 +4356,16 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCProtocolDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolDecl *>(u.ObjCProtocolDecl);
+  decltype(auto) val = self.getDefinition();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCProtocolDecl::DefinitionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::string_view ObjCProtocolDecl::ObjCRuntimeNameAsString(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolDecl *>(u.ObjCProtocolDecl);
   decltype(auto) val = self.getObjCRuntimeNameAsString();
@@ -3478,6 +4508,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, StaticAssertDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef StaticAssertDecl::AssertExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
+  decltype(auto) val = self.getAssertExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "StaticAssertDecl::AssertExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::StringLiteral StaticAssertDecl::Message(void) const noexcept {
   auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
   decltype(auto) val = self.getMessage();
@@ -3488,6 +4528,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, StaticAssertDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef StaticAssertDecl::MessageRef(void) const noexcept {
+  auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
+  decltype(auto) val = self.getMessage();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "StaticAssertDecl::MessageRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token StaticAssertDecl::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
   decltype(auto) val = self.getRParenLoc();
@@ -3495,6 +4545,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, StaticAssertDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StaticAssertDecl::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool StaticAssertDecl::IsFailed(void) const noexcept {
   auto &self = *const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl);
   decltype(auto) val = self.isFailed();
@@ -3535,6 +4592,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(TemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TemplateDecl::TemplatedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateDecl *>(u.TemplateDecl);
+  decltype(auto) val = self.getTemplatedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TemplateDecl::TemplatedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool TemplateDecl::HasAssociatedConstraints(void) const noexcept {
   auto &self = *const_cast<clang::TemplateDecl *>(u.TemplateDecl);
   decltype(auto) val = self.hasAssociatedConstraints();
@@ -3566,6 +4633,13 @@ bool TemplateTemplateParmDecl::DefaultArgumentWasInherited(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TemplateTemplateParmDecl::DefaultArgumentTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateTemplateParmDecl *>(u.TemplateTemplateParmDecl);
+  decltype(auto) val = self.getDefaultArgumentLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: TemplateTemplateParmDecl::ExpansionTemplateParameters
 uint32_t TemplateTemplateParmDecl::NumExpansionTemplateParameters(void) const noexcept {
   auto &self = *const_cast<clang::TemplateTemplateParmDecl *>(u.TemplateTemplateParmDecl);
@@ -3620,6 +4694,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, TranslationUnitDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TranslationUnitDecl::AnonymousNamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::TranslationUnitDecl *>(u.TranslationUnitDecl);
+  decltype(auto) val = self.getAnonymousNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TranslationUnitDecl::AnonymousNamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 TypeDecl::TypeDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -3646,6 +4730,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TypeDecl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeDecl *>(u.TypeDecl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> TypeDecl::TypeForDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::TypeDecl *>(u.TypeDecl);
   decltype(auto) val = self.getTypeForDecl();
@@ -3658,6 +4749,18 @@ std::optional<::pasta::Type> TypeDecl::TypeForDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> TypeDecl::TypeForDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeDecl *>(u.TypeDecl);
+  decltype(auto) val = self.getTypeForDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 TypedefNameDecl::TypedefNameDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -3681,6 +4784,18 @@ std::optional<::pasta::TagDecl> TypedefNameDecl::AnonymousDeclarationWithTypedef
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> TypedefNameDecl::AnonymousDeclarationWithTypedefNameRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypedefNameDecl *>(u.TypedefNameDecl);
+  decltype(auto) val = self.getAnonDeclWithTypedefName();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::TypedefNameDecl TypedefNameDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::TypedefNameDecl *>(u.TypedefNameDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -3691,12 +4806,30 @@ std::optional<::pasta::TagDecl> TypedefNameDecl::AnonymousDeclarationWithTypedef
   __builtin_unreachable();
 }
 
-// 0: TypedefNameDecl::
-::pasta::Type TypedefNameDecl::UnderlyingType(void) const noexcept {
+::pasta::DeclRef TypedefNameDecl::CanonicalDeclarationRef(void) const noexcept {
   auto &self = *const_cast<clang::TypedefNameDecl *>(u.TypedefNameDecl);
-  decltype(auto) val = self.getUnderlyingType();
-  assert(!val.isNull());
-  return TypeBuilder::Build(ast, val);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TypedefNameDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+// 0: TypedefNameDecl::
+::pasta::Type TypedefNameDecl::UnderlyingType(void) const noexcept {
+  auto &self = *const_cast<clang::TypedefNameDecl *>(u.TypedefNameDecl);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return TypeBuilder::Build(ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::TypeRef TypedefNameDecl::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypedefNameDecl *>(u.TypedefNameDecl);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -3739,6 +4872,16 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UnresolvedUsingTypenameDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnresolvedUsingTypenameDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedUsingTypenameDecl::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
   decltype(auto) val = self.getEllipsisLoc();
@@ -3746,6 +4889,13 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedUsingTypenameDecl::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: UnresolvedUsingTypenameDecl::NameInfo
 // 0: UnresolvedUsingTypenameDecl::Qualifier
 // 0: UnresolvedUsingTypenameDecl::QualifierToken
@@ -3756,6 +4906,13 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedUsingTypenameDecl::TypenameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
+  decltype(auto) val = self.getTypenameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedUsingTypenameDecl::UsingToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
   decltype(auto) val = self.getUsingLoc();
@@ -3763,6 +4920,13 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedUsingTypenameDecl::UsingTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
+  decltype(auto) val = self.getUsingLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UnresolvedUsingTypenameDecl::IsPackExpansion(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl);
   decltype(auto) val = self.isPackExpansion();
@@ -3794,6 +4958,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingDirectiveDecl::IdentifierTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
+  decltype(auto) val = self.getIdentLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UsingDirectiveDecl::NamespaceKeyToken(void) const noexcept {
   auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
   decltype(auto) val = self.getNamespaceKeyLocation();
@@ -3801,6 +4972,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingDirectiveDecl::NamespaceKeyTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
+  decltype(auto) val = self.getNamespaceKeyLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NamespaceDecl UsingDirectiveDecl::NominatedNamespace(void) const noexcept {
   auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
   decltype(auto) val = self.getNominatedNamespace();
@@ -3811,6 +4989,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingDirectiveDecl::NominatedNamespaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
+  decltype(auto) val = self.getNominatedNamespace();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingDirectiveDecl::NominatedNamespaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl UsingDirectiveDecl::NominatedNamespaceAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
   decltype(auto) val = self.getNominatedNamespaceAsWritten();
@@ -3821,6 +5009,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingDirectiveDecl::NominatedNamespaceAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
+  decltype(auto) val = self.getNominatedNamespaceAsWritten();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingDirectiveDecl::NominatedNamespaceAsWrittenRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: UsingDirectiveDecl::Qualifier
 // 0: UsingDirectiveDecl::QualifierToken
 ::pasta::Token UsingDirectiveDecl::UsingToken(void) const noexcept {
@@ -3830,6 +5028,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingDirectiveDecl::UsingTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl);
+  decltype(auto) val = self.getUsingLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 UsingPackDecl::UsingPackDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -3860,6 +5065,16 @@ std::vector<::pasta::NamedDecl> UsingPackDecl::Expansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingPackDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingPackDecl *>(u.UsingPackDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingPackDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl UsingPackDecl::InstantiatedFromUsingDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UsingPackDecl *>(u.UsingPackDecl);
   decltype(auto) val = self.getInstantiatedFromUsingDecl();
@@ -3870,6 +5085,16 @@ std::vector<::pasta::NamedDecl> UsingPackDecl::Expansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingPackDecl::InstantiatedFromUsingDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingPackDecl *>(u.UsingPackDecl);
+  decltype(auto) val = self.getInstantiatedFromUsingDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingPackDecl::InstantiatedFromUsingDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 UsingShadowDecl::UsingShadowDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -3888,6 +5113,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingShadowDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingShadowDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::BaseUsingDecl UsingShadowDecl::Introducer(void) const noexcept {
   auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
   decltype(auto) val = self.getIntroducer();
@@ -3898,6 +5133,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingShadowDecl::IntroducerRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
+  decltype(auto) val = self.getIntroducer();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingShadowDecl::IntroducerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::UsingShadowDecl> UsingShadowDecl::NextUsingShadowDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
   decltype(auto) val = self.getNextUsingShadowDecl();
@@ -3910,6 +5155,18 @@ std::optional<::pasta::UsingShadowDecl> UsingShadowDecl::NextUsingShadowDeclarat
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> UsingShadowDecl::NextUsingShadowDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
+  decltype(auto) val = self.getNextUsingShadowDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl UsingShadowDecl::TargetDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
   decltype(auto) val = self.getTargetDecl();
@@ -3920,6 +5177,16 @@ std::optional<::pasta::UsingShadowDecl> UsingShadowDecl::NextUsingShadowDeclarat
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingShadowDecl::TargetDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingShadowDecl *>(u.UsingShadowDecl);
+  decltype(auto) val = self.getTargetDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingShadowDecl::TargetDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ValueDecl::ValueDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -3964,6 +5231,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ValueDecl, VarTemplateSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ValueDecl::TypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ValueDecl *>(u.ValueDecl);
+  decltype(auto) val = self.getType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ValueDecl::IsWeak(void) const noexcept {
   auto &self = *const_cast<clang::ValueDecl *>(u.ValueDecl);
   decltype(auto) val = self.isWeak();
@@ -4042,6 +5317,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, AccessSpecDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AccessSpecDecl::AccessSpecifierTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AccessSpecDecl *>(u.AccessSpecDecl);
+  decltype(auto) val = self.getAccessSpecifierLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AccessSpecDecl::ColonToken(void) const noexcept {
   auto &self = *const_cast<clang::AccessSpecDecl *>(u.AccessSpecDecl);
   decltype(auto) val = self.getColonLoc();
@@ -4049,6 +5331,13 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, AccessSpecDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AccessSpecDecl::ColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AccessSpecDecl *>(u.AccessSpecDecl);
+  decltype(auto) val = self.getColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 BaseUsingDecl::BaseUsingDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -4092,6 +5381,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, BindingDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BindingDecl::BindingRef(void) const noexcept {
+  auto &self = *const_cast<clang::BindingDecl *>(u.BindingDecl);
+  decltype(auto) val = self.getBinding();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BindingDecl::BindingRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ValueDecl BindingDecl::DecomposedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::BindingDecl *>(u.BindingDecl);
   decltype(auto) val = self.getDecomposedDecl();
@@ -4102,6 +5401,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, BindingDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef BindingDecl::DecomposedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::BindingDecl *>(u.BindingDecl);
+  decltype(auto) val = self.getDecomposedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BindingDecl::DecomposedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::VarDecl BindingDecl::HoldingVariable(void) const noexcept {
   auto &self = *const_cast<clang::BindingDecl *>(u.BindingDecl);
   decltype(auto) val = self.getHoldingVar();
@@ -4112,6 +5421,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, BindingDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef BindingDecl::HoldingVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::BindingDecl *>(u.BindingDecl);
+  decltype(auto) val = self.getHoldingVar();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BindingDecl::HoldingVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 BlockDecl::BlockDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -4163,6 +5482,18 @@ std::optional<::pasta::Decl> BlockDecl::BlockManglingContextDeclaration(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> BlockDecl::BlockManglingContextDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
+  decltype(auto) val = self.getBlockManglingContextDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t BlockDecl::BlockManglingNumber(void) const noexcept {
   auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
   decltype(auto) val = self.getBlockManglingNumber();
@@ -4177,6 +5508,13 @@ uint32_t BlockDecl::BlockManglingNumber(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BlockDecl::CaretTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
+  decltype(auto) val = self.getCaretLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt BlockDecl::CompoundBody(void) const noexcept {
   auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
   decltype(auto) val = self.getCompoundBody();
@@ -4187,6 +5525,16 @@ uint32_t BlockDecl::BlockManglingNumber(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BlockDecl::CompoundBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
+  decltype(auto) val = self.getCompoundBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BlockDecl::CompoundBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t BlockDecl::NumCaptures(void) const noexcept {
   auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
   decltype(auto) val = self.getNumCaptures();
@@ -4290,6 +5638,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, CapturedDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CapturedDecl::ContextParameterRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedDecl *>(u.CapturedDecl);
+  decltype(auto) val = self.getContextParam();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CapturedDecl::ContextParameterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t CapturedDecl::ContextParameterPosition(void) const noexcept {
   auto &self = *const_cast<clang::CapturedDecl *>(u.CapturedDecl);
   decltype(auto) val = self.getContextParamPosition();
@@ -4343,6 +5701,16 @@ PASTA_DEFINE_BASE_OPERATORS(Decl, ClassScopeFunctionSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassScopeFunctionSpecializationDecl::SpecializationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassScopeFunctionSpecializationDecl *>(u.ClassScopeFunctionSpecializationDecl);
+  decltype(auto) val = self.getSpecialization();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassScopeFunctionSpecializationDecl::SpecializationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ClassScopeFunctionSpecializationDecl::TemplateArgumentsAsWritten
 bool ClassScopeFunctionSpecializationDecl::HasExplicitTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::ClassScopeFunctionSpecializationDecl *>(u.ClassScopeFunctionSpecializationDecl);
@@ -4369,6 +5737,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, ConceptDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ConceptDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConceptDecl *>(u.ConceptDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConceptDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConceptDecl::ConstraintExpression(void) const noexcept {
   auto &self = *const_cast<clang::ConceptDecl *>(u.ConceptDecl);
   decltype(auto) val = self.getConstraintExpr();
@@ -4379,6 +5757,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, ConceptDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConceptDecl::ConstraintExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConceptDecl *>(u.ConceptDecl);
+  decltype(auto) val = self.getConstraintExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConceptDecl::ConstraintExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ConceptDecl::IsTypeConcept(void) const noexcept {
   auto &self = *const_cast<clang::ConceptDecl *>(u.ConceptDecl);
   decltype(auto) val = self.isTypeConcept();
@@ -4411,6 +5799,16 @@ bool ConstructorUsingShadowDecl::ConstructsVirtualBase(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ConstructorUsingShadowDecl::ConstructedBaseClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getConstructedBaseClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConstructorUsingShadowDecl::ConstructedBaseClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::ConstructedBaseClassShadowDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
   decltype(auto) val = self.getConstructedBaseClassShadowDecl();
@@ -4423,6 +5821,18 @@ std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::C
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ConstructorUsingShadowDecl::ConstructedBaseClassShadowDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getConstructedBaseClassShadowDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::UsingDecl ConstructorUsingShadowDecl::Introducer(void) const noexcept {
   auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
   decltype(auto) val = self.getIntroducer();
@@ -4433,6 +5843,16 @@ std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::C
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ConstructorUsingShadowDecl::IntroducerRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getIntroducer();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConstructorUsingShadowDecl::IntroducerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl ConstructorUsingShadowDecl::NominatedBaseClass(void) const noexcept {
   auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
   decltype(auto) val = self.getNominatedBaseClass();
@@ -4443,6 +5863,16 @@ std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::C
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ConstructorUsingShadowDecl::NominatedBaseClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getNominatedBaseClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConstructorUsingShadowDecl::NominatedBaseClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::NominatedBaseClassShadowDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
   decltype(auto) val = self.getNominatedBaseClassShadowDecl();
@@ -4455,6 +5885,18 @@ std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::N
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ConstructorUsingShadowDecl::NominatedBaseClassShadowDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getNominatedBaseClassShadowDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl ConstructorUsingShadowDecl::Parent(void) const noexcept {
   auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
   decltype(auto) val = self.getParent();
@@ -4465,6 +5907,16 @@ std::optional<::pasta::ConstructorUsingShadowDecl> ConstructorUsingShadowDecl::N
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ConstructorUsingShadowDecl::ParentRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstructorUsingShadowDecl *>(u.ConstructorUsingShadowDecl);
+  decltype(auto) val = self.getParent();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConstructorUsingShadowDecl::ParentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 DeclaratorDecl::DeclaratorDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -4498,6 +5950,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(DeclaratorDecl, VarTemplateSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclaratorDecl::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DeclaratorDecl::FirstInnerToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
   decltype(auto) val = self.getInnerLocStart();
@@ -4505,6 +5964,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(DeclaratorDecl, VarTemplateSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclaratorDecl::FirstInnerTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getInnerLocStart();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t DeclaratorDecl::NumTemplateParameterLists(void) const noexcept {
   auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
   decltype(auto) val = self.getNumTemplateParameterLists();
@@ -4519,6 +5985,13 @@ uint32_t DeclaratorDecl::NumTemplateParameterLists(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclaratorDecl::FirstOuterTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getOuterLocStart();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DeclaratorDecl::Qualifier
 // 0: DeclaratorDecl::QualifierToken
 // 1: DeclaratorDecl::TemplateParameterList
@@ -4534,6 +6007,18 @@ std::optional<::pasta::Expr> DeclaratorDecl::TrailingRequiresClause(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> DeclaratorDecl::TrailingRequiresClauseRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getTrailingRequiresClause();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: DeclaratorDecl::
 ::pasta::Token DeclaratorDecl::TypeSpecEndToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
@@ -4542,6 +6027,13 @@ std::optional<::pasta::Expr> DeclaratorDecl::TrailingRequiresClause(void) const
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclaratorDecl::TypeSpecEndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getTypeSpecEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DeclaratorDecl::TypeSpecStartToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
   decltype(auto) val = self.getTypeSpecStartLoc();
@@ -4549,6 +6041,13 @@ std::optional<::pasta::Expr> DeclaratorDecl::TrailingRequiresClause(void) const
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclaratorDecl::TypeSpecStartTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl);
+  decltype(auto) val = self.getTypeSpecStartLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::TemplateParameterList> DeclaratorDecl::TemplateParameterLists(void) const noexcept {
   std::vector<::pasta::TemplateParameterList> ret;
   auto convert_elem = [&] (clang::TemplateParameterList * val) {
@@ -4574,9 +6073,19 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, EnumConstantDecl)
   auto &self = *const_cast<clang::EnumConstantDecl *>(u.EnumConstantDecl);
   decltype(auto) val = self.getCanonicalDecl();
   if (val) {
-    return DeclBuilder::Create<::pasta::EnumConstantDecl>(ast, val);
+    return DeclBuilder::Create<::pasta::EnumConstantDecl>(ast, val);
+  }
+  assert(false && "EnumConstantDecl::CanonicalDeclaration can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::DeclRef EnumConstantDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumConstantDecl *>(u.EnumConstantDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "EnumConstantDecl::CanonicalDeclaration can return nullptr!");
+  assert(false && "EnumConstantDecl::CanonicalDeclarationRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -4592,6 +6101,18 @@ std::optional<::pasta::Expr> EnumConstantDecl::InitializerExpression(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> EnumConstantDecl::InitializerExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumConstantDecl *>(u.EnumConstantDecl);
+  decltype(auto) val = self.getInitExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 llvm::APSInt EnumConstantDecl::InitializerValue(void) const noexcept {
   auto &self = *const_cast<clang::EnumConstantDecl *>(u.EnumConstantDecl);
   decltype(auto) val = self.getInitVal();
@@ -4625,6 +6146,21 @@ std::optional<::pasta::Expr> FieldDecl::BitWidth(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> FieldDecl::BitWidthRef(void) const noexcept {
+  auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
+  if (!self.isBitField()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getBitWidth();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t FieldDecl::BitWidthValue(void) const noexcept {
   auto &self = *(u.FieldDecl);
   decltype(auto) val = self.getBitWidthValue(ast->ci->getASTContext());
@@ -4642,6 +6178,16 @@ uint32_t FieldDecl::BitWidthValue(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FieldDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FieldDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VariableArrayType> FieldDecl::CapturedVLAType(void) const noexcept {
   auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
   decltype(auto) val = self.getCapturedVLAType();
@@ -4654,6 +6200,18 @@ std::optional<::pasta::VariableArrayType> FieldDecl::CapturedVLAType(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> FieldDecl::CapturedVLATypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
+  decltype(auto) val = self.getCapturedVLAType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t FieldDecl::FieldIndex(void) const noexcept {
   auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
   decltype(auto) val = self.getFieldIndex();
@@ -4680,6 +6238,18 @@ std::optional<::pasta::Expr> FieldDecl::InClassInitializer(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> FieldDecl::InClassInitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
+  decltype(auto) val = self.getInClassInitializer();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::RecordDecl FieldDecl::Parent(void) const noexcept {
   auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
   decltype(auto) val = self.getParent();
@@ -4690,6 +6260,16 @@ std::optional<::pasta::Expr> FieldDecl::InClassInitializer(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FieldDecl::ParentRef(void) const noexcept {
+  auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
+  decltype(auto) val = self.getParent();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FieldDecl::ParentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool FieldDecl::HasCapturedVLAType(void) const noexcept {
   auto &self = *const_cast<clang::FieldDecl *>(u.FieldDecl);
   decltype(auto) val = self.hasCapturedVLAType();
@@ -4815,6 +6395,14 @@ uint32_t FunctionDecl::BuiltinID(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionDecl::CallResultTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getCallResultType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionDecl FunctionDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -4825,6 +6413,16 @@ uint32_t FunctionDecl::BuiltinID(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ConstexprSpecKind FunctionDecl::ConstexprKind(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getConstexprKind();
@@ -4840,6 +6438,14 @@ enum ConstexprSpecKind FunctionDecl::ConstexprKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionDecl::DeclaredReturnTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getDeclaredReturnType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: FunctionDecl::DefaultedFunctionInfo
 std::optional<::pasta::FunctionDecl> FunctionDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
@@ -4853,6 +6459,18 @@ std::optional<::pasta::FunctionDecl> FunctionDecl::Definition(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getDefinition();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: FunctionDecl::DependentSpecializationInfo
 std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::DescribedFunctionTemplate(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
@@ -4866,6 +6484,18 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::DescribedFunctionTemp
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::DescribedFunctionTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getDescribedFunctionTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token FunctionDecl::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getEllipsisLoc();
@@ -4873,6 +6503,13 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::DescribedFunctionTemp
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionDecl::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange FunctionDecl::ExceptionSpecSourceRange(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getExceptionSpecSourceRange();
@@ -4880,6 +6517,13 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::DescribedFunctionTemp
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange FunctionDecl::ExceptionSpecSourceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getExceptionSpecSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ExceptionSpecificationType FunctionDecl::ExceptionSpecType(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getExceptionSpecType();
@@ -4900,6 +6544,18 @@ std::optional<::pasta::FunctionDecl> FunctionDecl::InstantiatedFromDeclaration(v
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::InstantiatedFromDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getInstantiatedFromDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionDecl> FunctionDecl::InstantiatedFromMemberFunction(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getInstantiatedFromMemberFunction();
@@ -4912,6 +6568,18 @@ std::optional<::pasta::FunctionDecl> FunctionDecl::InstantiatedFromMemberFunctio
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::InstantiatedFromMemberFunctionRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberFunction();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum LanguageLinkage FunctionDecl::LanguageLinkage(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getLanguageLinkage();
@@ -4978,6 +6646,13 @@ enum OverloadedOperatorKind FunctionDecl::OverloadedOperator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange FunctionDecl::ParametersSourceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getParametersSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FunctionDecl::PointOfInstantiation(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getPointOfInstantiation();
@@ -4985,6 +6660,13 @@ enum OverloadedOperatorKind FunctionDecl::OverloadedOperator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionDecl::PointOfInstantiationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getPointOfInstantiation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::PrimaryTemplate(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getPrimaryTemplate();
@@ -4997,6 +6679,18 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::PrimaryTemplate(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::PrimaryTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getPrimaryTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Type FunctionDecl::ReturnType(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getReturnType();
@@ -5005,6 +6699,14 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::PrimaryTemplate(void)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionDecl::ReturnTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getReturnType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange FunctionDecl::ReturnTypeSourceRange(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getReturnTypeSourceRange();
@@ -5012,6 +6714,13 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionDecl::PrimaryTemplate(void)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange FunctionDecl::ReturnTypeSourceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getReturnTypeSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum StorageClass FunctionDecl::StorageClass(void) const noexcept {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.getStorageClass();
@@ -5031,6 +6740,18 @@ std::optional<::pasta::FunctionDecl> FunctionDecl::TemplateInstantiationPattern(
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionDecl::TemplateInstantiationPatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  decltype(auto) val = self.getTemplateInstantiationPattern();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: FunctionDecl::TemplateSpecializationArguments
 // 0: FunctionDecl::TemplateSpecializationArgumentsAsWritten
 // 0: FunctionDecl::TemplateSpecializationInfo
@@ -5547,6 +7268,21 @@ std::optional<::pasta::FieldDecl> IndirectFieldDecl::AnonymousField(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> IndirectFieldDecl::AnonymousFieldRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
+  if (self.chain().size() < 2) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getAnonField();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::IndirectFieldDecl IndirectFieldDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -5557,6 +7293,16 @@ std::optional<::pasta::FieldDecl> IndirectFieldDecl::AnonymousField(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclRef IndirectFieldDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "IndirectFieldDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t IndirectFieldDecl::ChainingSize(void) const noexcept {
   auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
   decltype(auto) val = self.getChainingSize();
@@ -5579,6 +7325,21 @@ std::optional<::pasta::VarDecl> IndirectFieldDecl::VariableDeclaration(void) con
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> IndirectFieldDecl::VariableDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
+  if (self.chain().size() < 2) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getVarDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 LabelDecl::LabelDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -5607,6 +7368,16 @@ std::string_view LabelDecl::MSAssemblyLabel(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LabelDecl::StatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelDecl *>(u.LabelDecl);
+  decltype(auto) val = self.getStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LabelDecl::StatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool LabelDecl::IsGnuLocal(void) const noexcept {
   auto &self = *const_cast<clang::LabelDecl *>(u.LabelDecl);
   decltype(auto) val = self.isGnuLocal();
@@ -5705,6 +7476,18 @@ std::optional<::pasta::Expr> NonTypeTemplateParmDecl::DefaultArgument(void) cons
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> NonTypeTemplateParmDecl::DefaultArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl);
+  decltype(auto) val = self.getDefaultArgument();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token NonTypeTemplateParmDecl::DefaultArgumentToken(void) const noexcept {
   auto &self = *const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl);
   decltype(auto) val = self.getDefaultArgumentLoc();
@@ -5712,6 +7495,13 @@ std::optional<::pasta::Expr> NonTypeTemplateParmDecl::DefaultArgument(void) cons
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NonTypeTemplateParmDecl::DefaultArgumentTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl);
+  decltype(auto) val = self.getDefaultArgumentLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: NonTypeTemplateParmDecl::ExpansionType
 // 1: NonTypeTemplateParmDecl::ExpansionType
 std::optional<uint32_t> NonTypeTemplateParmDecl::NumExpansionTypes(void) const noexcept {
@@ -5736,6 +7526,18 @@ std::optional<::pasta::Expr> NonTypeTemplateParmDecl::PlaceholderTypeConstraint(
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> NonTypeTemplateParmDecl::PlaceholderTypeConstraintRef(void) const noexcept {
+  auto &self = *const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl);
+  decltype(auto) val = self.getPlaceholderTypeConstraint();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool NonTypeTemplateParmDecl::HasDefaultArgument(void) const noexcept {
   auto &self = *const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl);
   decltype(auto) val = self.hasDefaultArgument();
@@ -5854,6 +7656,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareMapperDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareMapperDecl::MapperVariableReferenceRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareMapperDecl *>(u.OMPDeclareMapperDecl);
+  decltype(auto) val = self.getMapperVarRef();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareMapperDecl::MapperVariableReferenceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::OMPDeclareMapperDecl OMPDeclareMapperDecl::PrevDeclarationInScope(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareMapperDecl *>(u.OMPDeclareMapperDecl);
   decltype(auto) val = self.getPrevDeclInScope();
@@ -5864,6 +7676,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareMapperDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef OMPDeclareMapperDecl::PrevDeclarationInScopeRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareMapperDecl *>(u.OMPDeclareMapperDecl);
+  decltype(auto) val = self.getPrevDeclInScope();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareMapperDecl::PrevDeclarationInScopeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPDeclareReductionDecl::OMPDeclareReductionDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -5877,9 +7699,19 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getCombiner();
   if (val) {
-    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::Combiner can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef OMPDeclareReductionDecl::CombinerRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getCombiner();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "OMPDeclareReductionDecl::Combiner can return nullptr!");
+  assert(false && "OMPDeclareReductionDecl::CombinerRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -5893,6 +7725,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareReductionDecl::CombinerInRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getCombinerIn();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::CombinerInRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPDeclareReductionDecl::CombinerOut(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getCombinerOut();
@@ -5903,6 +7745,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareReductionDecl::CombinerOutRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getCombinerOut();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::CombinerOutRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPDeclareReductionDecl::InitializerOriginal(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getInitOrig();
@@ -5913,6 +7765,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareReductionDecl::InitializerOriginalRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getInitOrig();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::InitializerOriginalRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPDeclareReductionDecl::InitializerPrivate(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getInitPriv();
@@ -5923,6 +7785,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareReductionDecl::InitializerPrivateRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getInitPriv();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::InitializerPrivateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPDeclareReductionDecl::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getInitializer();
@@ -5933,6 +7805,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDeclareReductionDecl::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getInitializer();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::InitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum OMPDeclareReductionDeclInitKind OMPDeclareReductionDecl::InitializerKind(void) const noexcept {
   auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
   decltype(auto) val = self.getInitializerKind();
@@ -5950,6 +7832,16 @@ enum OMPDeclareReductionDeclInitKind OMPDeclareReductionDecl::InitializerKind(vo
   __builtin_unreachable();
 }
 
+::pasta::DeclRef OMPDeclareReductionDecl::PrevDeclarationInScopeRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDeclareReductionDecl *>(u.OMPDeclareReductionDecl);
+  decltype(auto) val = self.getPrevDeclInScope();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDeclareReductionDecl::PrevDeclarationInScopeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPRequiresDecl::OMPRequiresDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -6032,6 +7924,13 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCCategoryDecl::CategoryNameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getCategoryNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCCategoryDecl::ClassInterface(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getClassInterface();
@@ -6042,6 +7941,16 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCategoryDecl::ClassInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getClassInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCategoryDecl::ClassInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCCategoryImplDecl ObjCCategoryDecl::Implementation(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getImplementation();
@@ -6052,6 +7961,16 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCategoryDecl::ImplementationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getImplementation();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCategoryDecl::ImplementationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCCategoryDecl::InstanceVariableLBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getIvarLBraceLoc();
@@ -6059,6 +7978,13 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCCategoryDecl::InstanceVariableLBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getIvarLBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCCategoryDecl::InstanceVariableRBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getIvarRBraceLoc();
@@ -6066,6 +7992,13 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCCategoryDecl::InstanceVariableRBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getIvarRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCCategoryDecl ObjCCategoryDecl::NextClassCategory(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getNextClassCategory();
@@ -6076,6 +8009,16 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCategoryDecl::NextClassCategoryRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getNextClassCategory();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCategoryDecl::NextClassCategoryRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCCategoryDecl ObjCCategoryDecl::NextClassCategoryRaw(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.getNextClassCategoryRaw();
@@ -6086,6 +8029,16 @@ bool ObjCCategoryDecl::IsClassExtension(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCategoryDecl::NextClassCategoryRawRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.getNextClassCategoryRaw();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCategoryDecl::NextClassCategoryRawRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ObjCCategoryDecl::ReferencedProtocols
 // 0: ObjCCategoryDecl::TypeParameterList
 // 0: ObjCCategoryDecl::
@@ -6105,6 +8058,19 @@ std::vector<::pasta::ObjCIvarDecl> ObjCCategoryDecl::InstanceVariables(void) con
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::ObjCIvarDecl> ObjCCategoryDecl::InstanceVariablesRange(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
+  decltype(auto) val = self.ivars();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::ObjCIvarDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::ObjCIvarDecl>(decl);
+  });
+}
+
 // 0: ObjCCategoryDecl::
 // 0: ObjCCategoryDecl::
 // 0: ObjCCategoryDecl::
@@ -6156,6 +8122,16 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCImplDecl, ObjCCategoryImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCCategoryImplDecl::CategoryDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryImplDecl *>(u.ObjCCategoryImplDecl);
+  decltype(auto) val = self.getCategoryDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCCategoryImplDecl::CategoryDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCCategoryImplDecl::CategoryNameToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCCategoryImplDecl *>(u.ObjCCategoryImplDecl);
   decltype(auto) val = self.getCategoryNameLoc();
@@ -6163,6 +8139,13 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCImplDecl, ObjCCategoryImplDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCCategoryImplDecl::CategoryNameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCCategoryImplDecl *>(u.ObjCCategoryImplDecl);
+  decltype(auto) val = self.getCategoryNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCIvarDecl::ObjCIvarDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -6197,6 +8180,16 @@ enum ObjCIvarDeclAccessControl ObjCIvarDecl::CanonicalAccessControl(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCIvarDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIvarDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCIvarDecl::ContainingInterface(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
   decltype(auto) val = self.getContainingInterface();
@@ -6207,6 +8200,16 @@ enum ObjCIvarDeclAccessControl ObjCIvarDecl::CanonicalAccessControl(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCIvarDecl::ContainingInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
+  decltype(auto) val = self.getContainingInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIvarDecl::ContainingInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCIvarDecl ObjCIvarDecl::NextInstanceVariable(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
   decltype(auto) val = self.getNextIvar();
@@ -6217,6 +8220,16 @@ enum ObjCIvarDeclAccessControl ObjCIvarDecl::CanonicalAccessControl(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCIvarDecl::NextInstanceVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
+  decltype(auto) val = self.getNextIvar();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIvarDecl::NextInstanceVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCIvarDecl::Synthesize(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarDecl *>(u.ObjCIvarDecl);
   decltype(auto) val = self.getSynthesize();
@@ -6254,6 +8267,13 @@ PASTA_DEFINE_BASE_OPERATORS(TypedefNameDecl, ObjCTypeParamDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCTypeParamDecl::ColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl);
+  decltype(auto) val = self.getColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ObjCTypeParamDecl::Index(void) const noexcept {
   auto &self = *const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl);
   decltype(auto) val = self.getIndex();
@@ -6275,6 +8295,13 @@ enum ObjCTypeParamVariance ObjCTypeParamDecl::Variance(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCTypeParamDecl::VarianceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl);
+  decltype(auto) val = self.getVarianceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCTypeParamDecl::HasExplicitBound(void) const noexcept {
   auto &self = *const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl);
   decltype(auto) val = self.hasExplicitBound();
@@ -6304,6 +8331,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(RedeclarableTemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef RedeclarableTemplateDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::RedeclarableTemplateDecl *>(u.RedeclarableTemplateDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "RedeclarableTemplateDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::RedeclarableTemplateDecl RedeclarableTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
   auto &self = *const_cast<clang::RedeclarableTemplateDecl *>(u.RedeclarableTemplateDecl);
   decltype(auto) val = self.getInstantiatedFromMemberTemplate();
@@ -6314,6 +8351,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(RedeclarableTemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef RedeclarableTemplateDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::RedeclarableTemplateDecl *>(u.RedeclarableTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "RedeclarableTemplateDecl::InstantiatedFromMemberTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool RedeclarableTemplateDecl::IsMemberSpecialization(void) const noexcept {
   auto &self = *const_cast<clang::RedeclarableTemplateDecl *>(u.RedeclarableTemplateDecl);
   decltype(auto) val = self.isMemberSpecialization();
@@ -6342,6 +8389,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(TagDecl, RecordDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange TagDecl::BraceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getBraceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TagDecl TagDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -6352,6 +8406,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(TagDecl, RecordDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TagDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TagDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TagDecl> TagDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
   decltype(auto) val = self.getDefinition();
@@ -6364,6 +8428,18 @@ std::optional<::pasta::TagDecl> TagDecl::Definition(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> TagDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getDefinition();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token TagDecl::FirstInnerToken(void) const noexcept {
   auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
   decltype(auto) val = self.getInnerLocStart();
@@ -6371,6 +8447,13 @@ std::optional<::pasta::TagDecl> TagDecl::Definition(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TagDecl::FirstInnerTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getInnerLocStart();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string_view TagDecl::KindName(void) const noexcept {
   auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
   decltype(auto) val = self.getKindName();
@@ -6396,6 +8479,13 @@ uint32_t TagDecl::NumTemplateParameterLists(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TagDecl::FirstOuterTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getOuterLocStart();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: TagDecl::Qualifier
 // 0: TagDecl::QualifierToken
 enum TagTypeKind TagDecl::TagKind(void) const noexcept {
@@ -6418,6 +8508,18 @@ std::optional<::pasta::TypedefNameDecl> TagDecl::TypedefNameForAnonymousDeclarat
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> TagDecl::TypedefNameForAnonymousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
+  decltype(auto) val = self.getTypedefNameForAnonDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool TagDecl::HasNameForLinkage(void) const noexcept {
   auto &self = *const_cast<clang::TagDecl *>(u.TagDecl);
   decltype(auto) val = self.hasNameForLinkage();
@@ -6554,6 +8656,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, TemplateParamObjectDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TemplateParamObjectDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateParamObjectDecl *>(u.TemplateParamObjectDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TemplateParamObjectDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: TemplateParamObjectDecl::Value
 TemplateTypeParmDecl::TemplateTypeParmDecl(
     std::shared_ptr<ASTImpl> ast_,
@@ -6584,6 +8696,19 @@ std::optional<::pasta::Type> TemplateTypeParmDecl::DefaultArgument(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> TemplateTypeParmDecl::DefaultArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateTypeParmDecl *>(u.TemplateTypeParmDecl);
+  if (!self.getDefaultArgumentInfo()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getDefaultArgument();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> TemplateTypeParmDecl::DefaultArgumentInfo(void) const noexcept {
   auto &self = *const_cast<clang::TemplateTypeParmDecl *>(u.TemplateTypeParmDecl);
   decltype(auto) val = self.getDefaultArgumentInfo();
@@ -6601,6 +8726,13 @@ std::optional<::pasta::Type> TemplateTypeParmDecl::DefaultArgumentInfo(void) con
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TemplateTypeParmDecl::DefaultArgumentTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateTypeParmDecl *>(u.TemplateTypeParmDecl);
+  decltype(auto) val = self.getDefaultArgumentLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t TemplateTypeParmDecl::Depth(void) const noexcept {
   auto &self = *const_cast<clang::TemplateTypeParmDecl *>(u.TemplateTypeParmDecl);
   decltype(auto) val = self.getDepth();
@@ -6686,6 +8818,18 @@ std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasDecl::DescribedAliasTempl
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> TypeAliasDecl::DescribedAliasTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeAliasDecl *>(u.TypeAliasDecl);
+  decltype(auto) val = self.getDescribedAliasTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 TypeAliasTemplateDecl::TypeAliasTemplateDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -6699,15 +8843,49 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, TypeAliasTemplateDecl)
   auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
   decltype(auto) val = self.getCanonicalDecl();
   if (val) {
-    return DeclBuilder::Create<::pasta::TypeAliasTemplateDecl>(ast, val);
+    return DeclBuilder::Create<::pasta::TypeAliasTemplateDecl>(ast, val);
+  }
+  assert(false && "TypeAliasTemplateDecl::CanonicalDeclaration can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::DeclRef TypeAliasTemplateDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TypeAliasTemplateDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
+  auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return DeclBuilder::Create<::pasta::TypeAliasTemplateDecl>(ast, val);
+  }
+  __builtin_unreachable();
+}
+
+std::optional<::pasta::DeclRef> TypeAliasTemplateDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "TypeAliasTemplateDecl::CanonicalDeclaration can return nullptr!");
   __builtin_unreachable();
 }
 
-std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
+std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::PreviousDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
-  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  decltype(auto) val = self.getPreviousDecl();
   if (!val) {
     return std::nullopt;
   }
@@ -6717,14 +8895,14 @@ std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::Instantiate
   __builtin_unreachable();
 }
 
-std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::PreviousDeclaration(void) const noexcept {
+std::optional<::pasta::DeclRef> TypeAliasTemplateDecl::PreviousDeclarationRef(void) const noexcept {
   auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
   decltype(auto) val = self.getPreviousDecl();
   if (!val) {
     return std::nullopt;
   }
   if (val) {
-    return DeclBuilder::Create<::pasta::TypeAliasTemplateDecl>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
   __builtin_unreachable();
 }
@@ -6739,6 +8917,16 @@ std::optional<::pasta::TypeAliasTemplateDecl> TypeAliasTemplateDecl::PreviousDec
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TypeAliasTemplateDecl::TemplatedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeAliasTemplateDecl *>(u.TypeAliasTemplateDecl);
+  decltype(auto) val = self.getTemplatedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TypeAliasTemplateDecl::TemplatedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 TypedefDecl::TypedefDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -6775,6 +8963,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, UnresolvedUsingValueDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UnresolvedUsingValueDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnresolvedUsingValueDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedUsingValueDecl::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl);
   decltype(auto) val = self.getEllipsisLoc();
@@ -6782,6 +8980,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, UnresolvedUsingValueDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedUsingValueDecl::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: UnresolvedUsingValueDecl::NameInfo
 // 0: UnresolvedUsingValueDecl::Qualifier
 // 0: UnresolvedUsingValueDecl::QualifierToken
@@ -6792,6 +8997,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, UnresolvedUsingValueDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedUsingValueDecl::UsingTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl);
+  decltype(auto) val = self.getUsingLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UnresolvedUsingValueDecl::IsAccessDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl);
   decltype(auto) val = self.isAccessDeclaration();
@@ -6824,6 +9036,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDecl *>(u.UsingDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: UsingDecl::NameInfo
 // 0: UsingDecl::Qualifier
 // 0: UsingDecl::QualifierToken
@@ -6834,6 +9056,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingDecl::UsingTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingDecl *>(u.UsingDecl);
+  decltype(auto) val = self.getUsingLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UsingDecl::HasTypename(void) const noexcept {
   auto &self = *const_cast<clang::UsingDecl *>(u.UsingDecl);
   decltype(auto) val = self.hasTypename();
@@ -6866,6 +9095,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingEnumDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingEnumDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::EnumDecl UsingEnumDecl::EnumDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
   decltype(auto) val = self.getEnumDecl();
@@ -6876,6 +9115,16 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingEnumDecl::EnumDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
+  decltype(auto) val = self.getEnumDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingEnumDecl::EnumDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token UsingEnumDecl::EnumToken(void) const noexcept {
   auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
   decltype(auto) val = self.getEnumLoc();
@@ -6883,6 +9132,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingEnumDecl::EnumTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
+  decltype(auto) val = self.getEnumLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UsingEnumDecl::UsingToken(void) const noexcept {
   auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
   decltype(auto) val = self.getUsingLoc();
@@ -6890,6 +9146,13 @@ PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UsingEnumDecl::UsingTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl);
+  decltype(auto) val = self.getUsingLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 VarDecl::VarDecl(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Decl *decl_)
@@ -6921,6 +9184,18 @@ std::optional<::pasta::VarDecl> VarDecl::ActingDefinition(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarDecl::ActingDefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getActingDefinition();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::VarDecl VarDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -6931,6 +9206,16 @@ std::optional<::pasta::VarDecl> VarDecl::ActingDefinition(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarTemplateDecl> VarDecl::DescribedVariableTemplate(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getDescribedVarTemplate();
@@ -6943,6 +9228,18 @@ std::optional<::pasta::VarTemplateDecl> VarDecl::DescribedVariableTemplate(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarDecl::DescribedVariableTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getDescribedVarTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: VarDecl::EvaluatedStatement
 // 0: VarDecl::EvaluatedValue
 // 1: VarDecl::FlexibleArrayInitializerCharacters
@@ -6958,6 +9255,18 @@ std::optional<::pasta::Expr> VarDecl::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> VarDecl::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getInit();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum VarDeclInitializationStyle VarDecl::InitializerStyle(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getInitStyle();
@@ -6977,6 +9286,18 @@ std::optional<::pasta::VarDecl> VarDecl::InitializingDeclaration(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarDecl::InitializingDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getInitializingDeclaration();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> VarDecl::InstantiatedFromStaticDataMember(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getInstantiatedFromStaticDataMember();
@@ -6989,6 +9310,18 @@ std::optional<::pasta::VarDecl> VarDecl::InstantiatedFromStaticDataMember(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarDecl::InstantiatedFromStaticDataMemberRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getInstantiatedFromStaticDataMember();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum LanguageLinkage VarDecl::LanguageLinkage(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getLanguageLinkage();
@@ -7004,6 +9337,13 @@ enum LanguageLinkage VarDecl::LanguageLinkage(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VarDecl::PointOfInstantiationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getPointOfInstantiation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum StorageClass VarDecl::StorageClass(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getStorageClass();
@@ -7044,6 +9384,18 @@ std::optional<::pasta::VarDecl> VarDecl::TemplateInstantiationPattern(void) cons
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarDecl::TemplateInstantiationPatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
+  decltype(auto) val = self.getTemplateInstantiationPattern();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum TemplateSpecializationKind VarDecl::TemplateSpecializationKind(void) const noexcept {
   auto &self = *const_cast<clang::VarDecl *>(u.VarDecl);
   decltype(auto) val = self.getTemplateSpecializationKind();
@@ -7354,6 +9706,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplateDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplateDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::VarTemplateDecl VarTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.getInstantiatedFromMemberTemplate();
@@ -7364,6 +9726,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplateDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplateDecl::InstantiatedFromMemberTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::VarTemplateDecl VarTemplateDecl::MostRecentDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.getMostRecentDecl();
@@ -7374,6 +9746,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, VarTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplateDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplateDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarTemplateDecl> VarTemplateDecl::PreviousDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.getPreviousDecl();
@@ -7386,6 +9768,18 @@ std::optional<::pasta::VarTemplateDecl> VarTemplateDecl::PreviousDeclaration(voi
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> VarTemplateDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::VarDecl VarTemplateDecl::TemplatedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.getTemplatedDecl();
@@ -7396,6 +9790,16 @@ std::optional<::pasta::VarTemplateDecl> VarTemplateDecl::PreviousDeclaration(voi
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplateDecl::TemplatedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
+  decltype(auto) val = self.getTemplatedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplateDecl::TemplatedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool VarTemplateDecl::IsThisDeclarationADefinition(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.isThisDeclarationADefinition();
@@ -7436,6 +9840,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(VarTemplateSpecializationDecl, VarTemplatePartial
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VarTemplateSpecializationDecl::ExternTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
+  decltype(auto) val = self.getExternLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::variant<std::monostate, ::pasta::VarTemplateDecl, ::pasta::VarTemplatePartialSpecializationDecl> VarTemplateSpecializationDecl::InstantiatedFrom(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
   decltype(auto) val = self.getInstantiatedFrom();
@@ -7462,6 +9873,13 @@ std::variant<std::monostate, ::pasta::VarTemplateDecl, ::pasta::VarTemplateParti
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VarTemplateSpecializationDecl::PointOfInstantiationRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
+  decltype(auto) val = self.getPointOfInstantiation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum TemplateSpecializationKind VarTemplateSpecializationDecl::SpecializationKind(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
   decltype(auto) val = self.getSpecializationKind();
@@ -7479,6 +9897,16 @@ enum TemplateSpecializationKind VarTemplateSpecializationDecl::SpecializationKin
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplateSpecializationDecl::SpecializedTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
+  decltype(auto) val = self.getSpecializedTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplateSpecializationDecl::SpecializedTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::variant<std::monostate, ::pasta::VarTemplateDecl, ::pasta::VarTemplatePartialSpecializationDecl> VarTemplateSpecializationDecl::SpecializedTemplateOrPartial(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
   decltype(auto) val = self.getSpecializedTemplateOrPartial();
@@ -7530,6 +9958,13 @@ std::vector<::pasta::TemplateArgument> VarTemplateSpecializationDecl::TemplateIn
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VarTemplateSpecializationDecl::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type VarTemplateSpecializationDecl::TypeAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl);
   decltype(auto) val = self.getTypeAsWritten();
@@ -7593,6 +10028,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXDeductionGuideDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDeductionGuideDecl::CorrespondingConstructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeductionGuideDecl *>(u.CXXDeductionGuideDecl);
+  decltype(auto) val = self.getCorrespondingConstructor();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDeductionGuideDecl::CorrespondingConstructorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::TemplateDecl CXXDeductionGuideDecl::DeducedTemplate(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeductionGuideDecl *>(u.CXXDeductionGuideDecl);
   decltype(auto) val = self.getDeducedTemplate();
@@ -7603,6 +10048,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXDeductionGuideDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDeductionGuideDecl::DeducedTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeductionGuideDecl *>(u.CXXDeductionGuideDecl);
+  decltype(auto) val = self.getDeducedTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDeductionGuideDecl::DeducedTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: CXXDeductionGuideDecl::ExplicitSpecifier
 bool CXXDeductionGuideDecl::IsCopyDeductionCandidate(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeductionGuideDecl *>(u.CXXDeductionGuideDecl);
@@ -7673,6 +10128,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(CXXMethodDecl, CXXDestructorDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXMethodDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXMethodDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 1: CXXMethodDecl::CorrespondingMethodDeclaredInClass
 // 1: CXXMethodDecl::CorrespondingMethodInClass
 // 2: DevirtualizedMethod
@@ -7687,29 +10152,75 @@ PASTA_DEFINE_DERIVED_OPERATORS(CXXMethodDecl, CXXDestructorDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXMethodDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXMethodDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl CXXMethodDecl::Parent(void) const noexcept {
   auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
   decltype(auto) val = self.getParent();
   if (val) {
     return DeclBuilder::Create<::pasta::CXXRecordDecl>(ast, val);
   }
-  assert(false && "CXXMethodDecl::Parent can return nullptr!");
+  assert(false && "CXXMethodDecl::Parent can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::DeclRef CXXMethodDecl::ParentRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
+  decltype(auto) val = self.getParent();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXMethodDecl::ParentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+enum RefQualifierKind CXXMethodDecl::ReferenceQualifier(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
+  decltype(auto) val = self.getRefQualifier();
+  return static_cast<::pasta::RefQualifierKind>(val);
+  __builtin_unreachable();
+}
+
+std::optional<::pasta::Type> CXXMethodDecl::ThisObjectType(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
+  if (!self.isInstance()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getThisObjectType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return TypeBuilder::Build(ast, val);
   __builtin_unreachable();
 }
 
-enum RefQualifierKind CXXMethodDecl::ReferenceQualifier(void) const noexcept {
+std::optional<::pasta::TypeRef> CXXMethodDecl::ThisObjectTypeRef(void) const noexcept {
   auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
-  decltype(auto) val = self.getRefQualifier();
-  return static_cast<::pasta::RefQualifierKind>(val);
+  if (!self.isInstance()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getThisObjectType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
-std::optional<::pasta::Type> CXXMethodDecl::ThisObjectType(void) const noexcept {
+std::optional<::pasta::Type> CXXMethodDecl::ThisType(void) const noexcept {
   auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
   if (!self.isInstance()) {
     return std::nullopt;
   }
-  decltype(auto) val = self.getThisObjectType();
+  decltype(auto) val = self.getThisType();
   if (val.isNull()) {
     return std::nullopt;
   }
@@ -7717,7 +10228,7 @@ std::optional<::pasta::Type> CXXMethodDecl::ThisObjectType(void) const noexcept
   __builtin_unreachable();
 }
 
-std::optional<::pasta::Type> CXXMethodDecl::ThisType(void) const noexcept {
+std::optional<::pasta::TypeRef> CXXMethodDecl::ThisTypeRef(void) const noexcept {
   auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
   if (!self.isInstance()) {
     return std::nullopt;
@@ -7726,7 +10237,7 @@ std::optional<::pasta::Type> CXXMethodDecl::ThisType(void) const noexcept {
   if (val.isNull()) {
     return std::nullopt;
   }
-  return TypeBuilder::Build(ast, val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -7862,6 +10373,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, ClassTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplateDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplateDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ClassTemplateDecl ClassTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.getInstantiatedFromMemberTemplate();
@@ -7872,6 +10393,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, ClassTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplateDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplateDecl::InstantiatedFromMemberTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ClassTemplateDecl ClassTemplateDecl::MostRecentDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.getMostRecentDecl();
@@ -7882,6 +10413,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, ClassTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplateDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplateDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ClassTemplateDecl> ClassTemplateDecl::PreviousDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.getPreviousDecl();
@@ -7894,6 +10435,18 @@ std::optional<::pasta::ClassTemplateDecl> ClassTemplateDecl::PreviousDeclaration
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ClassTemplateDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl ClassTemplateDecl::TemplatedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.getTemplatedDecl();
@@ -7904,6 +10457,16 @@ std::optional<::pasta::ClassTemplateDecl> ClassTemplateDecl::PreviousDeclaration
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplateDecl::TemplatedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
+  decltype(auto) val = self.getTemplatedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplateDecl::TemplatedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ClassTemplateDecl::IsThisDeclarationADefinition(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.isThisDeclarationADefinition();
@@ -7987,6 +10550,19 @@ std::vector<::pasta::EnumConstantDecl> EnumDecl::Enumerators(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::EnumConstantDecl> EnumDecl::EnumeratorsRange(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.enumerators();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::EnumConstantDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::EnumConstantDecl>(decl);
+  });
+}
+
 ::pasta::EnumDecl EnumDecl::CanonicalDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getCanonicalDecl();
@@ -7997,6 +10573,16 @@ std::vector<::pasta::EnumConstantDecl> EnumDecl::Enumerators(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclRef EnumDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "EnumDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::EnumDecl EnumDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getDefinition();
@@ -8007,6 +10593,16 @@ std::vector<::pasta::EnumConstantDecl> EnumDecl::Enumerators(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclRef EnumDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getDefinition();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "EnumDecl::DefinitionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::EnumDecl> EnumDecl::InstantiatedFromMemberEnum(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getInstantiatedFromMemberEnum();
@@ -8019,6 +10615,18 @@ std::optional<::pasta::EnumDecl> EnumDecl::InstantiatedFromMemberEnum(void) cons
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> EnumDecl::InstantiatedFromMemberEnumRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberEnum();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> EnumDecl::IntegerType(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   if (self.getIntegerType().isNull()) {
@@ -8032,6 +10640,19 @@ std::optional<::pasta::Type> EnumDecl::IntegerType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> EnumDecl::IntegerTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  if (self.getIntegerType().isNull()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getIntegerType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange EnumDecl::IntegerTypeRange(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getIntegerTypeRange();
@@ -8039,6 +10660,13 @@ std::optional<::pasta::Type> EnumDecl::IntegerType(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange EnumDecl::IntegerTypeRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getIntegerTypeRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: EnumDecl::MemberSpecializationInfo
 ::pasta::EnumDecl EnumDecl::MostRecentDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
@@ -8050,6 +10678,16 @@ std::optional<::pasta::Type> EnumDecl::IntegerType(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef EnumDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "EnumDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t EnumDecl::NumNegativeBits(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getNumNegativeBits();
@@ -8089,6 +10727,18 @@ std::optional<::pasta::EnumDecl> EnumDecl::PreviousDeclaration(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> EnumDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> EnumDecl::PromotionType(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getPromotionType();
@@ -8099,6 +10749,16 @@ std::optional<::pasta::Type> EnumDecl::PromotionType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> EnumDecl::PromotionTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getPromotionType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::EnumDecl> EnumDecl::TemplateInstantiationPattern(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getTemplateInstantiationPattern();
@@ -8111,6 +10771,18 @@ std::optional<::pasta::EnumDecl> EnumDecl::TemplateInstantiationPattern(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> EnumDecl::TemplateInstantiationPatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
+  decltype(auto) val = self.getTemplateInstantiationPattern();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum TemplateSpecializationKind EnumDecl::TemplateSpecializationKind(void) const noexcept {
   auto &self = *const_cast<clang::EnumDecl *>(u.EnumDecl);
   decltype(auto) val = self.getTemplateSpecializationKind();
@@ -8199,6 +10871,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, FunctionTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionTemplateDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionTemplateDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionTemplateDecl FunctionTemplateDecl::InstantiatedFromMemberTemplate(void) const noexcept {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.getInstantiatedFromMemberTemplate();
@@ -8209,6 +10891,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, FunctionTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionTemplateDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionTemplateDecl::InstantiatedFromMemberTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionTemplateDecl FunctionTemplateDecl::MostRecentDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.getMostRecentDecl();
@@ -8219,6 +10911,16 @@ PASTA_DEFINE_BASE_OPERATORS(TemplateDecl, FunctionTemplateDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionTemplateDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionTemplateDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionTemplateDecl> FunctionTemplateDecl::PreviousDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.getPreviousDecl();
@@ -8231,6 +10933,18 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionTemplateDecl::PreviousDecla
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionTemplateDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionDecl FunctionTemplateDecl::TemplatedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.getTemplatedDecl();
@@ -8241,6 +10955,16 @@ std::optional<::pasta::FunctionTemplateDecl> FunctionTemplateDecl::PreviousDecla
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionTemplateDecl::TemplatedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
+  decltype(auto) val = self.getTemplatedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionTemplateDecl::TemplatedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool FunctionTemplateDecl::IsAbbreviated(void) const noexcept {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.isAbbreviated();
@@ -8349,6 +11073,22 @@ std::optional<::pasta::Expr> ParmVarDecl::DefaultArgument(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ParmVarDecl::DefaultArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
+  if (HasUninstantiatedDefaultArgument() ||
+      HasUnparsedDefaultArgument()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getDefaultArg();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange ParmVarDecl::DefaultArgumentRange(void) const noexcept {
   auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
   decltype(auto) val = self.getDefaultArgRange();
@@ -8356,6 +11096,13 @@ std::optional<::pasta::Expr> ParmVarDecl::DefaultArgument(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ParmVarDecl::DefaultArgumentRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
+  decltype(auto) val = self.getDefaultArgRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ParmVarDecl::FunctionScopeDepth(void) const noexcept {
   auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
   decltype(auto) val = self.getFunctionScopeDepth();
@@ -8385,6 +11132,14 @@ enum DeclObjCDeclQualifier ParmVarDecl::ObjCDeclQualifier(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ParmVarDecl::OriginalTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
+  decltype(auto) val = self.getOriginalType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> ParmVarDecl::UninstantiatedDefaultArgument(void) const noexcept {
   auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
   if (!HasUninstantiatedDefaultArgument()) {
@@ -8400,6 +11155,21 @@ std::optional<::pasta::Expr> ParmVarDecl::UninstantiatedDefaultArgument(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ParmVarDecl::UninstantiatedDefaultArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
+  if (!HasUninstantiatedDefaultArgument()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getUninstantiatedDefaultArg();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool ParmVarDecl::HasDefaultArgument(void) const noexcept {
   auto &self = *const_cast<clang::ParmVarDecl *>(u.ParmVarDecl);
   decltype(auto) val = self.hasDefaultArg();
@@ -8498,6 +11268,19 @@ std::vector<::pasta::FieldDecl> RecordDecl::Fields(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::FieldDecl> RecordDecl::FieldsRange(void) const noexcept {
+  auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
+  decltype(auto) val = self.fields();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::FieldDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::FieldDecl>(decl);
+  });
+}
+
 std::optional<::pasta::FieldDecl> RecordDecl::FirstNamedDataMember(void) const noexcept {
   auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
   decltype(auto) val = self.findFirstNamedDataMember();
@@ -8510,6 +11293,18 @@ std::optional<::pasta::FieldDecl> RecordDecl::FirstNamedDataMember(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> RecordDecl::FirstNamedDataMemberRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
+  decltype(auto) val = self.findFirstNamedDataMember();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum RecordDeclArgPassingKind RecordDecl::ArgumentPassingRestrictions(void) const noexcept {
   auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
   decltype(auto) val = self.getArgPassingRestrictions();
@@ -8529,6 +11324,18 @@ std::optional<::pasta::RecordDecl> RecordDecl::Definition(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> RecordDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
+  decltype(auto) val = self.getDefinition();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::RecordDecl RecordDecl::MostRecentDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
   decltype(auto) val = self.getMostRecentDecl();
@@ -8539,6 +11346,16 @@ std::optional<::pasta::RecordDecl> RecordDecl::Definition(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef RecordDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "RecordDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::RecordDecl> RecordDecl::PreviousDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
   decltype(auto) val = self.getPreviousDecl();
@@ -8546,7 +11363,19 @@ std::optional<::pasta::RecordDecl> RecordDecl::PreviousDeclaration(void) const n
     return std::nullopt;
   }
   if (val) {
-    return DeclBuilder::Create<::pasta::RecordDecl>(ast, val);
+    return DeclBuilder::Create<::pasta::RecordDecl>(ast, val);
+  }
+  __builtin_unreachable();
+}
+
+std::optional<::pasta::DeclRef> RecordDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
   }
   __builtin_unreachable();
 }
@@ -8718,6 +11547,16 @@ PASTA_DEFINE_BASE_OPERATORS(VarTemplateSpecializationDecl, VarTemplatePartialSpe
   __builtin_unreachable();
 }
 
+::pasta::DeclRef VarTemplatePartialSpecializationDecl::InstantiatedFromMemberRef(void) const noexcept {
+  auto &self = *const_cast<clang::VarTemplatePartialSpecializationDecl *>(u.VarTemplatePartialSpecializationDecl);
+  decltype(auto) val = self.getInstantiatedFromMember();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VarTemplatePartialSpecializationDecl::InstantiatedFromMemberRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: VarTemplatePartialSpecializationDecl::TemplateArgumentsAsWritten
 ::pasta::TemplateParameterList VarTemplatePartialSpecializationDecl::TemplateParameters(void) const noexcept {
   auto &self = *const_cast<clang::VarTemplatePartialSpecializationDecl *>(u.VarTemplatePartialSpecializationDecl);
@@ -8769,6 +11608,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXConstructorDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXConstructorDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructorDecl *>(u.CXXConstructorDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXConstructorDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: CXXConstructorDecl::ExplicitSpecifier
 // 0: CXXConstructorDecl::InheritedConstructor
 uint32_t CXXConstructorDecl::NumConstructorInitializers(void) const noexcept {
@@ -8793,6 +11642,21 @@ std::optional<::pasta::CXXConstructorDecl> CXXConstructorDecl::TargetConstructor
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXConstructorDecl::TargetConstructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructorDecl *>(u.CXXConstructorDecl);
+  if (!self.isDelegatingConstructor()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getTargetConstructor();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: CXXConstructorDecl::
 // 0: CXXConstructorDecl::
 // 0: CXXConstructorDecl::
@@ -8891,6 +11755,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXConversionDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXConversionDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConversionDecl *>(u.CXXConversionDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXConversionDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXConversionDecl::ConversionType(void) const noexcept {
   auto &self = *const_cast<clang::CXXConversionDecl *>(u.CXXConversionDecl);
   decltype(auto) val = self.getConversionType();
@@ -8899,6 +11773,14 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXConversionDecl)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXConversionDecl::ConversionTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConversionDecl *>(u.CXXConversionDecl);
+  decltype(auto) val = self.getConversionType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXConversionDecl::ExplicitSpecifier
 bool CXXConversionDecl::IsExplicit(void) const noexcept {
   auto &self = *const_cast<clang::CXXConversionDecl *>(u.CXXConversionDecl);
@@ -8965,6 +11847,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueDecl, CXXDestructorDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDestructorDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDestructorDecl *>(u.CXXDestructorDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDestructorDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionDecl> CXXDestructorDecl::OperatorDelete(void) const noexcept {
   auto &self = *const_cast<clang::CXXDestructorDecl *>(u.CXXDestructorDecl);
   decltype(auto) val = self.getOperatorDelete();
@@ -8977,6 +11869,18 @@ std::optional<::pasta::FunctionDecl> CXXDestructorDecl::OperatorDelete(void) con
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXDestructorDecl::OperatorDeleteRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDestructorDecl *>(u.CXXDestructorDecl);
+  decltype(auto) val = self.getOperatorDelete();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXDestructorDecl::OperatorDeleteThisArgument(void) const noexcept {
   auto &self = *const_cast<clang::CXXDestructorDecl *>(u.CXXDestructorDecl);
   decltype(auto) val = self.getOperatorDeleteThisArg();
@@ -8989,6 +11893,18 @@ std::optional<::pasta::Expr> CXXDestructorDecl::OperatorDeleteThisArgument(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXDestructorDecl::OperatorDeleteThisArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDestructorDecl *>(u.CXXDestructorDecl);
+  decltype(auto) val = self.getOperatorDeleteThisArg();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::TemplateParameterList> CXXDestructorDecl::TemplateParameterLists(void) const noexcept {
   std::vector<::pasta::TemplateParameterList> ret;
   auto convert_elem = [&] (clang::TemplateParameterList * val) {
@@ -9088,6 +12004,19 @@ std::vector<::pasta::CXXConstructorDecl> CXXRecordDecl::Constructors(void) const
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::CXXConstructorDecl> CXXRecordDecl::ConstructorsRange(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.ctors();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::CXXConstructorDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::CXXConstructorDecl>(decl);
+  });
+}
+
 std::optional<bool> CXXRecordDecl::DefaultedCopyConstructorIsDeleted(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!self.getDefinition()) {
@@ -9167,6 +12096,16 @@ std::optional<std::vector<::pasta::FriendDecl>> CXXRecordDecl::Friends(void) con
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXRecordDecl::CanonicalDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getCanonicalDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXRecordDecl::CanonicalDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::Definition(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getDefinition();
@@ -9179,6 +12118,18 @@ std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::Definition(void) const noex
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::DefinitionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getDefinition();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionTemplateDecl> CXXRecordDecl::DependentLambdaCallOperator(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getDependentLambdaCallOperator();
@@ -9191,6 +12142,18 @@ std::optional<::pasta::FunctionTemplateDecl> CXXRecordDecl::DependentLambdaCallO
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::DependentLambdaCallOperatorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getDependentLambdaCallOperator();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ClassTemplateDecl> CXXRecordDecl::DescribedClassTemplate(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getDescribedClassTemplate();
@@ -9203,6 +12166,18 @@ std::optional<::pasta::ClassTemplateDecl> CXXRecordDecl::DescribedClassTemplate(
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::DescribedClassTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getDescribedClassTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXDestructorDecl> CXXRecordDecl::Destructor(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getDestructor();
@@ -9215,6 +12190,18 @@ std::optional<::pasta::CXXDestructorDecl> CXXRecordDecl::Destructor(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::DestructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getDestructor();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t CXXRecordDecl::DeviceLambdaManglingNumber(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getDeviceLambdaManglingNumber();
@@ -9247,6 +12234,18 @@ std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::InstantiatedFromMemberClass
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::InstantiatedFromMemberClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberClass();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXMethodDecl> CXXRecordDecl::LambdaCallOperator(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!self.isLambda()) {
@@ -9262,6 +12261,21 @@ std::optional<::pasta::CXXMethodDecl> CXXRecordDecl::LambdaCallOperator(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::LambdaCallOperatorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  if (!self.isLambda()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getLambdaCallOperator();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<enum LambdaCaptureDefault> CXXRecordDecl::LambdaCaptureDefault(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!self.isLambda()) {
@@ -9287,6 +12301,21 @@ std::optional<::pasta::Decl> CXXRecordDecl::LambdaContextDeclaration(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::LambdaContextDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  if (!self.isLambda()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getLambdaContextDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t CXXRecordDecl::LambdaDependencyKind(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getLambdaDependencyKind();
@@ -9361,6 +12390,16 @@ enum MSVtorDispMode CXXRecordDecl::MSVtorDispMode(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXRecordDecl::MostRecentDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getMostRecentDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXRecordDecl::MostRecentDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::MostRecentNonInjectedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getMostRecentNonInjectedDecl();
@@ -9373,6 +12412,18 @@ std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::MostRecentNonInjectedDeclar
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::MostRecentNonInjectedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getMostRecentNonInjectedDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<uint32_t> CXXRecordDecl::NumBases(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!self.getDefinition()) {
@@ -9415,6 +12466,18 @@ std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::PreviousDeclaration(void) c
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::PreviousDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.getPreviousDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::TemplateInstantiationPattern(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!clang::isTemplateInstantiation(self.getTemplateSpecializationKind())) {
@@ -9430,6 +12493,21 @@ std::optional<::pasta::CXXRecordDecl> CXXRecordDecl::TemplateInstantiationPatter
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::TemplateInstantiationPatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  if (!clang::isTemplateInstantiation(self.getTemplateSpecializationKind())) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getTemplateInstantiationPattern();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum TemplateSpecializationKind CXXRecordDecl::TemplateSpecializationKind(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.getTemplateSpecializationKind();
@@ -10146,6 +13224,21 @@ std::optional<::pasta::FunctionDecl> CXXRecordDecl::IsLocalClass(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXRecordDecl::IsLocalClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  if (!self.getDefinition()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.isLocalClass();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool CXXRecordDecl::IsNeverDependentLambda(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.isNeverDependentLambda();
@@ -10284,6 +13377,19 @@ std::optional<std::vector<::pasta::CXXMethodDecl>> CXXRecordDecl::Methods(void)
   __builtin_unreachable();
 }
 
+::pasta::DeclContextRange<::pasta::CXXMethodDecl> CXXRecordDecl::MethodsRange(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
+  decltype(auto) val = self.methods();
+  const clang::Decl *first = nullptr;
+  if (val.begin() != val.end()) {
+    first = *val.begin();
+  }
+  return ::pasta::DeclContextRange<::pasta::CXXMethodDecl>(
+      ast, first, [] (const clang::Decl *decl) {
+    return clang::isa<clang::CXXMethodDecl>(decl);
+  });
+}
+
 std::optional<bool> CXXRecordDecl::NeedsImplicitCopyAssignment(void) const noexcept {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   if (!self.getDefinition()) {
@@ -10453,6 +13559,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(ClassTemplateSpecializationDecl, ClassTemplatePar
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ClassTemplateSpecializationDecl::ExternTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
+  decltype(auto) val = self.getExternLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::variant<std::monostate, ::pasta::ClassTemplateDecl, ::pasta::ClassTemplatePartialSpecializationDecl> ClassTemplateSpecializationDecl::InstantiatedFrom(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
   decltype(auto) val = self.getInstantiatedFrom();
@@ -10479,6 +13592,13 @@ std::variant<std::monostate, ::pasta::ClassTemplateDecl, ::pasta::ClassTemplateP
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ClassTemplateSpecializationDecl::PointOfInstantiationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
+  decltype(auto) val = self.getPointOfInstantiation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum TemplateSpecializationKind ClassTemplateSpecializationDecl::SpecializationKind(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
   decltype(auto) val = self.getSpecializationKind();
@@ -10496,6 +13616,16 @@ enum TemplateSpecializationKind ClassTemplateSpecializationDecl::SpecializationK
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplateSpecializationDecl::SpecializedTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
+  decltype(auto) val = self.getSpecializedTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplateSpecializationDecl::SpecializedTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::variant<std::monostate, ::pasta::ClassTemplateDecl, ::pasta::ClassTemplatePartialSpecializationDecl> ClassTemplateSpecializationDecl::SpecializedTemplateOrPartial(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
   decltype(auto) val = self.getSpecializedTemplateOrPartial();
@@ -10546,6 +13676,13 @@ std::vector<::pasta::TemplateArgument> ClassTemplateSpecializationDecl::Template
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ClassTemplateSpecializationDecl::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> ClassTemplateSpecializationDecl::TypeAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl);
   if (!self.getTypeAsWritten()) {
@@ -10614,6 +13751,14 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, ClassTemplatePartialSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ClassTemplatePartialSpecializationDecl::InjectedSpecializationTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
+  decltype(auto) val = self.getInjectedSpecializationType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ClassTemplatePartialSpecializationDecl ClassTemplatePartialSpecializationDecl::InstantiatedFromMember(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
   decltype(auto) val = self.getInstantiatedFromMember();
@@ -10624,6 +13769,16 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, ClassTemplatePartialSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
+  decltype(auto) val = self.getInstantiatedFromMember();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ClassTemplatePartialSpecializationDecl ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberTemplate(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
   decltype(auto) val = self.getInstantiatedFromMemberTemplate();
@@ -10634,6 +13789,16 @@ PASTA_DEFINE_BASE_OPERATORS(TypeDecl, ClassTemplatePartialSpecializationDecl)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
+  decltype(auto) val = self.getInstantiatedFromMemberTemplate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberTemplateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ClassTemplatePartialSpecializationDecl::TemplateArgumentsAsWritten
 ::pasta::TemplateParameterList ClassTemplatePartialSpecializationDecl::TemplateParameters(void) const noexcept {
   auto &self = *const_cast<clang::ClassTemplatePartialSpecializationDecl *>(u.ClassTemplatePartialSpecializationDecl);
@@ -12,6 +12,7 @@
 #include <clang/AST/DeclObjC.h>
 #include <clang/AST/DeclTemplate.h>
 #include <clang/AST/Attr.h>
+#include <clang/AST/Stmt.h>
 #pragma clang diagnostic pop
 
 #include "AST.h"
@@ -420,6 +421,203 @@ TemplateParameterList::Parameters(void) const noexcept {
   return ret;
 }
 
+// Returns the next declaration after `decl` in its declaration context that
+// is accepted by `filter`, or `nullptr` if there isn't one.
+const clang::Decl *NextDeclInContext(const clang::Decl *decl,
+                                     DeclFilter filter) noexcept {
+  for (decl = decl->getNextDeclInContext(); decl;
+       decl = decl->getNextDeclInContext()) {
+    if (!filter || filter(decl)) {
+      return decl;
+    }
+  }
+  return nullptr;
+}
+
+// Returns an owning reference to `ast`, which must be owned by something.
+std::shared_ptr<ASTImpl> SharedAST(ASTImpl *ast) noexcept {
+  return ast->shared_from_this();
+}
+
+namespace {
+
+// Exposes whether a `clang::StmtIterator` walks an array of child statements.
+// Most statements keep their children in an array, but e.g. a `DeclStmt`
+// walks the initializers of its declarations instead.
+class ChildIterator : public clang::StmtIterator {
+ public:
+  inline explicit ChildIterator(const clang::StmtIterator &it)
+      : clang::StmtIterator(it) {}
+
+  inline bool IsInArray(void) const noexcept {
+    return inStmt();
+  }
+
+  inline clang::Stmt **Position(void) const noexcept {
+    return stmt;
+  }
+};
+
+// Returns the child of `stmt` at `index`, counting null children.
+static const clang::Stmt *ChildAt(const clang::Stmt *stmt, uintptr_t index) {
+  for (const clang::Stmt *child : stmt->children()) {
+    if (!index) {
+      return child;
+    }
+    --index;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+// An attribute cursor's `pos` points into the declaration's array of
+// attributes.
+Attr AttrRangeTraits::Dereference(ASTImpl *ast,
+                                  const LazyCursor &cursor) noexcept {
+  auto attr = *reinterpret_cast<clang::Attr *const *>(cursor.pos);
+  return AttrBuilder::Create<::pasta::Attr>(SharedAST(ast), attr);
+}
+
+void AttrRangeTraits::Advance(LazyCursor &cursor) noexcept {
+  cursor.pos = &(reinterpret_cast<clang::Attr *const *>(cursor.pos)[1]);
+}
+
+bool AttrRangeTraits::Equal(const LazyCursor &a,
+                            const LazyCursor &b) noexcept {
+  return a.pos == b.pos;
+}
+
+AttrRange RangeBuilder::Create(
+    std::shared_ptr<ASTImpl> ast_, const clang::Decl &,
+    llvm::iterator_range<clang::Attr *const *> attrs_) {
+  LazyCursor first;
+  LazyCursor after_last;
+  first.pos = attrs_.begin();
+  after_last.pos = attrs_.end();
+  return AttrRange(std::move(ast_), first, after_last);
+}
+
+// A redeclaration cursor's `pos` is the current redeclaration, and its `aux`
+// is the first one, at which the circular list of redeclarations ends.
+Decl RedeclarationRangeTraits::Dereference(ASTImpl *ast,
+                                           const LazyCursor &cursor) noexcept {
+  auto decl = reinterpret_cast<const clang::Decl *>(cursor.pos);
+  return DeclBuilder::Create<::pasta::Decl>(SharedAST(ast), decl);
+}
+
+void RedeclarationRangeTraits::Advance(LazyCursor &cursor) noexcept {
+  auto decl = const_cast<clang::Decl *>(
+      reinterpret_cast<const clang::Decl *>(cursor.pos));
+  clang::Decl::redecl_iterator it(decl);
+  ++it;
+  if (*it == cursor.aux) {
+    cursor.pos = nullptr;
+    cursor.aux = nullptr;
+  } else {
+    cursor.pos = *it;
+  }
+}
+
+bool RedeclarationRangeTraits::Equal(const LazyCursor &a,
+                                     const LazyCursor &b) noexcept {
+  return a.pos == b.pos;
+}
+
+RedeclarationRange RangeBuilder::Create(
+    std::shared_ptr<ASTImpl> ast_, const clang::Decl &,
+    llvm::iterator_range<clang::Decl::redecl_iterator> redecls_) {
+  LazyCursor first;
+  LazyCursor after_last;
+  if (redecls_.begin() != redecls_.end()) {
+    first.pos = *redecls_.begin();
+    first.aux = first.pos;
+  }
+  return RedeclarationRange(std::move(ast_), first, after_last);
+}
+
+// A child cursor either walks the array of children of its statement, or,
+// if the statement doesn't have one, counts its children. In the former case,
+// `pos` points into the array, `aux` points to the end of the array, and
+// `extra` is zero. In the latter case, `pos` is the statement, `aux` is its
+// number of children, and `extra` is one more than the current index. Either
+// way, null children are skipped.
+Stmt StmtChildRangeTraits::Dereference(ASTImpl *ast,
+                                       const LazyCursor &cursor) noexcept {
+  const clang::Stmt *child = nullptr;
+  if (!cursor.extra) {
+    child = *reinterpret_cast<clang::Stmt *const *>(cursor.pos);
+  } else {
+    child = ChildAt(reinterpret_cast<const clang::Stmt *>(cursor.pos),
+                    cursor.extra - 1u);
+  }
+  return StmtBuilder::Create<::pasta::Stmt>(SharedAST(ast), child);
+}
+
+// Skip over any null children, starting at `cursor`.
+static void SkipNullChildren(LazyCursor &cursor) noexcept {
+  if (!cursor.extra) {
+    auto it = reinterpret_cast<clang::Stmt *const *>(cursor.pos);
+    auto end = reinterpret_cast<clang::Stmt *const *>(cursor.aux);
+    while (it != end && !*it) {
+      ++it;
+    }
+    cursor.pos = it;
+
+  } else {
+    auto stmt = reinterpret_cast<const clang::Stmt *>(cursor.pos);
+    auto num_children = reinterpret_cast<uintptr_t>(cursor.aux);
+    while (cursor.extra <= num_children &&
+           !ChildAt(stmt, cursor.extra - 1u)) {
+      ++cursor.extra;
+    }
+  }
+}
+
+void StmtChildRangeTraits::Advance(LazyCursor &cursor) noexcept {
+  if (!cursor.extra) {
+    cursor.pos = &(reinterpret_cast<clang::Stmt *const *>(cursor.pos)[1]);
+  } else {
+    ++cursor.extra;
+  }
+  SkipNullChildren(cursor);
+}
+
+bool StmtChildRangeTraits::Equal(const LazyCursor &a,
+                                 const LazyCursor &b) noexcept {
+  return a.pos == b.pos && a.extra == b.extra;
+}
+
+StmtChildRange RangeBuilder::Create(
+    std::shared_ptr<ASTImpl> ast_, const clang::Stmt &stmt_,
+    llvm::iterator_range<clang::StmtIterator> children_) {
+  LazyCursor first;
+  LazyCursor after_last;
+  ChildIterator begin(children_.begin());
+  ChildIterator end(children_.end());
+  if (begin.IsInArray() && end.IsInArray()) {
+    first.pos = begin.Position();
+    first.aux = end.Position();
+    after_last.pos = end.Position();
+    after_last.aux = end.Position();
+
+  } else {
+    uintptr_t num_children = 0u;
+    for (auto it = children_.begin(); it != children_.end(); ++it) {
+      ++num_children;
+    }
+    first.pos = &stmt_;
+    first.aux = reinterpret_cast<const void *>(num_children);
+    first.extra = 1u;
+    after_last.pos = &stmt_;
+    after_last.aux = first.aux;
+    after_last.extra = num_children + 1u;
+  }
+
+  SkipNullChildren(first);
+  return StmtChildRange(std::move(ast_), first, after_last);
+}
+
 #endif  // PASTA_IN_BOOTSTRAP
 
 }  // namespace pasta
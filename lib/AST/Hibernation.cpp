@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "Hibernation.h"
+
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <zstd.h>
+
+#include "AST.h"
+#include "LazyAlignment.h"
+
+namespace pasta {
+namespace {
+
+// Favor speed over ratio; token and context arrays are very repetitive, and
+// so compress well at any level.
+static constexpr int kCompressionLevel = 1;
+
+// Compress the elements of `elems` into `buffer`. `elems` is left untouched.
+template <typename Container>
+static bool Compress(const Container &elems, Hibernation::Buffer &buffer) {
+  using T = typename Container::value_type;
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  buffer.size = elems.size();
+  buffer.capacity = elems.capacity();
+  if (elems.empty()) {
+    return true;
+  }
+
+  const size_t num_bytes = elems.size() * sizeof(T);
+  buffer.data.resize(ZSTD_compressBound(num_bytes));
+  const size_t ret = ZSTD_compress(buffer.data.data(), buffer.data.size(),
+                                   elems.data(), num_bytes,
+                                   kCompressionLevel);
+  if (ZSTD_isError(ret)) {
+    return false;
+  }
+
+  buffer.data.resize(ret);
+  buffer.data.shrink_to_fit();
+  return true;
+}
+
+// Decompress `buffer` into `elems`, and free `buffer`.
+template <typename Container>
+static void Decompress(Hibernation::Buffer &buffer, Container &elems,
+                       bool reserve) {
+  using T = typename Container::value_type;
+
+  if (reserve) {
+    elems.reserve(buffer.capacity);
+  }
+
+  if (buffer.size) {
+    const size_t num_bytes = buffer.size * sizeof(T);
+    std::unique_ptr<char[]> bytes(new char[num_bytes]);
+    const size_t ret = ZSTD_decompress(bytes.get(), num_bytes,
+                                       buffer.data.data(), buffer.data.size());
+    assert(!ZSTD_isError(ret) && ret == num_bytes);
+    (void) ret;
+
+    const T * const first = reinterpret_cast<const T *>(bytes.get());
+    elems.assign(first, &(first[buffer.size]));
+  }
+
+  buffer = {};
+}
+
+// Free the storage of `elems`.
+template <typename Container>
+static void Release(Container &elems) {
+  Container().swap(elems);
+}
+
+}  // namespace
+
+// Compress the tokens, token contexts, token columns, and backup token data,
+// and free the originals. The caller must hold the only reference to this
+// AST.
+bool ASTImpl::Hibernate(void) {
+  std::lock_guard<std::mutex> locker(hibernation_lock);
+  if (is_hibernating.load(std::memory_order_relaxed)) {
+    return true;
+  }
+
+  // Compress everything before freeing anything, so that a failure leaves
+  // this AST as it was.
+  auto state = std::make_unique<Hibernation>();
+  if (!Compress(tokens, state->tokens) ||
+      !Compress(contexts, state->contexts) ||
+      !Compress(backup_token_data, state->backup_token_data) ||
+      !Compress(token_columns.kinds, state->column_kinds) ||
+      !Compress(token_columns.roles, state->column_roles)) {
+    return false;
+  }
+
+  state->old_tokens = reinterpret_cast<uintptr_t>(tokens.data());
+
+  Release(tokens);
+  Release(contexts);
+  Release(backup_token_data);
+  Release(token_columns.kinds);
+  Release(token_columns.roles);
+
+  if (lazy_alignment) {
+    Release(lazy_alignment->scratch_tokens);
+  }
+
+  hibernation = std::move(state);
+  is_hibernating.store(true, std::memory_order_release);
+  return true;
+}
+
+// Decompress the buffers compressed by `Hibernate`.
+void ASTImpl::RehydrateBuffers(void) {
+  std::lock_guard<std::mutex> locker(hibernation_lock);
+  if (!is_hibernating.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  Hibernation &state = *hibernation;
+
+  // NOTE(pag): Lazy alignment appends to `contexts`, and relies on it never
+  //            moving, so it gets back all of the room that it had reserved.
+  Decompress(state.tokens, tokens, false);
+  Decompress(state.contexts, contexts, !!lazy_alignment);
+  Decompress(state.backup_token_data, backup_token_data, false);
+  Decompress(state.column_kinds, token_columns.kinds, false);
+  Decompress(state.column_roles, token_columns.roles, false);
+
+  // NOTE(pag): Rebasing rewrites `bounds`, `dense_decl_bounds`, `matching`,
+  //            and the lazy alignment groups, which are read under these
+  //            locks.
+  std::unique_lock<std::mutex> lazy_locker;
+  if (lazy_alignment) {
+    lazy_locker = std::unique_lock<std::mutex>(lazy_alignment->lock);
+  }
+  {
+    std::lock_guard<std::mutex> bounds_locker(bounds_mutex);
+    RebaseTokenPointers(state.old_tokens);
+  }
+
+  hibernation.reset();
+  is_hibernating.store(false, std::memory_order_release);
+}
+
+}  // namespace pasta
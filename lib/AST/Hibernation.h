@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace pasta {
+
+// Compressed copies of the buffers of a hibernating `ASTImpl`. See
+// `AST::Hibernate`.
+class Hibernation {
+ public:
+  // One zstd-compressed buffer.
+  struct Buffer {
+    std::string data;
+
+    // Number of elements in the buffer, and the number of elements to reserve
+    // room for when it is decompressed.
+    size_t size{0u};
+    size_t capacity{0u};
+  };
+
+  Buffer tokens;
+  Buffer contexts;
+  Buffer backup_token_data;
+  Buffer column_kinds;
+  Buffer column_roles;
+
+  // Address of the first token before hibernating. Pointers into the tokens
+  // are rebased from this address after they are decompressed.
+  uintptr_t old_tokens{0u};
+};
+
+}  // namespace pasta
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Token.h"
+
+namespace clang {
+class Decl;
+}  // namespace clang
+namespace pasta {
+
+// Top-level declaration (TLD) groups whose tokens are aligned on demand,
+// rather than by `ASTImpl::AlignTokens`. See
+// `CompileJobOptions::lazy_token_alignment`.
+class LazyAlignment {
+ public:
+  // A TLD group, as formed by `ASTImpl::AlignTokens`. The first declaration
+  // lexically contains the others.
+  struct Group {
+    std::vector<clang::Decl *> decls;
+    TokenImpl *parsed_first{nullptr};
+    TokenImpl *parsed_last{nullptr};
+  };
+
+  // A maximal run of groups whose parsed bounds overlap. The groups of a
+  // cluster are aligned together, and in order, as they would be by
+  // `ASTImpl::AlignTokens`.
+  struct Cluster {
+    TokenImpl *parsed_first{nullptr};
+    TokenImpl *parsed_last{nullptr};
+    uint32_t groups_begin{0u};
+    uint32_t groups_end{0u};
+
+    // Set, with release semantics, once the cluster's tokens have their
+    // contexts.
+    std::atomic<bool> is_aligned{false};
+  };
+
+  // Groups and clusters, in the order of their parsed tokens. Clusters are
+  // disjoint. These are read-only after `ASTImpl::AlignTokens`.
+  std::vector<Group> groups;
+  std::deque<Cluster> clusters;
+
+  // Kinds of the macro tokens from before `ASTImpl::LinkMacroTokenContexts`
+  // changed them, indexed like `RootMacroNode::tokens`. Alignment needs to
+  // see the same kinds as it would have when aligning eagerly.
+  std::vector<TokenKindBase> unlinked_macro_token_kinds;
+
+  // Number of contexts at the front of `ASTImpl::contexts` that are safe to
+  // read without holding `lock`. Published, with release semantics, after
+  // each cluster is migrated. `ASTImpl::contexts.size()` is only safe to
+  // read while holding `lock`, as migration appends to `ASTImpl::contexts`.
+  std::atomic<size_t> num_contexts{0u};
+
+  // Serializes the printing and alignment of clusters, and guards everything
+  // below.
+  std::mutex lock;
+
+  // Contexts migrated into `ASTImpl::contexts` so far, keyed by their data.
+  std::unordered_multimap<const void *, TokenContextIndex> data_to_context;
+  std::vector<TokenContextIndex> context_map;
+
+  // Copy of the tokens of the cluster being aligned. The tokens are aligned
+  // here, then published to `ASTImpl::tokens`, so that other threads never
+  // observe partially aligned tokens.
+  std::vector<TokenImpl> scratch_tokens;
+};
+
+}  // namespace pasta
@@ -4,6 +4,7 @@
 
 #include "Macro.h"
 
+#include <algorithm>
 #include <cassert>
 
 #pragma GCC diagnostic push
@@ -35,17 +36,21 @@
 namespace pasta {
 namespace {
 
-static MacroTokenImpl *FirstUseTokenImpl(const std::vector<Node> &nodes) {
+inline static void NoOnTokenCB(unsigned, MacroTokenImpl *, MacroTokenImpl *) {}
+inline static void NoOnNodeCB(unsigned, MacroNodeImpl *, MacroNodeImpl *) {}
+
+static MacroTokenImpl *FirstUseTokenImpl(const RootMacroNode &root,
+                                         std::span<const Node> nodes) {
   if (nodes.empty()) {
     return nullptr;
   }
 
   for (const Node &node : nodes) {
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
-      return std::get<MacroTokenImpl *>(node);
-    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
-      if (auto ret = sub_node->FirstUseToken()) {
+    if (node.IsToken()) {
+      return root.TokenAt(node);
+    } else if (node.IsNode()) {
+      MacroNodeImpl *sub_node = root.NodeAt(node);
+      if (auto ret = sub_node->FirstUseToken(root)) {
         return ret;
       }
     }
@@ -54,17 +59,18 @@ static MacroTokenImpl *FirstUseTokenImpl(const std::vector<Node> &nodes) {
   return nullptr;
 }
 
-static MacroTokenImpl *FirstExpansionTokenImpl(const std::vector<Node> &nodes) {
+static MacroTokenImpl *FirstExpansionTokenImpl(const RootMacroNode &root,
+                                               std::span<const Node> nodes) {
   if (nodes.empty()) {
     return nullptr;
   }
 
   for (const Node &node : nodes) {
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
-      return std::get<MacroTokenImpl *>(node);
-    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
-      if (auto ret = sub_node->FirstExpansionToken()) {
+    if (node.IsToken()) {
+      return root.TokenAt(node);
+    } else if (node.IsNode()) {
+      MacroNodeImpl *sub_node = root.NodeAt(node);
+      if (auto ret = sub_node->FirstExpansionToken(root)) {
         return ret;
       }
     }
@@ -74,18 +80,19 @@ static MacroTokenImpl *FirstExpansionTokenImpl(const std::vector<Node> &nodes) {
 }
 
 
-static const Node *FirstTokenImpl(const std::vector<Node> &nodes) {
+static const Node *FirstTokenImpl(const RootMacroNode &root,
+                                  std::span<const Node> nodes) {
   if (nodes.empty()) {
     return nullptr;
   }
 
   for (const Node &node : nodes) {
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
+    if (node.IsToken()) {
       return &node;
 
-    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
-      if (auto ret = sub_node->FirstToken()) {
+    } else if (node.IsNode()) {
+      MacroNodeImpl *sub_node = root.NodeAt(node);
+      if (auto ret = sub_node->FirstToken(root)) {
         return ret;
       }
     }
@@ -94,19 +101,20 @@ static const Node *FirstTokenImpl(const std::vector<Node> &nodes) {
   return nullptr;
 }
 
-static const Node *LastTokenImpl(const std::vector<Node> &nodes) {
+static const Node *LastTokenImpl(const RootMacroNode &root,
+                                 std::span<const Node> nodes) {
   if (nodes.empty()) {
     return nullptr;
   }
 
   for (auto it = nodes.rbegin(), end = nodes.rend(); it != end; ++it) {
     const Node &node = *it;
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
+    if (node.IsToken()) {
       return &node;
 
-    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
-      if (auto ret = sub_node->LastToken()) {
+    } else if (node.IsNode()) {
+      MacroNodeImpl *sub_node = root.NodeAt(node);
+      if (auto ret = sub_node->LastToken(root)) {
         return ret;
       }
     }
@@ -115,8 +123,245 @@ static const Node *LastTokenImpl(const std::vector<Node> &nodes) {
   return nullptr;
 }
 
+template <typename TokenCB, typename NodeCB>
+static void CloneNodeList(ASTImpl &ast,
+                          const MacroNodeImpl *old_parent,
+                          const NodeList &old_nodes,
+                          MacroNodeImpl *new_parent,
+                          NodeList &new_nodes,
+                          TokenCB on_token,
+                          NodeCB on_node) {
+  RootMacroNode &root = ast.root_macro_node;
+  auto i = 0u;
+  for (const Node &node : root.Nodes(old_nodes)) {
+    if (node.IsToken()) {
+      MacroTokenImpl *tok = root.TokenAt(node);
+      assert(tok->parent.IsNode());
+      assert(tok->parent == Node(old_parent));
+      MacroTokenImpl *cloned_tok = tok->Clone(ast, new_parent);
+      assert(tok->token_offset < cloned_tok->token_offset);
+      root.Append(new_nodes, cloned_tok);
+
+      on_token(i, tok, cloned_tok);
+
+    } else if (node.IsNode()) {
+      MacroNodeImpl *sub_node = root.NodeAt(node);
+      assert(sub_node->parent.IsNode());
+      assert(sub_node->parent == Node(old_parent));
+      auto cloned_node = sub_node->Clone(ast, new_parent);
+      root.Append(new_nodes, cloned_node);
+
+      on_node(i, sub_node, cloned_node);
+    }
+    ++i;
+  }
+}
+
+// Smallest `c` such that `2^c >= num_nodes`.
+static unsigned SizeClass(size_t num_nodes) {
+  unsigned size_class = 0u;
+  while ((size_t(1u) << size_class) < num_nodes) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+template <typename T>
+static T *NewNode(MacroArena<T> &arena, NodeTag tag) {
+  const auto index = static_cast<uint32_t>(arena.size());
+  T *node = &(arena.emplace_back());
+  node->self = Node(tag, index);
+  return node;
+}
+
 }  // namespace
 
+// Allocate a block of `2^size_class` nodes, returning its slot.
+uint32_t NodeListArena::Allocate(unsigned size_class) {
+  if (size_class > kChunkShift) {
+    assert(chunks.size() < (1u << (32u - kChunkShift)));
+    const auto chunk = static_cast<uint32_t>(chunks.size());
+    chunks.emplace_back(new Node[size_t(1u) << size_class]);
+    num_allocated_nodes += size_t(1u) << size_class;
+    return chunk << kChunkShift;
+  }
+
+  std::vector<uint32_t> &free_list = free_slots[size_class];
+  if (!free_list.empty()) {
+    uint32_t slot = free_list.back();
+    free_list.pop_back();
+    return slot;
+  }
+
+  const uint32_t block_size = 1u << size_class;
+  if ((kChunkSize - bump_offset) < block_size) {
+
+    // Give the tail of the current chunk to the free lists, so that it isn't
+    // lost, then start a new chunk.
+    while (bump_offset < kChunkSize) {
+      unsigned tail_class = kChunkShift;
+      while ((1u << tail_class) > (kChunkSize - bump_offset)) {
+        --tail_class;
+      }
+      free_slots[tail_class].push_back(
+          (bump_chunk << kChunkShift) | bump_offset);
+      bump_offset += 1u << tail_class;
+    }
+
+    assert(chunks.size() < (1u << (32u - kChunkShift)));
+    bump_chunk = static_cast<uint32_t>(chunks.size());
+    bump_offset = 0u;
+    chunks.emplace_back(new Node[kChunkSize]);
+    num_allocated_nodes += kChunkSize;
+  }
+
+  const uint32_t slot = (bump_chunk << kChunkShift) | bump_offset;
+  bump_offset += block_size;
+  return slot;
+}
+
+// Make sure that `list` has room for `num_nodes` nodes.
+void NodeListArena::Reserve(NodeList &list, size_t num_nodes) {
+  if (num_nodes <= list.capacity) {
+    return;
+  }
+
+  const unsigned size_class = SizeClass(std::max<size_t>(num_nodes, 2u));
+  const uint32_t new_slot = Allocate(size_class);
+
+  NodeList new_list;
+  new_list.slot = new_slot;
+  new_list.num_nodes = list.num_nodes;
+  new_list.capacity = 1u << size_class;
+
+  if (list.num_nodes) {
+    std::copy(Data(list), &(Data(list)[list.num_nodes]), Data(new_list));
+  }
+
+  Free(list);
+  list = new_list;
+}
+
+// Add `new_nodes` to the end of `list`.
+void NodeListArena::Append(NodeList &list, std::span<const Node> new_nodes) {
+  if (new_nodes.empty()) {
+    return;
+  }
+  const size_t num_nodes = list.num_nodes + new_nodes.size();
+  assert(num_nodes <= ~0u);
+  Reserve(list, num_nodes);
+  std::copy(new_nodes.begin(), new_nodes.end(), &(Data(list)[list.num_nodes]));
+  list.num_nodes = static_cast<uint32_t>(num_nodes);
+}
+
+// Return the storage of `list` to the arena, leaving `list` empty.
+void NodeListArena::Free(NodeList &list) {
+  if (list.capacity) {
+    const unsigned size_class = SizeClass(list.capacity);
+    if (size_class > kChunkShift) {
+      chunks[list.slot >> kChunkShift].reset();
+      num_allocated_nodes -= list.capacity;
+    } else {
+      free_slots[size_class].push_back(list.slot);
+    }
+  }
+  list = NodeList();
+}
+
+// Number of bytes allocated by this arena, including free blocks.
+size_t NodeListArena::MemoryUsage(void) const noexcept {
+  size_t num_bytes = (num_allocated_nodes * sizeof(Node)) +
+                     (chunks.capacity() * sizeof(chunks[0]));
+  for (const std::vector<uint32_t> &free_list : free_slots) {
+    num_bytes += free_list.capacity() * sizeof(uint32_t);
+  }
+  return num_bytes;
+}
+
+RootMacroNode::RootMacroNode(void)
+    : MacroNodeImpl(MacroKind::kOtherDirective) {
+  self = Node(NodeTag::kRoot, 0u);
+}
+
+MacroTokenImpl *RootMacroNode::NewToken(void) {
+  return NewNode(tokens, NodeTag::kToken);
+}
+
+MacroDirectiveImpl *RootMacroNode::NewDirective(void) {
+  return NewNode(directives, NodeTag::kDirective);
+}
+
+MacroExpansionImpl *RootMacroNode::NewExpansion(void) {
+  return NewNode(expansions, NodeTag::kExpansion);
+}
+
+MacroArgumentImpl *RootMacroNode::NewArgument(void) {
+  return NewNode(arguments, NodeTag::kArgument);
+}
+
+MacroParameterImpl *RootMacroNode::NewParameter(void) {
+  return NewNode(parameters, NodeTag::kParameter);
+}
+
+MacroSubstitutionImpl *RootMacroNode::NewSubstitution(void) {
+  return NewNode(substitutions, NodeTag::kSubstitution);
+}
+
+// Return the token referenced by `node`, or `nullptr` if `node` doesn't
+// reference a token.
+MacroTokenImpl *RootMacroNode::TokenAt(Node node) const noexcept {
+  if (node.IsToken()) {
+    return &(tokens[node.Index()]);
+  } else {
+    return nullptr;
+  }
+}
+
+// Return the macro node referenced by `node`, or `nullptr` if `node`
+// doesn't reference a macro node.
+MacroNodeImpl *RootMacroNode::NodeAt(Node node) const noexcept {
+  switch (node.Tag()) {
+    case NodeTag::kEmpty:
+    case NodeTag::kToken:
+      return nullptr;
+    case NodeTag::kDirective:
+      return &(directives[node.Index()]);
+    case NodeTag::kExpansion:
+      return &(expansions[node.Index()]);
+    case NodeTag::kArgument:
+      return &(arguments[node.Index()]);
+    case NodeTag::kParameter:
+      return &(parameters[node.Index()]);
+    case NodeTag::kSubstitution:
+      return &(substitutions[node.Index()]);
+    case NodeTag::kRoot:
+      return const_cast<RootMacroNode *>(this);
+  }
+  return nullptr;
+}
+
+// Add `node` to the end of `list`.
+void RootMacroNode::Append(NodeList &list, Node node) {
+  node_lists.Append(list, {&node, 1u});
+}
+
+// Add `new_nodes` to the end of `list`. `new_nodes` must not be in `list`.
+void RootMacroNode::Append(NodeList &list, std::span<const Node> new_nodes) {
+  node_lists.Append(list, new_nodes);
+}
+
+// Replace the nodes of `list` with those of `new_list`, and free the old
+// storage of `list`.
+void RootMacroNode::Replace(NodeList &list, NodeList &new_list) {
+  list.swap(new_list);
+  node_lists.Free(new_list);
+}
+
+MacroNodeImpl *RootMacroNode::Clone(ASTImpl &, MacroNodeImpl *) const {
+  abort();
+  __builtin_unreachable();
+}
+
 // Clone this token into the AST.
 MacroTokenImpl *MacroTokenImpl::Clone(ASTImpl &ast,
                                       MacroNodeImpl *new_parent) const {
@@ -124,7 +369,7 @@ MacroTokenImpl *MacroTokenImpl::Clone(ASTImpl &ast,
   size_t new_offset = ast.tokens.size();
   ast.tokens.emplace_back(std::move(ast_tok));
 
-  MacroTokenImpl *clone = &(ast.root_macro_node.tokens.emplace_back());
+  MacroTokenImpl *clone = ast.root_macro_node.NewToken();
   clone->token_offset = static_cast<uint32_t>(new_offset);
   assert(clone->token_offset == new_offset);
   clone->parent = new_parent;
@@ -145,11 +390,40 @@ MacroTokenImpl *MacroTokenImpl::Clone(ASTImpl &ast,
   return clone;
 }
 
+// Dispatch to the `Clone` of the derived class.
+MacroNodeImpl *MacroNodeImpl::Clone(
+    ASTImpl &ast, MacroNodeImpl *new_parent) const {
+  switch (self.Tag()) {
+    case NodeTag::kDirective:
+      return static_cast<const MacroDirectiveImpl *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kExpansion:
+      return static_cast<const MacroExpansionImpl *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kArgument:
+      return static_cast<const MacroArgumentImpl *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kParameter:
+      return static_cast<const MacroParameterImpl *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kSubstitution:
+      return static_cast<const MacroSubstitutionImpl *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kRoot:
+      return static_cast<const RootMacroNode *>(this)->Clone(
+          ast, new_parent);
+    case NodeTag::kEmpty:
+    case NodeTag::kToken:
+      break;
+  }
+  assert(false);
+  return nullptr;
+}
+
 MacroNodeImpl *MacroDirectiveImpl::Clone(
     ASTImpl &ast, MacroNodeImpl *new_parent) const {
 
-  MacroDirectiveImpl *clone = &(ast.root_macro_node.directives.emplace_back());
-  clone->cloned_from = this;
+  MacroDirectiveImpl *clone = ast.root_macro_node.NewDirective();
   clone->defined_macro = defined_macro;
   clone->included_file = included_file;
   clone->kind = kind;
@@ -158,14 +432,12 @@ MacroNodeImpl *MacroDirectiveImpl::Clone(
 
   CloneNodeList(
       ast, this, nodes, clone, clone->nodes,
-      [=] (unsigned i, MacroTokenImpl *tok, MacroTokenImpl *cloned_tok) {
-        if (std::holds_alternative<MacroTokenImpl *>(directive_name) &&
-            std::get<MacroTokenImpl *>(directive_name) == tok) {
+      [=, this] (unsigned, MacroTokenImpl *tok, MacroTokenImpl *cloned_tok) {
+        if (directive_name == Node(tok)) {
           clone->directive_name = cloned_tok;
         }
 
-        if (std::holds_alternative<MacroTokenImpl *>(macro_name) &&
-            std::get<MacroTokenImpl *>(macro_name) == tok) {
+        if (macro_name == Node(tok)) {
           clone->macro_name = cloned_tok;
         }
       },
@@ -180,13 +452,12 @@ MacroNodeImpl *MacroArgumentImpl::Clone(
   assert(!has_been_cloned);
   has_been_cloned = true;
 
-  MacroArgumentImpl *clone = &(ast.root_macro_node.arguments.emplace_back());
-  clone->cloned_from = this;
-  if (auto expansion = dynamic_cast<MacroExpansionImpl *>(new_parent)) {
+  MacroArgumentImpl *clone = ast.root_macro_node.NewArgument();
+  if (auto expansion = llvm::dyn_cast<MacroExpansionImpl>(new_parent)) {
     clone->index = static_cast<unsigned>(expansion->arguments.size());
     clone->offset = static_cast<unsigned>(expansion->nodes.size());
     clone->is_prearg_expansion = expansion->is_prearg_expansion;
-    expansion->arguments.emplace_back(clone);
+    ast.root_macro_node.Append(expansion->arguments, clone);
   } else {
     assert(false);
     clone->index = index;
@@ -209,9 +480,7 @@ MacroNodeImpl *MacroParameterImpl::Clone(ASTImpl &, MacroNodeImpl *) const {
 MacroNodeImpl *MacroSubstitutionImpl::Clone(
     ASTImpl &ast, MacroNodeImpl *new_parent) const {
 
-  MacroSubstitutionImpl *clone =
-      &(ast.root_macro_node.substitutions.emplace_back());
-  clone->cloned_from = this;
+  MacroSubstitutionImpl *clone = ast.root_macro_node.NewSubstitution();
   clone->parent = new_parent;
 
   CloneNodeList(ast, this, nodes, clone, clone->nodes, NoOnTokenCB, NoOnNodeCB);
@@ -224,13 +493,12 @@ MacroNodeImpl *MacroSubstitutionImpl::Clone(
 MacroNodeImpl *MacroExpansionImpl::Clone(
     ASTImpl &ast, MacroNodeImpl *new_parent) const {
 
-  MacroExpansionImpl *clone =
-      &(ast.root_macro_node.expansions.emplace_back());
-  clone->cloned_from = this;
+  RootMacroNode &root = ast.root_macro_node;
+  MacroExpansionImpl *clone = root.NewExpansion();
   clone->parent = new_parent;
   clone->definition = definition;
   clone->defined_macro = defined_macro;
-  if (auto new_parent_exp = dynamic_cast<MacroExpansionImpl *>(new_parent)) {
+  if (auto new_parent_exp = llvm::dyn_cast<MacroExpansionImpl>(new_parent)) {
     if (parent_for_prearg) {
       clone->parent_for_prearg = new_parent_exp;
     }
@@ -248,8 +516,8 @@ MacroNodeImpl *MacroExpansionImpl::Clone(
 
   CloneNodeList(
       ast, this, use_nodes, clone, clone->use_nodes,
-      [=, &arg_num] (unsigned i, MacroTokenImpl *tok,
-                     MacroTokenImpl *cloned_tok) {
+      [=, this, &root, &arg_num] (unsigned i, MacroTokenImpl *tok,
+                                  MacroTokenImpl *cloned_tok) {
         if (ident == tok) {
           clone->ident = cloned_tok;
         }
@@ -264,32 +532,30 @@ MacroNodeImpl *MacroExpansionImpl::Clone(
         }
 
         if (arg_num < arguments.size() &&
-            std::holds_alternative<MacroTokenImpl *>(arguments[arg_num]) &&
-            std::get<MacroTokenImpl *>(arguments[arg_num]) == tok) {
-          clone->arguments.emplace_back(cloned_tok);
+            root.Nodes(arguments)[arg_num] == Node(tok)) {
+          root.Append(clone->arguments, cloned_tok);
           ++arg_num;
         }
       },
-      [=, &arg_num] (unsigned i, MacroNodeImpl *node,
-          MacroNodeImpl *cloned_node) {
+      [=, this, &root, &arg_num] (unsigned i, MacroNodeImpl *node,
+                                  MacroNodeImpl *cloned_node) {
 
-        if (ident == node->FirstExpansionToken()) {
-          clone->ident = cloned_node->FirstExpansionToken();
+        if (ident == node->FirstExpansionToken(root)) {
+          clone->ident = cloned_node->FirstExpansionToken(root);
         }
 
-        if (l_paren == node->FirstExpansionToken()) {
-          clone->l_paren = cloned_node->FirstExpansionToken();
+        if (l_paren == node->FirstExpansionToken(root)) {
+          clone->l_paren = cloned_node->FirstExpansionToken(root);
         }
 
-        if (r_paren == node->FirstExpansionToken()) {
-          clone->r_paren = cloned_node->FirstExpansionToken();
+        if (r_paren == node->FirstExpansionToken(root)) {
+          clone->r_paren = cloned_node->FirstExpansionToken(root);
           clone->r_paren_index = i;
         }
 
         if (arg_num < arguments.size() &&
-            std::holds_alternative<MacroNodeImpl *>(arguments[arg_num]) &&
-            std::get<MacroNodeImpl *>(arguments[arg_num]) == node) {
-          clone->arguments.emplace_back(cloned_node);
+            root.Nodes(arguments)[arg_num] == Node(node)) {
+          root.Append(clone->arguments, cloned_node);
           ++arg_num;
         }
       });
@@ -297,68 +563,53 @@ MacroNodeImpl *MacroExpansionImpl::Clone(
   return clone;
 }
 
-MacroNodeImpl *RootMacroNode::Clone(ASTImpl &, MacroNodeImpl *) const {
-  abort();
-  __builtin_unreachable();
-}
-
-const Node *MacroNodeImpl::FirstToken(void) const {
-  return FirstTokenImpl(nodes);
-}
-
-const Node *MacroSubstitutionImpl::FirstToken(void) const {
-  if (auto tok = FirstTokenImpl(use_nodes)) {
-    return tok;
-  } else {
-    return FirstTokenImpl(nodes);
+const Node *MacroNodeImpl::FirstToken(const RootMacroNode &root) const {
+  if (llvm::isa<MacroSubstitutionImpl>(this)) {
+    auto sub = static_cast<const MacroSubstitutionImpl *>(this);
+    if (auto tok = FirstTokenImpl(root, root.Nodes(sub->use_nodes))) {
+      return tok;
+    }
   }
+  return FirstTokenImpl(root, root.Nodes(nodes));
 }
 
-const Node *MacroNodeImpl::LastToken(void) const {
-  return LastTokenImpl(nodes);
-}
-
-const Node *MacroSubstitutionImpl::LastToken(void) const {
-  if (auto tok = LastTokenImpl(use_nodes)) {
-    return tok;
-  } else {
-    return LastTokenImpl(nodes);
+const Node *MacroNodeImpl::LastToken(const RootMacroNode &root) const {
+  if (llvm::isa<MacroSubstitutionImpl>(this)) {
+    auto sub = static_cast<const MacroSubstitutionImpl *>(this);
+    if (auto tok = LastTokenImpl(root, root.Nodes(sub->use_nodes))) {
+      return tok;
+    }
   }
+  return LastTokenImpl(root, root.Nodes(nodes));
 }
 
-MacroTokenImpl *MacroNodeImpl::FirstUseToken(void) const {
-  return FirstUseTokenImpl(nodes);
-}
-
-MacroTokenImpl *MacroSubstitutionImpl::FirstUseToken(void) const {
-  if (!use_nodes.empty()) {
-    return FirstUseTokenImpl(use_nodes);
-  } else {
-    return FirstUseTokenImpl(nodes);  // An in-progress node.
+MacroTokenImpl *MacroNodeImpl::FirstUseToken(const RootMacroNode &root) const {
+  if (llvm::isa<MacroSubstitutionImpl>(this)) {
+    auto sub = static_cast<const MacroSubstitutionImpl *>(this);
+    if (!sub->use_nodes.empty()) {
+      return FirstUseTokenImpl(root, root.Nodes(sub->use_nodes));
+    }
   }
+  return FirstUseTokenImpl(root, root.Nodes(nodes));  // An in-progress node.
 }
 
-
-MacroTokenImpl *MacroNodeImpl::FirstExpansionToken(void) const {
-  return FirstExpansionTokenImpl(nodes);
-}
-
-MacroTokenImpl *MacroSubstitutionImpl::FirstExpansionToken(void) const {
-  if (!nodes.empty()) {
-    return FirstExpansionTokenImpl(nodes);
-  } else {
-    return FirstExpansionTokenImpl(use_nodes);
+MacroTokenImpl *MacroNodeImpl::FirstExpansionToken(
+    const RootMacroNode &root) const {
+  if (llvm::isa<MacroSubstitutionImpl>(this) && nodes.empty()) {
+    auto sub = static_cast<const MacroSubstitutionImpl *>(this);
+    return FirstExpansionTokenImpl(root, root.Nodes(sub->use_nodes));
   }
+  return FirstExpansionTokenImpl(root, root.Nodes(nodes));
 }
 
 Macro::~Macro(void) {}
 
 MacroKind Macro::Kind(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
+  if (node.IsToken()) {
     return MacroKind::kToken;
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    return std::get<MacroNodeImpl *>(node)->kind;
+  } else if (node.IsNode()) {
+    return ast->root_macro_node.NodeAt(node)->kind;
   } else {
     assert(false);
     DEBUG( std::cerr << "Bad macro kind on main file: "
@@ -370,10 +621,10 @@ MacroKind Macro::Kind(void) const noexcept {
 
 const void *Macro::RawMacro(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
-    return &(ast->tokens[std::get<MacroTokenImpl *>(node)->token_offset]);
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    auto ret = std::get<MacroNodeImpl *>(node);
+  if (node.IsToken()) {
+    return &(ast->tokens[ast->root_macro_node.TokenAt(node)->token_offset]);
+  } else if (node.IsNode()) {
+    auto ret = ast->root_macro_node.NodeAt(node);
     assert(ret != nullptr);
     return ret;
   } else {
@@ -387,21 +638,22 @@ const void *Macro::RawMacro(void) const noexcept {
 // Return the macro node containing this node.
 std::optional<Macro> Macro::Parent(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
-    return Macro(ast, &(std::get<MacroTokenImpl *>(node)->parent));
+  if (node.IsToken()) {
+    return Macro(ast, &(ast->root_macro_node.TokenAt(node)->parent));
   }
 
-  if (!std::holds_alternative<MacroNodeImpl *>(node)) {
+  if (!node.IsNode()) {
     return std::nullopt;
   }
 
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  if (!std::holds_alternative<MacroNodeImpl *>(node_impl->parent)) {
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  if (!node_impl->parent.IsNode()) {
     return std::nullopt;
   }
 
-  MacroNodeImpl *parent_node_impl = std::get<MacroNodeImpl *>(node_impl->parent);
-  if (dynamic_cast<RootMacroNode *>(parent_node_impl)) {
+  MacroNodeImpl *parent_node_impl =
+      ast->root_macro_node.NodeAt(node_impl->parent);
+  if (llvm::isa<RootMacroNode>(parent_node_impl)) {
     return std::nullopt;
   }
 
@@ -411,15 +663,16 @@ std::optional<Macro> Macro::Parent(void) const noexcept {
 // Children of this macro. If this is a MacroToken then this is empty.
 MacroRange Macro::Children(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    MacroNodeImpl *impl = std::get<MacroNodeImpl *>(node);
+  if (node.IsNode()) {
+    const RootMacroNode &root = ast->root_macro_node;
+    MacroNodeImpl *impl = root.NodeAt(node);
     MacroSubstitutionImpl *sub_impl =
-        dynamic_cast<MacroSubstitutionImpl *>(impl);
+        llvm::dyn_cast<MacroSubstitutionImpl>(impl);
     if (sub_impl) {
-      const auto first = sub_impl->use_nodes.data();
+      const auto first = root.Nodes(sub_impl->use_nodes).data();
       return MacroRange(ast, first, &(first[sub_impl->use_nodes.size()]));
     } else {
-      const auto first = impl->nodes.data();
+      const auto first = root.Nodes(impl->nodes).data();
       return MacroRange(ast, first, &(first[impl->nodes.size()]));
     }
   }
@@ -428,10 +681,11 @@ MacroRange Macro::Children(void) const noexcept {
 
 std::optional<MacroToken> Macro::BeginToken(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
+  if (node.IsToken()) {
     return reinterpret_cast<const MacroToken &>(*this);
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    if (const Node *tok = std::get<MacroNodeImpl *>(node)->FirstToken()) {
+  } else if (node.IsNode()) {
+    const RootMacroNode &root = ast->root_macro_node;
+    if (const Node *tok = root.NodeAt(node)->FirstToken(root)) {
       return MacroToken(ast, tok);
     }
   } else {
@@ -444,10 +698,11 @@ std::optional<MacroToken> Macro::BeginToken(void) const noexcept {
 
 std::optional<MacroToken> Macro::EndToken(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
+  if (node.IsToken()) {
     return reinterpret_cast<const MacroToken &>(*this);
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    if (const Node *tok = std::get<MacroNodeImpl *>(node)->LastToken()) {
+  } else if (node.IsNode()) {
+    const RootMacroNode &root = ast->root_macro_node;
+    if (const Node *tok = root.NodeAt(node)->LastToken(root)) {
       return MacroToken(ast, tok);
     }
   } else {
@@ -480,7 +735,7 @@ std::optional<FileToken> MacroToken::FileLocation(void) const noexcept {
 // Location of the token as parsed.
 Token MacroToken::ParsedLocation(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  auto offset = std::get<MacroTokenImpl *>(node)->token_offset;
+  auto offset = ast->root_macro_node.TokenAt(node)->token_offset;
   if (offset >= ast->tokens.size()) {
     assert(false);  // Not sure what's going on here.
     return Token(ast);
@@ -519,12 +774,13 @@ PASTA_FOR_EACH_MACRO_IMPL(PASTA_IGNORE,
 // Return the hash token of the directive.
 MacroToken MacroDirective::Hash(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
 
   assert(!dir_impl->nodes.empty());
-  assert(std::holds_alternative<MacroTokenImpl *>(dir_impl->nodes.front()));
-  return MacroToken(ast, &(dir_impl->nodes.front()));
+  Node &hash = ast->root_macro_node.Nodes(dir_impl->nodes).front();
+  assert(hash.IsToken());
+  return MacroToken(ast, &hash);
 }
 
 // The name of this directive, if any. Some GCC-specific macros don't have
@@ -533,10 +789,10 @@ MacroToken MacroDirective::Hash(void) const noexcept {
 // `#pragma ...`.
 std::optional<MacroToken> MacroDirective::DirectiveName(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
 
-  if (!std::holds_alternative<MacroTokenImpl *>(dir_impl->directive_name)) {
+  if (!dir_impl->directive_name.IsToken()) {
     return std::nullopt;
   }
 
@@ -547,10 +803,12 @@ std::optional<MacroToken> MacroDirective::DirectiveName(void) const noexcept {
 std::optional<MacroToken>
 MacroParameter::VariadicDots(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroParameterImpl *param_impl = dynamic_cast<MacroParameterImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroParameterImpl *param_impl =
+      llvm::dyn_cast<MacroParameterImpl>(node_impl);
   if (param_impl->is_variadic) {
-    return MacroToken(ast, &(param_impl->nodes.back()));
+    return MacroToken(
+        ast, &(ast->root_macro_node.Nodes(param_impl->nodes).back()));
   } else {
     return std::nullopt;
   }
@@ -559,10 +817,12 @@ MacroParameter::VariadicDots(void) const noexcept {
 // The name of the macro parameter, if any.
 std::optional<MacroToken> MacroParameter::Name(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroParameterImpl *param_impl = dynamic_cast<MacroParameterImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroParameterImpl *param_impl =
+      llvm::dyn_cast<MacroParameterImpl>(node_impl);
   if (param_impl->is_variadic) {
-    return MacroToken(ast, &(param_impl->nodes.front()));
+    return MacroToken(
+        ast, &(ast->root_macro_node.Nodes(param_impl->nodes).front()));
   } else {
     return std::nullopt;
   }
@@ -570,8 +830,9 @@ std::optional<MacroToken> MacroParameter::Name(void) const noexcept {
 
 unsigned MacroParameter::Index(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroParameterImpl *param_impl = dynamic_cast<MacroParameterImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroParameterImpl *param_impl =
+      llvm::dyn_cast<MacroParameterImpl>(node_impl);
   return param_impl->index;
 }
 
@@ -586,12 +847,12 @@ DefineMacroDirective::From(const Macro &node) {
 
 std::optional<MacroToken> DefineMacroDirective::Name(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
-  if (std::holds_alternative<MacroTokenImpl *>(dir_impl->macro_name)) {
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
+  if (dir_impl->macro_name.IsToken()) {
     return MacroToken(ast, &(dir_impl->macro_name));
   } else {
-    assert(std::holds_alternative<std::monostate>(dir_impl->macro_name));
+    assert(dir_impl->macro_name.IsEmpty());
     return std::nullopt;
   }
 }
@@ -599,8 +860,8 @@ std::optional<MacroToken> DefineMacroDirective::Name(void) const noexcept {
 // Number of explicit, i.e. not variadic, parameters.
 unsigned DefineMacroDirective::NumExplicitParameters(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (dir_impl->defined_macro) {
 
     // NOTE(pag): Clang includes the variadic parameter in `getNumParams()`.
@@ -615,8 +876,8 @@ unsigned DefineMacroDirective::NumExplicitParameters(void) const noexcept {
 // arguments when used.
 bool DefineMacroDirective::IsFunctionLike(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (dir_impl->defined_macro) {
     return dir_impl->defined_macro->isFunctionLike();
   } else {
@@ -628,8 +889,8 @@ bool DefineMacroDirective::IsFunctionLike(void) const noexcept {
 // Does this definition accept a variable number of arguments?
 bool DefineMacroDirective::IsVariadic(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (dir_impl->defined_macro) {
     return dir_impl->defined_macro->isVariadic();
   } else {
@@ -641,10 +902,10 @@ bool DefineMacroDirective::IsVariadic(void) const noexcept {
 // Uses of this macro.
 MacroRange DefineMacroDirective::Uses(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (!dir_impl->macro_uses.empty()) {
-    const auto first = dir_impl->macro_uses.data();
+    const auto first = ast->root_macro_node.Nodes(dir_impl->macro_uses).data();
     return MacroRange(
         ast, first, &(first[dir_impl->macro_uses.size()]));
   } else {
@@ -655,10 +916,10 @@ MacroRange DefineMacroDirective::Uses(void) const noexcept {
 // Body of the defined macro.
 MacroRange DefineMacroDirective::Body(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (!dir_impl->nodes.empty()) {
-    const auto first = dir_impl->nodes.data();
+    const auto first = ast->root_macro_node.Nodes(dir_impl->nodes).data();
     const auto num_nodes = dir_impl->nodes.size();
     const auto body_offset = dir_impl->body_offset;
     if (body_offset >= num_nodes) {
@@ -673,10 +934,10 @@ MacroRange DefineMacroDirective::Body(void) const noexcept {
 // Parameters of this macro definition.
 MacroRange DefineMacroDirective::Parameters(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   if (!dir_impl->parameters.empty()) {
-    const auto first = dir_impl->parameters.data();
+    const auto first = ast->root_macro_node.Nodes(dir_impl->parameters).data();
     return MacroRange(
         ast, first, &(first[dir_impl->parameters.size()]));
   } else {
@@ -717,17 +978,17 @@ std::optional<ConditionalMacroDirective> ConditionalMacroDirective::From(
 
 std::optional<File> IncludeLikeMacroDirective::IncludedFile(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroDirectiveImpl *dir_impl = llvm::dyn_cast<MacroDirectiveImpl>(node_impl);
   return dir_impl->included_file;
 }
 
 bool MacroArgument::IsVariadic(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroArgumentImpl *arg_impl = dynamic_cast<MacroArgumentImpl *>(node_impl);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(
-      std::get<MacroNodeImpl *>(arg_impl->parent));
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroArgumentImpl *arg_impl = llvm::dyn_cast<MacroArgumentImpl>(node_impl);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(
+      ast->root_macro_node.NodeAt(arg_impl->parent));
   if (exp_impl->defined_macro) {
     return exp_impl->defined_macro->getNumParams() <= arg_impl->index;
   }
@@ -736,13 +997,13 @@ bool MacroArgument::IsVariadic(void) const noexcept {
 
 unsigned MacroArgument::Index(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroArgumentImpl *arg_impl = dynamic_cast<MacroArgumentImpl *>(node_impl);
-  MacroNodeImpl *exp_node = std::get<MacroNodeImpl *>(arg_impl->parent);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(exp_node);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroArgumentImpl *arg_impl = llvm::dyn_cast<MacroArgumentImpl>(node_impl);
+  MacroNodeImpl *exp_node = ast->root_macro_node.NodeAt(arg_impl->parent);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(exp_node);
   auto i = 0u;
-  for (const Node &arg_node : exp_impl->arguments) {
-    if (std::get<MacroNodeImpl *>(arg_node) == node_impl) {
+  for (const Node &arg_node : ast->root_macro_node.Nodes(exp_impl->arguments)) {
+    if (arg_node == node) {
       return i;
     }
     ++i;
@@ -753,11 +1014,11 @@ unsigned MacroArgument::Index(void) const noexcept {
 
 MacroRange MacroSubstitution::ReplacementChildren(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
   MacroSubstitutionImpl *sub_impl =
-      dynamic_cast<MacroSubstitutionImpl *>(node_impl);
+      llvm::dyn_cast<MacroSubstitutionImpl>(node_impl);
   if (!sub_impl->nodes.empty()) {
-    const auto first = sub_impl->nodes.data();
+    const auto first = ast->root_macro_node.Nodes(sub_impl->nodes).data();
     return MacroRange(
         ast, first, &(first[sub_impl->nodes.size()]));
   } else {
@@ -768,17 +1029,17 @@ MacroRange MacroSubstitution::ReplacementChildren(void) const noexcept {
 MacroExpansion MacroExpansion::Containing(
     const MacroArgument &arg) noexcept {
   Node node = *reinterpret_cast<const Node *>(arg.impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroArgumentImpl *arg_impl = dynamic_cast<MacroArgumentImpl *>(node_impl);
+  MacroNodeImpl *node_impl = arg.ast->root_macro_node.NodeAt(node);
+  MacroArgumentImpl *arg_impl = llvm::dyn_cast<MacroArgumentImpl>(node_impl);
   return MacroExpansion(arg.ast, &(arg_impl->parent));
 }
 
 // Returns the directive that led to the definition of this expansion.
 std::optional<DefineMacroDirective> MacroExpansion::Definition(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(node_impl);
-  if (std::holds_alternative<MacroNodeImpl *>(exp_impl->definition)) {
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(node_impl);
+  if (exp_impl->definition.IsNode()) {
     return DefineMacroDirective(ast, &(exp_impl->definition));
   } else {
     return std::nullopt;
@@ -790,11 +1051,11 @@ std::optional<DefineMacroDirective> MacroExpansion::Definition(void) const noexc
 std::vector<MacroArgument>
 MacroExpansion::Arguments(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(node_impl);
 
   std::vector<MacroArgument> ret;
-  for (Node &arg : exp_impl->arguments) {
+  for (Node &arg : ast->root_macro_node.Nodes(exp_impl->arguments)) {
     ret.emplace_back(MacroArgument(ast, &arg));
   }
 
@@ -804,8 +1065,8 @@ MacroExpansion::Arguments(void) const noexcept {
 // Is this the argument pre-expansion phase of this expansion?
 bool MacroExpansion::IsArgumentPreExpansion(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(node_impl);
   return exp_impl->is_prearg_expansion;
 }
 
@@ -815,21 +1076,21 @@ bool MacroExpansion::IsArgumentPreExpansion(void) const noexcept {
 std::optional<MacroExpansion>
 MacroExpansion::ArgumentPreExpansion(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
-  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
-  MacroExpansionImpl *exp_impl = dynamic_cast<MacroExpansionImpl *>(node_impl);
+  MacroNodeImpl *node_impl = ast->root_macro_node.NodeAt(node);
+  MacroExpansionImpl *exp_impl = llvm::dyn_cast<MacroExpansionImpl>(node_impl);
 
   if (exp_impl->nodes.empty()) {
     return std::nullopt;
   }
 
-  Node &pa_node = exp_impl->nodes.front();
-  if (!std::holds_alternative<MacroNodeImpl *>(pa_node)) {
+  Node &pa_node = ast->root_macro_node.Nodes(exp_impl->nodes).front();
+  if (!pa_node.IsNode()) {
     return std::nullopt;
   }
 
-  MacroNodeImpl *pa_node_impl = std::get<MacroNodeImpl *>(pa_node);
+  MacroNodeImpl *pa_node_impl = ast->root_macro_node.NodeAt(pa_node);
   MacroExpansionImpl *pa_exp_impl =
-      dynamic_cast<MacroExpansionImpl *>(pa_node_impl);
+      llvm::dyn_cast<MacroExpansionImpl>(pa_node_impl);
 
   if (!pa_exp_impl || pa_exp_impl->parent_for_prearg != exp_impl) {
     return std::nullopt;
@@ -7,8 +7,19 @@
 #include <pasta/AST/Macro.h>
 
 #include <cassert>
-#include <deque>
-#include <variant>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <llvm/Support/Casting.h>
+#pragma GCC diagnostic pop
 
 #include <pasta/Util/File.h>
 
@@ -17,27 +28,278 @@ class MacroInfo;
 }  // namespace clang
 namespace pasta {
 
-using Node = std::variant<std::monostate, MacroNodeImpl *, MacroTokenImpl *>;
-using NodeList = std::vector<Node>;
-
-inline static void NoOnTokenCB(unsigned, MacroTokenImpl *, MacroTokenImpl *) {}
-inline static void NoOnNodeCB(unsigned, MacroNodeImpl *, MacroNodeImpl *) {}
-
 class ASTImpl;
+class MacroParameterImpl;
+class MacroSubstitutionImpl;
 class MacroTokenImpl;
+class RootMacroNode;
+
+// Which of the typed arenas of `RootMacroNode` a `Node` indexes into.
+enum class NodeTag : uint32_t {
+  kEmpty,
+  kToken,
+  kDirective,
+  kExpansion,
+  kArgument,
+  kParameter,
+  kSubstitution,
+  kRoot
+};
+
+// A reference to a macro token or macro node. This is a 32-bit tagged index:
+// the low bits say which arena of `RootMacroNode` holds the referenced thing,
+// and the high bits are its index in that arena. A default-constructed `Node`
+// references nothing. Use `RootMacroNode::TokenAt` and `RootMacroNode::NodeAt`
+// to go from a `Node` to the thing that it references.
+class Node {
+ public:
+  static constexpr unsigned kTagBits = 3u;
+  static constexpr uint32_t kTagMask = (1u << kTagBits) - 1u;
+  static constexpr uint32_t kMaxIndex = (1u << (32u - kTagBits)) - 1u;
+
+  Node(void) = default;
+
+  inline Node(NodeTag tag, uint32_t index)
+      : bits((index << kTagBits) | static_cast<uint32_t>(tag)) {
+    assert(index <= kMaxIndex);
+  }
+
+  // Token and node pointers convert into the `Node` referencing them, so that
+  // they can be stored directly into node lists and parent links. A null
+  // pointer converts into an empty `Node`.
+  Node(const MacroTokenImpl *tok);
+  Node(const MacroNodeImpl *node);
+
+  inline NodeTag Tag(void) const noexcept {
+    return static_cast<NodeTag>(bits & kTagMask);
+  }
+
+  inline uint32_t Index(void) const noexcept {
+    return bits >> kTagBits;
+  }
+
+  inline bool IsEmpty(void) const noexcept {
+    return Tag() == NodeTag::kEmpty;
+  }
+
+  inline bool IsToken(void) const noexcept {
+    return Tag() == NodeTag::kToken;
+  }
+
+  inline bool IsNode(void) const noexcept {
+    return Tag() > NodeTag::kToken;
+  }
+
+  bool operator==(const Node &) const noexcept = default;
+  bool operator!=(const Node &) const noexcept = default;
+
+ private:
+  uint32_t bits{0u};
+};
+
+static_assert(sizeof(Node) == sizeof(uint32_t));
+
+// A list of child nodes. This is only a handle: the nodes themselves live in
+// the `NodeListArena` of the `RootMacroNode`, so reading or appending goes
+// through `RootMacroNode::Nodes` and `RootMacroNode::Append`.
+class NodeList {
+ public:
+  inline size_t size(void) const noexcept {
+    return num_nodes;
+  }
+
+  inline bool empty(void) const noexcept {
+    return !num_nodes;
+  }
+
+  // Remove all nodes, keeping the list's storage for future appends.
+  inline void clear(void) noexcept {
+    num_nodes = 0u;
+  }
+
+  inline void pop_back(void) noexcept {
+    assert(0u < num_nodes);
+    --num_nodes;
+  }
+
+  inline void swap(NodeList &that) noexcept {
+    std::swap(slot, that.slot);
+    std::swap(num_nodes, that.num_nodes);
+    std::swap(capacity, that.capacity);
+  }
+
+ private:
+  friend class NodeListArena;
+
+  // Where the nodes of this list start in the arena.
+  uint32_t slot{0u};
+  uint32_t num_nodes{0u};
+  uint32_t capacity{0u};
+};
+
+// Backing storage for the `NodeList`s of one AST. Lists are carved out of
+// large, shared chunks in power-of-two sized blocks. A list that outgrows its
+// block moves into one twice the size, and its old block goes on a free list
+// for reuse by other lists. Chunks never move, so pointers to nodes in a list
+// are valid until that same list grows.
+class NodeListArena {
+ public:
+  // Blocks of at most `kChunkSize` nodes share chunks. Anything bigger gets a
+  // chunk of its own.
+  static constexpr unsigned kChunkShift = 16u;
+  static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+
+  inline Node *Data(const NodeList &list) const noexcept {
+    if (!list.capacity) {
+      return nullptr;
+    }
+    return &(chunks[list.slot >> kChunkShift][list.slot & (kChunkSize - 1u)]);
+  }
+
+  // Make sure that `list` has room for `num_nodes` nodes.
+  void Reserve(NodeList &list, size_t num_nodes);
+
+  // Add `new_nodes` to the end of `list`.
+  void Append(NodeList &list, std::span<const Node> new_nodes);
+
+  // Return the storage of `list` to the arena, leaving `list` empty.
+  void Free(NodeList &list);
+
+  // Number of bytes allocated by this arena, including free blocks.
+  size_t MemoryUsage(void) const noexcept;
+
+ private:
+  uint32_t Allocate(unsigned size_class);
+
+  std::vector<std::unique_ptr<Node[]>> chunks;
+
+  // Number of nodes in `chunks`.
+  size_t num_allocated_nodes{0u};
+
+  // The chunk from which small blocks are currently being allocated, and the
+  // offset of the next unallocated node in that chunk.
+  uint32_t bump_chunk{0u};
+  uint32_t bump_offset{kChunkSize};
+
+  // Free blocks of `2^i` nodes, for `i` up to `kChunkShift`.
+  std::vector<uint32_t> free_slots[kChunkShift + 1u];
+};
+
+// Append-only, chunked storage for one type of macro node. Elements never
+// move, and an element's index in the arena is the index of its `Node`.
+template <typename T>
+class MacroArena {
+ public:
+  static constexpr unsigned kChunkShift = 10u;
+  static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+
+  template <typename U>
+  class Iterator {
+   public:
+    inline Iterator(const MacroArena<T> *arena_, uint32_t index_)
+        : arena(arena_),
+          index(index_) {}
+
+    inline U &operator*(void) const noexcept {
+      return (*arena)[index];
+    }
+
+    inline Iterator &operator++(void) noexcept {
+      ++index;
+      return *this;
+    }
+
+    inline bool operator!=(const Iterator &that) const noexcept {
+      return index != that.index;
+    }
 
+   private:
+    const MacroArena<T> *arena;
+    uint32_t index;
+  };
+
+  MacroArena(void) = default;
+  MacroArena(const MacroArena<T> &) = delete;
+  MacroArena<T> &operator=(const MacroArena<T> &) = delete;
+
+  ~MacroArena(void) {
+    for (uint32_t i = 0u; i < num_elements; ++i) {
+      (*this)[i].~T();
+    }
+    for (T *chunk : chunks) {
+      std::allocator<T>().deallocate(chunk, kChunkSize);
+    }
+  }
+
+  inline size_t size(void) const noexcept {
+    return num_elements;
+  }
+
+  inline bool empty(void) const noexcept {
+    return !num_elements;
+  }
+
+  // Number of bytes allocated by this arena, including the unused tail of
+  // the last chunk.
+  inline size_t MemoryUsage(void) const noexcept {
+    return (chunks.size() * kChunkSize * sizeof(T)) +
+           (chunks.capacity() * sizeof(T *));
+  }
+
+  inline T &operator[](uint32_t index) const noexcept {
+    assert(index < num_elements);
+    return chunks[index >> kChunkShift][index & (kChunkSize - 1u)];
+  }
+
+  // Default-construct a new element at the end of the arena.
+  T &emplace_back(void) {
+    if (num_elements == (chunks.size() << kChunkShift)) {
+      chunks.push_back(std::allocator<T>().allocate(kChunkSize));
+    }
+    T *elem = &(chunks.back()[num_elements & (kChunkSize - 1u)]);
+    new (elem) T();
+    ++num_elements;
+    return *elem;
+  }
+
+  inline Iterator<T> begin(void) noexcept {
+    return Iterator<T>(this, 0u);
+  }
+
+  inline Iterator<T> end(void) noexcept {
+    return Iterator<T>(this, num_elements);
+  }
+
+  inline Iterator<const T> begin(void) const noexcept {
+    return Iterator<const T>(this, 0u);
+  }
+
+  inline Iterator<const T> end(void) const noexcept {
+    return Iterator<const T>(this, num_elements);
+  }
+
+ private:
+  std::vector<T *> chunks;
+  uint32_t num_elements{0u};
+};
+
+// Base of all macro nodes. There is no vtable; the `Tag` of `self` says which
+// derived class a node is, which is what `classof` checks so that
+// `llvm::isa`, `llvm::dyn_cast`, etc. work on macro nodes.
 class MacroNodeImpl {
  public:
   MacroNodeImpl(void) = delete;
   inline explicit MacroNodeImpl(MacroKind kind_)
       : kind(kind_) {}
 
-  virtual ~MacroNodeImpl(void) = default;
-  virtual MacroTokenImpl *FirstUseToken(void) const;
-  virtual MacroTokenImpl *FirstExpansionToken(void) const;
-  virtual const Node *FirstToken(void) const;
-  virtual const Node *LastToken(void) const;
-  virtual MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const = 0;
+  MacroTokenImpl *FirstUseToken(const RootMacroNode &root) const;
+  MacroTokenImpl *FirstExpansionToken(const RootMacroNode &root) const;
+  const Node *FirstToken(const RootMacroNode &root) const;
+  const Node *LastToken(const RootMacroNode &root) const;
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
+
+  // This node, i.e. where to find it in the arenas of the `RootMacroNode`.
+  Node self;
 
   Node parent;
   NodeList nodes;
@@ -45,7 +307,6 @@ class MacroNodeImpl {
   // Kind of this Node.
   MacroKind kind;
 
-  const MacroNodeImpl *cloned_from{nullptr};
 #ifndef NDEBUG
   unsigned line_added{0u};
 #endif
@@ -58,6 +319,9 @@ struct TokenKindAndFlags {
 
 class MacroTokenImpl final {
  public:
+  // This token, i.e. where to find it in `RootMacroNode::tokens`.
+  Node self;
+
   Node parent;
 
   // Offset of `TokenImpl` in `ASTImpl::tokens`.
@@ -75,13 +339,18 @@ class MacroTokenImpl final {
   MacroTokenImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 };
 
+static_assert(sizeof(MacroTokenImpl) == 4u * sizeof(uint32_t));
+
 class MacroDirectiveImpl final : public MacroNodeImpl {
  public:
   inline MacroDirectiveImpl(void)
       : MacroNodeImpl(MacroKind::kOtherDirective) {}
 
-  virtual ~MacroDirectiveImpl(void) = default;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const final;
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kDirective;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 
   // The info for the macro that was defined by this directive.
   const clang::MacroInfo *defined_macro{nullptr};
@@ -119,8 +388,11 @@ class MacroArgumentImpl final : public MacroNodeImpl {
   inline MacroArgumentImpl(void)
       : MacroNodeImpl(MacroKind::kArgument) {}
 
-  virtual ~MacroArgumentImpl(void) = default;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const final;
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kArgument;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 
   // Index of this argument in the macro call argument list. If there are five
   // arguments, then the first index is 0, second is 1, etc.
@@ -145,8 +417,11 @@ class MacroParameterImpl final : public MacroNodeImpl {
   inline MacroParameterImpl(void)
       : MacroNodeImpl(MacroKind::kParameter) {}
 
-  virtual ~MacroParameterImpl(void) = default;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const final;
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kParameter;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 
   NodeList uses;
 
@@ -160,12 +435,12 @@ class MacroSubstitutionImpl : public MacroNodeImpl {
   inline MacroSubstitutionImpl(void)
       : MacroNodeImpl(MacroKind::kSubstitution) {}
 
-  virtual ~MacroSubstitutionImpl(void) = default;
-  MacroTokenImpl *FirstUseToken(void) const final;
-  MacroTokenImpl *FirstExpansionToken(void) const final;
-  const Node *FirstToken(void) const final;
-  const Node *LastToken(void) const final;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const override;
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kSubstitution ||
+           node->self.Tag() == NodeTag::kExpansion;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 
   NodeList use_nodes;
 };
@@ -176,8 +451,11 @@ class MacroExpansionImpl final : public MacroSubstitutionImpl {
     kind = MacroKind::kExpansion;
   }
 
-  virtual ~MacroExpansionImpl(void) = default;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const final;
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kExpansion;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
 
   NodeList arguments;
   Node definition;
@@ -214,54 +492,70 @@ class MacroExpansionImpl final : public MacroSubstitutionImpl {
 };
 
 // The `nodes` of a `RootMacroNode` are the top-level macro nodes, e.g. top-
-// level directives, and top-level expansions.
+// level directives, and top-level expansions. The root also owns every other
+// macro node and token of the AST, in one arena per node type, as well as the
+// storage for all node lists.
 class RootMacroNode final : public MacroNodeImpl {
  public:
-  RootMacroNode(void)
-      : MacroNodeImpl(MacroKind::kOtherDirective) {}
+  RootMacroNode(void);
+
+  inline static bool classof(const MacroNodeImpl *node) noexcept {
+    return node->self.Tag() == NodeTag::kRoot;
+  }
+
+  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const;
+
+  // Create new tokens and nodes. Their `self` is filled in.
+  MacroTokenImpl *NewToken(void);
+  MacroDirectiveImpl *NewDirective(void);
+  MacroExpansionImpl *NewExpansion(void);
+  MacroArgumentImpl *NewArgument(void);
+  MacroParameterImpl *NewParameter(void);
+  MacroSubstitutionImpl *NewSubstitution(void);
+
+  // Return the token referenced by `node`, or `nullptr` if `node` doesn't
+  // reference a token.
+  MacroTokenImpl *TokenAt(Node node) const noexcept;
+
+  // Return the macro node referenced by `node`, or `nullptr` if `node`
+  // doesn't reference a macro node.
+  MacroNodeImpl *NodeAt(Node node) const noexcept;
+
+  // The nodes in `list`. Appending to `list` invalidates this span.
+  inline std::span<Node> Nodes(const NodeList &list) const noexcept {
+    return std::span<Node>(node_lists.Data(list), list.size());
+  }
 
-  virtual ~RootMacroNode(void) = default;
-  MacroNodeImpl *Clone(ASTImpl &ast, MacroNodeImpl *parent) const final;
+  // Add `node` to the end of `list`.
+  void Append(NodeList &list, Node node);
 
-  std::deque<MacroDirectiveImpl> directives;
-  std::deque<MacroExpansionImpl> expansions;
-  std::deque<MacroArgumentImpl> arguments;
-  std::deque<MacroParameterImpl> parameters;
-  std::deque<MacroSubstitutionImpl> substitutions;
-  std::deque<MacroTokenImpl> tokens;
-  NodeList token_nodes;
+  // Add `new_nodes` to the end of `list`. `new_nodes` must not be in `list`.
+  void Append(NodeList &list, std::span<const Node> new_nodes);
+
+  // Replace the nodes of `list` with those of `new_list`, and free the old
+  // storage of `list`.
+  void Replace(NodeList &list, NodeList &new_list);
+
+  MacroArena<MacroDirectiveImpl> directives;
+  MacroArena<MacroExpansionImpl> expansions;
+  MacroArena<MacroArgumentImpl> arguments;
+  MacroArena<MacroParameterImpl> parameters;
+  MacroArena<MacroSubstitutionImpl> substitutions;
+  MacroArena<MacroTokenImpl> tokens;
+  std::vector<Node> token_nodes;
+
+  mutable NodeListArena node_lists;
 };
 
-template <typename TokenCB, typename NodeCB>
-static void CloneNodeList(ASTImpl &ast,
-                          const MacroNodeImpl *old_parent,
-                          const NodeList &old_nodes,
-                          MacroNodeImpl *new_parent,
-                          NodeList &new_nodes,
-                          TokenCB on_token,
-                          NodeCB on_node) {
-  auto i = 0u;
-  for (const Node &node : old_nodes) {
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
-      MacroTokenImpl *tok = std::get<MacroTokenImpl *>(node);
-      assert(std::holds_alternative<MacroNodeImpl *>(tok->parent));
-      assert(std::get<MacroNodeImpl *>(tok->parent) == old_parent);
-      MacroTokenImpl *cloned_tok = tok->Clone(ast, new_parent);
-      assert(tok->token_offset < cloned_tok->token_offset);
-      new_nodes.emplace_back(cloned_tok);
-
-      on_token(i, tok, cloned_tok);
-
-    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
-      assert(std::holds_alternative<MacroNodeImpl *>(sub_node->parent));
-      assert(std::get<MacroNodeImpl *>(sub_node->parent) == old_parent);
-      auto cloned_node = sub_node->Clone(ast, new_parent);
-      new_nodes.emplace_back(cloned_node);
-
-      on_node(i, sub_node, cloned_node);
-    }
-    ++i;
+inline Node::Node(const MacroTokenImpl *tok) {
+  if (tok) {
+    bits = tok->self.bits;
+  }
+}
+
+inline Node::Node(const MacroNodeImpl *node) {
+  if (node) {
+    bits = node->self.bits;
   }
 }
 
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/MemoryUsage.h>
+
+#include <sstream>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/ASTContext.h>
+#include <clang/Basic/SourceManager.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Lex/Preprocessor.h>
+#pragma GCC diagnostic pop
+
+#include "AST.h"
+#include "LazyAlignment.h"
+
+namespace pasta {
+namespace {
+
+template <typename T>
+static uint64_t VectorBytes(const std::vector<T> &vec) {
+  return vec.capacity() * sizeof(T);
+}
+
+// NOTE(pag): This assumes a node-based hash table, i.e. one bucket pointer
+//            per bucket, plus a node per entry holding a next pointer, the
+//            entry, and possibly a cached hash.
+template <typename Map>
+static uint64_t MapBytes(const Map &map) {
+  return (map.bucket_count() * sizeof(void *)) +
+         (map.size() * (sizeof(typename Map::value_type) +
+                        (2u * sizeof(void *))));
+}
+
+}  // namespace
+
+// Measure the memory retained by this AST.
+ASTMemoryUsage ASTImpl::MemoryUsage(void) {
+  ASTMemoryUsage usage;
+
+  // The buffers of a hibernating AST are released, so wake it up first.
+  Rehydrate();
+  std::lock_guard<std::mutex> hibernation_locker(hibernation_lock);
+
+  usage.tokens = VectorBytes(tokens);
+  usage.token_columns = VectorBytes(token_columns.kinds) +
+                        VectorBytes(token_columns.roles);
+
+  // NOTE(pag): `token_file_locations` is only safe to read once it's built, as
+  //            `FileLocationOf` may be building it right now.
+  if (has_token_file_locations.load(std::memory_order_acquire)) {
+    usage.token_file_locations = VectorBytes(token_file_locations) +
+                                 VectorBytes(token_location_files);
+  }
+
+  usage.preprocessed_code = preprocessed_code.capacity();
+  usage.backup_token_data = backup_token_data.capacity();
+
+  // NOTE(pag): Lazy alignment appends to `contexts` while holding its lock.
+  std::unique_lock<std::mutex> lazy_locker;
+  if (lazy_alignment) {
+    lazy_locker = std::unique_lock<std::mutex>(lazy_alignment->lock);
+  }
+
+  usage.contexts = VectorBytes(contexts);
+
+  if (lazy_alignment) {
+    const LazyAlignment &lazy = *lazy_alignment;
+    usage.lazy_alignment = sizeof(LazyAlignment) +
+                           VectorBytes(lazy.groups) +
+                           (lazy.clusters.size() *
+                            sizeof(LazyAlignment::Cluster)) +
+                           VectorBytes(lazy.unlinked_macro_token_kinds) +
+                           MapBytes(lazy.data_to_context) +
+                           VectorBytes(lazy.context_map) +
+                           VectorBytes(lazy.scratch_tokens);
+    for (const LazyAlignment::Group &group : lazy.groups) {
+      usage.lazy_alignment += VectorBytes(group.decls);
+    }
+    lazy_locker.unlock();
+  }
+
+  const RootMacroNode &root = root_macro_node;
+  usage.macro_nodes = root.directives.MemoryUsage() +
+                      root.expansions.MemoryUsage() +
+                      root.arguments.MemoryUsage() +
+                      root.parameters.MemoryUsage() +
+                      root.substitutions.MemoryUsage() +
+                      MapBytes(tokens_to_macro_definitions);
+  usage.macro_tokens = root.tokens.MemoryUsage() +
+                       VectorBytes(root.token_nodes);
+  usage.macro_node_lists = root.node_lists.MemoryUsage();
+
+  {
+    std::lock_guard<std::mutex> locker(bounds_mutex);
+    usage.decl_bounds = MapBytes(bounds);
+    usage.matching = MapBytes(matching);
+  }
+  usage.decl_bounds += decl_ordinals.MemoryUsage() +
+                       VectorBytes(dense_decl_bounds);
+  usage.lexically_containing_decl = MapBytes(lexically_containing_decl);
+
+  for (const File &file : parsed_files) {
+    FileImpl &impl = *(file.impl);
+    {
+      std::lock_guard<std::mutex> locker(impl.data_lock);
+      if (!impl.fixed_data.empty()) {
+        usage.file_data += impl.fixed_data.capacity();
+      } else {
+        usage.file_data += impl.data.size();
+      }
+    }
+
+    std::unique_lock<std::mutex> locker(impl.tokens_lock);
+    impl.WaitForTokens(locker);
+    usage.file_tokens += VectorBytes(impl.tokens);
+  }
+
+  if (ci->hasASTContext()) {
+    const clang::ASTContext &ast_context = ci->getASTContext();
+    usage.clang_ast_context = ast_context.getASTAllocatedMemory() +
+                              ast_context.getSideTableAllocatedMemory();
+  }
+
+  if (ci->hasSourceManager()) {
+    const clang::SourceManager &sm = ci->getSourceManager();
+    const clang::SourceManager::MemoryBufferSizes buffer_sizes =
+        sm.getMemoryBufferSizes();
+    usage.clang_source_manager = sm.getContentCacheSize() +
+                                 sm.getDataStructureSizes() +
+                                 buffer_sizes.malloc_bytes +
+                                 buffer_sizes.mmap_bytes;
+  }
+
+  if (ci->hasPreprocessor()) {
+    usage.clang_preprocessor = ci->getPreprocessor().getTotalMemory();
+  }
+
+  return usage;
+}
+
+// Total of all of the above, except for `file_data` and `file_tokens`,
+// which aren't owned by the `AST`.
+uint64_t ASTMemoryUsage::Total(void) const noexcept {
+  return tokens + token_columns + token_file_locations + contexts +
+         preprocessed_code + backup_token_data + macro_nodes + macro_tokens +
+         macro_node_lists + decl_bounds + matching +
+         lexically_containing_decl + lazy_alignment +
+         clang_ast_context + clang_source_manager + clang_preprocessor;
+}
+
+// Render this breakdown as a JSON object.
+std::string ASTMemoryUsage::ToJSON(void) const {
+  std::stringstream os;
+  os << "{\"tokens\":" << tokens
+     << ",\"token_columns\":" << token_columns
+     << ",\"token_file_locations\":" << token_file_locations
+     << ",\"contexts\":" << contexts
+     << ",\"preprocessed_code\":" << preprocessed_code
+     << ",\"backup_token_data\":" << backup_token_data
+     << ",\"macro_nodes\":" << macro_nodes
+     << ",\"macro_tokens\":" << macro_tokens
+     << ",\"macro_node_lists\":" << macro_node_lists
+     << ",\"decl_bounds\":" << decl_bounds
+     << ",\"matching\":" << matching
+     << ",\"lexically_containing_decl\":" << lexically_containing_decl
+     << ",\"lazy_alignment\":" << lazy_alignment
+     << ",\"file_data\":" << file_data
+     << ",\"file_tokens\":" << file_tokens
+     << ",\"clang_ast_context\":" << clang_ast_context
+     << ",\"clang_source_manager\":" << clang_source_manager
+     << ",\"clang_preprocessor\":" << clang_preprocessor
+     << ",\"total\":" << Total()
+     << "}";
+  return os.str();
+}
+
+}  // namespace pasta
@@ -18,6 +18,19 @@ namespace pasta {
 class PrintedTokenRangeImpl;
 
 
+// Return the token kind of the keyword that spells the storage class `SC`.
+static clang::tok::TokenKind StorageClassTokenKind(clang::StorageClass SC) {
+  switch (SC) {
+    case clang::SC_None: break;
+    case clang::SC_Extern: return clang::tok::kw_extern;
+    case clang::SC_Static: return clang::tok::kw_static;
+    case clang::SC_PrivateExtern: return clang::tok::kw___private_extern__;
+    case clang::SC_Auto: return clang::tok::kw_auto;
+    case clang::SC_Register: return clang::tok::kw_register;
+  }
+  llvm_unreachable("Invalid storage class");
+}
+
 void Decl_printGroup(clang::Decl** Begin, size_t NumDecls,
                      raw_string_ostream &Out, const clang::PrintingPolicy &Policy,
                      unsigned Indentation, PrintedTokenRangeImpl &tokens) {
@@ -565,10 +578,12 @@ void DeclPrinter::VisitRecordDecl(clang::RecordDecl *D) {
 
 void DeclPrinter::VisitEnumConstantDecl(clang::EnumConstantDecl *D) {
   TokenPrinterContext ctx(Out, D, tokens);
-  Out << *D;
+  ctx.Emit(D->getIdentifier());
   prettyPrintAttributes(D);
   if (clang::Expr *Init = D->getInitExpr()) {
-    Out << " = ";
+    Out << ' ';
+    ctx.Emit(clang::tok::equal);
+    Out << ' ';
     StmtPrinter stmtPrinter(Out, nullptr, tokens, Policy, Indentation, "\n", &Context);
     stmtPrinter.Visit(const_cast<clang::Expr *>(Init));
   }
@@ -615,14 +630,20 @@ void DeclPrinter::VisitFunctionDecl(clang::FunctionDecl *D) {
   if (!Policy.SuppressSpecifiers) {
     switch (D->getStorageClass()) {
     case clang::SC_None: break;
-    case clang::SC_Extern: Out << "extern "; break;
-    case clang::SC_Static: Out << "static "; break;
-    case clang::SC_PrivateExtern: Out << "__private_extern__ "; break;
+    case clang::SC_Extern:
+    case clang::SC_Static:
+    case clang::SC_PrivateExtern:
+      ctx.Emit(StorageClassTokenKind(D->getStorageClass()));
+      Out << ' ';
+      break;
     case clang::SC_Auto: case clang::SC_Register:
       llvm_unreachable("invalid for functions");
     }
 
-    if (D->isInlineSpecified())  Out << "inline ";
+    if (D->isInlineSpecified()) {
+      ctx.Emit(clang::tok::kw_inline);
+      Out << ' ';
+    }
     if (D->isVirtualAsWritten()) Out << "virtual ";
     if (D->isModulePrivate())    Out << "__module_private__ ";
     if (D->isConstexprSpecified() && !D->isExplicitlyDefaulted())
@@ -985,6 +1006,15 @@ void DeclPrinter::VisitFunctionDecl(clang::FunctionDecl *D) {
       if (!Policy.TerseOutput && clang::isa<clang::CXXConstructorDecl>(*D))
         Out << " {}";
     }
+
+  // NOTE(pag): The parser skipped this body (see
+  //            `CompileJobOptions::skip_function_bodies`). Print an empty
+  //            body so that the braces of the parsed body align, and so
+  //            that the tokens inside of it inherit the function's context.
+  } else if (D->hasSkippedBody() && !Policy.TerseOutput) {
+    Out << ' ';
+    ctx.Emit(clang::tok::l_brace);
+    ctx.Emit(clang::tok::r_brace);
   }
 }
 
@@ -1019,8 +1049,10 @@ void DeclPrinter::VisitFieldDecl(clang::FieldDecl *D) {
   TokenPrinterContext ctx(Out, D, tokens);
 
   // FIXME: add printing of pragma attributes if required.
-  if (!Policy.SuppressSpecifiers && D->isMutable())
-    Out << "mutable ";
+  if (!Policy.SuppressSpecifiers && D->isMutable()) {
+    ctx.Emit(clang::tok::kw_mutable);
+    Out << ' ';
+  }
   if (!Policy.SuppressSpecifiers && D->isModulePrivate())
     Out << "__module_private__ ";
 
@@ -1031,14 +1063,16 @@ void DeclPrinter::VisitFieldDecl(clang::FieldDecl *D) {
       [&] () {
         if (auto name = D->getName(); !name.empty()) {
           TokenPrinterContext jump_up_stack(ctx);
-          Out << name;
+          jump_up_stack.Emit(D->getIdentifier());
           ctx.MarkLocation(D->getLocation());
         }
       },
       Indentation);
 
   if (D->isBitField()) {
-    Out << " : ";
+    Out << ' ';
+    ctx.Emit(clang::tok::colon);
+    Out << ' ';
     printPrettyStmt(D->getBitWidth(), Out, nullptr, Policy, Indentation);
   }
 
@@ -1068,8 +1102,10 @@ void DeclPrinter::VisitVarDecl(clang::VarDecl *D) {
 
   if (!Policy.SuppressSpecifiers) {
     clang::StorageClass SC = D->getStorageClass();
-    if (SC != clang::SC_None)
-      Out << clang::VarDecl::getStorageClassSpecifierString(SC) << " ";
+    if (SC != clang::SC_None) {
+      ctx.Emit(StorageClassTokenKind(SC));
+      Out << ' ';
+    }
 
     switch (D->getTSCSpec()) {
     case clang::TSCS_unspecified:
@@ -1097,7 +1133,7 @@ void DeclPrinter::VisitVarDecl(clang::VarDecl *D) {
   printDeclType(T, [&] () {
     if (auto name = D->getName(); !name.empty()) {
       TokenPrinterContext jump_up_stack(ctx);
-      Out << name;
+      jump_up_stack.Emit(D->getIdentifier());
       ctx.MarkLocation(D->getLocation());
     }
   });
@@ -1118,16 +1154,18 @@ void DeclPrinter::VisitVarDecl(clang::VarDecl *D) {
     }
     if (!ImplicitInit) {
       if ((D->getInitStyle() == clang::VarDecl::CallInit) && !clang::isa<clang::ParenListExpr>(Init))
-        Out << "(";
+        ctx.Emit(clang::tok::l_paren);
       else if (D->getInitStyle() == clang::VarDecl::CInit) {
-        Out << " = ";
+        Out << ' ';
+        ctx.Emit(clang::tok::equal);
+        Out << ' ';
       }
       clang::PrintingPolicy SubPolicy(Policy);
       SubPolicy.SuppressSpecifiers = false;
       SubPolicy.IncludeTagDefinition = false;
       printPrettyStmt(Init, Out, nullptr, SubPolicy, Indentation);
       if ((D->getInitStyle() == clang::VarDecl::CallInit) && !clang::isa<clang::ParenListExpr>(Init))
-        Out << ")";
+        ctx.Emit(clang::tok::r_paren);
     }
   }
   prettyPrintAttributes(D);
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace pasta {
+
+// Open-addressing hash map from non-null pointers to `V`s, using linear
+// probing and backward-shift deletion. All entries live in one flat vector,
+// so `Clear` leaves the map's memory allocated, which lets one map be reused
+// for printing many things without going back to the allocator.
+template <typename V>
+class PointerMap {
+ public:
+  // Return a pointer to the value associated with `key`, or `nullptr`.
+  V *Find(const void *key) noexcept {
+    if (auto i = IndexOf(key); i != kNotFound) {
+      return &(slots[i].value);
+    }
+    return nullptr;
+  }
+
+  const V *Find(const void *key) const noexcept {
+    return const_cast<PointerMap<V> *>(this)->Find(key);
+  }
+
+  bool Contains(const void *key) const noexcept {
+    return IndexOf(key) != kNotFound;
+  }
+
+  // Associate `val` with `key`, unless `key` already has an associated value.
+  // Returns the associated value, and `true` if `val` was inserted.
+  std::pair<V *, bool> Emplace(const void *key, V val) {
+    assert(key != nullptr);
+    if ((num_entries + 1u) * 2u > slots.size()) {
+      Grow();
+    }
+
+    const auto mask = slots.size() - 1u;
+    for (auto i = Home(key);; i = (i + 1u) & mask) {
+      Slot &slot = slots[i];
+      if (slot.key == key) {
+        return {&(slot.value), false};
+      } else if (!slot.key) {
+        slot.key = key;
+        slot.value = std::move(val);
+        ++num_entries;
+        return {&(slot.value), true};
+      }
+    }
+  }
+
+  // Remove any value associated with `key`.
+  void Erase(const void *key) noexcept {
+    auto i = IndexOf(key);
+    if (i == kNotFound) {
+      return;
+    }
+
+    // Shift back any later entries in this probe run whose home slot is not
+    // in `(i, j]`, so that lookups never have to step over tombstones.
+    const auto mask = slots.size() - 1u;
+    for (auto j = (i + 1u) & mask; slots[j].key; j = (j + 1u) & mask) {
+      const auto home = Home(slots[j].key);
+      const auto stays = i < j ? (i < home && home <= j)
+                               : (i < home || home <= j);
+      if (!stays) {
+        slots[i] = std::move(slots[j]);
+        i = j;
+      }
+    }
+
+    slots[i].key = nullptr;
+    slots[i].value = V();
+    --num_entries;
+  }
+
+  // Remove all entries, but keep the memory.
+  void Clear(void) noexcept {
+    if (num_entries) {
+      for (Slot &slot : slots) {
+        slot.key = nullptr;
+        slot.value = V();
+      }
+      num_entries = 0u;
+    }
+  }
+
+  size_t Size(void) const noexcept {
+    return num_entries;
+  }
+
+  // Number of bytes allocated for the slots of this map.
+  size_t MemoryUsage(void) const noexcept {
+    return slots.capacity() * sizeof(Slot);
+  }
+
+ private:
+  static constexpr size_t kNotFound = ~static_cast<size_t>(0u);
+  static constexpr size_t kMinNumSlots = 64u;
+
+  struct Slot {
+    const void *key{nullptr};
+    V value{};
+  };
+
+  // Fibonacci hashing; the low bits of pointers are mostly alignment.
+  size_t Home(const void *key) const noexcept {
+    auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+    hash *= 0x9E3779B97F4A7C15ull;
+    hash ^= hash >> 32u;
+    return static_cast<size_t>(hash) & (slots.size() - 1u);
+  }
+
+  size_t IndexOf(const void *key) const noexcept {
+    if (!num_entries || !key) {
+      return kNotFound;
+    }
+    const auto mask = slots.size() - 1u;
+    for (auto i = Home(key);; i = (i + 1u) & mask) {
+      if (slots[i].key == key) {
+        return i;
+      } else if (!slots[i].key) {
+        return kNotFound;
+      }
+    }
+  }
+
+  void Grow(void) {
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots);
+    slots.resize(old_slots.empty() ? kMinNumSlots : old_slots.size() * 2u);
+    num_entries = 0u;
+    for (Slot &slot : old_slots) {
+      if (slot.key) {
+        Emplace(slot.key, std::move(slot.value));
+      }
+    }
+  }
+
+  std::vector<Slot> slots;
+  size_t num_entries{0u};
+};
+
+}  // namespace pasta
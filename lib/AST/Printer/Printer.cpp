@@ -248,6 +248,15 @@ TokenKind PrintedToken::Kind(void) const {
   }
 }
 
+// Return the printable kind of this token.
+const char *PrintedToken::KindName(void) const {
+  if (impl) {
+    return clang::tok::getTokenName(impl->Kind());
+  } else {
+    return clang::tok::getTokenName(clang::tok::unknown);
+  }
+}
+
 // Number of leading new lines (before any indentation spaces).
 unsigned PrintedToken::NumLeadingNewLines(void) const {
   return impl->num_leading_new_lines;
@@ -344,6 +353,17 @@ ptrdiff_t PrintedTokenIterator::operator-(
 
 PrintedTokenRangeImpl::~PrintedTokenRangeImpl(void) {}
 
+// Clear out this range so that it can be reused to print something else.
+void PrintedTokenRangeImpl::Reset(void) {
+  assert(!curr_printer_context);
+  ast.reset();
+  tokens.clear();
+  data.clear();
+  contexts.clear();
+  data_to_index.Clear();
+  type_to_type_loc.Clear();
+}
+
 
 const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
     TokenPrinterContext *tokenizer, TokenContextIndex aliasee) {
@@ -370,9 +390,8 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
   alias_addr <<= 32u;
   alias_addr |= parent_index;
   const auto alias_data = reinterpret_cast<const void *>(alias_addr);
-  if (auto alias_it = data_to_index.find(alias_data);
-      alias_it != data_to_index.end()) {
-    return alias_it->second;  // Found an identical usage.
+  if (auto alias_index = data_to_index.Find(alias_data)) {
+    return *alias_index;  // Found an identical usage.
   }
 
   auto index = static_cast<TokenContextIndex>(contexts.size());
@@ -393,7 +412,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
         aliasee);
   }
 
-  data_to_index.emplace(alias_data, index);
+  data_to_index.Emplace(alias_data, index);
 
   return index;
 }
@@ -486,7 +505,6 @@ void TokenPrinterContext::Tokenize(void) {
     }
 
     lexer.seek(last_i, false);
-    last_i = i;
 
     const auto at_end = lexer.LexFromRawLexer(tok);
     if (tok.is(clang::tok::eof)) {
@@ -505,23 +523,13 @@ void TokenPrinterContext::Tokenize(void) {
       }
     }
 
-    const auto data_offset = static_cast<TokenDataIndex>(tokens.data.size());
-    assert(0ll <= static_cast<TokenDataOffset>(data_offset));
-    uint32_t data_len = 0u;
-    tokens.data.reserve(data_offset + tok.getLength());
-    for (last_i = i, i += tok.getLength(); last_i < i && token_data[last_i];
-        ++last_i) {
-      tokens.data.push_back(token_data[last_i]);
-      ++data_len;
-      assert(static_cast<uint32_t>(data_len & TokenImpl::kTokenSizeMask) != 0u);
-    }
-    tokens.data.push_back('\0');  // Make sure all tokens end up NUL-terminated.
+    // Copy out the token data, stopping at any embedded NUL.
+    std::string_view spelling(&(token_data[i]), tok.getLength());
+    spelling = spelling.substr(0u, spelling.find('\0'));
+    i += tok.getLength();
 
     // Add the token in.
-    tokens.tokens.emplace_back(
-        static_cast<TokenDataOffset>(data_offset),
-        static_cast<uint32_t>(data_len),
-        context_index, num_nl, num_sp, tok.getKind());
+    tokens.AppendToken(spelling, context_index, num_nl, num_sp, tok.getKind());
 
     // Reset so that if there is no whitespace afte the last token, then we
     // don't randomly add in trailing whitespace.
@@ -548,6 +556,89 @@ void TokenPrinterContext::Tokenize(void) {
   }
 }
 
+// Directly append a token of kind `kind` with spelling `spelling`, without
+// re-lexing it.
+void TokenPrinterContext::Emit(clang::tok::TokenKind kind,
+                               std::string_view spelling) {
+  assert(tokens.curr_printer_context == this);
+
+  // Pending whitespace, e.g. from `OS << ' '` between two emitted tokens, is
+  // the leading whitespace of this token, and doesn't need a lexer. Anything
+  // else was streamed by the printer, and is tokenized first. `Tokenize`
+  // leaves behind only trailing whitespace.
+  std::string &pending = out.str();
+  unsigned num_nl = 0u;
+  unsigned num_sp = 0u;
+  unsigned i = 0u;
+  std::tie(num_nl, num_sp, i) = SkipWhitespace(pending, 0u);
+  if (i < pending.size()) {
+    Tokenize();
+    std::tie(num_nl, num_sp, i) = SkipWhitespace(pending, 0u);
+    assert(i == pending.size());
+  }
+  pending.clear();
+
+  // Mirror `Tokenize`, which drops whitespace before separators.
+  if (kind == clang::tok::semi || kind == clang::tok::comma) {
+    num_nl = 0u;
+    num_sp = 0u;
+  }
+
+  tokens.AppendToken(spelling, context_index, num_nl, num_sp, kind);
+}
+
+// Directly append a keyword or punctuator using its canonical spelling.
+void TokenPrinterContext::Emit(clang::tok::TokenKind kind) {
+  if (const char *punc = clang::tok::getPunctuatorSpelling(kind)) {
+    Emit(kind, punc);
+    return;
+  }
+
+  const char *keyword = clang::tok::getKeywordSpelling(kind);
+  assert(keyword != nullptr);
+
+  // NOTE(pag): Whether or not something is a keyword depends on the language
+  //            options, so go through the same identifier table as `Tokenize`
+  //            does, rather than trusting `kind`.
+  if (tokens.ast) {
+    Emit(tokens.ast->orig_source_pp->getIdentifierInfo(keyword));
+  } else {
+    Emit(clang::tok::raw_identifier, keyword);
+  }
+}
+
+// Directly append an identifier.
+void TokenPrinterContext::Emit(const clang::IdentifierInfo *ident) {
+  assert(ident != nullptr);
+
+  // NOTE(pag): `Tokenize` only classifies keywords when there is an `ASTImpl`
+  //            and otherwise leaves identifiers as raw identifiers, so do the
+  //            same here.
+  auto kind = clang::tok::raw_identifier;
+  if (tokens.ast && clang::tok::getKeywordSpelling(ident->getTokenID())) {
+    kind = ident->getTokenID();
+  }
+  Emit(kind, ident->getName());
+}
+
+// Append a token whose kind and spelling are already known.
+void PrintedTokenRangeImpl::AppendToken(
+    std::string_view spelling, TokenContextIndex context_index,
+    unsigned num_leading_new_lines, unsigned num_leading_spaces,
+    clang::tok::TokenKind kind) {
+  const auto data_offset = static_cast<TokenDataIndex>(data.size());
+  assert(0ll <= static_cast<TokenDataOffset>(data_offset));
+  const auto data_len = static_cast<uint32_t>(spelling.size());
+  assert(static_cast<uint32_t>(data_len & TokenImpl::kTokenSizeMask) ==
+         data_len);
+  data.append(spelling);
+  data.push_back('\0');  // Make sure all tokens end up NUL-terminated.
+
+  tokens.emplace_back(
+      static_cast<TokenDataOffset>(data_offset), data_len, context_index,
+      num_leading_new_lines, num_leading_spaces, kind);
+}
+
 void PrintedTokenRangeImpl::MarkLocation(
     size_t tok_index, const TokenImpl &tok) {
   tokens[tok_index].opaque_source_loc = tok.opaque_source_loc;
@@ -593,7 +684,7 @@ TokenPrinterContext::~TokenPrinterContext(void) {
   Tokenize();
   tokens.curr_printer_context = prev_printer_context;
   if (owns_data) {
-    tokens.data_to_index.erase(owns_data);
+    tokens.data_to_index.Erase(owns_data);
   }
 }
 
@@ -16,12 +16,14 @@
 #include <cstdint>
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 #include "../Token.h"
+#include "PointerMap.h"
 
 namespace clang {
 class Decl;
+class IdentifierInfo;
 class LangOptions;
 class SourceLocation;
 class SourceManager;
@@ -81,10 +83,10 @@ class PrintedTokenRangeImpl {
   // etc. to the "owning" context for that thing. There can be multiple open
   // contexts for a given thing; the first one is always the owning one, and
   // the rest are aliasing ones.
-  std::unordered_map<const void *, unsigned> data_to_index;
+  PointerMap<unsigned> data_to_index;
 
   // Maps types to type locations.
-  std::unordered_map<const clang::Type *, clang::TypeLoc> type_to_type_loc;
+  PointerMap<clang::TypeLoc> type_to_type_loc;
 
   // The current top of the token printer context stack. The structure of the
   // token printing context stack is induced via the call stack, which happens
@@ -96,6 +98,10 @@ class PrintedTokenRangeImpl {
 
   ~PrintedTokenRangeImpl(void);
 
+  // Clear out this range so that it can be reused to print something else.
+  // This keeps all of the range's memory allocated.
+  void Reset(void);
+
   template <typename T>
   const TokenContextIndex CreateContext(
       TokenPrinterContext *tokenizer, const T *data);
@@ -103,6 +109,11 @@ class PrintedTokenRangeImpl {
   const TokenContextIndex CreateAlias(
       TokenPrinterContext *tokenizer, TokenContextIndex aliasee);
 
+  // Append a token whose kind and spelling are already known.
+  void AppendToken(std::string_view spelling, TokenContextIndex context_index,
+                   unsigned num_leading_new_lines, unsigned num_leading_spaces,
+                   clang::tok::TokenKind kind);
+
   void MarkLocation(size_t tok_index, const TokenImpl &tok);
   void MarkLocation(size_t tok_index, const clang::SourceLocation &loc);
 //  void PopContext(void);
@@ -131,6 +142,20 @@ class TokenPrinterContext {
 
   void Tokenize(void);
 
+  // Directly append a token of kind `kind` with spelling `spelling`, without
+  // re-lexing it. Anything already written to `out` is tokenized first, and
+  // any whitespace left pending in `out` becomes the token's leading
+  // whitespace.
+  void Emit(clang::tok::TokenKind kind, std::string_view spelling);
+
+  // Directly append a keyword or punctuator, e.g. `tok::kw_return` or
+  // `tok::semi`, using its canonical spelling.
+  void Emit(clang::tok::TokenKind kind);
+
+  // Directly append an identifier. This yields the same token kind as
+  // lexing the identifier's spelling would.
+  void Emit(const clang::IdentifierInfo *ident);
+
   // Mark the last printed token as having location `loc`. This helps to
   // correlate things in the actual parsed tokens with printed tokens.
   void MarkLocation(clang::SourceLocation loc);
@@ -161,8 +186,8 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateContext(
   auto dedup = !std::is_same_v<T, char> && !std::is_base_of_v<clang::Type, T>;
   if (dedup) {
     data = Canonicalize(data);
-    if (auto it = data_to_index.find(data); it != data_to_index.end()) {
-      return it->second;
+    if (auto index = data_to_index.Find(data)) {
+      return *index;
     }
   }
 
@@ -195,7 +220,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateContext(
         dedup = false;
         break;
       default:
-        if (!data_to_index.count(contexts[parent_index].data)) {
+        if (!data_to_index.Contains(contexts[parent_index].data)) {
           dedup = false;
         }
         break;
@@ -209,7 +234,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateContext(
 
   tokenizer->owns_data = data;
   if (dedup) {
-    data_to_index.emplace(data, index);
+    data_to_index.Emplace(data, index);
   }
 
   return index;
@@ -35,9 +35,83 @@ void StmtPrinter::printQualType(
   TypePrinter(Policy, tokens, Indentation).print(type_, OS, "", PlaceHolderFn);
 }
 
+// Return the token kind of the spelling of the binary operator `op`.
+static clang::tok::TokenKind BinaryOperatorTokenKind(
+    clang::BinaryOperatorKind op) {
+  switch (op) {
+    case clang::BO_PtrMemD: return clang::tok::periodstar;
+    case clang::BO_PtrMemI: return clang::tok::arrowstar;
+    case clang::BO_Mul: return clang::tok::star;
+    case clang::BO_Div: return clang::tok::slash;
+    case clang::BO_Rem: return clang::tok::percent;
+    case clang::BO_Add: return clang::tok::plus;
+    case clang::BO_Sub: return clang::tok::minus;
+    case clang::BO_Shl: return clang::tok::lessless;
+    case clang::BO_Shr: return clang::tok::greatergreater;
+    case clang::BO_Cmp: return clang::tok::spaceship;
+    case clang::BO_LT: return clang::tok::less;
+    case clang::BO_GT: return clang::tok::greater;
+    case clang::BO_LE: return clang::tok::lessequal;
+    case clang::BO_GE: return clang::tok::greaterequal;
+    case clang::BO_EQ: return clang::tok::equalequal;
+    case clang::BO_NE: return clang::tok::exclaimequal;
+    case clang::BO_And: return clang::tok::amp;
+    case clang::BO_Xor: return clang::tok::caret;
+    case clang::BO_Or: return clang::tok::pipe;
+    case clang::BO_LAnd: return clang::tok::ampamp;
+    case clang::BO_LOr: return clang::tok::pipepipe;
+    case clang::BO_Assign: return clang::tok::equal;
+    case clang::BO_MulAssign: return clang::tok::starequal;
+    case clang::BO_DivAssign: return clang::tok::slashequal;
+    case clang::BO_RemAssign: return clang::tok::percentequal;
+    case clang::BO_AddAssign: return clang::tok::plusequal;
+    case clang::BO_SubAssign: return clang::tok::minusequal;
+    case clang::BO_ShlAssign: return clang::tok::lesslessequal;
+    case clang::BO_ShrAssign: return clang::tok::greatergreaterequal;
+    case clang::BO_AndAssign: return clang::tok::ampequal;
+    case clang::BO_XorAssign: return clang::tok::caretequal;
+    case clang::BO_OrAssign: return clang::tok::pipeequal;
+    case clang::BO_Comma: return clang::tok::comma;
+  }
+  llvm_unreachable("Invalid binary operator");
+}
+
+// Return the token kind of the spelling of the unary operator `op`.
+static clang::tok::TokenKind UnaryOperatorTokenKind(
+    clang::UnaryOperatorKind op) {
+  switch (op) {
+    case clang::UO_PostInc: return clang::tok::plusplus;
+    case clang::UO_PostDec: return clang::tok::minusminus;
+    case clang::UO_PreInc: return clang::tok::plusplus;
+    case clang::UO_PreDec: return clang::tok::minusminus;
+    case clang::UO_AddrOf: return clang::tok::amp;
+    case clang::UO_Deref: return clang::tok::star;
+    case clang::UO_Plus: return clang::tok::plus;
+    case clang::UO_Minus: return clang::tok::minus;
+    case clang::UO_Not: return clang::tok::tilde;
+    case clang::UO_LNot: return clang::tok::exclaim;
+    case clang::UO_Real: return clang::tok::kw___real;
+    case clang::UO_Imag: return clang::tok::kw___imag;
+    case clang::UO_Extension: return clang::tok::kw___extension__;
+    case clang::UO_Coawait: return clang::tok::kw_co_await;
+  }
+  llvm_unreachable("Invalid unary operator");
+}
+
+// Print `name`, emitting it directly if it is a plain identifier.
+static void EmitNameInfo(TokenPrinterContext &ctx,
+                         const clang::DeclarationNameInfo &name) {
+  if (const clang::IdentifierInfo *ident =
+          name.getName().getAsIdentifierInfo()) {
+    ctx.Emit(ident);
+  } else {
+    ctx.out << name;
+  }
+}
+
 void StmtPrinter::PrintRawCompoundStmt(clang::CompoundStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  OS << "{";
+  ctx.Emit(clang::tok::l_brace);
   ctx.MarkLocation(Node->getLBracLoc());
 
   PrintFPPragmas(Node);
@@ -45,7 +119,8 @@ void StmtPrinter::PrintRawCompoundStmt(clang::CompoundStmt *Node) {
   for (auto *I : Node->body())
     PrintStmt(I);
 
-  Indent() << "}";
+  Indent();
+  ctx.Emit(clang::tok::r_brace);
   ctx.MarkLocation(Node->getRBracLoc());
 }
 
@@ -132,7 +207,8 @@ void StmtPrinter::PrintRawDeclStmt(const clang::DeclStmt *S) {
 
 void StmtPrinter::VisitNullStmt(clang::NullStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << ";";
+  Indent();
+  ctx.Emit(clang::tok::semi);
   ctx.MarkLocation(Node->getEndLoc());
   OS << NL;
 }
@@ -155,7 +231,9 @@ void StmtPrinter::VisitCompoundStmt(clang::CompoundStmt *Node) {
 
 void StmtPrinter::VisitCaseStmt(clang::CaseStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent(-1) << "case ";
+  Indent(-1);
+  ctx.Emit(clang::tok::kw_case);
+  OS << ' ';
   ctx.MarkLocation(Node->getCaseLoc());
   PrintExpr(Node->getLHS());
   if (Node->getRHS()) {
@@ -163,16 +241,18 @@ void StmtPrinter::VisitCaseStmt(clang::CaseStmt *Node) {
     ctx.MarkLocation(Node->getEllipsisLoc());
     PrintExpr(Node->getRHS());
   }
-  OS << ":" << NL;
+  ctx.Emit(clang::tok::colon);
+  OS << NL;
 
   PrintStmt(Node->getSubStmt(), 0);
 }
 
 void StmtPrinter::VisitDefaultStmt(clang::DefaultStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent(-1) << "default";
+  Indent(-1);
+  ctx.Emit(clang::tok::kw_default);
   ctx.MarkLocation(Node->getDefaultLoc());
-  OS << ":";
+  ctx.Emit(clang::tok::colon);
   OS << NL;
   PrintStmt(Node->getSubStmt(), 0);
 }
@@ -197,9 +277,10 @@ void StmtPrinter::VisitAttributedStmt(clang::AttributedStmt *Node) {
 
 void StmtPrinter::PrintRawIfStmt(clang::IfStmt *If) {
   TokenPrinterContext ctx(OS, If, tokens);
-  OS << "if ";
+  ctx.Emit(clang::tok::kw_if);
+  OS << ' ';
   ctx.MarkLocation(If->getIfLoc());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(If->getLParenLoc());
   if (If->getInit())
     PrintInitStmt(If->getInit(), 4);
@@ -207,7 +288,7 @@ void StmtPrinter::PrintRawIfStmt(clang::IfStmt *If) {
     PrintRawDeclStmt(DS);
   else
     PrintExpr(If->getCond());
-  OS << ')';
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(If->getRParenLoc());
 
   if (auto *CS = clang::dyn_cast<clang::CompoundStmt>(If->getThen())) {
@@ -221,7 +302,7 @@ void StmtPrinter::PrintRawIfStmt(clang::IfStmt *If) {
   }
 
   if (clang::Stmt *Else = If->getElse()) {
-    OS << "else";
+    ctx.Emit(clang::tok::kw_else);
     ctx.MarkLocation(If->getElseLoc());
 
     if (auto *CS = clang::dyn_cast<clang::CompoundStmt>(Else)) {
@@ -246,9 +327,11 @@ void StmtPrinter::VisitIfStmt(clang::IfStmt *If) {
 
 void StmtPrinter::VisitSwitchStmt(clang::SwitchStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "switch ";
+  Indent();
+  ctx.Emit(clang::tok::kw_switch);
+  OS << ' ';
   ctx.MarkLocation(Node->getSwitchLoc());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(Node->getLParenLoc());
   if (Node->getInit())
     PrintInitStmt(Node->getInit(), 8);
@@ -256,22 +339,23 @@ void StmtPrinter::VisitSwitchStmt(clang::SwitchStmt *Node) {
     PrintRawDeclStmt(DS);
   else
     PrintExpr(Node->getCond());
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParenLoc());
   PrintControlledStmt(Node->getBody());
 }
 
 void StmtPrinter::VisitWhileStmt(clang::WhileStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "while";
+  Indent();
+  ctx.Emit(clang::tok::kw_while);
   ctx.MarkLocation(Node->getWhileLoc());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(Node->getLParenLoc());
   if (const clang::DeclStmt *DS = Node->getConditionVariableDeclStmt())
     PrintRawDeclStmt(DS);
   else
     PrintExpr(Node->getCond());
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParenLoc());
   OS << NL;
   PrintStmt(Node->getBody());
@@ -279,7 +363,9 @@ void StmtPrinter::VisitWhileStmt(clang::WhileStmt *Node) {
 
 void StmtPrinter::VisitDoStmt(clang::DoStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "do ";
+  Indent();
+  ctx.Emit(clang::tok::kw_do);
+  OS << ' ';
   ctx.MarkLocation(Node->getDoLoc());
   if (auto *CS = clang::dyn_cast<clang::CompoundStmt>(Node->getBody())) {
     PrintRawCompoundStmt(CS);
@@ -290,20 +376,23 @@ void StmtPrinter::VisitDoStmt(clang::DoStmt *Node) {
     Indent();
   }
 
-  OS << "while";
+  ctx.Emit(clang::tok::kw_while);
   ctx.MarkLocation(Node->getWhileLoc());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   PrintExpr(Node->getCond());
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParenLoc());
-  OS << ";" << NL;
+  ctx.Emit(clang::tok::semi);
+  OS << NL;
 }
 
 void StmtPrinter::VisitForStmt(clang::ForStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "for ";
+  Indent();
+  ctx.Emit(clang::tok::kw_for);
+  OS << ' ';
   ctx.MarkLocation(Node->getForLoc());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(Node->getLParenLoc());
   if (Node->getInit())
     PrintInitStmt(Node->getInit(), 5);
@@ -311,12 +400,12 @@ void StmtPrinter::VisitForStmt(clang::ForStmt *Node) {
     OS << (Node->getCond() ? "; " : ";");
   if (Node->getCond())
     PrintExpr(Node->getCond());
-  OS << ";";
+  ctx.Emit(clang::tok::semi);
   if (Node->getInc()) {
     OS << " ";
     PrintExpr(Node->getInc());
   }
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParenLoc());
   PrintControlledStmt(Node->getBody());
 }
@@ -374,11 +463,13 @@ void StmtPrinter::VisitMSDependentExistsStmt(clang::MSDependentExistsStmt *Node)
 
 void StmtPrinter::VisitGotoStmt(clang::GotoStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "goto ";
+  Indent();
+  ctx.Emit(clang::tok::kw_goto);
+  OS << ' ';
   ctx.MarkLocation(Node->getGotoLoc());
-  OS << Node->getLabel()->getName();
+  ctx.Emit(Node->getLabel()->getIdentifier());
   ctx.MarkLocation(Node->getLabelLoc());
-  OS << ";";
+  ctx.Emit(clang::tok::semi);
   if (Policy.IncludeNewlines) OS << NL;
 }
 
@@ -395,29 +486,32 @@ void StmtPrinter::VisitIndirectGotoStmt(clang::IndirectGotoStmt *Node) {
 
 void StmtPrinter::VisitContinueStmt(clang::ContinueStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "continue";
+  Indent();
+  ctx.Emit(clang::tok::kw_continue);
   ctx.MarkLocation(Node->getContinueLoc());
-  OS << ";";
+  ctx.Emit(clang::tok::semi);
   if (Policy.IncludeNewlines) OS << NL;
 }
 
 void StmtPrinter::VisitBreakStmt(clang::BreakStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "break";
+  Indent();
+  ctx.Emit(clang::tok::kw_break);
   ctx.MarkLocation(Node->getBreakLoc());
-  OS << ";";
+  ctx.Emit(clang::tok::semi);
   if (Policy.IncludeNewlines) OS << NL;
 }
 
 void StmtPrinter::VisitReturnStmt(clang::ReturnStmt *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  Indent() << "return";
+  Indent();
+  ctx.Emit(clang::tok::kw_return);
   ctx.MarkLocation(Node->getReturnLoc());
   if (Node->getRetValue()) {
     OS << " ";
     PrintExpr(Node->getRetValue());
   }
-  OS << ";";
+  ctx.Emit(clang::tok::semi);
   if (Policy.IncludeNewlines) OS << NL;
 }
 
@@ -1226,7 +1320,7 @@ void StmtPrinter::VisitDeclRefExpr(clang::DeclRefExpr *Node) {
     OS << "template ";
     ctx.MarkLocation(Node->getTemplateKeywordLoc());
   }
-  OS << Node->getNameInfo();
+  EmitNameInfo(ctx, Node->getNameInfo());
   if (Node->hasExplicitTemplateArgs()) {
       const clang::TemplateParameterList *TPL = nullptr;
     if (!Node->hadMultipleCandidates())
@@ -1467,17 +1561,17 @@ void StmtPrinter::VisitStringLiteral(clang::StringLiteral *Str) {
 
 void StmtPrinter::VisitParenExpr(clang::ParenExpr *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(Node->getLParen());
   PrintExpr(Node->getSubExpr());
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParen());
 }
 
 void StmtPrinter::VisitUnaryOperator(clang::UnaryOperator *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
   if (!Node->isPostfix()) {
-    OS << clang::UnaryOperator::getOpcodeStr(Node->getOpcode());
+    ctx.Emit(UnaryOperatorTokenKind(Node->getOpcode()));
 
     // Print a space if this is an "identifier operator" like __real, or if
     // it might be concatenated incorrectly like '+'.
@@ -1498,7 +1592,7 @@ void StmtPrinter::VisitUnaryOperator(clang::UnaryOperator *Node) {
   PrintExpr(Node->getSubExpr());
 
   if (Node->isPostfix())
-    OS << clang::UnaryOperator::getOpcodeStr(Node->getOpcode());
+    ctx.Emit(UnaryOperatorTokenKind(Node->getOpcode()));
 }
 
 void StmtPrinter::VisitOffsetOfExpr(clang::OffsetOfExpr *Node) {
@@ -1609,9 +1703,9 @@ void StmtPrinter::VisitGenericSelectionExpr(clang::GenericSelectionExpr *Node) {
 void StmtPrinter::VisitArraySubscriptExpr(clang::ArraySubscriptExpr *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
   PrintExpr(Node->getLHS());
-  OS << "[";
+  ctx.Emit(clang::tok::l_square);
   PrintExpr(Node->getRHS());
-  OS << "]";
+  ctx.Emit(clang::tok::r_square);
   ctx.MarkLocation(Node->getRBracketLoc());
 }
 
@@ -1706,7 +1800,10 @@ void StmtPrinter::PrintCallArgs(clang::CallExpr *Call) {
       break;
     }
 
-    if (i) OS << ", ";
+    if (i) {
+      tokens.curr_printer_context->Emit(clang::tok::comma);
+      OS << ' ';
+    }
     PrintExpr(Call->getArg(i));
   }
 }
@@ -1714,9 +1811,9 @@ void StmtPrinter::PrintCallArgs(clang::CallExpr *Call) {
 void StmtPrinter::VisitCallExpr(clang::CallExpr *Call) {
   TokenPrinterContext ctx(OS, Call, tokens);
   PrintExpr(Call->getCallee());
-  OS << "(";
+  ctx.Emit(clang::tok::l_paren);
   PrintCallArgs(Call);
-  OS << ")";
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Call->getRParenLoc());
 }
 
@@ -1737,7 +1834,7 @@ void StmtPrinter::VisitMemberExpr(clang::MemberExpr *Node) {
                      : nullptr;
 
     if (!ParentDecl || !ParentDecl->isAnonymousStructOrUnion()) {
-      OS << (Node->isArrow() ? "->" : ".");
+      ctx.Emit(Node->isArrow() ? clang::tok::arrow : clang::tok::period);
       ctx.MarkLocation(Node->getOperatorLoc());
     }
   }
@@ -1752,7 +1849,7 @@ void StmtPrinter::VisitMemberExpr(clang::MemberExpr *Node) {
     OS << "template ";
     ctx.MarkLocation(Node->getTemplateKeywordLoc());
   }
-  OS << Node->getMemberNameInfo();
+  EmitNameInfo(ctx, Node->getMemberNameInfo());
   const clang::TemplateParameterList *TPL = nullptr;
   if (auto *FD = clang::dyn_cast<clang::FunctionDecl>(Node->getMemberDecl())) {
     if (!Node->hadMultipleCandidates())
@@ -1784,10 +1881,10 @@ void StmtPrinter::VisitExtVectorElementExpr(clang::ExtVectorElementExpr *Node) {
 
 void StmtPrinter::VisitCStyleCastExpr(clang::CStyleCastExpr *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  OS << '(';
+  ctx.Emit(clang::tok::l_paren);
   ctx.MarkLocation(Node->getLParenLoc());
   printQualType(Node->getTypeAsWritten(), OS, Policy);
-  OS << ')';
+  ctx.Emit(clang::tok::r_paren);
   ctx.MarkLocation(Node->getRParenLoc());
   PrintExpr(Node->getSubExpr());
 }
@@ -1810,7 +1907,9 @@ void StmtPrinter::VisitImplicitCastExpr(clang::ImplicitCastExpr *Node) {
 void StmtPrinter::VisitBinaryOperator(clang::BinaryOperator *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
   PrintExpr(Node->getLHS());
-  OS << " " << clang::BinaryOperator::getOpcodeStr(Node->getOpcode()) << " ";
+  OS << ' ';
+  ctx.Emit(BinaryOperatorTokenKind(Node->getOpcode()));
+  OS << ' ';
   ctx.MarkLocation(Node->getOperatorLoc());
   PrintExpr(Node->getRHS());
 }
@@ -1818,7 +1917,9 @@ void StmtPrinter::VisitBinaryOperator(clang::BinaryOperator *Node) {
 void StmtPrinter::VisitCompoundAssignOperator(clang::CompoundAssignOperator *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
   PrintExpr(Node->getLHS());
-  OS << " " << clang::BinaryOperator::getOpcodeStr(Node->getOpcode()) << " ";
+  OS << ' ';
+  ctx.Emit(BinaryOperatorTokenKind(Node->getOpcode()));
+  OS << ' ';
   ctx.MarkLocation(Node->getOperatorLoc());
   PrintExpr(Node->getRHS());
 }
@@ -1826,10 +1927,14 @@ void StmtPrinter::VisitCompoundAssignOperator(clang::CompoundAssignOperator *Nod
 void StmtPrinter::VisitConditionalOperator(clang::ConditionalOperator *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
   PrintExpr(Node->getCond());
-  OS << " ? ";
+  OS << ' ';
+  ctx.Emit(clang::tok::question);
+  OS << ' ';
   ctx.MarkLocation(Node->getQuestionLoc());
   PrintExpr(Node->getLHS());
-  OS << " : ";
+  OS << ' ';
+  ctx.Emit(clang::tok::colon);
+  OS << ' ';
   ctx.MarkLocation(Node->getColonLoc());
   PrintExpr(Node->getRHS());
 }
@@ -1912,16 +2017,19 @@ void StmtPrinter::VisitInitListExpr(clang::InitListExpr *Node) {
     return;
   }
 
-  OS << "{";
+  ctx.Emit(clang::tok::l_brace);
   ctx.MarkLocation(Node->getLBraceLoc());
   for (unsigned i = 0, e = Node->getNumInits(); i != e; ++i) {
-    if (i) OS << ", ";
+    if (i) {
+      ctx.Emit(clang::tok::comma);
+      OS << ' ';
+    }
     if (Node->getInit(i))
       PrintExpr(Node->getInit(i));
     else
       OS << "{}";
   }
-  OS << "}";
+  ctx.Emit(clang::tok::r_brace);
   ctx.MarkLocation(Node->getRBraceLoc());
 }
 
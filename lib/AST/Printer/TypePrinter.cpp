@@ -422,7 +422,7 @@ void TypePrinter::printPointer(const clang::PointerType *T, raw_string_ostream &
   IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
     {
       TokenPrinterContext jump_up_stack(ctx, no_alias_tag{});
-      OS << '*';
+      jump_up_stack.Emit(clang::tok::star);
     }
     IdentFn();
   };
@@ -433,11 +433,11 @@ void TypePrinter::printPointer(const clang::PointerType *T, raw_string_ostream &
     IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
       {
         TokenPrinterContext jump_up_stack(ctx);
-        OS << '(';
+        jump_up_stack.Emit(clang::tok::l_paren);
       }
       IdentFn();
       TokenPrinterContext jump_up_stack(ctx);
-      OS << ')';
+      jump_up_stack.Emit(clang::tok::r_paren);
     };
   }
 
@@ -516,7 +516,7 @@ void TypePrinter::printLValueReference(const clang::LValueReferenceType *T,
   IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
     {
       TokenPrinterContext jump_up_stack(ctx, no_alias_tag{});
-      OS << '&';
+      jump_up_stack.Emit(clang::tok::amp);
     }
     IdentFn();
   };
@@ -527,11 +527,11 @@ void TypePrinter::printLValueReference(const clang::LValueReferenceType *T,
     IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
       {
         TokenPrinterContext jump_up_stack(ctx);
-        OS << '(';
+        jump_up_stack.Emit(clang::tok::l_paren);
       }
       IdentFn();
       TokenPrinterContext jump_up_stack(ctx);
-      OS << ')';
+      jump_up_stack.Emit(clang::tok::r_paren);
     };
   }
 
@@ -577,7 +577,7 @@ void TypePrinter::printRValueReference(const clang::RValueReferenceType *T,
   IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
     {
       TokenPrinterContext jump_up_stack(ctx, no_alias_tag{});
-      OS << "&&";
+      jump_up_stack.Emit(clang::tok::ampamp);
     }
     IdentFn();
   };
@@ -588,11 +588,11 @@ void TypePrinter::printRValueReference(const clang::RValueReferenceType *T,
     IdentFn = [&, IdentFn = std::move(IdentFn)] (void) {
       {
         TokenPrinterContext jump_up_stack(ctx);
-        OS << '(';
+        jump_up_stack.Emit(clang::tok::l_paren);
       }
       IdentFn();
       TokenPrinterContext jump_up_stack(ctx);
-      OS << ')';
+      jump_up_stack.Emit(clang::tok::r_paren);
     };
   }
 
@@ -1763,7 +1763,7 @@ void TypePrinter::printTypeSpec(clang::NamedDecl *D, raw_string_ostream &OS) {
     AppendScope(D->getDeclContext(), OS, D->getDeclName());
 
   clang::IdentifierInfo *II = D->getIdentifier();
-  OS << II->getName();
+  ctx.Emit(II);
   spaceBeforePlaceHolder(OS);
 }
 
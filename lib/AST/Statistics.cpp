@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/Statistics.h>
+
+#include <sstream>
+
+#include "AST.h"
+
+namespace pasta {
+namespace {
+
+static const char * const kTokenRoleNames[] = {
+  "Invalid",
+  "BeginOfFileMarker",
+  "FileToken",
+  "EndOfFileMarker",
+  "BeginOfMacroExpansionMarker",
+  "InitialMacroUseToken",
+  "IntermediateMacroExpansionToken",
+  "FinalMacroExpansionToken",
+  "EndOfMacroExpansionMarker",
+  "EndOfInternalMacroEventMarker",
+};
+
+static constexpr size_t kNumTokenRoles =
+    sizeof(kTokenRoleNames) / sizeof(kTokenRoleNames[0]);
+
+static_assert(static_cast<size_t>(TokenRole::kEndOfInternalMacroEventMarker) ==
+              (kNumTokenRoles - 1u));
+
+}  // namespace
+
+// Fill in the token, context, and macro counters of `statistics`.
+void ASTImpl::CollectStatistics(void) {
+  statistics.num_tokens = tokens.size();
+  statistics.num_tokens_by_role.clear();
+  statistics.num_tokens_by_role.resize(kNumTokenRoles, 0u);
+  for (const TokenImpl &tok : tokens) {
+    auto role = static_cast<size_t>(tok.Role());
+    if (role < kNumTokenRoles) {
+      statistics.num_tokens_by_role[role] += 1u;
+    }
+  }
+
+  statistics.num_contexts = contexts.size();
+  statistics.num_parsed_files = parsed_files.size();
+  statistics.num_macro_directives = root_macro_node.directives.size();
+  statistics.num_macro_expansions = root_macro_node.expansions.size();
+  statistics.num_macro_arguments = root_macro_node.arguments.size();
+  statistics.num_macro_parameters = root_macro_node.parameters.size();
+  statistics.num_macro_substitutions = root_macro_node.substitutions.size();
+  statistics.num_macro_tokens = root_macro_node.tokens.size();
+}
+
+// Render these statistics as JSON in the Chrome trace event format.
+std::string ASTStatistics::ToJSON(void) const {
+  std::stringstream os;
+  os << "{\"traceEvents\":[";
+
+  auto sep = "";
+  for (const ASTPhaseTiming &phase : phases) {
+    os << sep << "{\"name\":\"" << phase.name
+       << "\",\"cat\":\"pasta\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":"
+       << phase.start_us << ",\"dur\":" << phase.wall_us
+       << ",\"args\":{\"cpu_us\":" << phase.cpu_us << "}}";
+    sep = ",";
+  }
+
+  os << "],\"displayTimeUnit\":\"ms\",\"otherData\":{"
+     << "\"num_tokens\":" << num_tokens;
+
+  for (size_t i = 0u; i < num_tokens_by_role.size() && i < kNumTokenRoles;
+       ++i) {
+    os << ",\"num_" << kTokenRoleNames[i] << "_tokens\":"
+       << num_tokens_by_role[i];
+  }
+
+  os << ",\"num_contexts\":" << num_contexts
+     << ",\"num_parsed_files\":" << num_parsed_files
+     << ",\"num_macro_directives\":" << num_macro_directives
+     << ",\"num_macro_expansions\":" << num_macro_expansions
+     << ",\"num_macro_arguments\":" << num_macro_arguments
+     << ",\"num_macro_parameters\":" << num_macro_parameters
+     << ",\"num_macro_substitutions\":" << num_macro_substitutions
+     << ",\"num_macro_tokens\":" << num_macro_tokens
+     << ",\"num_tld_groups_aligned\":" << num_tld_groups_aligned
+     << ",\"num_tld_groups_skipped\":" << num_tld_groups_skipped
+     << ",\"num_tld_groups_filtered\":" << num_tld_groups_filtered
+     << ",\"num_alignment_drains\":" << num_alignment_drains
+     << ",\"num_token_cache_hits\":" << num_token_cache_hits
+     << ",\"num_token_cache_misses\":" << num_token_cache_misses
+     << "}}";
+
+  return os.str();
+}
+
+}  // namespace pasta
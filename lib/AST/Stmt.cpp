@@ -1322,6 +1322,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(Stmt, WhileStmt)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Stmt::IgnoreContainersRef(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.IgnoreContainers();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Stmt::IgnoreContainersRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: Stmt::
 // 0: Stmt::
 std::vector<::pasta::Stmt> Stmt::Children(void) const noexcept {
@@ -1337,6 +1347,12 @@ std::vector<::pasta::Stmt> Stmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtChildRange Stmt::ChildrenRange(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.children();
+  return RangeBuilder::Create(ast, self, val);
+}
+
 ::pasta::Token Stmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::Stmt *>(u.Stmt);
   decltype(auto) val = self.getBeginLoc();
@@ -1344,6 +1360,13 @@ std::vector<::pasta::Stmt> Stmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Stmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token Stmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::Stmt *>(u.Stmt);
   decltype(auto) val = self.getEndLoc();
@@ -1351,6 +1374,13 @@ std::vector<::pasta::Stmt> Stmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Stmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 int64_t Stmt::ID(void) const noexcept {
   auto &self = *(u.Stmt);
   decltype(auto) val = self.getID(ast->ci->getASTContext());
@@ -1365,6 +1395,13 @@ int64_t Stmt::ID(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange Stmt::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::StmtKind Stmt::Kind(void) const noexcept {
   auto &self = *const_cast<clang::Stmt *>(u.Stmt);
   decltype(auto) val = self.getStmtClass();
@@ -1394,6 +1431,16 @@ std::string_view Stmt::KindName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Stmt::StripLabelLikeStatementsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
+  decltype(auto) val = self.stripLabelLikeStatements();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Stmt::StripLabelLikeStatementsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 SwitchCase::SwitchCase(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -1409,6 +1456,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchCase::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchCase::ColonToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
   decltype(auto) val = self.getColonLoc();
@@ -1416,6 +1470,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchCase::ColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchCase::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
   decltype(auto) val = self.getEndLoc();
@@ -1423,6 +1484,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchCase::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchCase::KeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
   decltype(auto) val = self.getKeywordLoc();
@@ -1430,6 +1498,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchCase::KeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::SwitchCase> SwitchCase::NextSwitchCase(void) const noexcept {
   auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
   decltype(auto) val = self.getNextSwitchCase();
@@ -1442,6 +1517,18 @@ std::optional<::pasta::SwitchCase> SwitchCase::NextSwitchCase(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> SwitchCase::NextSwitchCaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getNextSwitchCase();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt SwitchCase::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
   decltype(auto) val = self.getSubStmt();
@@ -1452,6 +1539,16 @@ std::optional<::pasta::SwitchCase> SwitchCase::NextSwitchCase(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SwitchCase::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchCase *>(u.SwitchCase);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SwitchCase::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 SwitchStmt::SwitchStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -1478,6 +1575,13 @@ std::vector<::pasta::Stmt> SwitchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt SwitchStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getBody();
@@ -1488,6 +1592,16 @@ std::vector<::pasta::Stmt> SwitchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SwitchStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SwitchStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr SwitchStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getCond();
@@ -1498,6 +1612,16 @@ std::vector<::pasta::Stmt> SwitchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SwitchStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SwitchStmt::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> SwitchStmt::ConditionVariable(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getConditionVariable();
@@ -1510,6 +1634,18 @@ std::optional<::pasta::VarDecl> SwitchStmt::ConditionVariable(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> SwitchStmt::ConditionVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getConditionVariable();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclStmt> SwitchStmt::ConditionVariableDeclarationStatement(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getConditionVariableDeclStmt();
@@ -1522,6 +1658,18 @@ std::optional<::pasta::DeclStmt> SwitchStmt::ConditionVariableDeclarationStateme
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> SwitchStmt::ConditionVariableDeclarationStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getConditionVariableDeclStmt();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getEndLoc();
@@ -1529,6 +1677,13 @@ std::optional<::pasta::DeclStmt> SwitchStmt::ConditionVariableDeclarationStateme
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> SwitchStmt::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getInit();
@@ -1541,6 +1696,18 @@ std::optional<::pasta::Stmt> SwitchStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> SwitchStmt::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getInit();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchStmt::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getLParenLoc();
@@ -1548,6 +1715,13 @@ std::optional<::pasta::Stmt> SwitchStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchStmt::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -1555,6 +1729,13 @@ std::optional<::pasta::Stmt> SwitchStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::SwitchCase> SwitchStmt::FirstSwitchCase(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getSwitchCaseList();
@@ -1567,6 +1748,18 @@ std::optional<::pasta::SwitchCase> SwitchStmt::FirstSwitchCase(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> SwitchStmt::FirstSwitchCaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getSwitchCaseList();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token SwitchStmt::SwitchToken(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.getSwitchLoc();
@@ -1574,6 +1767,13 @@ std::optional<::pasta::SwitchCase> SwitchStmt::FirstSwitchCase(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SwitchStmt::SwitchTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
+  decltype(auto) val = self.getSwitchLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool SwitchStmt::HasInitializerStorage(void) const noexcept {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.hasInitStorage();
@@ -1746,6 +1946,18 @@ std::optional<::pasta::Expr> ValueStmt::ExpressionStatement(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ValueStmt::ExpressionStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ValueStmt *>(u.ValueStmt);
+  decltype(auto) val = self.getExprStmt();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 WhileStmt::WhileStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -1772,6 +1984,13 @@ std::vector<::pasta::Stmt> WhileStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef WhileStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt WhileStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getBody();
@@ -1782,6 +2001,16 @@ std::vector<::pasta::Stmt> WhileStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef WhileStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "WhileStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr WhileStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getCond();
@@ -1792,6 +2021,16 @@ std::vector<::pasta::Stmt> WhileStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef WhileStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "WhileStmt::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> WhileStmt::ConditionVariable(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getConditionVariable();
@@ -1804,6 +2043,18 @@ std::optional<::pasta::VarDecl> WhileStmt::ConditionVariable(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> WhileStmt::ConditionVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getConditionVariable();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatement(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getConditionVariableDeclStmt();
@@ -1816,6 +2067,18 @@ std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatemen
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> WhileStmt::ConditionVariableDeclarationStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getConditionVariableDeclStmt();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token WhileStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getEndLoc();
@@ -1823,6 +2086,13 @@ std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatemen
   __builtin_unreachable();
 }
 
+::pasta::TokenRef WhileStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token WhileStmt::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getLParenLoc();
@@ -1830,6 +2100,13 @@ std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatemen
   __builtin_unreachable();
 }
 
+::pasta::TokenRef WhileStmt::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token WhileStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -1837,6 +2114,13 @@ std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatemen
   __builtin_unreachable();
 }
 
+::pasta::TokenRef WhileStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token WhileStmt::WhileToken(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.getWhileLoc();
@@ -1844,6 +2128,13 @@ std::optional<::pasta::DeclStmt> WhileStmt::ConditionVariableDeclarationStatemen
   __builtin_unreachable();
 }
 
+::pasta::TokenRef WhileStmt::WhileTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
+  decltype(auto) val = self.getWhileLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool WhileStmt::HasVariableStorage(void) const noexcept {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.hasVarStorage();
@@ -1890,6 +2181,13 @@ std::string AsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsmStmt::AssemblyTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
+  decltype(auto) val = self.getAsmLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AsmStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -1897,6 +2195,13 @@ std::string AsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsmStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: AsmStmt::Clobber
 ::pasta::Token AsmStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
@@ -1905,6 +2210,13 @@ std::string AsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsmStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: AsmStmt::InputConstraint
 // 1: AsmStmt::InputExpression
 uint32_t AsmStmt::NumClobbers(void) const noexcept {
@@ -2091,6 +2403,13 @@ std::vector<::pasta::Stmt> AttributedStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AttributedStmt::AttributeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
+  decltype(auto) val = self.getAttrLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Attr> AttributedStmt::Attributes(void) const noexcept {
   auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
   decltype(auto) val = self.getAttrs();
@@ -2111,6 +2430,13 @@ std::vector<::pasta::Attr> AttributedStmt::Attributes(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AttributedStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AttributedStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2118,6 +2444,13 @@ std::vector<::pasta::Attr> AttributedStmt::Attributes(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AttributedStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt AttributedStmt::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
   decltype(auto) val = self.getSubStmt();
@@ -2128,6 +2461,16 @@ std::vector<::pasta::Attr> AttributedStmt::Attributes(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AttributedStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AttributedStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 BreakStmt::BreakStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2154,13 +2497,27 @@ std::vector<::pasta::Stmt> BreakStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token BreakStmt::BreakToken(void) const noexcept {
+::pasta::TokenRef BreakStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::Token BreakStmt::BreakToken(void) const noexcept {
   auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
   decltype(auto) val = self.getBreakLoc();
   return ast->TokenAt(val);
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BreakStmt::BreakTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
+  decltype(auto) val = self.getBreakLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token BreakStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2168,6 +2525,13 @@ std::vector<::pasta::Stmt> BreakStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BreakStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CXXCatchStmt::CXXCatchStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2194,6 +2558,13 @@ std::vector<::pasta::Stmt> CXXCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXCatchStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXCatchStmt::CatchToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.getCatchLoc();
@@ -2201,6 +2572,13 @@ std::vector<::pasta::Stmt> CXXCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXCatchStmt::CatchTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getCatchLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXCatchStmt::CaughtType(void) const noexcept {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.getCaughtType();
@@ -2209,6 +2587,14 @@ std::vector<::pasta::Stmt> CXXCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXCatchStmt::CaughtTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getCaughtType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXCatchStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2216,6 +2602,13 @@ std::vector<::pasta::Stmt> CXXCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXCatchStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> CXXCatchStmt::ExceptionDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.getExceptionDecl();
@@ -2228,6 +2621,18 @@ std::optional<::pasta::VarDecl> CXXCatchStmt::ExceptionDeclaration(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXCatchStmt::ExceptionDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getExceptionDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CXXCatchStmt::HandlerBlock(void) const noexcept {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.getHandlerBlock();
@@ -2238,6 +2643,16 @@ std::optional<::pasta::VarDecl> CXXCatchStmt::ExceptionDeclaration(void) const n
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXCatchStmt::HandlerBlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
+  decltype(auto) val = self.getHandlerBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXCatchStmt::HandlerBlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CXXForRangeStmt::CXXForRangeStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2264,6 +2679,13 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::DeclStmt CXXForRangeStmt::BeginStatement(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getBeginStmt();
@@ -2274,6 +2696,16 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::BeginStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getBeginStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::BeginStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CXXForRangeStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getBody();
@@ -2284,6 +2716,16 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXForRangeStmt::CoawaitToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getCoawaitLoc();
@@ -2291,6 +2733,13 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::CoawaitTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getCoawaitLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXForRangeStmt::ColonToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getColonLoc();
@@ -2298,6 +2747,13 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::ColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXForRangeStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getCond();
@@ -2308,6 +2764,16 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXForRangeStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2315,6 +2781,13 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::DeclStmt CXXForRangeStmt::EndStatement(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getEndStmt();
@@ -2325,6 +2798,16 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::EndStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getEndStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::EndStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXForRangeStmt::ForToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getForLoc();
@@ -2332,6 +2815,13 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::ForTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getForLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXForRangeStmt::Increment(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getInc();
@@ -2342,6 +2832,16 @@ std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::IncrementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getInc();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::IncrementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getInit();
@@ -2354,6 +2854,18 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXForRangeStmt::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getInit();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::DeclStmt CXXForRangeStmt::LoopVariableStatement(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getLoopVarStmt();
@@ -2364,6 +2876,16 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::LoopVariableStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getLoopVarStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::LoopVariableStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::VarDecl CXXForRangeStmt::LoopVariable(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getLoopVariable();
@@ -2374,6 +2896,16 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXForRangeStmt::LoopVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getLoopVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::LoopVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXForRangeStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -2381,6 +2913,13 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXForRangeStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXForRangeStmt::RangeInitializer(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getRangeInit();
@@ -2391,6 +2930,16 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::RangeInitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getRangeInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::RangeInitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::DeclStmt CXXForRangeStmt::RangeStatement(void) const noexcept {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.getRangeStmt();
@@ -2401,6 +2950,16 @@ std::optional<::pasta::Stmt> CXXForRangeStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXForRangeStmt::RangeStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
+  decltype(auto) val = self.getRangeStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXForRangeStmt::RangeStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CXXTryStmt::CXXTryStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2427,6 +2986,13 @@ std::vector<::pasta::Stmt> CXXTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTryStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXTryStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2434,6 +3000,13 @@ std::vector<::pasta::Stmt> CXXTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTryStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: CXXTryStmt::Handler
 uint32_t CXXTryStmt::NumHandlers(void) const noexcept {
   auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
@@ -2452,6 +3025,16 @@ uint32_t CXXTryStmt::NumHandlers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXTryStmt::TryBlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
+  decltype(auto) val = self.getTryBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXTryStmt::TryBlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXTryStmt::TryToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
   decltype(auto) val = self.getTryLoc();
@@ -2459,6 +3042,13 @@ uint32_t CXXTryStmt::NumHandlers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTryStmt::TryTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
+  decltype(auto) val = self.getTryLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::CXXCatchStmt> CXXTryStmt::Handlers(void) const noexcept {
   std::vector<::pasta::CXXCatchStmt> ret;
   auto convert_elem = [&] (const clang::CXXCatchStmt * val) {
@@ -2509,6 +3099,13 @@ std::vector<::pasta::Stmt> CapturedStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CapturedStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CapturedDecl CapturedStmt::CapturedDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.getCapturedDecl();
@@ -2519,6 +3116,16 @@ std::vector<::pasta::Stmt> CapturedStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CapturedStmt::CapturedDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getCapturedDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CapturedStmt::CapturedDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::RecordDecl CapturedStmt::CapturedRecordDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.getCapturedRecordDecl();
@@ -2529,6 +3136,16 @@ std::vector<::pasta::Stmt> CapturedStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CapturedStmt::CapturedRecordDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getCapturedRecordDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CapturedStmt::CapturedRecordDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum CapturedRegionKind CapturedStmt::CapturedRegionKind(void) const noexcept {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.getCapturedRegionKind();
@@ -2546,6 +3163,16 @@ enum CapturedRegionKind CapturedStmt::CapturedRegionKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CapturedStmt::CapturedStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getCapturedStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CapturedStmt::CapturedStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CapturedStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2553,6 +3180,13 @@ enum CapturedRegionKind CapturedStmt::CapturedRegionKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CapturedStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CapturedStmt::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.getSourceRange();
@@ -2560,6 +3194,13 @@ enum CapturedRegionKind CapturedStmt::CapturedRegionKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CapturedStmt::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CaseStmt::CaseStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2594,6 +3235,13 @@ std::vector<::pasta::Stmt> CaseStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CaseStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CaseStmt::CaseToken(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getCaseLoc();
@@ -2601,6 +3249,13 @@ std::vector<::pasta::Stmt> CaseStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CaseStmt::CaseTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getCaseLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CaseStmt::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getEllipsisLoc();
@@ -2608,6 +3263,13 @@ std::vector<::pasta::Stmt> CaseStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CaseStmt::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CaseStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2615,6 +3277,13 @@ std::vector<::pasta::Stmt> CaseStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CaseStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CaseStmt::LHS(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getLHS();
@@ -2625,6 +3294,16 @@ std::vector<::pasta::Stmt> CaseStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CaseStmt::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CaseStmt::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CaseStmt::RHS(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getRHS();
@@ -2637,6 +3316,18 @@ std::optional<::pasta::Expr> CaseStmt::RHS(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CaseStmt::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getRHS();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CaseStmt::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.getSubStmt();
@@ -2647,6 +3338,16 @@ std::optional<::pasta::Expr> CaseStmt::RHS(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CaseStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CaseStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CompoundStmt::CompoundStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2674,10 +3375,17 @@ std::vector<::pasta::Stmt> CompoundStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token CompoundStmt::BeginToken(void) const noexcept {
+::pasta::Token CompoundStmt::BeginToken(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef CompoundStmt::BeginTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
   decltype(auto) val = self.getBeginLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -2688,6 +3396,13 @@ std::vector<::pasta::Stmt> CompoundStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CompoundStmt::LeftBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
   decltype(auto) val = self.getLBracLoc();
@@ -2695,6 +3410,13 @@ std::vector<::pasta::Stmt> CompoundStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundStmt::LeftBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
+  decltype(auto) val = self.getLBracLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CompoundStmt::RightBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
   decltype(auto) val = self.getRBracLoc();
@@ -2702,6 +3424,13 @@ std::vector<::pasta::Stmt> CompoundStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundStmt::RightBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
+  decltype(auto) val = self.getRBracLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> CompoundStmt::StatementExpressionResult(void) const noexcept {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
   decltype(auto) val = self.getStmtExprResult();
@@ -2714,6 +3443,18 @@ std::optional<::pasta::Stmt> CompoundStmt::StatementExpressionResult(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CompoundStmt::StatementExpressionResultRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
+  decltype(auto) val = self.getStmtExprResult();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: CompoundStmt::StoredFPFeatures
 bool CompoundStmt::HasStoredFPFeatures(void) const noexcept {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
@@ -2755,6 +3496,13 @@ std::vector<::pasta::Stmt> ContinueStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ContinueStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ContinueStmt::ContinueToken(void) const noexcept {
   auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
   decltype(auto) val = self.getContinueLoc();
@@ -2762,6 +3510,13 @@ std::vector<::pasta::Stmt> ContinueStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ContinueStmt::ContinueTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
+  decltype(auto) val = self.getContinueLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ContinueStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2769,6 +3524,13 @@ std::vector<::pasta::Stmt> ContinueStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ContinueStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CoreturnStmt::CoreturnStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -2795,6 +3557,13 @@ std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoreturnStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoreturnStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2802,6 +3571,13 @@ std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoreturnStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoreturnStmt::KeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.getKeywordLoc();
@@ -2809,6 +3585,13 @@ std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoreturnStmt::KeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
+  decltype(auto) val = self.getKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoreturnStmt::Operand(void) const noexcept {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.getOperand();
@@ -2819,6 +3602,16 @@ std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoreturnStmt::OperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
+  decltype(auto) val = self.getOperand();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoreturnStmt::OperandRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoreturnStmt::PromiseCall(void) const noexcept {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.getPromiseCall();
@@ -2829,6 +3622,16 @@ std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoreturnStmt::PromiseCallRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
+  decltype(auto) val = self.getPromiseCall();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoreturnStmt::PromiseCallRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool CoreturnStmt::IsImplicit(void) const noexcept {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.isImplicit();
@@ -2865,6 +3668,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::AllocateRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getAllocate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::AllocateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoroutineBodyStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -2872,6 +3685,13 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoroutineBodyStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getBody();
@@ -2882,6 +3702,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineBodyStmt::Deallocate(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getDeallocate();
@@ -2892,6 +3722,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::DeallocateRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getDeallocate();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::DeallocateRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoroutineBodyStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getEndLoc();
@@ -2899,6 +3739,13 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoroutineBodyStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::ExceptionHandler(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getExceptionHandler();
@@ -2909,6 +3756,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::ExceptionHandlerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getExceptionHandler();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::ExceptionHandlerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::FallthroughHandler(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getFallthroughHandler();
@@ -2919,6 +3776,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::FallthroughHandlerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getFallthroughHandler();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::FallthroughHandlerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::FinalSuspendStatement(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getFinalSuspendStmt();
@@ -2929,6 +3796,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::FinalSuspendStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getFinalSuspendStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::FinalSuspendStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::InitializerSuspendStatement(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getInitSuspendStmt();
@@ -2939,6 +3816,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::InitializerSuspendStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getInitSuspendStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::InitializerSuspendStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getParamMoves();
@@ -2962,6 +3849,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CoroutineBodyStmt::PromiseDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getPromiseDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::PromiseDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::PromiseDeclarationStatement(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getPromiseDeclStmt();
@@ -2972,6 +3869,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::PromiseDeclarationStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getPromiseDeclStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::PromiseDeclarationStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::ReturnStatement(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getReturnStmt();
@@ -2982,6 +3889,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::ReturnStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getReturnStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::ReturnStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt CoroutineBodyStmt::ReturnStatementOnAllocFailure(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getReturnStmtOnAllocFailure();
@@ -2992,6 +3909,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::ReturnStatementOnAllocFailureRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getReturnStmtOnAllocFailure();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::ReturnStatementOnAllocFailureRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineBodyStmt::ReturnValue(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getReturnValue();
@@ -3002,6 +3929,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::ReturnValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getReturnValue();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::ReturnValueRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineBodyStmt::ReturnValueInitializer(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getReturnValueInit();
@@ -3012,6 +3949,16 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineBodyStmt::ReturnValueInitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
+  decltype(auto) val = self.getReturnValueInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineBodyStmt::ReturnValueInitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool CoroutineBodyStmt::HasDependentPromiseType(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.hasDependentPromiseType();
@@ -3060,6 +4007,13 @@ std::vector<::pasta::Decl> DeclStmt::Declarations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DeclStmt::DeclarationGroup
 ::pasta::Token DeclStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
@@ -3068,6 +4022,13 @@ std::vector<::pasta::Decl> DeclStmt::Declarations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Decl> DeclStmt::SingleDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
   if (!IsSingleDeclaration()) {
@@ -3083,6 +4044,21 @@ std::optional<::pasta::Decl> DeclStmt::SingleDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> DeclStmt::SingleDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
+  if (!IsSingleDeclaration()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getSingleDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool DeclStmt::IsSingleDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
   decltype(auto) val = self.isSingleDecl();
@@ -3117,6 +4093,13 @@ std::vector<::pasta::Stmt> DefaultStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DefaultStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DefaultStmt::DefaultToken(void) const noexcept {
   auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
   decltype(auto) val = self.getDefaultLoc();
@@ -3124,6 +4107,13 @@ std::vector<::pasta::Stmt> DefaultStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DefaultStmt::DefaultTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
+  decltype(auto) val = self.getDefaultLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DefaultStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
   decltype(auto) val = self.getEndLoc();
@@ -3131,6 +4121,13 @@ std::vector<::pasta::Stmt> DefaultStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DefaultStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt DefaultStmt::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
   decltype(auto) val = self.getSubStmt();
@@ -3141,6 +4138,16 @@ std::vector<::pasta::Stmt> DefaultStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DefaultStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DefaultStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 DoStmt::DoStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -3167,6 +4174,13 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DoStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt DoStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getBody();
@@ -3177,6 +4191,16 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DoStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DoStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DoStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getCond();
@@ -3187,6 +4211,16 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DoStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DoStmt::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token DoStmt::DoToken(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getDoLoc();
@@ -3194,6 +4228,13 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DoStmt::DoTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getDoLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DoStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getEndLoc();
@@ -3201,6 +4242,13 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DoStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DoStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -3208,6 +4256,13 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DoStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DoStmt::WhileToken(void) const noexcept {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.getWhileLoc();
@@ -3215,6 +4270,13 @@ std::vector<::pasta::Stmt> DoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DoStmt::WhileTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
+  decltype(auto) val = self.getWhileLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 Expr::Expr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -3413,6 +4475,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreConversionOperatorSingleStep(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreConversionOperatorSingleStep();
@@ -3423,6 +4495,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreConversionOperatorSingleStepRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreConversionOperatorSingleStep();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreConversionOperatorSingleStepRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreImplicitCasts(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreImpCasts();
@@ -3433,6 +4515,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreImplicitCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreImpCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreImplicitCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreImplicit(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreImplicit();
@@ -3443,6 +4535,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreImplicitRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreImplicit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreImplicitRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreImplicitAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreImplicitAsWritten();
@@ -3453,6 +4555,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreImplicitAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreImplicitAsWritten();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreImplicitAsWrittenRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreParenthesisBaseCasts(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreParenBaseCasts();
@@ -3463,6 +4575,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreParenthesisBaseCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreParenBaseCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreParenthesisBaseCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreParenthesisCasts(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreParenCasts();
@@ -3473,6 +4595,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreParenthesisCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreParenCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreParenthesisCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreParenthesisImplicitCasts(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreParenImpCasts();
@@ -3483,6 +4615,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreParenthesisImplicitCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreParenImpCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreParenthesisImplicitCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreParenthesisLValueCasts(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreParenLValueCasts();
@@ -3493,6 +4635,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreParenthesisLValueCastsRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreParenLValueCasts();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreParenthesisLValueCastsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreParenthesisNoopCasts(void) const noexcept {
   auto &self = *(u.Expr);
   decltype(auto) val = self.IgnoreParenNoopCasts(ast->ci->getASTContext());
@@ -3514,6 +4666,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreParenthesesRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreParens();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreParenthesesRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::IgnoreUnlessSpelledInSource(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.IgnoreUnlessSpelledInSource();
@@ -3524,6 +4686,16 @@ bool Expr::HasSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::IgnoreUnlessSpelledInSourceRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.IgnoreUnlessSpelledInSource();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::IgnoreUnlessSpelledInSourceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool Expr::ContainsErrors(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.containsErrors();
@@ -3562,6 +4734,18 @@ std::optional<::pasta::CXXRecordDecl> Expr::BestDynamicClassType(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Expr::BestDynamicClassTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getBestDynamicClassType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Expr Expr::BestDynamicClassTypeExpression(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.getBestDynamicClassTypeExpr();
@@ -3572,6 +4756,16 @@ std::optional<::pasta::CXXRecordDecl> Expr::BestDynamicClassType(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::StmtRef Expr::BestDynamicClassTypeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getBestDynamicClassTypeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Expr::BestDynamicClassTypeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: Expr::Dependence
 ::pasta::Token Expr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
@@ -3580,6 +4774,13 @@ std::optional<::pasta::CXXRecordDecl> Expr::BestDynamicClassType(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef Expr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: Expr::FPFeaturesInEffect
 // 1: Expr::IntegerConstantExpression
 std::optional<::pasta::ObjCPropertyRefExpr> Expr::ObjCProperty(void) const noexcept {
@@ -3597,6 +4798,21 @@ std::optional<::pasta::ObjCPropertyRefExpr> Expr::ObjCProperty(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> Expr::ObjCPropertyRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  if (!self.isLValue() || self.getObjectKind() != clang::OK_ObjCProperty) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getObjCProperty();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum ExprObjectKind Expr::ObjectKind(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.getObjectKind();
@@ -3616,6 +4832,18 @@ std::optional<::pasta::Decl> Expr::ReferencedDeclarationOfCallee(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Expr::ReferencedDeclarationOfCalleeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getReferencedDeclOfCallee();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FieldDecl> Expr::SourceBitField(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.getSourceBitField();
@@ -3628,6 +4856,18 @@ std::optional<::pasta::FieldDecl> Expr::SourceBitField(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Expr::SourceBitFieldRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getSourceBitField();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> Expr::Type(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.getType();
@@ -3638,6 +4878,16 @@ std::optional<::pasta::Type> Expr::Type(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Expr::TypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Expr *>(u.Expr);
+  decltype(auto) val = self.getType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ExprValueKind Expr::ValueKind(void) const noexcept {
   auto &self = *const_cast<clang::Expr *>(u.Expr);
   decltype(auto) val = self.getValueKind();
@@ -3881,6 +5131,13 @@ std::vector<::pasta::Stmt> ExpressionTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExpressionTraitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExpressionTraitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -3888,6 +5145,13 @@ std::vector<::pasta::Stmt> ExpressionTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExpressionTraitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ExpressionTraitExpr::QueriedExpression(void) const noexcept {
   auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
   decltype(auto) val = self.getQueriedExpression();
@@ -3898,6 +5162,16 @@ std::vector<::pasta::Stmt> ExpressionTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ExpressionTraitExpr::QueriedExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
+  decltype(auto) val = self.getQueriedExpression();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ExpressionTraitExpr::QueriedExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ExpressionTrait ExpressionTraitExpr::Trait(void) const noexcept {
   auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
   decltype(auto) val = self.getTrait();
@@ -3948,6 +5222,13 @@ bool ExtVectorElementExpr::ContainsDuplicateElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExtVectorElementExpr::AccessorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
+  decltype(auto) val = self.getAccessorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ExtVectorElementExpr::Base(void) const noexcept {
   auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
   decltype(auto) val = self.getBase();
@@ -3958,6 +5239,16 @@ bool ExtVectorElementExpr::ContainsDuplicateElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ExtVectorElementExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ExtVectorElementExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExtVectorElementExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -3965,6 +5256,13 @@ bool ExtVectorElementExpr::ContainsDuplicateElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExtVectorElementExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExtVectorElementExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
   decltype(auto) val = self.getEndLoc();
@@ -3972,6 +5270,13 @@ bool ExtVectorElementExpr::ContainsDuplicateElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExtVectorElementExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ExtVectorElementExpr::NumElements(void) const noexcept {
   auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
   decltype(auto) val = self.getNumElements();
@@ -4014,6 +5319,13 @@ std::vector<::pasta::Stmt> FixedPointLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FixedPointLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FixedPointLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -4021,6 +5333,13 @@ std::vector<::pasta::Stmt> FixedPointLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FixedPointLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FixedPointLiteral::Token(void) const noexcept {
   auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
   decltype(auto) val = self.getLocation();
@@ -4028,6 +5347,13 @@ std::vector<::pasta::Stmt> FixedPointLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FixedPointLiteral::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t FixedPointLiteral::Scale(void) const noexcept {
   auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
   decltype(auto) val = self.getScale();
@@ -4064,6 +5390,13 @@ std::vector<::pasta::Stmt> FloatingLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FloatingLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FloatingLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -4071,6 +5404,13 @@ std::vector<::pasta::Stmt> FloatingLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FloatingLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FloatingLiteral::Token(void) const noexcept {
   auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
   decltype(auto) val = self.getLocation();
@@ -4078,6 +5418,13 @@ std::vector<::pasta::Stmt> FloatingLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FloatingLiteral::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: FloatingLiteral::RawSemantics
 // 0: FloatingLiteral::Semantics
 // 0: FloatingLiteral::Value
@@ -4115,6 +5462,13 @@ std::vector<::pasta::Stmt> ForStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ForStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ForStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getBody();
@@ -4125,6 +5479,16 @@ std::vector<::pasta::Stmt> ForStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ForStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ForStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> ForStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getCond();
@@ -4137,6 +5501,18 @@ std::optional<::pasta::Expr> ForStmt::Condition(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ForStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getCond();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> ForStmt::ConditionVariable(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getConditionVariable();
@@ -4149,6 +5525,18 @@ std::optional<::pasta::VarDecl> ForStmt::ConditionVariable(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ForStmt::ConditionVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getConditionVariable();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclStmt> ForStmt::ConditionVariableDeclarationStatement(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getConditionVariableDeclStmt();
@@ -4161,10 +5549,29 @@ std::optional<::pasta::DeclStmt> ForStmt::ConditionVariableDeclarationStatement(
   __builtin_unreachable();
 }
 
-::pasta::Token ForStmt::EndToken(void) const noexcept {
+std::optional<::pasta::StmtRef> ForStmt::ConditionVariableDeclarationStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getConditionVariableDeclStmt();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
+::pasta::Token ForStmt::EndToken(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getEndLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef ForStmt::EndTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getEndLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -4175,6 +5582,13 @@ std::optional<::pasta::DeclStmt> ForStmt::ConditionVariableDeclarationStatement(
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ForStmt::ForTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getForLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> ForStmt::Increment(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getInc();
@@ -4187,6 +5601,18 @@ std::optional<::pasta::Expr> ForStmt::Increment(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ForStmt::IncrementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getInc();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> ForStmt::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getInit();
@@ -4199,6 +5625,18 @@ std::optional<::pasta::Stmt> ForStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ForStmt::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getInit();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token ForStmt::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getLParenLoc();
@@ -4206,6 +5644,13 @@ std::optional<::pasta::Stmt> ForStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ForStmt::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ForStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -4213,6 +5658,13 @@ std::optional<::pasta::Stmt> ForStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ForStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 FullExpr::FullExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -4233,6 +5685,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(FullExpr, ExprWithCleanups)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef FullExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::FullExpr *>(u.FullExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FullExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 FunctionParmPackExpr::FunctionParmPackExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -4263,6 +5725,13 @@ std::vector<::pasta::Stmt> FunctionParmPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionParmPackExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token FunctionParmPackExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
   decltype(auto) val = self.getEndLoc();
@@ -4270,6 +5739,13 @@ std::vector<::pasta::Stmt> FunctionParmPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionParmPackExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: FunctionParmPackExpr::Expansion
 uint32_t FunctionParmPackExpr::NumExpansions(void) const noexcept {
   auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
@@ -4288,6 +5764,16 @@ uint32_t FunctionParmPackExpr::NumExpansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef FunctionParmPackExpr::ParameterPackRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
+  decltype(auto) val = self.getParameterPack();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "FunctionParmPackExpr::ParameterPackRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token FunctionParmPackExpr::ParameterPackToken(void) const noexcept {
   auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
   decltype(auto) val = self.getParameterPackLocation();
@@ -4295,6 +5781,13 @@ uint32_t FunctionParmPackExpr::NumExpansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionParmPackExpr::ParameterPackTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
+  decltype(auto) val = self.getParameterPackLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::VarDecl> FunctionParmPackExpr::Expansions(void) const noexcept {
   std::vector<::pasta::VarDecl> ret;
   auto convert_elem = [&] (clang::VarDecl * val) {
@@ -4338,6 +5831,16 @@ std::string GCCAsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef GCCAsmStmt::AssemblyStringRef(void) const noexcept {
+  auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
+  decltype(auto) val = self.getAsmString();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "GCCAsmStmt::AssemblyStringRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token GCCAsmStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -4345,6 +5848,13 @@ std::string GCCAsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GCCAsmStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: GCCAsmStmt::Clobber
 // 1: GCCAsmStmt::ClobberStringLiteral
 ::pasta::Token GCCAsmStmt::EndToken(void) const noexcept {
@@ -4354,6 +5864,13 @@ std::string GCCAsmStmt::GenerateAssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GCCAsmStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: GCCAsmStmt::InputConstraint
 // 1: GCCAsmStmt::InputConstraintLiteral
 // 1: GCCAsmStmt::InputExpression
@@ -4382,6 +5899,13 @@ uint32_t GCCAsmStmt::NumLabels(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GCCAsmStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool GCCAsmStmt::IsAssemblyGoto(void) const noexcept {
   auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
   decltype(auto) val = self.isAsmGoto();
@@ -4634,6 +6158,13 @@ std::vector<::pasta::Stmt> GNUNullExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GNUNullExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GNUNullExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
   decltype(auto) val = self.getEndLoc();
@@ -4641,6 +6172,13 @@ std::vector<::pasta::Stmt> GNUNullExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GNUNullExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GNUNullExpr::TokenToken(void) const noexcept {
   auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
   decltype(auto) val = self.getTokenLocation();
@@ -4648,6 +6186,13 @@ std::vector<::pasta::Stmt> GNUNullExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GNUNullExpr::TokenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
+  decltype(auto) val = self.getTokenLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 GenericSelectionExpr::GenericSelectionExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -4692,6 +6237,13 @@ std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GenericSelectionExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr GenericSelectionExpr::ControllingExpression(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getControllingExpr();
@@ -4702,6 +6254,16 @@ std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) co
   __builtin_unreachable();
 }
 
+::pasta::StmtRef GenericSelectionExpr::ControllingExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getControllingExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "GenericSelectionExpr::ControllingExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token GenericSelectionExpr::DefaultToken(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getDefaultLoc();
@@ -4709,6 +6271,13 @@ std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GenericSelectionExpr::DefaultTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getDefaultLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GenericSelectionExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getEndLoc();
@@ -4716,6 +6285,13 @@ std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GenericSelectionExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GenericSelectionExpr::GenericToken(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getGenericLoc();
@@ -4723,6 +6299,13 @@ std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GenericSelectionExpr::GenericTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getGenericLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t GenericSelectionExpr::NumAssociations(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getNumAssocs();
@@ -4737,6 +6320,13 @@ uint32_t GenericSelectionExpr::NumAssociations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GenericSelectionExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr GenericSelectionExpr::ResultExpression(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getResultExpr();
@@ -4747,6 +6337,16 @@ uint32_t GenericSelectionExpr::NumAssociations(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef GenericSelectionExpr::ResultExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
+  decltype(auto) val = self.getResultExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "GenericSelectionExpr::ResultExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t GenericSelectionExpr::ResultIndex(void) const noexcept {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getResultIndex();
@@ -4787,6 +6387,13 @@ std::vector<::pasta::Stmt> GotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GotoStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GotoStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
   decltype(auto) val = self.getEndLoc();
@@ -4794,6 +6401,13 @@ std::vector<::pasta::Stmt> GotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GotoStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token GotoStmt::GotoToken(void) const noexcept {
   auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
   decltype(auto) val = self.getGotoLoc();
@@ -4801,6 +6415,13 @@ std::vector<::pasta::Stmt> GotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GotoStmt::GotoTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
+  decltype(auto) val = self.getGotoLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::LabelDecl GotoStmt::Label(void) const noexcept {
   auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
   decltype(auto) val = self.getLabel();
@@ -4811,6 +6432,16 @@ std::vector<::pasta::Stmt> GotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef GotoStmt::LabelRef(void) const noexcept {
+  auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
+  decltype(auto) val = self.getLabel();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "GotoStmt::LabelRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token GotoStmt::LabelToken(void) const noexcept {
   auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
   decltype(auto) val = self.getLabelLoc();
@@ -4818,6 +6449,13 @@ std::vector<::pasta::Stmt> GotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef GotoStmt::LabelTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
+  decltype(auto) val = self.getLabelLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 IfStmt::IfStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -4844,6 +6482,13 @@ std::vector<::pasta::Stmt> IfStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr IfStmt::Condition(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getCond();
@@ -4854,6 +6499,16 @@ std::vector<::pasta::Stmt> IfStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef IfStmt::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "IfStmt::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> IfStmt::ConditionVariable(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getConditionVariable();
@@ -4866,6 +6521,18 @@ std::optional<::pasta::VarDecl> IfStmt::ConditionVariable(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> IfStmt::ConditionVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getConditionVariable();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeclStmt> IfStmt::ConditionVariableDeclarationStatement(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getConditionVariableDeclStmt();
@@ -4878,6 +6545,18 @@ std::optional<::pasta::DeclStmt> IfStmt::ConditionVariableDeclarationStatement(v
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> IfStmt::ConditionVariableDeclarationStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getConditionVariableDeclStmt();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> IfStmt::Else(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getElse();
@@ -4890,6 +6569,18 @@ std::optional<::pasta::Stmt> IfStmt::Else(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> IfStmt::ElseRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getElse();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token IfStmt::ElseToken(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getElseLoc();
@@ -4897,6 +6588,13 @@ std::optional<::pasta::Stmt> IfStmt::Else(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::ElseTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getElseLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IfStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getEndLoc();
@@ -4904,6 +6602,13 @@ std::optional<::pasta::Stmt> IfStmt::Else(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IfStmt::IfToken(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getIfLoc();
@@ -4911,6 +6616,13 @@ std::optional<::pasta::Stmt> IfStmt::Else(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::IfTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getIfLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Stmt> IfStmt::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getInit();
@@ -4923,6 +6635,18 @@ std::optional<::pasta::Stmt> IfStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> IfStmt::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getInit();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token IfStmt::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getLParenLoc();
@@ -4930,6 +6654,13 @@ std::optional<::pasta::Stmt> IfStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: IfStmt::NondiscardedCase
 ::pasta::Token IfStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
@@ -4938,6 +6669,13 @@ std::optional<::pasta::Stmt> IfStmt::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IfStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum IfStatementKind IfStmt::StatementKind(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getStatementKind();
@@ -4945,13 +6683,23 @@ enum IfStatementKind IfStmt::StatementKind(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Stmt IfStmt::Then(void) const noexcept {
+::pasta::Stmt IfStmt::Then(void) const noexcept {
+  auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
+  decltype(auto) val = self.getThen();
+  if (val) {
+    return StmtBuilder::Create<::pasta::Stmt>(ast, val);
+  }
+  assert(false && "IfStmt::Then can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef IfStmt::ThenRef(void) const noexcept {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.getThen();
   if (val) {
-    return StmtBuilder::Create<::pasta::Stmt>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "IfStmt::Then can return nullptr!");
+  assert(false && "IfStmt::ThenRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -5039,6 +6787,13 @@ std::vector<::pasta::Stmt> ImaginaryLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImaginaryLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ImaginaryLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -5046,6 +6801,13 @@ std::vector<::pasta::Stmt> ImaginaryLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImaginaryLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ImaginaryLiteral::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
   decltype(auto) val = self.getSubExpr();
@@ -5056,6 +6818,16 @@ std::vector<::pasta::Stmt> ImaginaryLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ImaginaryLiteral::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ImaginaryLiteral::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ImplicitValueInitExpr::ImplicitValueInitExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -5084,6 +6856,13 @@ std::vector<::pasta::Stmt> ImplicitValueInitExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImplicitValueInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImplicitValueInitExpr *>(u.ImplicitValueInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ImplicitValueInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ImplicitValueInitExpr *>(u.ImplicitValueInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -5091,6 +6870,13 @@ std::vector<::pasta::Stmt> ImplicitValueInitExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImplicitValueInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImplicitValueInitExpr *>(u.ImplicitValueInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 IndirectGotoStmt::IndirectGotoStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -5117,6 +6903,13 @@ std::vector<::pasta::Stmt> IndirectGotoStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IndirectGotoStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const noexcept {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.getConstantTarget();
@@ -5129,6 +6922,18 @@ std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> IndirectGotoStmt::ConstantTargetRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getConstantTarget();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token IndirectGotoStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.getEndLoc();
@@ -5136,6 +6941,13 @@ std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const n
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IndirectGotoStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IndirectGotoStmt::GotoToken(void) const noexcept {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.getGotoLoc();
@@ -5143,6 +6955,13 @@ std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const n
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IndirectGotoStmt::GotoTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getGotoLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IndirectGotoStmt::StarToken(void) const noexcept {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.getStarLoc();
@@ -5150,6 +6969,13 @@ std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const n
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IndirectGotoStmt::StarTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getStarLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr IndirectGotoStmt::Target(void) const noexcept {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.getTarget();
@@ -5160,6 +6986,16 @@ std::optional<::pasta::LabelDecl> IndirectGotoStmt::ConstantTarget(void) const n
   __builtin_unreachable();
 }
 
+::pasta::StmtRef IndirectGotoStmt::TargetRef(void) const noexcept {
+  auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
+  decltype(auto) val = self.getTarget();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "IndirectGotoStmt::TargetRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 InitListExpr::InitListExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -5195,6 +7031,18 @@ std::optional<::pasta::Expr> InitListExpr::ArrayFiller(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> InitListExpr::ArrayFillerRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getArrayFiller();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token InitListExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -5202,6 +7050,13 @@ std::optional<::pasta::Expr> InitListExpr::ArrayFiller(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef InitListExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token InitListExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.getEndLoc();
@@ -5209,6 +7064,13 @@ std::optional<::pasta::Expr> InitListExpr::ArrayFiller(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef InitListExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: InitListExpr::Initializer
 std::optional<::pasta::FieldDecl> InitListExpr::InitializedFieldInUnion(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
@@ -5222,6 +7084,18 @@ std::optional<::pasta::FieldDecl> InitListExpr::InitializedFieldInUnion(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> InitListExpr::InitializedFieldInUnionRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getInitializedFieldInUnion();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: InitListExpr::Initializers
 ::pasta::Token InitListExpr::LBraceToken(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
@@ -5230,6 +7104,13 @@ std::optional<::pasta::FieldDecl> InitListExpr::InitializedFieldInUnion(void) co
   __builtin_unreachable();
 }
 
+::pasta::TokenRef InitListExpr::LBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getLBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t InitListExpr::NumInitializers(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.getNumInits();
@@ -5244,6 +7125,13 @@ uint32_t InitListExpr::NumInitializers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef InitListExpr::RBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::InitListExpr> InitListExpr::SemanticForm(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.getSemanticForm();
@@ -5256,6 +7144,18 @@ std::optional<::pasta::InitListExpr> InitListExpr::SemanticForm(void) const noex
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> InitListExpr::SemanticFormRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getSemanticForm();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::InitListExpr> InitListExpr::SyntacticForm(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.getSyntacticForm();
@@ -5268,6 +7168,18 @@ std::optional<::pasta::InitListExpr> InitListExpr::SyntacticForm(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> InitListExpr::SyntacticFormRef(void) const noexcept {
+  auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
+  decltype(auto) val = self.getSyntacticForm();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool InitListExpr::HadArrayRangeDesignator(void) const noexcept {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.hadArrayRangeDesignator();
@@ -5368,6 +7280,13 @@ std::vector<::pasta::Stmt> IntegerLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IntegerLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IntegerLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -5375,6 +7294,13 @@ std::vector<::pasta::Stmt> IntegerLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IntegerLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token IntegerLiteral::Token(void) const noexcept {
   auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
   decltype(auto) val = self.getLocation();
@@ -5382,6 +7308,13 @@ std::vector<::pasta::Stmt> IntegerLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef IntegerLiteral::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 LabelStmt::LabelStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -5409,6 +7342,13 @@ std::vector<::pasta::Stmt> LabelStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LabelStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::LabelDecl LabelStmt::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.getDecl();
@@ -5419,6 +7359,16 @@ std::vector<::pasta::Stmt> LabelStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef LabelStmt::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LabelStmt::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token LabelStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.getEndLoc();
@@ -5426,6 +7376,13 @@ std::vector<::pasta::Stmt> LabelStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LabelStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token LabelStmt::IdentifierToken(void) const noexcept {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.getIdentLoc();
@@ -5433,6 +7390,13 @@ std::vector<::pasta::Stmt> LabelStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LabelStmt::IdentifierTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
+  decltype(auto) val = self.getIdentLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string_view LabelStmt::Name(void) const noexcept {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.getName();
@@ -5455,6 +7419,16 @@ std::string_view LabelStmt::Name(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LabelStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LabelStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool LabelStmt::IsSideEntry(void) const noexcept {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.isSideEntry();
@@ -5500,6 +7474,13 @@ std::vector<::pasta::Stmt> LambdaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LambdaExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt LambdaExpr::Body(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getBody();
@@ -5510,6 +7491,16 @@ std::vector<::pasta::Stmt> LambdaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LambdaExpr::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LambdaExpr::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::CXXMethodDecl LambdaExpr::CallOperator(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getCallOperator();
@@ -5520,6 +7511,16 @@ std::vector<::pasta::Stmt> LambdaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef LambdaExpr::CallOperatorRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getCallOperator();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LambdaExpr::CallOperatorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum LambdaCaptureDefault LambdaExpr::CaptureDefault(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getCaptureDefault();
@@ -5534,6 +7535,13 @@ enum LambdaCaptureDefault LambdaExpr::CaptureDefault(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LambdaExpr::CaptureDefaultTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getCaptureDefaultLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt LambdaExpr::CompoundStatementBody(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getCompoundStmtBody();
@@ -5544,6 +7552,16 @@ enum LambdaCaptureDefault LambdaExpr::CaptureDefault(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef LambdaExpr::CompoundStatementBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getCompoundStmtBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LambdaExpr::CompoundStatementBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionTemplateDecl> LambdaExpr::DependentCallOperator(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getDependentCallOperator();
@@ -5556,6 +7574,18 @@ std::optional<::pasta::FunctionTemplateDecl> LambdaExpr::DependentCallOperator(v
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> LambdaExpr::DependentCallOperatorRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getDependentCallOperator();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token LambdaExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getEndLoc();
@@ -5563,6 +7593,13 @@ std::optional<::pasta::FunctionTemplateDecl> LambdaExpr::DependentCallOperator(v
   __builtin_unreachable();
 }
 
+::pasta::TokenRef LambdaExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::NamedDecl> LambdaExpr::ExplicitTemplateParameters(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getExplicitTemplateParameters();
@@ -5583,6 +7620,13 @@ std::vector<::pasta::NamedDecl> LambdaExpr::ExplicitTemplateParameters(void) con
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange LambdaExpr::IntroducerRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getIntroducerRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl LambdaExpr::LambdaClass(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getLambdaClass();
@@ -5593,6 +7637,16 @@ std::vector<::pasta::NamedDecl> LambdaExpr::ExplicitTemplateParameters(void) con
   __builtin_unreachable();
 }
 
+::pasta::DeclRef LambdaExpr::LambdaClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getLambdaClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "LambdaExpr::LambdaClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TemplateParameterList> LambdaExpr::TemplateParameterList(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getTemplateParameterList();
@@ -5615,6 +7669,18 @@ std::optional<::pasta::Expr> LambdaExpr::TrailingRequiresClause(void) const noex
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> LambdaExpr::TrailingRequiresClauseRef(void) const noexcept {
+  auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
+  decltype(auto) val = self.getTrailingRequiresClause();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool LambdaExpr::HasExplicitParameters(void) const noexcept {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.hasExplicitParameters();
@@ -5717,6 +7783,13 @@ std::string_view MSAsmStmt::AssemblyString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSAsmStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: MSAsmStmt::Clobber
 std::vector<std::string_view> MSAsmStmt::Clobbers(void) const noexcept {
   auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
@@ -5737,6 +7810,13 @@ std::vector<std::string_view> MSAsmStmt::Clobbers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSAsmStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: MSAsmStmt::InputConstraint
 // 1: MSAsmStmt::InputExpression
 ::pasta::Token MSAsmStmt::LBraceToken(void) const noexcept {
@@ -5746,6 +7826,13 @@ std::vector<std::string_view> MSAsmStmt::Clobbers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSAsmStmt::LBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
+  decltype(auto) val = self.getLBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: MSAsmStmt::OutputConstraint
 // 1: MSAsmStmt::OutputExpression
 bool MSAsmStmt::HasBraces(void) const noexcept {
@@ -5849,6 +7936,13 @@ std::vector<::pasta::Stmt> MSDependentExistsStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSDependentExistsStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSDependentExistsStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
   decltype(auto) val = self.getEndLoc();
@@ -5856,6 +7950,13 @@ std::vector<::pasta::Stmt> MSDependentExistsStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSDependentExistsStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSDependentExistsStmt::KeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
   decltype(auto) val = self.getKeywordLoc();
@@ -5863,6 +7964,13 @@ std::vector<::pasta::Stmt> MSDependentExistsStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSDependentExistsStmt::KeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
+  decltype(auto) val = self.getKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MSDependentExistsStmt::NameInfo
 // 0: MSDependentExistsStmt::QualifierToken
 ::pasta::CompoundStmt MSDependentExistsStmt::SubStatement(void) const noexcept {
@@ -5875,6 +7983,16 @@ std::vector<::pasta::Stmt> MSDependentExistsStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MSDependentExistsStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MSDependentExistsStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool MSDependentExistsStmt::IsIfExists(void) const noexcept {
   auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
   decltype(auto) val = self.isIfExists();
@@ -5920,6 +8038,16 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MSPropertyRefExpr::BaseExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getBaseExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MSPropertyRefExpr::BaseExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertyRefExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -5927,6 +8055,13 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertyRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertyRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.getEndLoc();
@@ -5934,6 +8069,13 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertyRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertyRefExpr::MemberToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.getMemberLoc();
@@ -5941,6 +8083,13 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertyRefExpr::MemberTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getMemberLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::MSPropertyDecl MSPropertyRefExpr::PropertyDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.getPropertyDecl();
@@ -5951,6 +8100,16 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef MSPropertyRefExpr::PropertyDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getPropertyDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MSPropertyRefExpr::PropertyDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: MSPropertyRefExpr::QualifierToken
 ::pasta::TokenRange MSPropertyRefExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
@@ -5959,6 +8118,13 @@ std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange MSPropertyRefExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool MSPropertyRefExpr::IsArrow(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.isArrow();
@@ -6004,6 +8170,16 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MSPropertySubscriptExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MSPropertySubscriptExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertySubscriptExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -6011,6 +8187,13 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertySubscriptExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertySubscriptExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6018,6 +8201,13 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertySubscriptExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertySubscriptExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.getExprLoc();
@@ -6025,6 +8215,13 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertySubscriptExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr MSPropertySubscriptExpr::Index(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.getIdx();
@@ -6035,6 +8232,16 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MSPropertySubscriptExpr::IndexRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getIdx();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MSPropertySubscriptExpr::IndexRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MSPropertySubscriptExpr::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.getRBracketLoc();
@@ -6042,6 +8249,13 @@ std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MSPropertySubscriptExpr::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 MaterializeTemporaryExpr::MaterializeTemporaryExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -6070,6 +8284,13 @@ std::vector<::pasta::Stmt> MaterializeTemporaryExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MaterializeTemporaryExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MaterializeTemporaryExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6077,6 +8298,13 @@ std::vector<::pasta::Stmt> MaterializeTemporaryExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MaterializeTemporaryExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ValueDecl> MaterializeTemporaryExpr::ExtendingDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.getExtendingDecl();
@@ -6089,6 +8317,18 @@ std::optional<::pasta::ValueDecl> MaterializeTemporaryExpr::ExtendingDeclaration
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> MaterializeTemporaryExpr::ExtendingDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
+  decltype(auto) val = self.getExtendingDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::LifetimeExtendedTemporaryDecl> MaterializeTemporaryExpr::LifetimeExtendedTemporaryDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.getLifetimeExtendedTemporaryDecl();
@@ -6101,6 +8341,18 @@ std::optional<::pasta::LifetimeExtendedTemporaryDecl> MaterializeTemporaryExpr::
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> MaterializeTemporaryExpr::LifetimeExtendedTemporaryDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
+  decltype(auto) val = self.getLifetimeExtendedTemporaryDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t MaterializeTemporaryExpr::ManglingNumber(void) const noexcept {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.getManglingNumber();
@@ -6126,6 +8378,16 @@ enum StorageDuration MaterializeTemporaryExpr::StorageDuration(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MaterializeTemporaryExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MaterializeTemporaryExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool MaterializeTemporaryExpr::IsBoundToLvalueReference(void) const noexcept {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.isBoundToLvalueReference();
@@ -6171,6 +8433,16 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MatrixSubscriptExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MatrixSubscriptExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MatrixSubscriptExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -6178,6 +8450,13 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MatrixSubscriptExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr MatrixSubscriptExpr::ColumnIndex(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getColumnIdx();
@@ -6188,6 +8467,16 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MatrixSubscriptExpr::ColumnIndexRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getColumnIdx();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MatrixSubscriptExpr::ColumnIndexRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MatrixSubscriptExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6195,6 +8484,13 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MatrixSubscriptExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MatrixSubscriptExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getExprLoc();
@@ -6202,6 +8498,13 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MatrixSubscriptExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MatrixSubscriptExpr::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getRBracketLoc();
@@ -6209,6 +8512,13 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MatrixSubscriptExpr::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr MatrixSubscriptExpr::RowIndex(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.getRowIdx();
@@ -6219,6 +8529,16 @@ std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MatrixSubscriptExpr::RowIndexRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
+  decltype(auto) val = self.getRowIdx();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MatrixSubscriptExpr::RowIndexRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool MatrixSubscriptExpr::IsIncomplete(void) const noexcept {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.isIncomplete();
@@ -6257,6 +8577,16 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef MemberExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MemberExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MemberExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -6264,6 +8594,13 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MemberExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6271,6 +8608,13 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token MemberExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.getExprLoc();
@@ -6278,6 +8622,13 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MemberExpr::FoundDeclaration
 ::pasta::Token MemberExpr::LAngleToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
@@ -6286,6 +8637,13 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::LAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getLAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ValueDecl MemberExpr::MemberDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.getMemberDecl();
@@ -6296,6 +8654,16 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef MemberExpr::MemberDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getMemberDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MemberExpr::MemberDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token MemberExpr::MemberToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.getMemberLoc();
@@ -6303,6 +8671,13 @@ std::vector<::pasta::Stmt> MemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::MemberTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getMemberLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MemberExpr::MemberNameInfo
 uint32_t MemberExpr::NumTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
@@ -6318,6 +8693,13 @@ uint32_t MemberExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MemberExpr::Qualifier
 // 0: MemberExpr::QualifierToken
 ::pasta::Token MemberExpr::RAngleToken(void) const noexcept {
@@ -6327,6 +8709,13 @@ uint32_t MemberExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::RAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getRAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MemberExpr::TemplateArguments
 ::pasta::Token MemberExpr::TemplateKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
@@ -6335,6 +8724,13 @@ uint32_t MemberExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef MemberExpr::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool MemberExpr::HadMultipleCandidates(void) const noexcept {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.hadMultipleCandidates();
@@ -6414,6 +8810,13 @@ std::vector<::pasta::Stmt> NoInitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NoInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NoInitExpr *>(u.NoInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token NoInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::NoInitExpr *>(u.NoInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6421,6 +8824,13 @@ std::vector<::pasta::Stmt> NoInitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NoInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NoInitExpr *>(u.NoInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 NullStmt::NullStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -6447,6 +8857,13 @@ std::vector<::pasta::Stmt> NullStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NullStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token NullStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
   decltype(auto) val = self.getEndLoc();
@@ -6454,6 +8871,13 @@ std::vector<::pasta::Stmt> NullStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NullStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token NullStmt::SemiToken(void) const noexcept {
   auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
   decltype(auto) val = self.getSemiLoc();
@@ -6461,6 +8885,13 @@ std::vector<::pasta::Stmt> NullStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef NullStmt::SemiTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
+  decltype(auto) val = self.getSemiLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool NullStmt::HasLeadingEmptyMacro(void) const noexcept {
   auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
   decltype(auto) val = self.hasLeadingEmptyMacro();
@@ -6485,17 +8916,27 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
       ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
     }
   }
-  return ret;
+  return ret;
+  __builtin_unreachable();
+}
+
+::pasta::Expr OMPArraySectionExpr::Base(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+  }
+  assert(false && "OMPArraySectionExpr::Base can return nullptr!");
   __builtin_unreachable();
 }
 
-::pasta::Expr OMPArraySectionExpr::Base(void) const noexcept {
+::pasta::StmtRef OMPArraySectionExpr::BaseRef(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getBase();
   if (val) {
-    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "OMPArraySectionExpr::Base can return nullptr!");
+  assert(false && "OMPArraySectionExpr::BaseRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -6506,6 +8947,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArraySectionExpr::FirstColonToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getColonLocFirst();
@@ -6513,6 +8961,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::FirstColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getColonLocFirst();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArraySectionExpr::SecondColonToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getColonLocSecond();
@@ -6520,6 +8975,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::SecondColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getColonLocSecond();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArraySectionExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getEndLoc();
@@ -6527,6 +8989,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArraySectionExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getExprLoc();
@@ -6534,6 +9003,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPArraySectionExpr::Length(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getLength();
@@ -6544,6 +9020,16 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPArraySectionExpr::LengthRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getLength();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPArraySectionExpr::LengthRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPArraySectionExpr::LowerBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getLowerBound();
@@ -6554,6 +9040,16 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPArraySectionExpr::LowerBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getLowerBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPArraySectionExpr::LowerBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArraySectionExpr::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getRBracketLoc();
@@ -6561,6 +9057,13 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArraySectionExpr::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPArraySectionExpr::Stride(void) const noexcept {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.getStride();
@@ -6571,6 +9074,16 @@ std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPArraySectionExpr::StrideRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
+  decltype(auto) val = self.getStride();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPArraySectionExpr::StrideRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPArrayShapingExpr::OMPArrayShapingExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -6602,6 +9115,16 @@ std::vector<::pasta::Stmt> OMPArrayShapingExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPArrayShapingExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPArrayShapingExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArrayShapingExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -6609,6 +9132,13 @@ std::vector<::pasta::Stmt> OMPArrayShapingExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArrayShapingExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::TokenRange> OMPArrayShapingExpr::BracketsRanges(void) const noexcept {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.getBracketsRanges();
@@ -6640,6 +9170,13 @@ std::vector<::pasta::Expr> OMPArrayShapingExpr::Dimensions(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArrayShapingExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArrayShapingExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -6647,6 +9184,13 @@ std::vector<::pasta::Expr> OMPArrayShapingExpr::Dimensions(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArrayShapingExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPArrayShapingExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -6654,6 +9198,13 @@ std::vector<::pasta::Expr> OMPArrayShapingExpr::Dimensions(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPArrayShapingExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 OMPCanonicalLoop::OMPCanonicalLoop(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -6680,6 +9231,13 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPCanonicalLoop::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CapturedStmt OMPCanonicalLoop::DistanceFunc(void) const noexcept {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.getDistanceFunc();
@@ -6690,6 +9248,16 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPCanonicalLoop::DistanceFuncRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getDistanceFunc();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPCanonicalLoop::DistanceFuncRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPCanonicalLoop::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.getEndLoc();
@@ -6697,6 +9265,13 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPCanonicalLoop::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt OMPCanonicalLoop::LoopStatement(void) const noexcept {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.getLoopStmt();
@@ -6707,6 +9282,16 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPCanonicalLoop::LoopStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getLoopStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPCanonicalLoop::LoopStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::CapturedStmt OMPCanonicalLoop::LoopVariableFunc(void) const noexcept {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.getLoopVarFunc();
@@ -6717,6 +9302,16 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPCanonicalLoop::LoopVariableFuncRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getLoopVarFunc();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPCanonicalLoop::LoopVariableFuncRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::DeclRefExpr OMPCanonicalLoop::LoopVariableReference(void) const noexcept {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.getLoopVarRef();
@@ -6727,6 +9322,16 @@ std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPCanonicalLoop::LoopVariableReferenceRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
+  decltype(auto) val = self.getLoopVarRef();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPCanonicalLoop::LoopVariableReferenceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPExecutableDirective::OMPExecutableDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -6830,6 +9435,16 @@ std::vector<::pasta::Stmt> OMPExecutableDirective::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPExecutableDirective::AssociatedStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getAssociatedStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPExecutableDirective::AssociatedStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPExecutableDirective::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.getBeginLoc();
@@ -6837,6 +9452,13 @@ std::vector<::pasta::Stmt> OMPExecutableDirective::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPExecutableDirective::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OMPExecutableDirective::CapturedStatement
 // 1: OMPExecutableDirective::Clause
 // 0: OMPExecutableDirective::DirectiveKind
@@ -6847,6 +9469,13 @@ std::vector<::pasta::Stmt> OMPExecutableDirective::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPExecutableDirective::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CapturedStmt OMPExecutableDirective::InnermostCapturedStatement(void) const noexcept {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.getInnermostCapturedStmt();
@@ -6857,6 +9486,16 @@ std::vector<::pasta::Stmt> OMPExecutableDirective::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPExecutableDirective::InnermostCapturedStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getInnermostCapturedStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPExecutableDirective::InnermostCapturedStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t OMPExecutableDirective::NumClauses(void) const noexcept {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.getNumClauses();
@@ -6874,6 +9513,16 @@ uint32_t OMPExecutableDirective::NumClauses(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPExecutableDirective::RawStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getRawStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPExecutableDirective::RawStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt OMPExecutableDirective::StructuredBlock(void) const noexcept {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.getStructuredBlock();
@@ -6884,6 +9533,16 @@ uint32_t OMPExecutableDirective::NumClauses(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPExecutableDirective::StructuredBlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
+  decltype(auto) val = self.getStructuredBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPExecutableDirective::StructuredBlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPExecutableDirective::HasAssociatedStatement(void) const noexcept {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.hasAssociatedStmt();
@@ -6941,6 +9600,13 @@ std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPIteratorExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OMPIteratorExpr::ColonToken
 ::pasta::Token OMPIteratorExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
@@ -6949,6 +9615,13 @@ std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPIteratorExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OMPIteratorExpr::Helper
 // 1: OMPIteratorExpr::IteratorDeclaration
 ::pasta::Token OMPIteratorExpr::IteratorKwToken(void) const noexcept {
@@ -6958,6 +9631,13 @@ std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPIteratorExpr::IteratorKwTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
+  decltype(auto) val = self.getIteratorKwLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OMPIteratorExpr::IteratorRange
 ::pasta::Token OMPIteratorExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
@@ -6966,6 +9646,13 @@ std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPIteratorExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OMPIteratorExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -6973,6 +9660,13 @@ std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPIteratorExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OMPIteratorExpr::SecondColonToken
 uint32_t OMPIteratorExpr::NumOfIterators(void) const noexcept {
   auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
@@ -7152,6 +9846,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CalculateLastIteration(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCalcLastIteration();
@@ -7162,6 +9866,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CalculateLastIterationRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCalcLastIteration();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CalculateLastIterationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedCondition(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedCond();
@@ -7172,6 +9886,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedDistanceCondition(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedDistCond();
@@ -7182,6 +9906,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedDistanceConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedDistCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedDistanceConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedEnsureUpperBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedEnsureUpperBound();
@@ -7192,6 +9926,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedEnsureUpperBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedEnsureUpperBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedEnsureUpperBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedInitializer(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedInit();
@@ -7202,6 +9946,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedInitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedInitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedLowerBoundVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedLowerBoundVariable();
@@ -7212,6 +9966,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedLowerBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedLowerBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedLowerBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedNextLowerBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedNextLowerBound();
@@ -7222,6 +9986,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedNextLowerBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedNextLowerBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedNextLowerBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedNextUpperBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedNextUpperBound();
@@ -7232,13 +10006,33 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedNextUpperBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedNextUpperBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedNextUpperBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::CombinedParallelForInDistanceCondition(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCombinedParForInDistCond();
   if (val) {
     return StmtBuilder::Create<::pasta::Expr>(ast, val);
   }
-  assert(false && "OMPLoopDirective::CombinedParallelForInDistanceCondition can return nullptr!");
+  assert(false && "OMPLoopDirective::CombinedParallelForInDistanceCondition can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef OMPLoopDirective::CombinedParallelForInDistanceConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedParForInDistCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedParallelForInDistanceConditionRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -7252,6 +10046,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::CombinedUpperBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCombinedUpperBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::CombinedUpperBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::Condition(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getCond();
@@ -7262,6 +10066,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::DistanceIncrement(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getDistInc();
@@ -7272,6 +10086,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::DistanceIncrementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getDistInc();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::DistanceIncrementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::EnsureUpperBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getEnsureUpperBound();
@@ -7282,6 +10106,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::EnsureUpperBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getEnsureUpperBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::EnsureUpperBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::Increment(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getInc();
@@ -7292,6 +10126,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::IncrementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getInc();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::IncrementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getInit();
@@ -7302,6 +10146,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::InitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::IsLastIterationVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getIsLastIterVariable();
@@ -7312,6 +10166,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::IsLastIterationVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getIsLastIterVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::IsLastIterationVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::IterationVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getIterationVariable();
@@ -7322,6 +10186,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::IterationVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getIterationVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::IterationVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::LastIteration(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getLastIteration();
@@ -7332,6 +10206,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::LastIterationRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getLastIteration();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::LastIterationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::LowerBoundVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getLowerBoundVariable();
@@ -7342,6 +10226,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::LowerBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getLowerBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::LowerBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::NextLowerBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getNextLowerBound();
@@ -7352,6 +10246,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::NextLowerBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getNextLowerBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::NextLowerBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::NextUpperBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getNextUpperBound();
@@ -7362,6 +10266,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::NextUpperBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getNextUpperBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::NextUpperBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::NumIterations(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getNumIterations();
@@ -7372,6 +10286,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::NumIterationsRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getNumIterations();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::NumIterationsRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::PreCondition(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getPreCond();
@@ -7382,6 +10306,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::PreConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getPreCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::PreConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt OMPLoopDirective::PreInitializers(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getPreInits();
@@ -7392,6 +10326,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::PreInitializersRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getPreInits();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::PreInitializersRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::PrevEnsureUpperBound(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getPrevEnsureUpperBound();
@@ -7402,6 +10346,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::PrevEnsureUpperBoundRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getPrevEnsureUpperBound();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::PrevEnsureUpperBoundRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::PrevLowerBoundVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getPrevLowerBoundVariable();
@@ -7412,6 +10366,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::PrevLowerBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getPrevLowerBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::PrevLowerBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::PrevUpperBoundVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getPrevUpperBoundVariable();
@@ -7422,6 +10386,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::PrevUpperBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getPrevUpperBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::PrevUpperBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::StrideVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getStrideVariable();
@@ -7432,6 +10406,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::StrideVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getStrideVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::StrideVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPLoopDirective::UpperBoundVariable(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.getUpperBoundVariable();
@@ -7442,6 +10426,16 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopDirective::UpperBoundVariableRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
+  decltype(auto) val = self.getUpperBoundVariable();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopDirective::UpperBoundVariableRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> OMPLoopDirective::Initializers(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.inits();
@@ -7508,6 +10502,16 @@ uint32_t OMPLoopTransformationDirective::NumAssociatedLoops(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopTransformationDirective::PreInitializersRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopTransformationDirective *>(u.OMPLoopTransformationDirective);
+  decltype(auto) val = self.getPreInits();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopTransformationDirective::PreInitializersRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt OMPLoopTransformationDirective::TransformedStatement(void) const noexcept {
   auto &self = *const_cast<clang::OMPLoopTransformationDirective *>(u.OMPLoopTransformationDirective);
   decltype(auto) val = self.getTransformedStmt();
@@ -7518,6 +10522,16 @@ uint32_t OMPLoopTransformationDirective::NumAssociatedLoops(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPLoopTransformationDirective::TransformedStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPLoopTransformationDirective *>(u.OMPLoopTransformationDirective);
+  decltype(auto) val = self.getTransformedStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPLoopTransformationDirective::TransformedStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPMaskedDirective::OMPMaskedDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -7599,6 +10613,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPMetaDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPMetaDirective::IfStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPMetaDirective *>(u.OMPMetaDirective);
+  decltype(auto) val = self.getIfStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPMetaDirective::IfStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPOrderedDirective::OMPOrderedDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -7623,6 +10647,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPParallelDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPParallelDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPParallelDirective *>(u.OMPParallelDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPParallelDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPParallelDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPParallelDirective *>(u.OMPParallelDirective);
   decltype(auto) val = self.hasCancel();
@@ -7649,6 +10683,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPParallelForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPParallelForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPParallelForDirective *>(u.OMPParallelForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPParallelForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPParallelForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPParallelForDirective *>(u.OMPParallelForDirective);
   decltype(auto) val = self.hasCancel();
@@ -7691,6 +10735,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPParallelMaskedDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPParallelMaskedDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPParallelMaskedDirective *>(u.OMPParallelMaskedDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPParallelMaskedDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPParallelMaskedTaskLoopDirective::OMPParallelMaskedTaskLoopDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -7733,6 +10787,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPParallelMasterDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPParallelMasterDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPParallelMasterDirective *>(u.OMPParallelMasterDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPParallelMasterDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPParallelMasterTaskLoopDirective::OMPParallelMasterTaskLoopDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -7775,6 +10839,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPParallelSectionsDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPParallelSectionsDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPParallelSectionsDirective *>(u.OMPParallelSectionsDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPParallelSectionsDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPParallelSectionsDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPParallelSectionsDirective *>(u.OMPParallelSectionsDirective);
   decltype(auto) val = self.hasCancel();
@@ -7820,6 +10894,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPSectionsDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPSectionsDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPSectionsDirective *>(u.OMPSectionsDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPSectionsDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPSectionsDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPSectionsDirective *>(u.OMPSectionsDirective);
   decltype(auto) val = self.hasCancel();
@@ -7888,6 +10972,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTargetParallelDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPTargetParallelDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTargetParallelDirective *>(u.OMPTargetParallelDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTargetParallelDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPTargetParallelDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPTargetParallelDirective *>(u.OMPTargetParallelDirective);
   decltype(auto) val = self.hasCancel();
@@ -7914,6 +11008,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTargetParallelForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPTargetParallelForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTargetParallelForDirective *>(u.OMPTargetParallelForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTargetParallelForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPTargetParallelForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPTargetParallelForDirective *>(u.OMPTargetParallelForDirective);
   decltype(auto) val = self.hasCancel();
@@ -7983,6 +11087,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTargetTeamsDistributeParallelForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPTargetTeamsDistributeParallelForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTargetTeamsDistributeParallelForDirective *>(u.OMPTargetTeamsDistributeParallelForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTargetTeamsDistributeParallelForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPTargetTeamsDistributeParallelForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPTargetTeamsDistributeParallelForDirective *>(u.OMPTargetTeamsDistributeParallelForDirective);
   decltype(auto) val = self.hasCancel();
@@ -8080,6 +11194,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTaskgroupDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPTaskgroupDirective::ReductionReferenceRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTaskgroupDirective *>(u.OMPTaskgroupDirective);
+  decltype(auto) val = self.getReductionRef();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTaskgroupDirective::ReductionReferenceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 OMPTaskwaitDirective::OMPTaskwaitDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8129,6 +11253,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTeamsDistributeParallelForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPTeamsDistributeParallelForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTeamsDistributeParallelForDirective *>(u.OMPTeamsDistributeParallelForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTeamsDistributeParallelForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPTeamsDistributeParallelForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPTeamsDistributeParallelForDirective *>(u.OMPTeamsDistributeParallelForDirective);
   decltype(auto) val = self.hasCancel();
@@ -8178,17 +11312,37 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPTileDirective)
   if (val) {
     return StmtBuilder::Create<::pasta::Stmt>(ast, val);
   }
-  assert(false && "OMPTileDirective::PreInitializers can return nullptr!");
+  assert(false && "OMPTileDirective::PreInitializers can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef OMPTileDirective::PreInitializersRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTileDirective *>(u.OMPTileDirective);
+  decltype(auto) val = self.getPreInits();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPTileDirective::PreInitializersRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::Stmt OMPTileDirective::TransformedStatement(void) const noexcept {
+  auto &self = *const_cast<clang::OMPTileDirective *>(u.OMPTileDirective);
+  decltype(auto) val = self.getTransformedStmt();
+  if (val) {
+    return StmtBuilder::Create<::pasta::Stmt>(ast, val);
+  }
+  assert(false && "OMPTileDirective::TransformedStatement can return nullptr!");
   __builtin_unreachable();
 }
 
-::pasta::Stmt OMPTileDirective::TransformedStatement(void) const noexcept {
+::pasta::StmtRef OMPTileDirective::TransformedStatementRef(void) const noexcept {
   auto &self = *const_cast<clang::OMPTileDirective *>(u.OMPTileDirective);
   decltype(auto) val = self.getTransformedStmt();
   if (val) {
-    return StmtBuilder::Create<::pasta::Stmt>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "OMPTileDirective::TransformedStatement can return nullptr!");
+  assert(false && "OMPTileDirective::TransformedStatementRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -8211,6 +11365,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPUnrollDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPUnrollDirective::PreInitializersRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPUnrollDirective *>(u.OMPUnrollDirective);
+  decltype(auto) val = self.getPreInits();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPUnrollDirective::PreInitializersRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt OMPUnrollDirective::TransformedStatement(void) const noexcept {
   auto &self = *const_cast<clang::OMPUnrollDirective *>(u.OMPUnrollDirective);
   decltype(auto) val = self.getTransformedStmt();
@@ -8221,6 +11385,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPUnrollDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPUnrollDirective::TransformedStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPUnrollDirective *>(u.OMPUnrollDirective);
+  decltype(auto) val = self.getTransformedStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPUnrollDirective::TransformedStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCArrayLiteral::ObjCArrayLiteral(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8252,6 +11426,16 @@ std::vector<::pasta::Stmt> ObjCArrayLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCArrayLiteral::ArrayWithObjectsMethodRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
+  decltype(auto) val = self.getArrayWithObjectsMethod();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCArrayLiteral::ArrayWithObjectsMethodRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCArrayLiteral::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
   decltype(auto) val = self.getBeginLoc();
@@ -8259,6 +11443,13 @@ std::vector<::pasta::Stmt> ObjCArrayLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCArrayLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCArrayLiteral::Element
 // 0: ObjCArrayLiteral::Elements
 ::pasta::Token ObjCArrayLiteral::EndToken(void) const noexcept {
@@ -8268,6 +11459,13 @@ std::vector<::pasta::Stmt> ObjCArrayLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCArrayLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ObjCArrayLiteral::NumElements(void) const noexcept {
   auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
   decltype(auto) val = self.getNumElements();
@@ -8282,6 +11480,13 @@ uint32_t ObjCArrayLiteral::NumElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCArrayLiteral::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> ObjCArrayLiteral::Elements(void) const noexcept {
   std::vector<::pasta::Expr> ret;
   auto convert_elem = [&] (const clang::Expr * val) {
@@ -8324,6 +11529,13 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtCatchStmt::AtCatchTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getAtCatchLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtCatchStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -8331,6 +11543,13 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtCatchStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ObjCAtCatchStmt::CatchBody(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.getCatchBody();
@@ -8341,6 +11560,16 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtCatchStmt::CatchBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getCatchBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtCatchStmt::CatchBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::VarDecl ObjCAtCatchStmt::CatchParameterDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.getCatchParamDecl();
@@ -8351,6 +11580,16 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCAtCatchStmt::CatchParameterDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getCatchParamDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtCatchStmt::CatchParameterDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtCatchStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.getEndLoc();
@@ -8358,6 +11597,13 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtCatchStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtCatchStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -8365,6 +11611,13 @@ std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtCatchStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCAtCatchStmt::HasEllipsis(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.hasEllipsis();
@@ -8398,6 +11651,13 @@ std::vector<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtFinallyStmt::AtFinallyTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
+  decltype(auto) val = self.getAtFinallyLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtFinallyStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -8405,6 +11665,13 @@ std::vector<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtFinallyStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtFinallyStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
   decltype(auto) val = self.getEndLoc();
@@ -8412,6 +11679,13 @@ std::vector<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtFinallyStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ObjCAtFinallyStmt::FinallyBody(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
   decltype(auto) val = self.getFinallyBody();
@@ -8422,6 +11696,16 @@ std::vector<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtFinallyStmt::FinallyBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
+  decltype(auto) val = self.getFinallyBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtFinallyStmt::FinallyBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCAtSynchronizedStmt::ObjCAtSynchronizedStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8448,6 +11732,13 @@ std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtSynchronizedStmt::AtSynchronizedTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
+  decltype(auto) val = self.getAtSynchronizedLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtSynchronizedStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -8455,6 +11746,13 @@ std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtSynchronizedStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtSynchronizedStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
   decltype(auto) val = self.getEndLoc();
@@ -8462,6 +11760,13 @@ std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtSynchronizedStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt ObjCAtSynchronizedStmt::SynchBody(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
   decltype(auto) val = self.getSynchBody();
@@ -8472,6 +11777,16 @@ std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtSynchronizedStmt::SynchBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
+  decltype(auto) val = self.getSynchBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtSynchronizedStmt::SynchBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCAtSynchronizedStmt::SynchExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
   decltype(auto) val = self.getSynchExpr();
@@ -8482,6 +11797,16 @@ std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtSynchronizedStmt::SynchExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
+  decltype(auto) val = self.getSynchExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtSynchronizedStmt::SynchExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCAtThrowStmt::ObjCAtThrowStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8508,6 +11833,13 @@ std::vector<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtThrowStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtThrowStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
   decltype(auto) val = self.getEndLoc();
@@ -8515,6 +11847,13 @@ std::vector<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtThrowStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCAtThrowStmt::ThrowExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
   decltype(auto) val = self.getThrowExpr();
@@ -8525,6 +11864,16 @@ std::vector<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtThrowStmt::ThrowExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
+  decltype(auto) val = self.getThrowExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtThrowStmt::ThrowExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtThrowStmt::ThrowToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
   decltype(auto) val = self.getThrowLoc();
@@ -8532,6 +11881,13 @@ std::vector<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtThrowStmt::ThrowTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
+  decltype(auto) val = self.getThrowLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCAtTryStmt::ObjCAtTryStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8561,6 +11917,13 @@ std::vector<::pasta::Stmt> ObjCAtTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtTryStmt::AtTryTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
+  decltype(auto) val = self.getAtTryLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAtTryStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -8568,6 +11931,13 @@ std::vector<::pasta::Stmt> ObjCAtTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtTryStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCAtTryStmt::CatchStatement
 ::pasta::Token ObjCAtTryStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
@@ -8576,6 +11946,13 @@ std::vector<::pasta::Stmt> ObjCAtTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAtTryStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCAtFinallyStmt ObjCAtTryStmt::FinallyStatement(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
   decltype(auto) val = self.getFinallyStmt();
@@ -8586,6 +11963,16 @@ std::vector<::pasta::Stmt> ObjCAtTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtTryStmt::FinallyStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
+  decltype(auto) val = self.getFinallyStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtTryStmt::FinallyStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t ObjCAtTryStmt::NumCatchStatements(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
   decltype(auto) val = self.getNumCatchStmts();
@@ -8603,6 +11990,16 @@ uint32_t ObjCAtTryStmt::NumCatchStatements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAtTryStmt::TryBodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
+  decltype(auto) val = self.getTryBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAtTryStmt::TryBodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::ObjCAtCatchStmt> ObjCAtTryStmt::CatchStatements(void) const noexcept {
   std::vector<::pasta::ObjCAtCatchStmt> ret;
   auto convert_elem = [&] (const clang::ObjCAtCatchStmt * val) {
@@ -8645,6 +12042,13 @@ std::vector<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAutoreleasePoolStmt::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAutoreleasePoolStmt::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
   decltype(auto) val = self.getBeginLoc();
@@ -8652,6 +12056,13 @@ std::vector<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAutoreleasePoolStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAutoreleasePoolStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
   decltype(auto) val = self.getEndLoc();
@@ -8659,6 +12070,13 @@ std::vector<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAutoreleasePoolStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ObjCAutoreleasePoolStmt::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
   decltype(auto) val = self.getSubStmt();
@@ -8669,6 +12087,16 @@ std::vector<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCAutoreleasePoolStmt::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCAutoreleasePoolStmt::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCAvailabilityCheckExpr::ObjCAvailabilityCheckExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8697,6 +12125,13 @@ std::vector<::pasta::Stmt> ObjCAvailabilityCheckExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAvailabilityCheckExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCAvailabilityCheckExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
   decltype(auto) val = self.getEndLoc();
@@ -8704,6 +12139,13 @@ std::vector<::pasta::Stmt> ObjCAvailabilityCheckExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCAvailabilityCheckExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange ObjCAvailabilityCheckExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
   decltype(auto) val = self.getSourceRange();
@@ -8711,6 +12153,13 @@ std::vector<::pasta::Stmt> ObjCAvailabilityCheckExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCAvailabilityCheckExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCAvailabilityCheckExpr::Version
 bool ObjCAvailabilityCheckExpr::HasVersion(void) const noexcept {
   auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
@@ -8747,6 +12196,13 @@ std::vector<::pasta::Stmt> ObjCBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBoolLiteralExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBoolLiteralExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
   decltype(auto) val = self.getEndLoc();
@@ -8754,6 +12210,13 @@ std::vector<::pasta::Stmt> ObjCBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBoolLiteralExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBoolLiteralExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
   decltype(auto) val = self.getLocation();
@@ -8761,6 +12224,13 @@ std::vector<::pasta::Stmt> ObjCBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBoolLiteralExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCBoolLiteralExpr::Value(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
   decltype(auto) val = self.getValue();
@@ -8798,6 +12268,13 @@ std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBoxedExpr::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBoxedExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -8805,6 +12282,13 @@ std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBoxedExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCBoxedExpr::BoxingMethod(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.getBoxingMethod();
@@ -8815,6 +12299,16 @@ std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCBoxedExpr::BoxingMethodRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getBoxingMethod();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCBoxedExpr::BoxingMethodRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBoxedExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.getEndLoc();
@@ -8822,10 +12316,24 @@ std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::TokenRange ObjCBoxedExpr::Tokens(void) const noexcept {
+::pasta::TokenRef ObjCBoxedExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRange ObjCBoxedExpr::Tokens(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getSourceRange();
+  return ast->TokenRangeFrom(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRefRange ObjCBoxedExpr::TokensRef(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.getSourceRange();
-  return ast->TokenRangeFrom(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -8839,6 +12347,16 @@ std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCBoxedExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCBoxedExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCBoxedExpr::IsExpressibleAsConstantInitializer(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.isExpressibleAsConstantInitializer();
@@ -8874,6 +12392,13 @@ std::vector<::pasta::Stmt> ObjCDictionaryLiteral::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCDictionaryLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCDictionaryLiteral::DictionaryWithObjectsMethod(void) const noexcept {
   auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
   decltype(auto) val = self.getDictWithObjectsMethod();
@@ -8884,6 +12409,16 @@ std::vector<::pasta::Stmt> ObjCDictionaryLiteral::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCDictionaryLiteral::DictionaryWithObjectsMethodRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
+  decltype(auto) val = self.getDictWithObjectsMethod();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCDictionaryLiteral::DictionaryWithObjectsMethodRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCDictionaryLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -8891,6 +12426,13 @@ std::vector<::pasta::Stmt> ObjCDictionaryLiteral::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCDictionaryLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCDictionaryLiteral::KeyValueElement
 uint32_t ObjCDictionaryLiteral::NumElements(void) const noexcept {
   auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
@@ -8906,6 +12448,13 @@ uint32_t ObjCDictionaryLiteral::NumElements(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCDictionaryLiteral::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCEncodeExpr::ObjCEncodeExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8934,6 +12483,13 @@ std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCEncodeExpr::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCEncodeExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -8941,6 +12497,13 @@ std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCEncodeExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCEncodeExpr::EncodedType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
   decltype(auto) val = self.getEncodedType();
@@ -8949,6 +12512,14 @@ std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCEncodeExpr::EncodedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
+  decltype(auto) val = self.getEncodedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCEncodeExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
   decltype(auto) val = self.getEndLoc();
@@ -8956,6 +12527,13 @@ std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCEncodeExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCEncodeExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -8963,6 +12541,13 @@ std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCEncodeExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCForCollectionStmt::ObjCForCollectionStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -8989,6 +12574,13 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCForCollectionStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ObjCForCollectionStmt::Body(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getBody();
@@ -8999,6 +12591,16 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCForCollectionStmt::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCForCollectionStmt::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCForCollectionStmt::Collection(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getCollection();
@@ -9009,6 +12611,16 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCForCollectionStmt::CollectionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getCollection();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCForCollectionStmt::CollectionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt ObjCForCollectionStmt::Element(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getElement();
@@ -9019,6 +12631,16 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCForCollectionStmt::ElementRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getElement();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCForCollectionStmt::ElementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCForCollectionStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getEndLoc();
@@ -9026,6 +12648,13 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCForCollectionStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCForCollectionStmt::ForToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getForLoc();
@@ -9033,6 +12662,13 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCForCollectionStmt::ForTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getForLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCForCollectionStmt::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.getRParenLoc();
@@ -9040,6 +12676,13 @@ std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCForCollectionStmt::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCIndirectCopyRestoreExpr::ObjCIndirectCopyRestoreExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -9068,6 +12711,13 @@ std::vector<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIndirectCopyRestoreExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIndirectCopyRestoreExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9075,6 +12725,13 @@ std::vector<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIndirectCopyRestoreExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIndirectCopyRestoreExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
   decltype(auto) val = self.getExprLoc();
@@ -9082,6 +12739,13 @@ std::vector<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIndirectCopyRestoreExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCIndirectCopyRestoreExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
   decltype(auto) val = self.getSubExpr();
@@ -9092,6 +12756,16 @@ std::vector<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCIndirectCopyRestoreExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIndirectCopyRestoreExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCIndirectCopyRestoreExpr::ShouldCopy(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
   decltype(auto) val = self.shouldCopy();
@@ -9130,6 +12804,16 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCIsaExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIsaExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::BaseTokenEnd(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getBaseLocEnd();
@@ -9137,6 +12821,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::BaseTokenEndRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getBaseLocEnd();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9144,6 +12835,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9151,6 +12849,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getExprLoc();
@@ -9158,6 +12863,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::IsaMemberToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getIsaMemberLoc();
@@ -9165,6 +12877,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::IsaMemberTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getIsaMemberLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIsaExpr::OperationToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.getOpLoc();
@@ -9172,6 +12891,13 @@ std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIsaExpr::OperationTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
+  decltype(auto) val = self.getOpLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCIsaExpr::IsArrow(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.isArrow();
@@ -9210,6 +12936,16 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCIvarRefExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIvarRefExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIvarRefExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9217,6 +12953,13 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIvarRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCIvarDecl ObjCIvarRefExpr::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.getDecl();
@@ -9227,6 +12970,16 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCIvarRefExpr::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCIvarRefExpr::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIvarRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9234,6 +12987,13 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIvarRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIvarRefExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.getLocation();
@@ -9241,6 +13001,13 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIvarRefExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCIvarRefExpr::OperationToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.getOpLoc();
@@ -9248,6 +13015,13 @@ std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCIvarRefExpr::OperationTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
+  decltype(auto) val = self.getOpLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCIvarRefExpr::IsArrow(void) const noexcept {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.isArrow();
@@ -9307,6 +13081,13 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMessageExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCMessageExpr::CallReturnType(void) const noexcept {
   auto &self = *(u.ObjCMessageExpr);
   decltype(auto) val = self.getCallReturnType(ast->ci->getASTContext());
@@ -9323,6 +13104,14 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCMessageExpr::ClassReceiverRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getClassReceiver();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCMessageExpr::ClassReceiverType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getClassReceiverTypeInfo();
@@ -9338,6 +13127,13 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMessageExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCMessageExpr::InstanceReceiver(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getInstanceReceiver();
@@ -9348,6 +13144,16 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCMessageExpr::InstanceReceiverRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getInstanceReceiver();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMessageExpr::InstanceReceiverRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCMessageExpr::LeftToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getLeftLoc();
@@ -9355,6 +13161,13 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMessageExpr::LeftTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getLeftLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCMessageExpr::MethodDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getMethodDecl();
@@ -9365,6 +13178,16 @@ std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMessageExpr::MethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMessageExpr::MethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ObjCMethodFamily ObjCMessageExpr::MethodFamily(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getMethodFamily();
@@ -9396,6 +13219,16 @@ uint32_t ObjCMessageExpr::NumSelectorTokens(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCMessageExpr::ReceiverInterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getReceiverInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCMessageExpr::ReceiverInterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getReceiverKind();
@@ -9410,6 +13243,13 @@ enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange ObjCMessageExpr::ReceiverRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getReceiverRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCMessageExpr::ReceiverType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getReceiverType();
@@ -9418,6 +13258,14 @@ enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCMessageExpr::ReceiverTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getReceiverType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCMessageExpr::RightToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getRightLoc();
@@ -9425,12 +13273,26 @@ enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMessageExpr::RightTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getRightLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCMessageExpr::Selector
 // 1: ObjCMessageExpr::SelectorToken
 ::pasta::Token ObjCMessageExpr::SelectorStartToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getSelectorStartLoc();
-  return ast->TokenAt(val);
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef ObjCMessageExpr::SelectorStartTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getSelectorStartLoc();
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -9441,6 +13303,13 @@ enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCMessageExpr::SuperTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getSuperLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCMessageExpr::SuperType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.getSuperType();
@@ -9449,6 +13318,14 @@ enum ObjCMessageExprReceiverKind ObjCMessageExpr::ReceiverKind(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCMessageExpr::SuperTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
+  decltype(auto) val = self.getSuperType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCMessageExpr::IsClassMessage(void) const noexcept {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.isClassMessage();
@@ -9521,6 +13398,16 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCPropertyRefExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyRefExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyRefExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9528,6 +13415,13 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCPropertyRefExpr::ClassReceiver(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getClassReceiver();
@@ -9538,6 +13432,16 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyRefExpr::ClassReceiverRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getClassReceiver();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyRefExpr::ClassReceiverRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9545,6 +13449,13 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCPropertyDecl ObjCPropertyRefExpr::ExplicitProperty(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getExplicitProperty();
@@ -9555,6 +13466,16 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyRefExpr::ExplicitPropertyRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getExplicitProperty();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyRefExpr::ExplicitPropertyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ObjCPropertyRefExpr::GetterSelector
 ::pasta::ObjCMethodDecl ObjCPropertyRefExpr::ImplicitPropertyGetter(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
@@ -9566,6 +13487,16 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyRefExpr::ImplicitPropertyGetterRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getImplicitPropertyGetter();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyRefExpr::ImplicitPropertyGetterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCMethodDecl ObjCPropertyRefExpr::ImplicitPropertySetter(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getImplicitPropertySetter();
@@ -9576,6 +13507,16 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCPropertyRefExpr::ImplicitPropertySetterRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getImplicitPropertySetter();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCPropertyRefExpr::ImplicitPropertySetterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyRefExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getLocation();
@@ -9583,6 +13524,13 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyRefExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCPropertyRefExpr::ReceiverToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getReceiverLocation();
@@ -9590,6 +13538,13 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCPropertyRefExpr::ReceiverTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getReceiverLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCPropertyRefExpr::ReceiverType(void) const noexcept {
   auto &self = *(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.getReceiverType(ast->ci->getASTContext());
@@ -9607,6 +13562,14 @@ std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCPropertyRefExpr::SuperReceiverTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
+  decltype(auto) val = self.getSuperReceiverType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCPropertyRefExpr::IsClassReceiver(void) const noexcept {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.isClassReceiver();
@@ -9684,6 +13647,13 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCProtocolExpr::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCProtocolExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9691,6 +13661,13 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCProtocolExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCProtocolExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9698,6 +13675,13 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCProtocolExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCProtocolDecl ObjCProtocolExpr::Protocol(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.getProtocol();
@@ -9708,6 +13692,16 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCProtocolExpr::ProtocolRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getProtocol();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCProtocolExpr::ProtocolRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCProtocolExpr::ProtocolIdToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.getProtocolIdLoc();
@@ -9715,6 +13709,13 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCProtocolExpr::ProtocolIdTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getProtocolIdLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCProtocolExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -9722,6 +13723,13 @@ std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCProtocolExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ObjCSelectorExpr::ObjCSelectorExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -9750,6 +13758,13 @@ std::vector<::pasta::Stmt> ObjCSelectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSelectorExpr::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCSelectorExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9757,6 +13772,13 @@ std::vector<::pasta::Stmt> ObjCSelectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSelectorExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCSelectorExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9764,6 +13786,13 @@ std::vector<::pasta::Stmt> ObjCSelectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSelectorExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ObjCSelectorExpr::NumArguments(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
   decltype(auto) val = self.getNumArgs();
@@ -9778,6 +13807,13 @@ uint32_t ObjCSelectorExpr::NumArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSelectorExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ObjCSelectorExpr::Selector
 ObjCStringLiteral::ObjCStringLiteral(
     std::shared_ptr<ASTImpl> ast_,
@@ -9807,6 +13843,13 @@ std::vector<::pasta::Stmt> ObjCStringLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCStringLiteral::AtTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
+  decltype(auto) val = self.getAtLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCStringLiteral::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
   decltype(auto) val = self.getBeginLoc();
@@ -9814,6 +13857,13 @@ std::vector<::pasta::Stmt> ObjCStringLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCStringLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCStringLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -9821,6 +13871,13 @@ std::vector<::pasta::Stmt> ObjCStringLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCStringLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::StringLiteral ObjCStringLiteral::String(void) const noexcept {
   auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
   decltype(auto) val = self.getString();
@@ -9831,6 +13888,16 @@ std::vector<::pasta::Stmt> ObjCStringLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCStringLiteral::StringRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
+  decltype(auto) val = self.getString();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCStringLiteral::StringRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ObjCSubscriptRefExpr::ObjCSubscriptRefExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -9862,6 +13929,16 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCSubscriptRefExpr::AtIndexMethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getAtIndexMethodDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCSubscriptRefExpr::AtIndexMethodDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCSubscriptRefExpr::BaseExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.getBaseExpr();
@@ -9872,6 +13949,16 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCSubscriptRefExpr::BaseExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getBaseExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCSubscriptRefExpr::BaseExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCSubscriptRefExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -9879,6 +13966,13 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSubscriptRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCSubscriptRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.getEndLoc();
@@ -9886,6 +13980,13 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSubscriptRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ObjCSubscriptRefExpr::KeyExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.getKeyExpr();
@@ -9896,6 +13997,16 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ObjCSubscriptRefExpr::KeyExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getKeyExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCSubscriptRefExpr::KeyExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCSubscriptRefExpr::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.getRBracket();
@@ -9903,6 +14014,13 @@ std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCSubscriptRefExpr::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
+  decltype(auto) val = self.getRBracket();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ObjCSubscriptRefExpr::IsArraySubscriptReferenceExpression(void) const noexcept {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.isArraySubscriptRefExpr();
@@ -9938,6 +14056,13 @@ std::vector<::pasta::Stmt> OffsetOfExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OffsetOfExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OffsetOfExpr::Component
 ::pasta::Token OffsetOfExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
@@ -9946,6 +14071,13 @@ std::vector<::pasta::Stmt> OffsetOfExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OffsetOfExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: OffsetOfExpr::IndexExpression
 uint32_t OffsetOfExpr::NumComponents(void) const noexcept {
   auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
@@ -9968,6 +14100,13 @@ uint32_t OffsetOfExpr::NumExpressions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OffsetOfExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OffsetOfExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -9975,6 +14114,13 @@ uint32_t OffsetOfExpr::NumExpressions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OffsetOfExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: OffsetOfExpr::
 OpaqueValueExpr::OpaqueValueExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -10004,6 +14150,13 @@ std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OpaqueValueExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OpaqueValueExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10011,6 +14164,13 @@ std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OpaqueValueExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OpaqueValueExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.getExprLoc();
@@ -10018,6 +14178,13 @@ std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OpaqueValueExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token OpaqueValueExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.getLocation();
@@ -10025,6 +14192,13 @@ std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OpaqueValueExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OpaqueValueExpr::SourceExpression(void) const noexcept {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.getSourceExpr();
@@ -10035,6 +14209,16 @@ std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OpaqueValueExpr::SourceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
+  decltype(auto) val = self.getSourceExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OpaqueValueExpr::SourceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OpaqueValueExpr::IsUnique(void) const noexcept {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.isUnique();
@@ -10062,6 +14246,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(OverloadExpr, UnresolvedMemberExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OverloadExpr::LAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
+  decltype(auto) val = self.getLAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: OverloadExpr::Name
 // 0: OverloadExpr::NameInfo
 ::pasta::Token OverloadExpr::NameToken(void) const noexcept {
@@ -10071,6 +14262,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(OverloadExpr, UnresolvedMemberExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OverloadExpr::NameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
+  decltype(auto) val = self.getNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> OverloadExpr::NamingClass(void) const noexcept {
   auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
   decltype(auto) val = self.getNamingClass();
@@ -10083,6 +14281,18 @@ std::optional<::pasta::CXXRecordDecl> OverloadExpr::NamingClass(void) const noex
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> OverloadExpr::NamingClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
+  decltype(auto) val = self.getNamingClass();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t OverloadExpr::NumDeclarations(void) const noexcept {
   auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
   decltype(auto) val = self.getNumDecls();
@@ -10102,7 +14312,14 @@ uint32_t OverloadExpr::NumTemplateArguments(void) const noexcept {
 ::pasta::Token OverloadExpr::RAngleToken(void) const noexcept {
   auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
   decltype(auto) val = self.getRAngleLoc();
-  return ast->TokenAt(val);
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef OverloadExpr::RAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
+  decltype(auto) val = self.getRAngleLoc();
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -10114,6 +14331,13 @@ uint32_t OverloadExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OverloadExpr::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool OverloadExpr::HasExplicitTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::OverloadExpr *>(u.OverloadExpr);
   decltype(auto) val = self.hasExplicitTemplateArgs();
@@ -10157,6 +14381,13 @@ std::vector<::pasta::Stmt> PackExpansionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PackExpansionExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token PackExpansionExpr::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
   decltype(auto) val = self.getEllipsisLoc();
@@ -10164,6 +14395,13 @@ std::vector<::pasta::Stmt> PackExpansionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PackExpansionExpr::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token PackExpansionExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10171,6 +14409,13 @@ std::vector<::pasta::Stmt> PackExpansionExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PackExpansionExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<unsigned> PackExpansionExpr::NumExpansions(void) const noexcept {
   auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
   decltype(auto) val = self.getNumExpansions();
@@ -10192,6 +14437,16 @@ std::optional<unsigned> PackExpansionExpr::NumExpansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef PackExpansionExpr::PatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
+  decltype(auto) val = self.getPattern();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "PackExpansionExpr::PatternRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ParenExpr::ParenExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10220,6 +14475,13 @@ std::vector<::pasta::Stmt> ParenExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ParenExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10227,6 +14489,13 @@ std::vector<::pasta::Stmt> ParenExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ParenExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
   decltype(auto) val = self.getLParen();
@@ -10234,6 +14503,13 @@ std::vector<::pasta::Stmt> ParenExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
+  decltype(auto) val = self.getLParen();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ParenExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
   decltype(auto) val = self.getRParen();
@@ -10241,6 +14517,13 @@ std::vector<::pasta::Stmt> ParenExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
+  decltype(auto) val = self.getRParen();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ParenExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
   decltype(auto) val = self.getSubExpr();
@@ -10251,6 +14534,16 @@ std::vector<::pasta::Stmt> ParenExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ParenExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ParenExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ParenListExpr::ParenListExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10279,6 +14572,13 @@ std::vector<::pasta::Stmt> ParenListExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenListExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ParenListExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10286,6 +14586,13 @@ std::vector<::pasta::Stmt> ParenListExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenListExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ParenListExpr::Expression
 ::pasta::Token ParenListExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
@@ -10294,6 +14601,13 @@ std::vector<::pasta::Stmt> ParenListExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenListExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ParenListExpr::NumExpressions(void) const noexcept {
   auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
   decltype(auto) val = self.getNumExprs();
@@ -10308,6 +14622,13 @@ uint32_t ParenListExpr::NumExpressions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ParenListExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> ParenListExpr::Expressions(void) const noexcept {
   std::vector<::pasta::Expr> ret;
   auto convert_elem = [&] (const clang::Expr * val) {
@@ -10352,6 +14673,13 @@ std::vector<::pasta::Stmt> PredefinedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PredefinedExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token PredefinedExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10359,6 +14687,13 @@ std::vector<::pasta::Stmt> PredefinedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PredefinedExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::StringLiteral PredefinedExpr::FunctionName(void) const noexcept {
   auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
   decltype(auto) val = self.getFunctionName();
@@ -10369,6 +14704,16 @@ std::vector<::pasta::Stmt> PredefinedExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef PredefinedExpr::FunctionNameRef(void) const noexcept {
+  auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
+  decltype(auto) val = self.getFunctionName();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "PredefinedExpr::FunctionNameRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum PredefinedExprIdentKind PredefinedExpr::IdentifierKind(void) const noexcept {
   auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
   decltype(auto) val = self.getIdentKind();
@@ -10394,6 +14739,13 @@ std::string_view PredefinedExpr::IdentifierKindName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PredefinedExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 PseudoObjectExpr::PseudoObjectExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10422,6 +14774,13 @@ std::vector<::pasta::Stmt> PseudoObjectExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PseudoObjectExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token PseudoObjectExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10429,6 +14788,13 @@ std::vector<::pasta::Stmt> PseudoObjectExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PseudoObjectExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token PseudoObjectExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.getExprLoc();
@@ -10436,6 +14802,13 @@ std::vector<::pasta::Stmt> PseudoObjectExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef PseudoObjectExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t PseudoObjectExpr::NumSemanticExpressions(void) const noexcept {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.getNumSemanticExprs();
@@ -10453,6 +14826,16 @@ uint32_t PseudoObjectExpr::NumSemanticExpressions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef PseudoObjectExpr::ResultExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
+  decltype(auto) val = self.getResultExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "PseudoObjectExpr::ResultExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t PseudoObjectExpr::ResultExpressionIndex(void) const noexcept {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.getResultExprIndex();
@@ -10471,6 +14854,16 @@ uint32_t PseudoObjectExpr::ResultExpressionIndex(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef PseudoObjectExpr::SyntacticFormRef(void) const noexcept {
+  auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
+  decltype(auto) val = self.getSyntacticForm();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "PseudoObjectExpr::SyntacticFormRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> PseudoObjectExpr::Semantics(void) const noexcept {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.semantics();
@@ -10517,6 +14910,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, RecoveryExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RecoveryExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecoveryExpr *>(u.RecoveryExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token RecoveryExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::RecoveryExpr *>(u.RecoveryExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10524,6 +14924,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, RecoveryExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RecoveryExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecoveryExpr *>(u.RecoveryExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> RecoveryExpr::SubExpressions(void) const noexcept {
   auto &self = *const_cast<clang::RecoveryExpr *>(u.RecoveryExpr);
   decltype(auto) val = self.subExpressions();
@@ -10565,6 +14972,13 @@ std::vector<::pasta::Stmt> RequiresExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RequiresExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::RequiresExprBodyDecl RequiresExpr::Body(void) const noexcept {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.getBody();
@@ -10575,6 +14989,16 @@ std::vector<::pasta::Stmt> RequiresExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef RequiresExpr::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "RequiresExpr::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token RequiresExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10582,6 +15006,13 @@ std::vector<::pasta::Stmt> RequiresExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RequiresExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::ParmVarDecl> RequiresExpr::LocalParameters(void) const noexcept {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.getLocalParameters();
@@ -10602,6 +15033,13 @@ std::vector<::pasta::ParmVarDecl> RequiresExpr::LocalParameters(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RequiresExpr::RBraceTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
+  decltype(auto) val = self.getRBraceLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: RequiresExpr::Requirements
 ::pasta::Token RequiresExpr::RequiresKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
@@ -10610,6 +15048,13 @@ std::vector<::pasta::ParmVarDecl> RequiresExpr::LocalParameters(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef RequiresExpr::RequiresKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
+  decltype(auto) val = self.getRequiresKWLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool RequiresExpr::IsSatisfied(void) const noexcept {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.isSatisfied();
@@ -10643,6 +15088,13 @@ std::vector<::pasta::Stmt> ReturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ReturnStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ReturnStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
   decltype(auto) val = self.getEndLoc();
@@ -10650,6 +15102,13 @@ std::vector<::pasta::Stmt> ReturnStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ReturnStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::VarDecl> ReturnStmt::NRVOCandidate(void) const noexcept {
   auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
   decltype(auto) val = self.getNRVOCandidate();
@@ -10662,6 +15121,18 @@ std::optional<::pasta::VarDecl> ReturnStmt::NRVOCandidate(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ReturnStmt::NRVOCandidateRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
+  decltype(auto) val = self.getNRVOCandidate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> ReturnStmt::ReturnValue(void) const noexcept {
   auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
   decltype(auto) val = self.getRetValue();
@@ -10674,6 +15145,18 @@ std::optional<::pasta::Expr> ReturnStmt::ReturnValue(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ReturnStmt::ReturnValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
+  decltype(auto) val = self.getRetValue();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token ReturnStmt::ReturnToken(void) const noexcept {
   auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
   decltype(auto) val = self.getReturnLoc();
@@ -10681,6 +15164,13 @@ std::optional<::pasta::Expr> ReturnStmt::ReturnValue(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ReturnStmt::ReturnTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
+  decltype(auto) val = self.getReturnLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 SEHExceptStmt::SEHExceptStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10707,6 +15197,13 @@ std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHExceptStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt SEHExceptStmt::Block(void) const noexcept {
   auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
   decltype(auto) val = self.getBlock();
@@ -10717,6 +15214,16 @@ std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHExceptStmt::BlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
+  decltype(auto) val = self.getBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHExceptStmt::BlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHExceptStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
   decltype(auto) val = self.getEndLoc();
@@ -10724,6 +15231,13 @@ std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHExceptStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHExceptStmt::ExceptToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
   decltype(auto) val = self.getExceptLoc();
@@ -10731,6 +15245,13 @@ std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHExceptStmt::ExceptTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
+  decltype(auto) val = self.getExceptLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr SEHExceptStmt::FilterExpression(void) const noexcept {
   auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
   decltype(auto) val = self.getFilterExpr();
@@ -10741,6 +15262,16 @@ std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHExceptStmt::FilterExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
+  decltype(auto) val = self.getFilterExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHExceptStmt::FilterExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 SEHFinallyStmt::SEHFinallyStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10767,6 +15298,13 @@ std::vector<::pasta::Stmt> SEHFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHFinallyStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt SEHFinallyStmt::Block(void) const noexcept {
   auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
   decltype(auto) val = self.getBlock();
@@ -10777,6 +15315,16 @@ std::vector<::pasta::Stmt> SEHFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHFinallyStmt::BlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
+  decltype(auto) val = self.getBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHFinallyStmt::BlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHFinallyStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
   decltype(auto) val = self.getEndLoc();
@@ -10784,6 +15332,13 @@ std::vector<::pasta::Stmt> SEHFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHFinallyStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHFinallyStmt::FinallyToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
   decltype(auto) val = self.getFinallyLoc();
@@ -10791,6 +15346,13 @@ std::vector<::pasta::Stmt> SEHFinallyStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHFinallyStmt::FinallyTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
+  decltype(auto) val = self.getFinallyLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 SEHLeaveStmt::SEHLeaveStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10810,10 +15372,17 @@ std::vector<::pasta::Stmt> SEHLeaveStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token SEHLeaveStmt::BeginToken(void) const noexcept {
+::pasta::Token SEHLeaveStmt::BeginToken(void) const noexcept {
+  auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef SEHLeaveStmt::BeginTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
   decltype(auto) val = self.getBeginLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -10824,6 +15393,13 @@ std::vector<::pasta::Stmt> SEHLeaveStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHLeaveStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHLeaveStmt::LeaveToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
   decltype(auto) val = self.getLeaveLoc();
@@ -10831,6 +15407,13 @@ std::vector<::pasta::Stmt> SEHLeaveStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHLeaveStmt::LeaveTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
+  decltype(auto) val = self.getLeaveLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 SEHTryStmt::SEHTryStmt(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10857,6 +15440,13 @@ std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHTryStmt::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHTryStmt::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getEndLoc();
@@ -10864,6 +15454,13 @@ std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHTryStmt::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::SEHExceptStmt SEHTryStmt::ExceptHandler(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getExceptHandler();
@@ -10874,6 +15471,16 @@ std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHTryStmt::ExceptHandlerRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getExceptHandler();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHTryStmt::ExceptHandlerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::SEHFinallyStmt SEHTryStmt::FinallyHandler(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getFinallyHandler();
@@ -10884,6 +15491,16 @@ std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHTryStmt::FinallyHandlerRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getFinallyHandler();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHTryStmt::FinallyHandlerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt SEHTryStmt::Handler(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getHandler();
@@ -10894,6 +15511,16 @@ std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHTryStmt::HandlerRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getHandler();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHTryStmt::HandlerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool SEHTryStmt::IsCXXTry(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getIsCXXTry();
@@ -10911,6 +15538,16 @@ bool SEHTryStmt::IsCXXTry(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SEHTryStmt::TryBlockRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getTryBlock();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SEHTryStmt::TryBlockRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token SEHTryStmt::TryToken(void) const noexcept {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.getTryLoc();
@@ -10918,6 +15555,13 @@ bool SEHTryStmt::IsCXXTry(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SEHTryStmt::TryTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
+  decltype(auto) val = self.getTryLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 SYCLUniqueStableNameExpr::SYCLUniqueStableNameExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -10953,6 +15597,13 @@ std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SYCLUniqueStableNameExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SYCLUniqueStableNameExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
   decltype(auto) val = self.getEndLoc();
@@ -10960,6 +15611,13 @@ std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SYCLUniqueStableNameExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SYCLUniqueStableNameExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
   decltype(auto) val = self.getLParenLocation();
@@ -10967,6 +15625,13 @@ std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SYCLUniqueStableNameExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
+  decltype(auto) val = self.getLParenLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SYCLUniqueStableNameExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
   decltype(auto) val = self.getLocation();
@@ -10974,6 +15639,13 @@ std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SYCLUniqueStableNameExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SYCLUniqueStableNameExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
   decltype(auto) val = self.getRParenLocation();
@@ -10981,6 +15653,13 @@ std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SYCLUniqueStableNameExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
+  decltype(auto) val = self.getRParenLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: SYCLUniqueStableNameExpr::
 ShuffleVectorExpr::ShuffleVectorExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -11010,6 +15689,13 @@ std::vector<::pasta::Stmt> ShuffleVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ShuffleVectorExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ShuffleVectorExpr::BuiltinToken(void) const noexcept {
   auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
   decltype(auto) val = self.getBuiltinLoc();
@@ -11017,6 +15703,13 @@ std::vector<::pasta::Stmt> ShuffleVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ShuffleVectorExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ShuffleVectorExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11024,6 +15717,13 @@ std::vector<::pasta::Stmt> ShuffleVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ShuffleVectorExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ShuffleVectorExpr::Expression
 uint32_t ShuffleVectorExpr::NumSubExpressions(void) const noexcept {
   auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
@@ -11039,6 +15739,13 @@ uint32_t ShuffleVectorExpr::NumSubExpressions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ShuffleVectorExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 2: ShuffleMaskIndex
 SizeOfPackExpr::SizeOfPackExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -11068,6 +15775,13 @@ std::vector<::pasta::Stmt> SizeOfPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SizeOfPackExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SizeOfPackExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11075,6 +15789,13 @@ std::vector<::pasta::Stmt> SizeOfPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SizeOfPackExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SizeOfPackExpr::OperatorToken(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   decltype(auto) val = self.getOperatorLoc();
@@ -11082,6 +15803,13 @@ std::vector<::pasta::Stmt> SizeOfPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SizeOfPackExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl SizeOfPackExpr::Pack(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   decltype(auto) val = self.getPack();
@@ -11092,6 +15820,16 @@ std::vector<::pasta::Stmt> SizeOfPackExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef SizeOfPackExpr::PackRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getPack();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SizeOfPackExpr::PackRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<uint32_t> SizeOfPackExpr::PackLength(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   if (self.isValueDependent()) {
@@ -11109,6 +15847,13 @@ std::optional<uint32_t> SizeOfPackExpr::PackLength(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SizeOfPackExpr::PackTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getPackLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<std::vector<::pasta::TemplateArgument>> SizeOfPackExpr::PartialArguments(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   if (!self.isPartiallySubstituted()) {
@@ -11130,6 +15875,13 @@ std::optional<std::vector<::pasta::TemplateArgument>> SizeOfPackExpr::PartialArg
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SizeOfPackExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool SizeOfPackExpr::IsPartiallySubstituted(void) const noexcept {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   decltype(auto) val = self.isPartiallySubstituted();
@@ -11166,6 +15918,13 @@ std::vector<::pasta::Stmt> SourceLocExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SourceLocExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string_view SourceLocExpr::BuiltinString(void) const noexcept {
   auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
   decltype(auto) val = self.getBuiltinStr();
@@ -11184,6 +15943,13 @@ std::string_view SourceLocExpr::BuiltinString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SourceLocExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum SourceLocExprIdentKind SourceLocExpr::IdentifierKind(void) const noexcept {
   auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
   decltype(auto) val = self.getIdentKind();
@@ -11198,6 +15964,13 @@ enum SourceLocExprIdentKind SourceLocExpr::IdentifierKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SourceLocExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::DeclContext SourceLocExpr::ParentContext(void) const noexcept {
   auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
   decltype(auto) val = self.getParentContext();
@@ -11243,6 +16016,13 @@ std::vector<::pasta::Stmt> StmtExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StmtExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token StmtExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11250,6 +16030,13 @@ std::vector<::pasta::Stmt> StmtExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StmtExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token StmtExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -11257,6 +16044,13 @@ std::vector<::pasta::Stmt> StmtExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StmtExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token StmtExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -11264,6 +16058,13 @@ std::vector<::pasta::Stmt> StmtExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StmtExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CompoundStmt StmtExpr::SubStatement(void) const noexcept {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.getSubStmt();
@@ -11274,6 +16075,16 @@ std::vector<::pasta::Stmt> StmtExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef StmtExpr::SubStatementRef(void) const noexcept {
+  auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
+  decltype(auto) val = self.getSubStmt();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "StmtExpr::SubStatementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t StmtExpr::TemplateDepth(void) const noexcept {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.getTemplateDepth();
@@ -11329,6 +16140,13 @@ std::optional<bool> StringLiteral::ContainsNonAsciiOrNull(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StringLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StringLiteral *>(u.StringLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t StringLiteral::ByteLength(void) const noexcept {
   auto &self = *const_cast<clang::StringLiteral *>(u.StringLiteral);
   decltype(auto) val = self.getByteLength();
@@ -11362,6 +16180,13 @@ uint32_t StringLiteral::CharacterByteWidth(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef StringLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::StringLiteral *>(u.StringLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum StringLiteralStringKind StringLiteral::Kind(void) const noexcept {
   auto &self = *const_cast<clang::StringLiteral *>(u.StringLiteral);
   decltype(auto) val = self.getKind();
@@ -11471,6 +16296,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const no
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SubstNonTypeTemplateParmExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11478,6 +16310,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const no
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SubstNonTypeTemplateParmExpr::NameToken(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.getNameLoc();
@@ -11485,6 +16324,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const no
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmExpr::NameTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
+  decltype(auto) val = self.getNameLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NonTypeTemplateParmDecl SubstNonTypeTemplateParmExpr::Parameter(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.getParameter();
@@ -11495,6 +16341,16 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const no
   __builtin_unreachable();
 }
 
+::pasta::DeclRef SubstNonTypeTemplateParmExpr::ParameterRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
+  decltype(auto) val = self.getParameter();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SubstNonTypeTemplateParmExpr::ParameterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type SubstNonTypeTemplateParmExpr::ParameterType(void) const noexcept {
   auto &self = *(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.getParameterType(ast->ci->getASTContext());
@@ -11513,6 +16369,16 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const no
   __builtin_unreachable();
 }
 
+::pasta::StmtRef SubstNonTypeTemplateParmExpr::ReplacementRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
+  decltype(auto) val = self.getReplacement();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SubstNonTypeTemplateParmExpr::ReplacementRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool SubstNonTypeTemplateParmExpr::IsReferenceParameter(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.isReferenceParameter();
@@ -11549,6 +16415,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) cons
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmPackExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token SubstNonTypeTemplateParmPackExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11556,6 +16429,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) cons
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmPackExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NonTypeTemplateParmDecl SubstNonTypeTemplateParmPackExpr::ParameterPack(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
   decltype(auto) val = self.getParameterPack();
@@ -11566,6 +16446,16 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) cons
   __builtin_unreachable();
 }
 
+::pasta::DeclRef SubstNonTypeTemplateParmPackExpr::ParameterPackRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
+  decltype(auto) val = self.getParameterPack();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SubstNonTypeTemplateParmPackExpr::ParameterPackRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token SubstNonTypeTemplateParmPackExpr::ParameterPackToken(void) const noexcept {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
   decltype(auto) val = self.getParameterPackLocation();
@@ -11573,6 +16463,13 @@ std::vector<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) cons
   __builtin_unreachable();
 }
 
+::pasta::TokenRef SubstNonTypeTemplateParmPackExpr::ParameterPackTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
+  decltype(auto) val = self.getParameterPackLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 TypeTraitExpr::TypeTraitExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -11603,6 +16500,13 @@ std::vector<::pasta::Stmt> TypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TypeTraitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeTraitExpr *>(u.TypeTraitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token TypeTraitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::TypeTraitExpr *>(u.TypeTraitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11610,6 +16514,13 @@ std::vector<::pasta::Stmt> TypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TypeTraitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeTraitExpr *>(u.TypeTraitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t TypeTraitExpr::NumArguments(void) const noexcept {
   auto &self = *const_cast<clang::TypeTraitExpr *>(u.TypeTraitExpr);
   decltype(auto) val = self.getNumArgs();
@@ -11675,6 +16586,13 @@ std::vector<::pasta::Stmt> TypoExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TypoExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypoExpr *>(u.TypoExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token TypoExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::TypoExpr *>(u.TypoExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11682,6 +16600,13 @@ std::vector<::pasta::Stmt> TypoExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef TypoExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypoExpr *>(u.TypoExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 UnaryExprOrTypeTraitExpr::UnaryExprOrTypeTraitExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -11718,6 +16643,21 @@ std::optional<::pasta::Expr> UnaryExprOrTypeTraitExpr::ArgumentExpression(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> UnaryExprOrTypeTraitExpr::ArgumentExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  if (self.isArgumentType()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getArgumentExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> UnaryExprOrTypeTraitExpr::ArgumentType(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   if (!self.isArgumentType()) {
@@ -11731,6 +16671,19 @@ std::optional<::pasta::Type> UnaryExprOrTypeTraitExpr::ArgumentType(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> UnaryExprOrTypeTraitExpr::ArgumentTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  if (!self.isArgumentType()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getArgumentType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnaryExprOrTypeTraitExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -11738,6 +16691,13 @@ std::optional<::pasta::Type> UnaryExprOrTypeTraitExpr::ArgumentType(void) const
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryExprOrTypeTraitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnaryExprOrTypeTraitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11745,6 +16705,13 @@ std::optional<::pasta::Type> UnaryExprOrTypeTraitExpr::ArgumentType(void) const
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryExprOrTypeTraitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum UnaryExprOrTypeTrait UnaryExprOrTypeTraitExpr::Kind(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.getKind();
@@ -11759,6 +16726,13 @@ enum UnaryExprOrTypeTrait UnaryExprOrTypeTraitExpr::Kind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryExprOrTypeTraitExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnaryExprOrTypeTraitExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -11766,6 +16740,13 @@ enum UnaryExprOrTypeTrait UnaryExprOrTypeTraitExpr::Kind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryExprOrTypeTraitExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type UnaryExprOrTypeTraitExpr::TypeOfArgument(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.getTypeOfArgument();
@@ -11774,6 +16755,14 @@ enum UnaryExprOrTypeTrait UnaryExprOrTypeTraitExpr::Kind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UnaryExprOrTypeTraitExpr::TypeOfArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
+  decltype(auto) val = self.getTypeOfArgument();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UnaryExprOrTypeTraitExpr::IsArgumentType(void) const noexcept {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.isArgumentType();
@@ -11816,6 +16805,13 @@ std::vector<::pasta::Stmt> UnaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryOperator::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnaryOperator::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
   decltype(auto) val = self.getEndLoc();
@@ -11823,6 +16819,13 @@ std::vector<::pasta::Stmt> UnaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryOperator::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnaryOperator::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
   decltype(auto) val = self.getExprLoc();
@@ -11830,6 +16833,13 @@ std::vector<::pasta::Stmt> UnaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryOperator::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: UnaryOperator::FPFeaturesInEffect
 // 0: UnaryOperator::FPOptionsOverride
 enum UnaryOperatorKind UnaryOperator::Opcode(void) const noexcept {
@@ -11846,6 +16856,13 @@ enum UnaryOperatorKind UnaryOperator::Opcode(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnaryOperator::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: UnaryOperator::StoredFPFeatures
 ::pasta::Expr UnaryOperator::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
@@ -11857,6 +16874,16 @@ enum UnaryOperatorKind UnaryOperator::Opcode(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef UnaryOperator::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnaryOperator::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool UnaryOperator::HasStoredFPFeatures(void) const noexcept {
   auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
   decltype(auto) val = self.hasStoredFPFeatures();
@@ -11937,6 +16964,13 @@ std::vector<::pasta::Stmt> UnresolvedLookupExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedLookupExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedLookupExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
   decltype(auto) val = self.getEndLoc();
@@ -11944,6 +16978,13 @@ std::vector<::pasta::Stmt> UnresolvedLookupExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedLookupExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> UnresolvedLookupExpr::NamingClass(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
   decltype(auto) val = self.getNamingClass();
@@ -11956,6 +16997,18 @@ std::optional<::pasta::CXXRecordDecl> UnresolvedLookupExpr::NamingClass(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> UnresolvedLookupExpr::NamingClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
+  decltype(auto) val = self.getNamingClass();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool UnresolvedLookupExpr::IsOverloaded(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
   decltype(auto) val = self.isOverloaded();
@@ -12002,6 +17055,16 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef UnresolvedMemberExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnresolvedMemberExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type UnresolvedMemberExpr::BaseType(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getBaseType();
@@ -12010,6 +17073,14 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UnresolvedMemberExpr::BaseTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getBaseType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedMemberExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -12017,6 +17088,13 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedMemberExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedMemberExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12024,6 +17102,13 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedMemberExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedMemberExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getExprLoc();
@@ -12031,6 +17116,13 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedMemberExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedMemberExpr::MemberToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getMemberLoc();
@@ -12038,6 +17130,13 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedMemberExpr::MemberTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getMemberLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: UnresolvedMemberExpr::MemberName
 // 0: UnresolvedMemberExpr::MemberNameInfo
 ::pasta::CXXRecordDecl UnresolvedMemberExpr::NamingClass(void) const noexcept {
@@ -12050,6 +17149,16 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UnresolvedMemberExpr::NamingClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getNamingClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnresolvedMemberExpr::NamingClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token UnresolvedMemberExpr::OperatorToken(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.getOperatorLoc();
@@ -12057,6 +17166,13 @@ std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UnresolvedMemberExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UnresolvedMemberExpr::HasUnresolvedUsing(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.hasUnresolvedUsing();
@@ -12106,6 +17222,13 @@ std::vector<::pasta::Stmt> VAArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VAArgExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token VAArgExpr::BuiltinToken(void) const noexcept {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.getBuiltinLoc();
@@ -12113,6 +17236,13 @@ std::vector<::pasta::Stmt> VAArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VAArgExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token VAArgExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12120,6 +17250,13 @@ std::vector<::pasta::Stmt> VAArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VAArgExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token VAArgExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -12127,6 +17264,13 @@ std::vector<::pasta::Stmt> VAArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VAArgExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr VAArgExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.getSubExpr();
@@ -12137,6 +17281,16 @@ std::vector<::pasta::Stmt> VAArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef VAArgExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VAArgExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type VAArgExpr::WrittenType(void) const noexcept {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.getWrittenTypeInfo();
@@ -12169,6 +17323,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AbstractConditionalOperator::ColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
+  decltype(auto) val = self.getColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AbstractConditionalOperator::Condition(void) const noexcept {
   auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
   decltype(auto) val = self.getCond();
@@ -12179,6 +17340,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AbstractConditionalOperator::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AbstractConditionalOperator::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AbstractConditionalOperator::FalseExpression(void) const noexcept {
   auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
   decltype(auto) val = self.getFalseExpr();
@@ -12189,6 +17360,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AbstractConditionalOperator::FalseExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
+  decltype(auto) val = self.getFalseExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AbstractConditionalOperator::FalseExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token AbstractConditionalOperator::QuestionToken(void) const noexcept {
   auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
   decltype(auto) val = self.getQuestionLoc();
@@ -12196,6 +17377,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AbstractConditionalOperator::QuestionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
+  decltype(auto) val = self.getQuestionLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AbstractConditionalOperator::TrueExpression(void) const noexcept {
   auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
   decltype(auto) val = self.getTrueExpr();
@@ -12206,6 +17394,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AbstractConditionalOperator::TrueExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator);
+  decltype(auto) val = self.getTrueExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AbstractConditionalOperator::TrueExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 AddrLabelExpr::AddrLabelExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12234,6 +17432,13 @@ std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AddrLabelExpr::AmpAmpTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
+  decltype(auto) val = self.getAmpAmpLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AddrLabelExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -12241,6 +17446,13 @@ std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AddrLabelExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AddrLabelExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12248,6 +17460,13 @@ std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AddrLabelExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::LabelDecl AddrLabelExpr::Label(void) const noexcept {
   auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
   decltype(auto) val = self.getLabel();
@@ -12258,6 +17477,16 @@ std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef AddrLabelExpr::LabelRef(void) const noexcept {
+  auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
+  decltype(auto) val = self.getLabel();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AddrLabelExpr::LabelRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token AddrLabelExpr::LabelToken(void) const noexcept {
   auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
   decltype(auto) val = self.getLabelLoc();
@@ -12265,6 +17494,13 @@ std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AddrLabelExpr::LabelTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
+  decltype(auto) val = self.getLabelLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ArrayInitIndexExpr::ArrayInitIndexExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12293,6 +17529,13 @@ std::vector<::pasta::Stmt> ArrayInitIndexExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArrayInitIndexExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitIndexExpr *>(u.ArrayInitIndexExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArrayInitIndexExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ArrayInitIndexExpr *>(u.ArrayInitIndexExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12300,6 +17543,13 @@ std::vector<::pasta::Stmt> ArrayInitIndexExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArrayInitIndexExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitIndexExpr *>(u.ArrayInitIndexExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ArrayInitLoopExpr::ArrayInitLoopExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12335,6 +17585,13 @@ llvm::APInt ArrayInitLoopExpr::ArraySize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArrayInitLoopExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::OpaqueValueExpr ArrayInitLoopExpr::CommonExpression(void) const noexcept {
   auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
   decltype(auto) val = self.getCommonExpr();
@@ -12345,10 +17602,27 @@ llvm::APInt ArrayInitLoopExpr::ArraySize(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token ArrayInitLoopExpr::EndToken(void) const noexcept {
+::pasta::StmtRef ArrayInitLoopExpr::CommonExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
+  decltype(auto) val = self.getCommonExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArrayInitLoopExpr::CommonExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::Token ArrayInitLoopExpr::EndToken(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
+  decltype(auto) val = self.getEndLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef ArrayInitLoopExpr::EndTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
   decltype(auto) val = self.getEndLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -12362,6 +17636,16 @@ llvm::APInt ArrayInitLoopExpr::ArraySize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArrayInitLoopExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArrayInitLoopExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ArraySubscriptExpr::ArraySubscriptExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12393,6 +17677,16 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArraySubscriptExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArraySubscriptExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArraySubscriptExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -12400,6 +17694,13 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArraySubscriptExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArraySubscriptExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12407,6 +17708,13 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArraySubscriptExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArraySubscriptExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getExprLoc();
@@ -12414,6 +17722,13 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArraySubscriptExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ArraySubscriptExpr::Index(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getIdx();
@@ -12424,6 +17739,16 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArraySubscriptExpr::IndexRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getIdx();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArraySubscriptExpr::IndexRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ArraySubscriptExpr::LHS(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getLHS();
@@ -12434,6 +17759,16 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArraySubscriptExpr::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArraySubscriptExpr::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArraySubscriptExpr::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getRBracketLoc();
@@ -12441,6 +17776,13 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArraySubscriptExpr::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ArraySubscriptExpr::RHS(void) const noexcept {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.getRHS();
@@ -12451,6 +17793,16 @@ std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArraySubscriptExpr::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArraySubscriptExpr::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ArrayTypeTraitExpr::ArrayTypeTraitExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12479,6 +17831,13 @@ std::vector<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArrayTypeTraitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ArrayTypeTraitExpr::DimensionExpression(void) const noexcept {
   auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
   decltype(auto) val = self.getDimensionExpression();
@@ -12489,6 +17848,16 @@ std::vector<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ArrayTypeTraitExpr::DimensionExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
+  decltype(auto) val = self.getDimensionExpression();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ArrayTypeTraitExpr::DimensionExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ArrayTypeTraitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12496,6 +17865,13 @@ std::vector<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ArrayTypeTraitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ArrayTypeTraitExpr::QueriedType(void) const noexcept {
   auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
   decltype(auto) val = self.getQueriedType();
@@ -12504,6 +17880,14 @@ std::vector<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ArrayTypeTraitExpr::QueriedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
+  decltype(auto) val = self.getQueriedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ArrayTypeTrait ArrayTypeTraitExpr::Trait(void) const noexcept {
   auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
   decltype(auto) val = self.getTrait();
@@ -12546,6 +17930,13 @@ std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsTypeExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AsTypeExpr::BuiltinToken(void) const noexcept {
   auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
   decltype(auto) val = self.getBuiltinLoc();
@@ -12553,6 +17944,13 @@ std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsTypeExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AsTypeExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12560,6 +17958,13 @@ std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsTypeExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AsTypeExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -12567,6 +17972,13 @@ std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AsTypeExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AsTypeExpr::SrcExpression(void) const noexcept {
   auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
   decltype(auto) val = self.getSrcExpr();
@@ -12577,6 +17989,16 @@ std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AsTypeExpr::SrcExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
+  decltype(auto) val = self.getSrcExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AsTypeExpr::SrcExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 AtomicExpr::AtomicExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12605,6 +18027,13 @@ std::vector<::pasta::Stmt> AtomicExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AtomicExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AtomicExpr::BuiltinToken(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getBuiltinLoc();
@@ -12612,6 +18041,13 @@ std::vector<::pasta::Stmt> AtomicExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AtomicExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token AtomicExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getEndLoc();
@@ -12619,6 +18055,13 @@ std::vector<::pasta::Stmt> AtomicExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AtomicExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t AtomicExpr::NumSubExpressions(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getNumSubExprs();
@@ -12643,6 +18086,16 @@ enum AtomicExprAtomicOp AtomicExpr::Operation(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AtomicExpr::OrderRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getOrder();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AtomicExpr::OrderRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> AtomicExpr::OrderFail(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   if (self.getNumSubExprs() <= 3 /* ORDER_FAIL */) {
@@ -12658,6 +18111,21 @@ std::optional<::pasta::Expr> AtomicExpr::OrderFail(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AtomicExpr::OrderFailRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  if (self.getNumSubExprs() <= 3 /* ORDER_FAIL */) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getOrderFail();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Expr AtomicExpr::Pointer(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getPtr();
@@ -12668,6 +18136,16 @@ std::optional<::pasta::Expr> AtomicExpr::OrderFail(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef AtomicExpr::PointerRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getPtr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "AtomicExpr::PointerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token AtomicExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -12675,6 +18153,13 @@ std::optional<::pasta::Expr> AtomicExpr::OrderFail(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef AtomicExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> AtomicExpr::Scope(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   if (self.getOp() < clang::AtomicExpr::AO__opencl_atomic_load ||
@@ -12691,6 +18176,22 @@ std::optional<::pasta::Expr> AtomicExpr::Scope(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AtomicExpr::ScopeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  if (self.getOp() < clang::AtomicExpr::AO__opencl_atomic_load ||
+      self.getOp() > clang::AtomicExpr::AO__opencl_atomic_fetch_max) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getScope();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: AtomicExpr::ScopeModel
 // 0: AtomicExpr::SubExpressions
 std::optional<::pasta::Expr> AtomicExpr::Value1(void) const noexcept {
@@ -12710,6 +18211,23 @@ std::optional<::pasta::Expr> AtomicExpr::Value1(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AtomicExpr::Value1Ref(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  if (self.getOp() != clang::AtomicExpr::AO__c11_atomic_init &&
+      self.getOp() != clang::AtomicExpr::AO__opencl_atomic_init &&
+      self.getNumSubExprs() <= 2 /* VAL1 */) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getVal1();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> AtomicExpr::Value2(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   if (self.getOp() != clang::AtomicExpr::AO__atomic_exchange &&
@@ -12726,6 +18244,22 @@ std::optional<::pasta::Expr> AtomicExpr::Value2(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AtomicExpr::Value2Ref(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  if (self.getOp() != clang::AtomicExpr::AO__atomic_exchange &&
+      self.getNumSubExprs() <= 4 /* VAL2 */) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getVal2();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Type AtomicExpr::ValueType(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.getValueType();
@@ -12734,6 +18268,14 @@ std::optional<::pasta::Expr> AtomicExpr::Value2(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AtomicExpr::ValueTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  decltype(auto) val = self.getValueType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> AtomicExpr::Weak(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   if (self.getNumSubExprs() <= 5 /* WEAK */) {
@@ -12749,6 +18291,21 @@ std::optional<::pasta::Expr> AtomicExpr::Weak(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> AtomicExpr::WeakRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
+  if (self.getNumSubExprs() <= 5 /* WEAK */) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getWeak();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool AtomicExpr::IsCmpXChg(void) const noexcept {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.isCmpXChg();
@@ -12815,6 +18372,13 @@ std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryConditionalOperator::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr BinaryConditionalOperator::Common(void) const noexcept {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.getCommon();
@@ -12825,6 +18389,16 @@ std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BinaryConditionalOperator::CommonRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getCommon();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryConditionalOperator::CommonRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr BinaryConditionalOperator::Condition(void) const noexcept {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.getCond();
@@ -12835,6 +18409,16 @@ std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BinaryConditionalOperator::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryConditionalOperator::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token BinaryConditionalOperator::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.getEndLoc();
@@ -12842,23 +18426,50 @@ std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryConditionalOperator::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr BinaryConditionalOperator::FalseExpression(void) const noexcept {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.getFalseExpr();
   if (val) {
     return StmtBuilder::Create<::pasta::Expr>(ast, val);
   }
-  assert(false && "BinaryConditionalOperator::FalseExpression can return nullptr!");
+  assert(false && "BinaryConditionalOperator::FalseExpression can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef BinaryConditionalOperator::FalseExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getFalseExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryConditionalOperator::FalseExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::OpaqueValueExpr BinaryConditionalOperator::OpaqueValue(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getOpaqueValue();
+  if (val) {
+    return StmtBuilder::Create<::pasta::OpaqueValueExpr>(ast, val);
+  }
+  assert(false && "BinaryConditionalOperator::OpaqueValue can return nullptr!");
   __builtin_unreachable();
 }
 
-::pasta::OpaqueValueExpr BinaryConditionalOperator::OpaqueValue(void) const noexcept {
+::pasta::StmtRef BinaryConditionalOperator::OpaqueValueRef(void) const noexcept {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.getOpaqueValue();
   if (val) {
-    return StmtBuilder::Create<::pasta::OpaqueValueExpr>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "BinaryConditionalOperator::OpaqueValue can return nullptr!");
+  assert(false && "BinaryConditionalOperator::OpaqueValueRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -12872,6 +18483,16 @@ std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BinaryConditionalOperator::TrueExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
+  decltype(auto) val = self.getTrueExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryConditionalOperator::TrueExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 BinaryOperator::BinaryOperator(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -12901,6 +18522,13 @@ std::vector<::pasta::Stmt> BinaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryOperator::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token BinaryOperator::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
   decltype(auto) val = self.getEndLoc();
@@ -12908,6 +18536,13 @@ std::vector<::pasta::Stmt> BinaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryOperator::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token BinaryOperator::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
   decltype(auto) val = self.getExprLoc();
@@ -12915,6 +18550,13 @@ std::vector<::pasta::Stmt> BinaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryOperator::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: BinaryOperator::FPFeatures
 // 1: BinaryOperator::FPFeaturesInEffect
 ::pasta::Expr BinaryOperator::LHS(void) const noexcept {
@@ -12927,6 +18569,16 @@ std::vector<::pasta::Stmt> BinaryOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BinaryOperator::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryOperator::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum BinaryOperatorKind BinaryOperator::Opcode(void) const noexcept {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
   decltype(auto) val = self.getOpcode();
@@ -12952,6 +18604,13 @@ std::string_view BinaryOperator::OpcodeString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BinaryOperator::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr BinaryOperator::RHS(void) const noexcept {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
   decltype(auto) val = self.getRHS();
@@ -12962,6 +18621,16 @@ std::string_view BinaryOperator::OpcodeString(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BinaryOperator::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BinaryOperator::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: BinaryOperator::StoredFPFeatures
 bool BinaryOperator::HasStoredFPFeatures(void) const noexcept {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
@@ -13091,6 +18760,13 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BlockExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::BlockDecl BlockExpr::BlockDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.getBlockDecl();
@@ -13101,6 +18777,16 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef BlockExpr::BlockDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getBlockDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BlockExpr::BlockDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Stmt BlockExpr::Body(void) const noexcept {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.getBody();
@@ -13111,6 +18797,16 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef BlockExpr::BodyRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getBody();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BlockExpr::BodyRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token BlockExpr::CaretToken(void) const noexcept {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.getCaretLocation();
@@ -13118,6 +18814,13 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BlockExpr::CaretTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getCaretLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token BlockExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13125,6 +18828,13 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BlockExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionProtoType BlockExpr::FunctionType(void) const noexcept {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.getFunctionType();
@@ -13135,6 +18845,16 @@ std::vector<::pasta::Stmt> BlockExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BlockExpr::FunctionTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
+  decltype(auto) val = self.getFunctionType();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BlockExpr::FunctionTypeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CXXBindTemporaryExpr::CXXBindTemporaryExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -13163,6 +18883,13 @@ std::vector<::pasta::Stmt> CXXBindTemporaryExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXBindTemporaryExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXBindTemporaryExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13170,6 +18897,13 @@ std::vector<::pasta::Stmt> CXXBindTemporaryExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXBindTemporaryExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXBindTemporaryExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
   decltype(auto) val = self.getSubExpr();
@@ -13180,6 +18914,16 @@ std::vector<::pasta::Stmt> CXXBindTemporaryExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXBindTemporaryExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXBindTemporaryExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: CXXBindTemporaryExpr::Temporary
 CXXBoolLiteralExpr::CXXBoolLiteralExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -13209,6 +18953,13 @@ std::vector<::pasta::Stmt> CXXBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXBoolLiteralExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXBoolLiteralExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13216,6 +18967,13 @@ std::vector<::pasta::Stmt> CXXBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXBoolLiteralExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXBoolLiteralExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
   decltype(auto) val = self.getLocation();
@@ -13223,6 +18981,13 @@ std::vector<::pasta::Stmt> CXXBoolLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXBoolLiteralExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXBoolLiteralExpr::Value(void) const noexcept {
   auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
   decltype(auto) val = self.getValue();
@@ -13276,6 +19041,13 @@ std::vector<::pasta::Stmt> CXXConstructExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXConstructExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum CXXConstructExprConstructionKind CXXConstructExpr::ConstructionKind(void) const noexcept {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.getConstructionKind();
@@ -13293,6 +19065,16 @@ enum CXXConstructExprConstructionKind CXXConstructExpr::ConstructionKind(void) c
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXConstructExpr::ConstructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
+  decltype(auto) val = self.getConstructor();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXConstructExpr::ConstructorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXConstructExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13300,6 +19082,13 @@ enum CXXConstructExprConstructionKind CXXConstructExpr::ConstructionKind(void) c
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXConstructExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXConstructExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.getLocation();
@@ -13307,6 +19096,13 @@ enum CXXConstructExprConstructionKind CXXConstructExpr::ConstructionKind(void) c
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXConstructExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t CXXConstructExpr::NumArguments(void) const noexcept {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.getNumArgs();
@@ -13321,6 +19117,13 @@ uint32_t CXXConstructExpr::NumArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXConstructExpr::ParenthesisOrBraceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
+  decltype(auto) val = self.getParenOrBraceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXConstructExpr::HadMultipleCandidates(void) const noexcept {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.hadMultipleCandidates();
@@ -13384,6 +19187,13 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultArgExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDefaultArgExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13391,6 +19201,13 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultArgExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXDefaultArgExpr::Expression(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.getExpr();
@@ -13401,6 +19218,16 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXDefaultArgExpr::ExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDefaultArgExpr::ExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDefaultArgExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.getExprLoc();
@@ -13408,6 +19235,13 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultArgExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ParmVarDecl CXXDefaultArgExpr::Parameter(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.getParam();
@@ -13418,6 +19252,16 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDefaultArgExpr::ParameterRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getParam();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDefaultArgExpr::ParameterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::DeclContext CXXDefaultArgExpr::UsedContext(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.getUsedContext();
@@ -13435,6 +19279,13 @@ std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultArgExpr::UsedTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
+  decltype(auto) val = self.getUsedLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CXXDefaultInitExpr::CXXDefaultInitExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -13463,6 +19314,13 @@ std::vector<::pasta::Stmt> CXXDefaultInitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDefaultInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13470,6 +19328,13 @@ std::vector<::pasta::Stmt> CXXDefaultInitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXDefaultInitExpr::Expression(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
   if (!self.getField()->getInClassInitializer()) {
@@ -13485,6 +19350,21 @@ std::optional<::pasta::Expr> CXXDefaultInitExpr::Expression(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXDefaultInitExpr::ExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
+  if (!self.getField()->getInClassInitializer()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::FieldDecl CXXDefaultInitExpr::Field(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
   decltype(auto) val = self.getField();
@@ -13495,6 +19375,16 @@ std::optional<::pasta::Expr> CXXDefaultInitExpr::Expression(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDefaultInitExpr::FieldRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
+  decltype(auto) val = self.getField();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDefaultInitExpr::FieldRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::DeclContext CXXDefaultInitExpr::UsedContext(void) const noexcept {
   auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
   decltype(auto) val = self.getUsedContext();
@@ -13512,6 +19402,13 @@ std::optional<::pasta::Expr> CXXDefaultInitExpr::Expression(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDefaultInitExpr::UsedTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
+  decltype(auto) val = self.getUsedLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CXXDeleteExpr::CXXDeleteExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -13550,6 +19447,16 @@ bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXDeleteExpr::ArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
+  decltype(auto) val = self.getArgument();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDeleteExpr::ArgumentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDeleteExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -13557,6 +19464,13 @@ bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDeleteExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXDeleteExpr::DestroyedType(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.getDestroyedType();
@@ -13565,6 +19479,14 @@ bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXDeleteExpr::DestroyedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
+  decltype(auto) val = self.getDestroyedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDeleteExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13572,6 +19494,13 @@ bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDeleteExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionDecl CXXDeleteExpr::OperatorDelete(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.getOperatorDelete();
@@ -13582,6 +19511,16 @@ bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXDeleteExpr::OperatorDeleteRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
+  decltype(auto) val = self.getOperatorDelete();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXDeleteExpr::OperatorDeleteRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool CXXDeleteExpr::IsArrayForm(void) const noexcept {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.isArrayForm();
@@ -13624,7 +19563,22 @@ std::vector<::pasta::Stmt> CXXDependentScopeMemberExpr::Children(void) const noe
   __builtin_unreachable();
 }
 
-std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexcept {
+std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  if (self.isImplicitAccess()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getBase();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+  }
+  __builtin_unreachable();
+}
+
+std::optional<::pasta::StmtRef> CXXDependentScopeMemberExpr::BaseRef(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   if (self.isImplicitAccess()) {
     return std::nullopt;
@@ -13634,7 +19588,7 @@ std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexc
     return std::nullopt;
   }
   if (val) {
-    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
   __builtin_unreachable();
 }
@@ -13647,6 +19601,14 @@ std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXDependentScopeMemberExpr::BaseTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getBaseType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDependentScopeMemberExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -13654,6 +19616,13 @@ std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDependentScopeMemberExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13661,6 +19630,13 @@ std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::NamedDecl> CXXDependentScopeMemberExpr::FirstQualifierFoundInScope(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.getFirstQualifierFoundInScope();
@@ -13673,6 +19649,18 @@ std::optional<::pasta::NamedDecl> CXXDependentScopeMemberExpr::FirstQualifierFou
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXDependentScopeMemberExpr::FirstQualifierFoundInScopeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getFirstQualifierFoundInScope();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXDependentScopeMemberExpr::LAngleToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.getLAngleLoc();
@@ -13680,6 +19668,13 @@ std::optional<::pasta::NamedDecl> CXXDependentScopeMemberExpr::FirstQualifierFou
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::LAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getLAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXDependentScopeMemberExpr::Member
 ::pasta::Token CXXDependentScopeMemberExpr::MemberToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
@@ -13688,6 +19683,13 @@ std::optional<::pasta::NamedDecl> CXXDependentScopeMemberExpr::FirstQualifierFou
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::MemberTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getMemberLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXDependentScopeMemberExpr::MemberNameInfo
 uint32_t CXXDependentScopeMemberExpr::NumTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
@@ -13703,6 +19705,13 @@ uint32_t CXXDependentScopeMemberExpr::NumTemplateArguments(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXDependentScopeMemberExpr::Qualifier
 // 0: CXXDependentScopeMemberExpr::QualifierToken
 ::pasta::Token CXXDependentScopeMemberExpr::RAngleToken(void) const noexcept {
@@ -13712,6 +19721,13 @@ uint32_t CXXDependentScopeMemberExpr::NumTemplateArguments(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::RAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getRAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXDependentScopeMemberExpr::TemplateArguments
 ::pasta::Token CXXDependentScopeMemberExpr::TemplateKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
@@ -13720,6 +19736,13 @@ uint32_t CXXDependentScopeMemberExpr::NumTemplateArguments(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXDependentScopeMemberExpr::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXDependentScopeMemberExpr::HasExplicitTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.hasExplicitTemplateArgs();
@@ -13777,6 +19800,13 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFoldExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::UnresolvedLookupExpr CXXFoldExpr::Callee(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getCallee();
@@ -13787,6 +19817,16 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXFoldExpr::CalleeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getCallee();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXFoldExpr::CalleeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFoldExpr::EllipsisToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getEllipsisLoc();
@@ -13794,6 +19834,13 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFoldExpr::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFoldExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13801,6 +19848,13 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFoldExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXFoldExpr::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getInit();
@@ -13811,6 +19865,16 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXFoldExpr::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXFoldExpr::InitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXFoldExpr::LHS(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getLHS();
@@ -13821,6 +19885,16 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXFoldExpr::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXFoldExpr::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFoldExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -13828,6 +19902,13 @@ std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFoldExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<unsigned> CXXFoldExpr::NumExpansions(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getNumExpansions();
@@ -13856,6 +19937,16 @@ enum BinaryOperatorKind CXXFoldExpr::Operator(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXFoldExpr::PatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getPattern();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXFoldExpr::PatternRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXFoldExpr::RHS(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getRHS();
@@ -13866,6 +19957,16 @@ enum BinaryOperatorKind CXXFoldExpr::Operator(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXFoldExpr::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXFoldExpr::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFoldExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -13873,6 +19974,13 @@ enum BinaryOperatorKind CXXFoldExpr::Operator(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFoldExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXFoldExpr::IsLeftFold(void) const noexcept {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.isLeftFold();
@@ -13922,6 +20030,13 @@ bool CXXInheritedCtorInitExpr::ConstructsVirtualBase(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXInheritedCtorInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum CXXConstructExprConstructionKind CXXInheritedCtorInitExpr::ConstructionKind(void) const noexcept {
   auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
   decltype(auto) val = self.getConstructionKind();
@@ -13939,6 +20054,16 @@ enum CXXConstructExprConstructionKind CXXInheritedCtorInitExpr::ConstructionKind
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXInheritedCtorInitExpr::ConstructorRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
+  decltype(auto) val = self.getConstructor();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXInheritedCtorInitExpr::ConstructorRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXInheritedCtorInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -13946,6 +20071,13 @@ enum CXXConstructExprConstructionKind CXXInheritedCtorInitExpr::ConstructionKind
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXInheritedCtorInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXInheritedCtorInitExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
   decltype(auto) val = self.getLocation();
@@ -13953,6 +20085,13 @@ enum CXXConstructExprConstructionKind CXXInheritedCtorInitExpr::ConstructionKind
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXInheritedCtorInitExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXInheritedCtorInitExpr::InheritedFromVirtualBase(void) const noexcept {
   auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
   decltype(auto) val = self.inheritedFromVBase();
@@ -13996,6 +20135,14 @@ bool CXXNewExpr::DoesUsualArrayDeleteWantSize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXNewExpr::AllocatedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getAllocatedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXNewExpr::ArraySize(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getArraySize();
@@ -14014,6 +20161,13 @@ std::optional<::pasta::Expr> CXXNewExpr::ArraySize(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNewExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXConstructExpr> CXXNewExpr::ConstructExpression(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getConstructExpr();
@@ -14026,6 +20180,18 @@ std::optional<::pasta::CXXConstructExpr> CXXNewExpr::ConstructExpression(void) c
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXNewExpr::ConstructExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getConstructExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXNewExpr::DirectInitializerRange(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getDirectInitRange();
@@ -14033,6 +20199,13 @@ std::optional<::pasta::CXXConstructExpr> CXXNewExpr::ConstructExpression(void) c
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXNewExpr::DirectInitializerRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getDirectInitRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNewExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14040,6 +20213,13 @@ std::optional<::pasta::CXXConstructExpr> CXXNewExpr::ConstructExpression(void) c
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNewExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum CXXNewExprInitializationStyle CXXNewExpr::InitializationStyle(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getInitializationStyle();
@@ -14059,6 +20239,18 @@ std::optional<::pasta::Expr> CXXNewExpr::Initializer(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXNewExpr::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getInitializer();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t CXXNewExpr::NumPlacementArguments(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getNumPlacementArgs();
@@ -14076,6 +20268,16 @@ uint32_t CXXNewExpr::NumPlacementArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXNewExpr::OperatorDeleteRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getOperatorDelete();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXNewExpr::OperatorDeleteRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::FunctionDecl CXXNewExpr::OperatorNew(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getOperatorNew();
@@ -14086,6 +20288,16 @@ uint32_t CXXNewExpr::NumPlacementArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXNewExpr::OperatorNewRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getOperatorNew();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXNewExpr::OperatorNewRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 1: CXXNewExpr::PlacementArgument
 ::pasta::TokenRange CXXNewExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
@@ -14094,6 +20306,13 @@ uint32_t CXXNewExpr::NumPlacementArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXNewExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXNewExpr::TypeIdParentheses(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.getTypeIdParens();
@@ -14101,6 +20320,13 @@ uint32_t CXXNewExpr::NumPlacementArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXNewExpr::TypeIdParenthesesRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
+  decltype(auto) val = self.getTypeIdParens();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXNewExpr::HasInitializer(void) const noexcept {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.hasInitializer();
@@ -14188,6 +20414,13 @@ std::vector<::pasta::Stmt> CXXNoexceptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNoexceptExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNoexceptExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14195,6 +20428,13 @@ std::vector<::pasta::Stmt> CXXNoexceptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNoexceptExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXNoexceptExpr::Operand(void) const noexcept {
   auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
   decltype(auto) val = self.getOperand();
@@ -14205,6 +20445,16 @@ std::vector<::pasta::Stmt> CXXNoexceptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXNoexceptExpr::OperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
+  decltype(auto) val = self.getOperand();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXNoexceptExpr::OperandRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXNoexceptExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
   decltype(auto) val = self.getSourceRange();
@@ -14212,6 +20462,13 @@ std::vector<::pasta::Stmt> CXXNoexceptExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXNoexceptExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXNoexceptExpr::Value(void) const noexcept {
   auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
   decltype(auto) val = self.getValue();
@@ -14247,6 +20504,13 @@ std::vector<::pasta::Stmt> CXXNullPtrLiteralExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNullPtrLiteralExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNullPtrLiteralExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14254,6 +20518,13 @@ std::vector<::pasta::Stmt> CXXNullPtrLiteralExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNullPtrLiteralExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNullPtrLiteralExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
   decltype(auto) val = self.getLocation();
@@ -14261,6 +20532,13 @@ std::vector<::pasta::Stmt> CXXNullPtrLiteralExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNullPtrLiteralExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CXXPseudoDestructorExpr::CXXPseudoDestructorExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -14292,17 +20570,41 @@ std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXPseudoDestructorExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXPseudoDestructorExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXPseudoDestructorExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
-  decltype(auto) val = self.getBeginLoc();
+  decltype(auto) val = self.getBeginLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef CXXPseudoDestructorExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::Token CXXPseudoDestructorExpr::ColonColonToken(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getColonColonLoc();
   return ast->TokenAt(val);
   __builtin_unreachable();
 }
 
-::pasta::Token CXXPseudoDestructorExpr::ColonColonToken(void) const noexcept {
+::pasta::TokenRef CXXPseudoDestructorExpr::ColonColonTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
   decltype(auto) val = self.getColonColonLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -14314,6 +20616,14 @@ std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXPseudoDestructorExpr::DestroyedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getDestroyedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXPseudoDestructorExpr::DestroyedTypeIdentifier
 ::pasta::Token CXXPseudoDestructorExpr::DestroyedTypeToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
@@ -14322,6 +20632,13 @@ std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXPseudoDestructorExpr::DestroyedTypeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getDestroyedTypeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXPseudoDestructorExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14329,6 +20646,13 @@ std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXPseudoDestructorExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXPseudoDestructorExpr::OperatorToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
   decltype(auto) val = self.getOperatorLoc();
@@ -14336,6 +20660,13 @@ std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXPseudoDestructorExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXPseudoDestructorExpr::Qualifier
 // 0: CXXPseudoDestructorExpr::QualifierToken
 std::optional<::pasta::Type> CXXPseudoDestructorExpr::ScopeType(void) const noexcept {
@@ -14358,6 +20689,13 @@ std::optional<::pasta::Type> CXXPseudoDestructorExpr::ScopeType(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXPseudoDestructorExpr::TildeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
+  decltype(auto) val = self.getTildeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXPseudoDestructorExpr::HasQualifier(void) const noexcept {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
   decltype(auto) val = self.hasQualifier();
@@ -14387,6 +20725,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXRewrittenBinaryOperator::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXRewrittenBinaryOperator::DecomposedForm
 ::pasta::Token CXXRewrittenBinaryOperator::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
@@ -14395,6 +20740,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXRewrittenBinaryOperator::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXRewrittenBinaryOperator::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getExprLoc();
@@ -14402,6 +20754,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXRewrittenBinaryOperator::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXRewrittenBinaryOperator::LHS(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getLHS();
@@ -14412,6 +20771,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXRewrittenBinaryOperator::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXRewrittenBinaryOperator::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum BinaryOperatorKind CXXRewrittenBinaryOperator::Opcode(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getOpcode();
@@ -14444,6 +20813,13 @@ enum BinaryOperatorKind CXXRewrittenBinaryOperator::Operator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXRewrittenBinaryOperator::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXRewrittenBinaryOperator::RHS(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getRHS();
@@ -14454,6 +20830,16 @@ enum BinaryOperatorKind CXXRewrittenBinaryOperator::Operator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXRewrittenBinaryOperator::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXRewrittenBinaryOperator::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXRewrittenBinaryOperator::SemanticForm(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getSemanticForm();
@@ -14464,6 +20850,16 @@ enum BinaryOperatorKind CXXRewrittenBinaryOperator::Operator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXRewrittenBinaryOperator::SemanticFormRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getSemanticForm();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXRewrittenBinaryOperator::SemanticFormRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXRewrittenBinaryOperator::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.getSourceRange();
@@ -14471,6 +20867,13 @@ enum BinaryOperatorKind CXXRewrittenBinaryOperator::Operator(void) const noexcep
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXRewrittenBinaryOperator::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXRewrittenBinaryOperator::IsAssignmentOperation(void) const noexcept {
   auto &self = *const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator);
   decltype(auto) val = self.isAssignmentOp();
@@ -14520,6 +20923,13 @@ std::vector<::pasta::Stmt> CXXScalarValueInitExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXScalarValueInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXScalarValueInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14527,6 +20937,13 @@ std::vector<::pasta::Stmt> CXXScalarValueInitExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXScalarValueInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXScalarValueInitExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -14534,6 +20951,13 @@ std::vector<::pasta::Stmt> CXXScalarValueInitExpr::Children(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXScalarValueInitExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXScalarValueInitExpr::
 CXXStdInitializerListExpr::CXXStdInitializerListExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -14563,6 +20987,13 @@ std::vector<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXStdInitializerListExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXStdInitializerListExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14570,6 +21001,13 @@ std::vector<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXStdInitializerListExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXStdInitializerListExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
   decltype(auto) val = self.getSourceRange();
@@ -14577,6 +21015,13 @@ std::vector<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXStdInitializerListExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXStdInitializerListExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
   decltype(auto) val = self.getSubExpr();
@@ -14587,6 +21032,16 @@ std::vector<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXStdInitializerListExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXStdInitializerListExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CXXTemporaryObjectExpr::CXXTemporaryObjectExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -14603,6 +21058,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXTemporaryObjectExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTemporaryObjectExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTemporaryObjectExpr *>(u.CXXTemporaryObjectExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXTemporaryObjectExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXTemporaryObjectExpr *>(u.CXXTemporaryObjectExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14610,6 +21072,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXTemporaryObjectExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTemporaryObjectExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTemporaryObjectExpr *>(u.CXXTemporaryObjectExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXTemporaryObjectExpr::
 std::vector<::pasta::Expr> CXXTemporaryObjectExpr::Arguments(void) const noexcept {
   std::vector<::pasta::Expr> ret;
@@ -14655,6 +21124,13 @@ std::vector<::pasta::Stmt> CXXThisExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThisExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXThisExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14662,6 +21138,13 @@ std::vector<::pasta::Stmt> CXXThisExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThisExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXThisExpr::Token(void) const noexcept {
   auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
   decltype(auto) val = self.getLocation();
@@ -14669,6 +21152,13 @@ std::vector<::pasta::Stmt> CXXThisExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThisExpr::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXThisExpr::IsImplicit(void) const noexcept {
   auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
   decltype(auto) val = self.isImplicit();
@@ -14704,6 +21194,13 @@ std::vector<::pasta::Stmt> CXXThrowExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThrowExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXThrowExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14711,6 +21208,13 @@ std::vector<::pasta::Stmt> CXXThrowExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThrowExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXThrowExpr::SubExpression(void) const noexcept {
   auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
   decltype(auto) val = self.getSubExpr();
@@ -14723,6 +21227,18 @@ std::optional<::pasta::Expr> CXXThrowExpr::SubExpression(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXThrowExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXThrowExpr::ThrowToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
   decltype(auto) val = self.getThrowLoc();
@@ -14730,6 +21246,13 @@ std::optional<::pasta::Expr> CXXThrowExpr::SubExpression(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXThrowExpr::ThrowTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
+  decltype(auto) val = self.getThrowLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXThrowExpr::IsThrownVariableInScope(void) const noexcept {
   auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
   decltype(auto) val = self.isThrownVariableInScope();
@@ -14765,6 +21288,13 @@ std::vector<::pasta::Stmt> CXXTypeidExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTypeidExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXTypeidExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14772,6 +21302,13 @@ std::vector<::pasta::Stmt> CXXTypeidExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXTypeidExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXTypeidExpr::ExpressionOperand(void) const noexcept {
   auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
   if (self.isTypeOperand()) {
@@ -14787,6 +21324,21 @@ std::optional<::pasta::Expr> CXXTypeidExpr::ExpressionOperand(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXTypeidExpr::ExpressionOperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
+  if (self.isTypeOperand()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getExprOperand();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXTypeidExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
   decltype(auto) val = self.getSourceRange();
@@ -14794,6 +21346,13 @@ std::optional<::pasta::Expr> CXXTypeidExpr::ExpressionOperand(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXTypeidExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXTypeidExpr::TypeOperand(void) const noexcept {
   auto &self = *(u.CXXTypeidExpr);
   decltype(auto) val = self.getTypeOperand(ast->ci->getASTContext());
@@ -14878,6 +21437,13 @@ std::vector<::pasta::Stmt> CXXUnresolvedConstructExpr::Children(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUnresolvedConstructExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXUnresolvedConstructExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14885,6 +21451,13 @@ std::vector<::pasta::Stmt> CXXUnresolvedConstructExpr::Children(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUnresolvedConstructExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXUnresolvedConstructExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -14892,6 +21465,13 @@ std::vector<::pasta::Stmt> CXXUnresolvedConstructExpr::Children(void) const noex
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUnresolvedConstructExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t CXXUnresolvedConstructExpr::NumArguments(void) const noexcept {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.getNumArgs();
@@ -14906,6 +21486,13 @@ uint32_t CXXUnresolvedConstructExpr::NumArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUnresolvedConstructExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXUnresolvedConstructExpr::TypeAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.getTypeAsWritten();
@@ -14914,6 +21501,14 @@ uint32_t CXXUnresolvedConstructExpr::NumArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXUnresolvedConstructExpr::TypeAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
+  decltype(auto) val = self.getTypeAsWritten();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CXXUnresolvedConstructExpr::
 bool CXXUnresolvedConstructExpr::IsListInitialization(void) const noexcept {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
@@ -14950,6 +21545,13 @@ std::vector<::pasta::Stmt> CXXUuidofExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUuidofExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXUuidofExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
   decltype(auto) val = self.getEndLoc();
@@ -14957,6 +21559,13 @@ std::vector<::pasta::Stmt> CXXUuidofExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXUuidofExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Expr> CXXUuidofExpr::ExpressionOperand(void) const noexcept {
   auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
   if (self.isTypeOperand()) {
@@ -14972,6 +21581,21 @@ std::optional<::pasta::Expr> CXXUuidofExpr::ExpressionOperand(void) const noexce
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> CXXUuidofExpr::ExpressionOperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
+  if (self.isTypeOperand()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getExprOperand();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::MSGuidDecl CXXUuidofExpr::GuidDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
   decltype(auto) val = self.getGuidDecl();
@@ -14982,6 +21606,16 @@ std::optional<::pasta::Expr> CXXUuidofExpr::ExpressionOperand(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXUuidofExpr::GuidDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
+  decltype(auto) val = self.getGuidDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXUuidofExpr::GuidDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXUuidofExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
   decltype(auto) val = self.getSourceRange();
@@ -14989,6 +21623,13 @@ std::optional<::pasta::Expr> CXXUuidofExpr::ExpressionOperand(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXUuidofExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXUuidofExpr::TypeOperand(void) const noexcept {
   auto &self = *(u.CXXUuidofExpr);
   decltype(auto) val = self.getTypeOperand(ast->ci->getASTContext());
@@ -15064,7 +21705,14 @@ enum CallExprADLCallKind CallExpr::ADLCallKind(void) const noexcept {
 ::pasta::Token CallExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.getBeginLoc();
-  return ast->TokenAt(val);
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef CallExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -15093,6 +21741,16 @@ uint32_t CallExpr::BuiltinCallee(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CallExpr::CalleeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getCallee();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CallExpr::CalleeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Decl> CallExpr::CalleeDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.getCalleeDecl();
@@ -15105,6 +21763,18 @@ std::optional<::pasta::Decl> CallExpr::CalleeDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CallExpr::CalleeDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getCalleeDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionDecl> CallExpr::DirectCallee(void) const noexcept {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.getDirectCallee();
@@ -15117,6 +21787,18 @@ std::optional<::pasta::FunctionDecl> CallExpr::DirectCallee(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CallExpr::DirectCalleeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getDirectCallee();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Token CallExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15124,6 +21806,13 @@ std::optional<::pasta::FunctionDecl> CallExpr::DirectCallee(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CallExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CallExpr::FPFeatures
 // 1: CallExpr::FPFeaturesInEffect
 uint32_t CallExpr::NumArguments(void) const noexcept {
@@ -15147,6 +21836,13 @@ uint32_t CallExpr::NumCommas(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CallExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CallExpr::StoredFPFeatures
 std::optional<::pasta::Attr> CallExpr::UnusedResultAttribute(void) const noexcept {
   auto &self = *(u.CallExpr);
@@ -15266,6 +21962,18 @@ std::optional<::pasta::NamedDecl> CastExpr::ConversionFunction(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CastExpr::ConversionFunctionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
+  decltype(auto) val = self.getConversionFunction();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: CastExpr::FPFeatures
 // 1: CastExpr::FPFeaturesInEffect
 // 0: CastExpr::StoredFPFeatures
@@ -15279,6 +21987,16 @@ std::optional<::pasta::NamedDecl> CastExpr::ConversionFunction(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CastExpr::SubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
+  decltype(auto) val = self.getSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CastExpr::SubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CastExpr::SubExpressionAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
   decltype(auto) val = self.getSubExprAsWritten();
@@ -15289,6 +22007,16 @@ std::optional<::pasta::NamedDecl> CastExpr::ConversionFunction(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CastExpr::SubExpressionAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
+  decltype(auto) val = self.getSubExprAsWritten();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CastExpr::SubExpressionAsWrittenRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FieldDecl> CastExpr::TargetUnionField(void) const noexcept {
   auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
   if (self.getCastKind() != clang::CK_ToUnion) {
@@ -15304,6 +22032,21 @@ std::optional<::pasta::FieldDecl> CastExpr::TargetUnionField(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CastExpr::TargetUnionFieldRef(void) const noexcept {
+  auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
+  if (self.getCastKind() != clang::CK_ToUnion) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getTargetUnionField();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool CastExpr::HasStoredFPFeatures(void) const noexcept {
   auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
   decltype(auto) val = self.hasStoredFPFeatures();
@@ -15344,6 +22087,13 @@ std::vector<::pasta::Stmt> CharacterLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CharacterLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CharacterLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -15351,6 +22101,13 @@ std::vector<::pasta::Stmt> CharacterLiteral::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CharacterLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum CharacterLiteralCharacterKind CharacterLiteral::Kind(void) const noexcept {
   auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
   decltype(auto) val = self.getKind();
@@ -15365,6 +22122,13 @@ enum CharacterLiteralCharacterKind CharacterLiteral::Kind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CharacterLiteral::TokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
+  decltype(auto) val = self.getLocation();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t CharacterLiteral::Value(void) const noexcept {
   auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
   decltype(auto) val = self.getValue();
@@ -15400,6 +22164,13 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ChooseExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ChooseExpr::BuiltinToken(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getBuiltinLoc();
@@ -15407,6 +22178,13 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ChooseExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ChooseExpr::ChosenSubExpression(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getChosenSubExpr();
@@ -15417,6 +22195,16 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ChooseExpr::ChosenSubExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getChosenSubExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ChooseExpr::ChosenSubExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ChooseExpr::Condition(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getCond();
@@ -15427,6 +22215,16 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ChooseExpr::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ChooseExpr::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ChooseExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15434,6 +22232,13 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ChooseExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ChooseExpr::LHS(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getLHS();
@@ -15444,6 +22249,16 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ChooseExpr::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ChooseExpr::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ChooseExpr::RHS(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getRHS();
@@ -15454,6 +22269,16 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ChooseExpr::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ChooseExpr::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ChooseExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -15461,6 +22286,13 @@ std::vector<::pasta::Stmt> ChooseExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ChooseExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ChooseExpr::IsConditionDependent(void) const noexcept {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.isConditionDependent();
@@ -15492,6 +22324,14 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CompoundAssignOperator)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CompoundAssignOperator::ComputationLHSTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundAssignOperator *>(u.CompoundAssignOperator);
+  decltype(auto) val = self.getComputationLHSType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type CompoundAssignOperator::ComputationResultType(void) const noexcept {
   auto &self = *const_cast<clang::CompoundAssignOperator *>(u.CompoundAssignOperator);
   decltype(auto) val = self.getComputationResultType();
@@ -15500,6 +22340,14 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CompoundAssignOperator)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CompoundAssignOperator::ComputationResultTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundAssignOperator *>(u.CompoundAssignOperator);
+  decltype(auto) val = self.getComputationResultType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CompoundLiteralExpr::CompoundLiteralExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -15528,6 +22376,13 @@ std::vector<::pasta::Stmt> CompoundLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundLiteralExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CompoundLiteralExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15535,6 +22390,13 @@ std::vector<::pasta::Stmt> CompoundLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundLiteralExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CompoundLiteralExpr::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
   decltype(auto) val = self.getInitializer();
@@ -15545,6 +22407,16 @@ std::vector<::pasta::Stmt> CompoundLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CompoundLiteralExpr::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
+  decltype(auto) val = self.getInitializer();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CompoundLiteralExpr::InitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CompoundLiteralExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -15552,6 +22424,13 @@ std::vector<::pasta::Stmt> CompoundLiteralExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CompoundLiteralExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: CompoundLiteralExpr::
 bool CompoundLiteralExpr::IsFileScope(void) const noexcept {
   auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
@@ -15588,6 +22467,13 @@ std::vector<::pasta::Stmt> ConceptSpecializationExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConceptSpecializationExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConceptSpecializationExpr *>(u.ConceptSpecializationExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ConceptSpecializationExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ConceptSpecializationExpr *>(u.ConceptSpecializationExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15595,6 +22481,13 @@ std::vector<::pasta::Stmt> ConceptSpecializationExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConceptSpecializationExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConceptSpecializationExpr *>(u.ConceptSpecializationExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ConceptSpecializationExpr::Satisfaction
 std::vector<::pasta::TemplateArgument> ConceptSpecializationExpr::TemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::ConceptSpecializationExpr *>(u.ConceptSpecializationExpr);
@@ -15643,6 +22536,13 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConditionalOperator::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConditionalOperator::Condition(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getCond();
@@ -15653,6 +22553,16 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConditionalOperator::ConditionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getCond();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConditionalOperator::ConditionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token ConditionalOperator::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getEndLoc();
@@ -15660,6 +22570,13 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConditionalOperator::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConditionalOperator::FalseExpression(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getFalseExpr();
@@ -15670,6 +22587,16 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConditionalOperator::FalseExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getFalseExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConditionalOperator::FalseExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConditionalOperator::LHS(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getLHS();
@@ -15680,6 +22607,16 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConditionalOperator::LHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getLHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConditionalOperator::LHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConditionalOperator::RHS(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getRHS();
@@ -15690,6 +22627,16 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConditionalOperator::RHSRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getRHS();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConditionalOperator::RHSRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConditionalOperator::TrueExpression(void) const noexcept {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.getTrueExpr();
@@ -15700,6 +22647,16 @@ std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConditionalOperator::TrueExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
+  decltype(auto) val = self.getTrueExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConditionalOperator::TrueExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ConstantExpr::ConstantExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -15730,6 +22687,13 @@ std::vector<::pasta::Stmt> ConstantExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConstantExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstantExpr *>(u.ConstantExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ConstantExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ConstantExpr *>(u.ConstantExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15737,6 +22701,13 @@ std::vector<::pasta::Stmt> ConstantExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConstantExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstantExpr *>(u.ConstantExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: ConstantExpr::ResultAPValueKind
 llvm::APSInt ConstantExpr::ResultAsAPSInt(void) const noexcept {
   auto &self = *const_cast<clang::ConstantExpr *>(u.ConstantExpr);
@@ -15795,17 +22766,38 @@ std::vector<::pasta::Stmt> ConvertVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
-::pasta::Token ConvertVectorExpr::BuiltinToken(void) const noexcept {
+::pasta::TokenRef ConvertVectorExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::Token ConvertVectorExpr::BuiltinToken(void) const noexcept {
+  auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return ast->TokenAt(val);
+  __builtin_unreachable();
+}
+
+::pasta::TokenRef ConvertVectorExpr::BuiltinTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
+  decltype(auto) val = self.getBuiltinLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::Token ConvertVectorExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
-  decltype(auto) val = self.getBuiltinLoc();
+  decltype(auto) val = self.getEndLoc();
   return ast->TokenAt(val);
   __builtin_unreachable();
 }
 
-::pasta::Token ConvertVectorExpr::EndToken(void) const noexcept {
+::pasta::TokenRef ConvertVectorExpr::EndTokenRef(void) const noexcept {
   auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
   decltype(auto) val = self.getEndLoc();
-  return ast->TokenAt(val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -15816,6 +22808,13 @@ std::vector<::pasta::Stmt> ConvertVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ConvertVectorExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr ConvertVectorExpr::SrcExpression(void) const noexcept {
   auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
   decltype(auto) val = self.getSrcExpr();
@@ -15826,6 +22825,16 @@ std::vector<::pasta::Stmt> ConvertVectorExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef ConvertVectorExpr::SrcExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
+  decltype(auto) val = self.getSrcExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ConvertVectorExpr::SrcExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: ConvertVectorExpr::
 CoroutineSuspendExpr::CoroutineSuspendExpr(
     std::shared_ptr<ASTImpl> ast_,
@@ -15857,6 +22866,13 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoroutineSuspendExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineSuspendExpr::CommonExpression(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getCommonExpr();
@@ -15867,6 +22883,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::CommonExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getCommonExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::CommonExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoroutineSuspendExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15874,6 +22900,13 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoroutineSuspendExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CoroutineSuspendExpr::KeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getKeywordLoc();
@@ -15881,6 +22914,13 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CoroutineSuspendExpr::KeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::OpaqueValueExpr CoroutineSuspendExpr::OpaqueValue(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getOpaqueValue();
@@ -15891,6 +22931,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::OpaqueValueRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getOpaqueValue();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::OpaqueValueRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineSuspendExpr::Operand(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getOperand();
@@ -15901,6 +22951,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::OperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getOperand();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::OperandRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineSuspendExpr::ReadyExpression(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getReadyExpr();
@@ -15911,6 +22971,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::ReadyExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getReadyExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::ReadyExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineSuspendExpr::ResumeExpression(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getResumeExpr();
@@ -15921,6 +22991,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::ResumeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getResumeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::ResumeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CoroutineSuspendExpr::SuspendExpression(void) const noexcept {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.getSuspendExpr();
@@ -15931,6 +23011,16 @@ std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CoroutineSuspendExpr::SuspendExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
+  decltype(auto) val = self.getSuspendExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CoroutineSuspendExpr::SuspendExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 CoyieldExpr::CoyieldExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -15968,6 +23058,13 @@ std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ValueDecl DeclRefExpr::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.getDecl();
@@ -15978,6 +23075,16 @@ std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef DeclRefExpr::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DeclRefExpr::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token DeclRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.getEndLoc();
@@ -15985,6 +23092,13 @@ std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::NamedDecl DeclRefExpr::FoundDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.getFoundDecl();
@@ -15995,6 +23109,16 @@ std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::DeclRef DeclRefExpr::FoundDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getFoundDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DeclRefExpr::FoundDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token DeclRefExpr::LAngleToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.getLAngleLoc();
@@ -16002,6 +23126,13 @@ std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclRefExpr::LAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getLAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DeclRefExpr::NameInfo
 uint32_t DeclRefExpr::NumTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
@@ -16019,6 +23150,13 @@ uint32_t DeclRefExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclRefExpr::RAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getRAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DeclRefExpr::TemplateArguments
 ::pasta::Token DeclRefExpr::TemplateKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
@@ -16027,6 +23165,13 @@ uint32_t DeclRefExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DeclRefExpr::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool DeclRefExpr::HadMultipleCandidates(void) const noexcept {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.hadMultipleCandidates();
@@ -16105,6 +23250,13 @@ std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentCoawaitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentCoawaitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16112,6 +23264,13 @@ std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentCoawaitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentCoawaitExpr::KeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
   decltype(auto) val = self.getKeywordLoc();
@@ -16119,6 +23278,13 @@ std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentCoawaitExpr::KeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
+  decltype(auto) val = self.getKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentCoawaitExpr::Operand(void) const noexcept {
   auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
   decltype(auto) val = self.getOperand();
@@ -16129,6 +23295,16 @@ std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentCoawaitExpr::OperandRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
+  decltype(auto) val = self.getOperand();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentCoawaitExpr::OperandRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::UnresolvedLookupExpr DependentCoawaitExpr::OperatorCoawaitLookup(void) const noexcept {
   auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
   decltype(auto) val = self.getOperatorCoawaitLookup();
@@ -16139,6 +23315,16 @@ std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentCoawaitExpr::OperatorCoawaitLookupRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
+  decltype(auto) val = self.getOperatorCoawaitLookup();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentCoawaitExpr::OperatorCoawaitLookupRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 DependentScopeDeclRefExpr::DependentScopeDeclRefExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -16167,6 +23353,13 @@ std::vector<::pasta::Stmt> DependentScopeDeclRefExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentScopeDeclRefExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DependentScopeDeclRefExpr::DeclarationName
 ::pasta::Token DependentScopeDeclRefExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
@@ -16175,6 +23368,13 @@ std::vector<::pasta::Stmt> DependentScopeDeclRefExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentScopeDeclRefExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentScopeDeclRefExpr::LAngleToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
   decltype(auto) val = self.getLAngleLoc();
@@ -16182,6 +23382,13 @@ std::vector<::pasta::Stmt> DependentScopeDeclRefExpr::Children(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentScopeDeclRefExpr::LAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
+  decltype(auto) val = self.getLAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DependentScopeDeclRefExpr::NameInfo
 uint32_t DependentScopeDeclRefExpr::NumTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
@@ -16199,6 +23406,13 @@ uint32_t DependentScopeDeclRefExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentScopeDeclRefExpr::RAngleTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
+  decltype(auto) val = self.getRAngleLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DependentScopeDeclRefExpr::TemplateArguments
 ::pasta::Token DependentScopeDeclRefExpr::TemplateKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
@@ -16207,6 +23421,13 @@ uint32_t DependentScopeDeclRefExpr::NumTemplateArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentScopeDeclRefExpr::TemplateKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
+  decltype(auto) val = self.getTemplateKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool DependentScopeDeclRefExpr::HasExplicitTemplateArguments(void) const noexcept {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
   decltype(auto) val = self.hasExplicitTemplateArgs();
@@ -16264,6 +23485,13 @@ std::vector<::pasta::Designator> DesignatedInitExpr::Designators(void) const noe
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DesignatedInitExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Designator> DesignatedInitExpr::Designator(unsigned int idx) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   if (idx >= self.designators().size()) {
@@ -16286,6 +23514,13 @@ std::optional<::pasta::Designator> DesignatedInitExpr::Designator(unsigned int i
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange DesignatedInitExpr::DesignatorsSourceRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
+  decltype(auto) val = self.getDesignatorsSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DesignatedInitExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16293,6 +23528,13 @@ std::optional<::pasta::Designator> DesignatedInitExpr::Designator(unsigned int i
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DesignatedInitExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DesignatedInitExpr::EqualOrColonToken(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   decltype(auto) val = self.getEqualOrColonLoc();
@@ -16300,6 +23542,13 @@ std::optional<::pasta::Designator> DesignatedInitExpr::Designator(unsigned int i
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DesignatedInitExpr::EqualOrColonTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
+  decltype(auto) val = self.getEqualOrColonLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DesignatedInitExpr::Initializer(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   decltype(auto) val = self.getInit();
@@ -16310,6 +23559,16 @@ std::optional<::pasta::Designator> DesignatedInitExpr::Designator(unsigned int i
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DesignatedInitExpr::InitializerRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
+  decltype(auto) val = self.getInit();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DesignatedInitExpr::InitializerRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t DesignatedInitExpr::NumSubExpressions(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   decltype(auto) val = self.getNumSubExprs();
@@ -16386,6 +23645,16 @@ std::vector<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DesignatedInitUpdateExpr::BaseRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
+  decltype(auto) val = self.getBase();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DesignatedInitUpdateExpr::BaseRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token DesignatedInitUpdateExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -16393,6 +23662,13 @@ std::vector<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DesignatedInitUpdateExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DesignatedInitUpdateExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16400,6 +23676,13 @@ std::vector<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DesignatedInitUpdateExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::InitListExpr DesignatedInitUpdateExpr::Updater(void) const noexcept {
   auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
   decltype(auto) val = self.getUpdater();
@@ -16410,6 +23693,16 @@ std::vector<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const noexce
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DesignatedInitUpdateExpr::UpdaterRef(void) const noexcept {
+  auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
+  decltype(auto) val = self.getUpdater();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DesignatedInitUpdateExpr::UpdaterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ExplicitCastExpr::ExplicitCastExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -16437,6 +23730,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ExplicitCastExpr, ObjCBridgedCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ExplicitCastExpr::TypeAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExplicitCastExpr *>(u.ExplicitCastExpr);
+  decltype(auto) val = self.getTypeAsWritten();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ExplicitCastExpr::TypeInfoAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::ExplicitCastExpr *>(u.ExplicitCastExpr);
   decltype(auto) val = self.getTypeInfoAsWritten();
@@ -16481,6 +23782,13 @@ bool ExprWithCleanups::CleanupsHaveSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExprWithCleanups::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExprWithCleanups *>(u.ExprWithCleanups);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ExprWithCleanups::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ExprWithCleanups *>(u.ExprWithCleanups);
   decltype(auto) val = self.getEndLoc();
@@ -16488,6 +23796,13 @@ bool ExprWithCleanups::CleanupsHaveSideEffects(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ExprWithCleanups::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExprWithCleanups *>(u.ExprWithCleanups);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ExprWithCleanups::NumObjects(void) const noexcept {
   auto &self = *const_cast<clang::ExprWithCleanups *>(u.ExprWithCleanups);
   decltype(auto) val = self.getNumObjects();
@@ -16538,6 +23853,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ImplicitCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImplicitCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImplicitCastExpr *>(u.ImplicitCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ImplicitCastExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::ImplicitCastExpr *>(u.ImplicitCastExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16545,6 +23867,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ImplicitCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ImplicitCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ImplicitCastExpr *>(u.ImplicitCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ImplicitCastExpr::IsPartOfExplicitCast(void) const noexcept {
   auto &self = *const_cast<clang::ImplicitCastExpr *>(u.ImplicitCastExpr);
   decltype(auto) val = self.isPartOfExplicitCast();
@@ -16557,15 +23886,25 @@ OMPAtomicDirective::OMPAtomicDirective(
     const ::clang::Stmt *stmt_)
     : OMPExecutableDirective(std::move(ast_), stmt_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(OMPExecutableDirective, OMPAtomicDirective)
-PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
-::pasta::Expr OMPAtomicDirective::ConditionExpression(void) const noexcept {
+PASTA_DEFINE_BASE_OPERATORS(OMPExecutableDirective, OMPAtomicDirective)
+PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
+::pasta::Expr OMPAtomicDirective::ConditionExpression(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getCondExpr();
+  if (val) {
+    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+  }
+  assert(false && "OMPAtomicDirective::ConditionExpression can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::StmtRef OMPAtomicDirective::ConditionExpressionRef(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getCondExpr();
   if (val) {
-    return StmtBuilder::Create<::pasta::Expr>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "OMPAtomicDirective::ConditionExpression can return nullptr!");
+  assert(false && "OMPAtomicDirective::ConditionExpressionRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -16579,6 +23918,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::DRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getD();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::DRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAtomicDirective::Expression(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getExpr();
@@ -16589,6 +23938,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::ExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::ExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAtomicDirective::R(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getR();
@@ -16599,6 +23958,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::RRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getR();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::RRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAtomicDirective::UpdateExpression(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getUpdateExpr();
@@ -16609,6 +23978,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::UpdateExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getUpdateExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::UpdateExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAtomicDirective::V(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getV();
@@ -16619,6 +23998,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::VRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getV();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::VRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr OMPAtomicDirective::X(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.getX();
@@ -16629,6 +24018,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPAtomicDirective::XRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
+  decltype(auto) val = self.getX();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPAtomicDirective::XRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPAtomicDirective::IsFailOnly(void) const noexcept {
   auto &self = *const_cast<clang::OMPAtomicDirective *>(u.OMPAtomicDirective);
   decltype(auto) val = self.isFailOnly();
@@ -16702,6 +24101,13 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPDispatchDirective)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef OMPDispatchDirective::TargetCallTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDispatchDirective *>(u.OMPDispatchDirective);
+  decltype(auto) val = self.getTargetCallLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 OMPDistributeDirective::OMPDistributeDirective(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -16730,6 +24136,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPDistributeParallelForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPDistributeParallelForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPDistributeParallelForDirective *>(u.OMPDistributeParallelForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPDistributeParallelForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPDistributeParallelForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPDistributeParallelForDirective *>(u.OMPDistributeParallelForDirective);
   decltype(auto) val = self.hasCancel();
@@ -16774,6 +24190,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPForDirective)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef OMPForDirective::TaskReductionReferenceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::OMPForDirective *>(u.OMPForDirective);
+  decltype(auto) val = self.getTaskReductionRefExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "OMPForDirective::TaskReductionReferenceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool OMPForDirective::HasCancel(void) const noexcept {
   auto &self = *const_cast<clang::OMPForDirective *>(u.OMPForDirective);
   decltype(auto) val = self.hasCancel();
@@ -16816,6 +24242,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCBridgedCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBridgedCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBridgedCastExpr::BridgeKeywordToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
   decltype(auto) val = self.getBridgeKeywordLoc();
@@ -16823,6 +24256,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCBridgedCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBridgedCastExpr::BridgeKeywordTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
+  decltype(auto) val = self.getBridgeKeywordLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ObjCBridgeCastKind ObjCBridgedCastExpr::BridgeKind(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
   decltype(auto) val = self.getBridgeKind();
@@ -16848,6 +24288,13 @@ std::string_view ObjCBridgedCastExpr::BridgeKindName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBridgedCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token ObjCBridgedCastExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -16855,6 +24302,13 @@ std::string_view ObjCBridgedCastExpr::BridgeKindName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef ObjCBridgedCastExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 UserDefinedLiteral::UserDefinedLiteral(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -16871,6 +24325,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UserDefinedLiteral)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UserDefinedLiteral::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr UserDefinedLiteral::CookedLiteral(void) const noexcept {
   auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
   decltype(auto) val = self.getCookedLiteral();
@@ -16881,6 +24342,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UserDefinedLiteral)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef UserDefinedLiteral::CookedLiteralRef(void) const noexcept {
+  auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
+  decltype(auto) val = self.getCookedLiteral();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UserDefinedLiteral::CookedLiteralRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token UserDefinedLiteral::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
   decltype(auto) val = self.getEndLoc();
@@ -16888,6 +24359,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UserDefinedLiteral)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UserDefinedLiteral::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum UserDefinedLiteralLiteralOperatorKind UserDefinedLiteral::LiteralOperatorKind(void) const noexcept {
   auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
   decltype(auto) val = self.getLiteralOperatorKind();
@@ -16903,6 +24381,13 @@ enum UserDefinedLiteralLiteralOperatorKind UserDefinedLiteral::LiteralOperatorKi
   __builtin_unreachable();
 }
 
+::pasta::TokenRef UserDefinedLiteral::UDSuffixTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral);
+  decltype(auto) val = self.getUDSuffixLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> UserDefinedLiteral::Arguments(void) const noexcept {
   std::vector<::pasta::Expr> ret;
   auto convert_elem = [&] (const clang::Expr * val) {
@@ -16936,6 +24421,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, BuiltinBitCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BuiltinBitCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BuiltinBitCastExpr *>(u.BuiltinBitCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token BuiltinBitCastExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::BuiltinBitCastExpr *>(u.BuiltinBitCastExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16943,6 +24435,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, BuiltinBitCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef BuiltinBitCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::BuiltinBitCastExpr *>(u.BuiltinBitCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CStyleCastExpr::CStyleCastExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -16960,6 +24459,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CStyleCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CStyleCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CStyleCastExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
   decltype(auto) val = self.getEndLoc();
@@ -16967,6 +24473,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CStyleCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CStyleCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CStyleCastExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -16974,6 +24487,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CStyleCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CStyleCastExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CStyleCastExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -16981,6 +24501,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CStyleCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CStyleCastExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CUDAKernelCallExpr::CUDAKernelCallExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -17000,6 +24527,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CUDAKernelCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CUDAKernelCallExpr::ConfigRef(void) const noexcept {
+  auto &self = *const_cast<clang::CUDAKernelCallExpr *>(u.CUDAKernelCallExpr);
+  decltype(auto) val = self.getConfig();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CUDAKernelCallExpr::ConfigRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> CUDAKernelCallExpr::Arguments(void) const noexcept {
   std::vector<::pasta::Expr> ret;
   auto convert_elem = [&] (const clang::Expr * val) {
@@ -17033,6 +24570,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXFunctionalCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFunctionalCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFunctionalCastExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
   decltype(auto) val = self.getEndLoc();
@@ -17040,6 +24584,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXFunctionalCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFunctionalCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFunctionalCastExpr::LParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
   decltype(auto) val = self.getLParenLoc();
@@ -17047,6 +24598,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXFunctionalCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFunctionalCastExpr::LParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
+  decltype(auto) val = self.getLParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXFunctionalCastExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -17054,6 +24612,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXFunctionalCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXFunctionalCastExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXFunctionalCastExpr::IsListInitialization(void) const noexcept {
   auto &self = *const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr);
   decltype(auto) val = self.isListInitialization();
@@ -17077,6 +24642,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXMemberCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXMemberCallExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr CXXMemberCallExpr::ImplicitObjectArgument(void) const noexcept {
   auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
   decltype(auto) val = self.getImplicitObjectArgument();
@@ -17087,6 +24659,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXMemberCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef CXXMemberCallExpr::ImplicitObjectArgumentRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
+  decltype(auto) val = self.getImplicitObjectArgument();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXMemberCallExpr::ImplicitObjectArgumentRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXMethodDecl> CXXMemberCallExpr::MethodDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
   decltype(auto) val = self.getMethodDecl();
@@ -17099,6 +24681,18 @@ std::optional<::pasta::CXXMethodDecl> CXXMemberCallExpr::MethodDeclaration(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> CXXMemberCallExpr::MethodDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
+  decltype(auto) val = self.getMethodDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Type CXXMemberCallExpr::ObjectType(void) const noexcept {
   auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
   decltype(auto) val = self.getObjectType();
@@ -17107,6 +24701,14 @@ std::optional<::pasta::CXXMethodDecl> CXXMemberCallExpr::MethodDeclaration(void)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef CXXMemberCallExpr::ObjectTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
+  decltype(auto) val = self.getObjectType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl CXXMemberCallExpr::RecordDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
   decltype(auto) val = self.getRecordDecl();
@@ -17117,6 +24719,16 @@ std::optional<::pasta::CXXMethodDecl> CXXMemberCallExpr::MethodDeclaration(void)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef CXXMemberCallExpr::RecordDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXMemberCallExpr *>(u.CXXMemberCallExpr);
+  decltype(auto) val = self.getRecordDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "CXXMemberCallExpr::RecordDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Expr> CXXMemberCallExpr::Arguments(void) const noexcept {
   std::vector<::pasta::Expr> ret;
   auto convert_elem = [&] (const clang::Expr * val) {
@@ -17155,6 +24767,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(CXXNamedCastExpr, CXXStaticCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXNamedCastExpr::AngleBracketsRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
+  decltype(auto) val = self.getAngleBrackets();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNamedCastExpr::BeginToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
   decltype(auto) val = self.getBeginLoc();
@@ -17162,6 +24781,13 @@ PASTA_DEFINE_DERIVED_OPERATORS(CXXNamedCastExpr, CXXStaticCastExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNamedCastExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::string_view CXXNamedCastExpr::CastName(void) const noexcept {
   auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
   decltype(auto) val = self.getCastName();
@@ -17181,6 +24807,13 @@ std::string_view CXXNamedCastExpr::CastName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNamedCastExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNamedCastExpr::OperatorToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
   decltype(auto) val = self.getOperatorLoc();
@@ -17188,6 +24821,13 @@ std::string_view CXXNamedCastExpr::CastName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNamedCastExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXNamedCastExpr::RParenToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
   decltype(auto) val = self.getRParenLoc();
@@ -17195,6 +24835,13 @@ std::string_view CXXNamedCastExpr::CastName(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXNamedCastExpr::RParenTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr);
+  decltype(auto) val = self.getRParenLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 CXXOperatorCallExpr::CXXOperatorCallExpr(
     std::shared_ptr<ASTImpl> ast_,
     const ::clang::Stmt *stmt_)
@@ -17211,6 +24858,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXOperatorCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXOperatorCallExpr::BeginTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
+  decltype(auto) val = self.getBeginLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXOperatorCallExpr::EndToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
   decltype(auto) val = self.getEndLoc();
@@ -17218,6 +24872,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXOperatorCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXOperatorCallExpr::EndTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
+  decltype(auto) val = self.getEndLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token CXXOperatorCallExpr::ExpressionToken(void) const noexcept {
   auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
   decltype(auto) val = self.getExprLoc();
@@ -17225,6 +24886,13 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXOperatorCallExpr)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXOperatorCallExpr::ExpressionTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
+  decltype(auto) val = self.getExprLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum OverloadedOperatorKind CXXOperatorCallExpr::Operator(void) const noexcept {
   auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
   decltype(auto) val = self.getOperator();
@@ -17239,6 +24907,13 @@ enum OverloadedOperatorKind CXXOperatorCallExpr::Operator(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef CXXOperatorCallExpr::OperatorTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
+  decltype(auto) val = self.getOperatorLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange CXXOperatorCallExpr::Tokens(void) const noexcept {
   auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
   decltype(auto) val = self.getSourceRange();
@@ -17246,6 +24921,13 @@ enum OverloadedOperatorKind CXXOperatorCallExpr::Operator(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange CXXOperatorCallExpr::TokensRef(void) const noexcept {
+  auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
+  decltype(auto) val = self.getSourceRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool CXXOperatorCallExpr::IsAssignmentOperation(void) const noexcept {
   auto &self = *const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr);
   decltype(auto) val = self.isAssignmentOp();
@@ -17361,5 +25043,19 @@ bool CXXDynamicCastExpr::IsAlwaysNull(void) const noexcept {
   __builtin_unreachable();
 }
 
+StmtRef::StmtRef(ASTImpl *ast_, const ::clang::Stmt *stmt_)
+    : ast(ast_),
+      stmt(stmt_),
+      kind(static_cast<StmtKind>(stmt_->getStmtClass())) {}
+
+std::string_view StmtRef::KindName(void) const noexcept {
+  return stmt->getStmtClassName();
+}
+
+::pasta::Stmt StmtRef::Owned(void) const {
+  return StmtBuilder::Create<::pasta::Stmt>(
+      ast->shared_from_this(), stmt);
+}
+
 }  // namespace pasta
 #endif  // PASTA_IN_BOOTSTRAP
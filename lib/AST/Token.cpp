@@ -22,7 +22,9 @@
 #pragma GCC diagnostic pop
 
 #include "AST.h"
+#include "LazyAlignment.h"
 #include "Printer/Printer.h"
+#include "../Util/FileManager.h"
 
 namespace pasta {
 namespace {
@@ -243,14 +245,11 @@ const TokenContextImpl *TokenContextImpl::Parent(
     return nullptr;
   }
 
-  if (parent_index >= contexts.size()) {
-    assert(false);
-    return nullptr;
-  }
-
-  auto first_context = &(contexts.front());
-  auto last_context = &(contexts.back());
-  if (this < first_context || this > last_context) {
+  // NOTE(pag): This doesn't look at `contexts.size()`, as lazy alignment may be
+  //            appending to `contexts` on another thread. A parent precedes its
+  //            children, so checking against the index of `this` is enough.
+  auto first_context = contexts.data();
+  if (this < first_context || this >= &(first_context[contexts.capacity()])) {
     assert(false);
     return nullptr;
   }
@@ -272,14 +271,9 @@ const TokenContextImpl *TokenContextImpl::Aliasee(
   auto alias_index = reinterpret_cast<uintptr_t>(data);
   assert(alias_index == static_cast<TokenContextIndex>(alias_index));
 
-  if (alias_index >= contexts.size()) {
-    assert(false);
-    return this;
-  }
-
-  auto first_context = &(contexts.front());
-  auto last_context = &(contexts.back());
-  if (this < first_context || this > last_context) {
+  // NOTE(pag): Like in `Parent`, an aliasee precedes its alias.
+  auto first_context = contexts.data();
+  if (this < first_context || this >= &(first_context[contexts.capacity()])) {
     assert(false);
     return this;
   }
@@ -428,26 +422,14 @@ std::optional<FileToken> Token::FileLocation(void) const {
     return std::nullopt;
   }
 
-  size_t tok_index = Index();
-  size_t max_index = ast->tokens.size();
-
-  clang::SourceLocation loc;
-  while (tok_index < max_index) {
-    const TokenImpl &tok = ast->tokens[tok_index];
-    loc = tok.Location();
-    if (loc.isInvalid()) {
-      return std::nullopt;
-
-    } else if (loc.isFileID()) {
-      break;
-
-    } else {
-      max_index = tok_index;
-      tok_index = tok.derived_index;
-    }
+  const TokenFileLocation *loc = ast->FileLocationOf(Index());
+  if (!loc) {
+    return std::nullopt;
   }
 
-  return ast->FileTokenAt(loc);
+  const File &file = ast->token_location_files[loc->file_index];
+  FileTokenImpl * const file_tokens = file.impl->tokens.data();
+  return FileToken(file.impl, &(file_tokens[loc->file_token_index]));
 }
 
 // Location of the token in a macro expansion.
@@ -552,9 +534,15 @@ const TokenContextImpl *TokenImpl::Context(
       break;
   }
 
+  // NOTE(pag): With lazy alignment, `contexts` may be growing on another
+  //            thread, so only the published prefix of it is safe to look at.
+  const size_t num_contexts = ast.lazy_alignment ?
+      ast.lazy_alignment->num_contexts.load(std::memory_order_acquire) :
+      contexts.size();
+
   if (ci == kInvalidTokenContextIndex) {
     return nullptr;
-  } else if (ci >= contexts.size()) {
+  } else if (ci >= num_contexts) {
     assert(false);
     return nullptr;
   } else {
@@ -566,7 +554,9 @@ const TokenContextImpl *TokenImpl::Context(
 std::optional<TokenContext> Token::Context(void) const noexcept {
   if (!impl) {
     return std::nullopt;
-  } else if (auto context = impl->Context(*ast, ast->contexts)) {
+  }
+
+  if (auto context = ast->TokenContextOf(impl)) {
     std::shared_ptr<const std::vector<TokenContextImpl>> contexts(
         ast, &(ast->contexts));
     return TokenContext(context, std::move(contexts));
@@ -686,6 +676,204 @@ Token TokenRange::operator[](size_t index) const {
   return Token(ast, &(first[index]));
 }
 
+// Returns the column indices of `[first, after_last)` if the range is backed
+// by `ast.tokens` and `ast.token_columns` mirrors those tokens.
+static bool ColumnBounds(ASTImpl &ast, const TokenImpl *first,
+                         const TokenImpl *after_last, size_t &begin,
+                         size_t &end) {
+  ast.Rehydrate();
+  if (!ast.token_columns.Mirrors(ast.tokens, ast.tokens_version)) {
+    return false;
+  }
+  const TokenImpl *tokens_begin = ast.tokens.data();
+  const TokenImpl *tokens_end = &(tokens_begin[ast.tokens.size()]);
+  if (first < tokens_begin || after_last > tokens_end) {
+    return false;
+  }
+  begin = static_cast<size_t>(first - tokens_begin);
+  end = static_cast<size_t>(after_last - tokens_begin);
+  return true;
+}
+
+// Return the first token in this range whose kind is `kind`, if any.
+std::optional<Token> TokenRange::FindFirst(TokenKind kind) const noexcept {
+  if (!first || !after_last) {
+    return std::nullopt;
+  }
+
+  const auto kind_val = static_cast<TokenKindBase>(kind);
+  size_t begin = 0u;
+  size_t end = 0u;
+  if (ColumnBounds(*ast, first, after_last, begin, end)) {
+    if (auto i = ast->token_columns.FindKind(begin, end, kind_val); i < end) {
+      return Token(ast, &(ast->tokens[i]));
+    }
+    return std::nullopt;
+  }
+
+  for (auto tok = first; tok < after_last; ++tok) {
+    if (tok->kind == kind_val) {
+      return Token(ast, tok);
+    }
+  }
+  return std::nullopt;
+}
+
+// Return the first token in this range whose role is `role`, if any.
+std::optional<Token> TokenRange::FindFirst(TokenRole role) const noexcept {
+  if (!first || !after_last) {
+    return std::nullopt;
+  }
+
+  size_t begin = 0u;
+  size_t end = 0u;
+  if (ColumnBounds(*ast, first, after_last, begin, end)) {
+    const auto role_val = static_cast<TokenKindBase>(role);
+    if (auto i = ast->token_columns.FindRole(begin, end, role_val); i < end) {
+      return Token(ast, &(ast->tokens[i]));
+    }
+    return std::nullopt;
+  }
+
+  for (auto tok = first; tok < after_last; ++tok) {
+    if (tok->Role() == role) {
+      return Token(ast, tok);
+    }
+  }
+  return std::nullopt;
+}
+
+// Number of tokens in this range whose kind is `kind`.
+size_t TokenRange::Count(TokenKind kind) const noexcept {
+  if (!first || !after_last) {
+    return 0u;
+  }
+
+  const auto kind_val = static_cast<TokenKindBase>(kind);
+  size_t begin = 0u;
+  size_t end = 0u;
+  if (ColumnBounds(*ast, first, after_last, begin, end)) {
+    return ast->token_columns.CountKind(begin, end, kind_val);
+  }
+
+  size_t count = 0u;
+  for (auto tok = first; tok < after_last; ++tok) {
+    count += tok->kind == kind_val;
+  }
+  return count;
+}
+
+// Return a borrowed view of this range.
+TokenRefRange TokenRange::Borrow(void) const noexcept {
+  return TokenRefRange(ast.get(), first, after_last);
+}
+
+// Locations in files of the tokens in this range, one per token.
+std::vector<std::optional<FileToken>> TokenRange::FileLocations(void) const {
+  std::vector<std::optional<FileToken>> locs;
+  if (!first || !after_last) {
+    return locs;
+  }
+
+  const TokenImpl *tokens_begin = ast->tokens.data();
+  locs.reserve(static_cast<size_t>(after_last - first));
+
+  // NOTE(pag): Every returned `FileToken` holds its own reference to its
+  //            file. What's saved over `Token::FileLocation` is making a
+  //            `Token`, and so referencing the `AST`, per token.
+  uint32_t last_file_index = TokenFileLocation::kInvalidFileIndex;
+  const std::shared_ptr<FileImpl> *file = nullptr;
+  FileTokenImpl *file_tokens = nullptr;
+
+  for (auto tok = first; tok < after_last; ++tok) {
+    const TokenFileLocation *loc =
+        ast->FileLocationOf(static_cast<size_t>(tok - tokens_begin));
+    if (!loc) {
+      locs.emplace_back(std::nullopt);
+      continue;
+    }
+
+    if (loc->file_index != last_file_index) {
+      last_file_index = loc->file_index;
+      file = &(ast->token_location_files[last_file_index].impl);
+      file_tokens = (*file)->tokens.data();
+    }
+
+    locs.emplace_back(FileToken(*file, &(file_tokens[loc->file_token_index])));
+  }
+  return locs;
+}
+
+// Return an owning version of this token.
+Token TokenRef::Owned(void) const {
+  auto self = ast->shared_from_this();
+  if (impl) {
+    return Token(std::move(self), impl);
+  } else {
+    return Token(std::move(self));
+  }
+}
+
+// Return the data associated with this token.
+std::string_view TokenRef::Data(void) const {
+  if (!impl) {
+    return {};
+  } else {
+    return impl->Data(*ast);
+  }
+}
+
+// Index of this token in the AST's token list.
+uint64_t TokenRef::Index(void) const {
+  if (impl) {
+    return static_cast<uint64_t>(impl - ast->tokens.data());
+  } else {
+    return std::numeric_limits<uint64_t>::max();
+  }
+}
+
+// Kind of this token.
+TokenKind TokenRef::Kind(void) const noexcept {
+  if (impl) {
+    return static_cast<TokenKind>(impl->Kind());
+  } else {
+    return TokenKind::kUnknown;
+  }
+}
+
+// Return the role of this token.
+TokenRole TokenRef::Role(void) const noexcept {
+  if (impl) {
+    return impl->Role();
+  } else {
+    return TokenRole::kInvalid;
+  }
+}
+
+// Kind of this token.
+const char *TokenRef::KindName(void) const noexcept {
+  if (impl) {
+    return clang::tok::getTokenName(impl->Kind());
+  } else {
+    return clang::tok::getTokenName(clang::tok::unknown);
+  }
+}
+
+// Return this token's context, or a null context.
+std::optional<TokenContext> TokenRef::Context(void) const noexcept {
+  if (!impl) {
+    return std::nullopt;
+  }
+
+  if (auto context = ast->TokenContextOf(impl)) {
+    std::shared_ptr<const std::vector<TokenContextImpl>> contexts(
+        ast->shared_from_this(), &(ast->contexts));
+    return TokenContext(context, std::move(contexts));
+  } else {
+    return std::nullopt;
+  }
+}
+
 // Strip off leading whitespace from a token that has been read.
 void SkipLeadingWhitspace(clang::Token &tok, clang::SourceLocation &tok_loc,
                           std::string &tok_data) {
@@ -217,7 +217,9 @@ class TokenImpl {
     return static_cast<clang::tok::TokenKind>(kind);
   }
 
-  // Return the context of this token, or `nullptr`.
+  // Return the context of this token, or `nullptr`. With lazy alignment, the
+  // context isn't there until the token's group is aligned, so readers go
+  // through `ASTImpl::TokenContextOf` instead.
   const TokenContextImpl *Context(
       const ASTImpl &ast,
       const std::vector<TokenContextImpl> &contexts) const noexcept;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "TokenColumns.h"
+
+#include <cstdint>
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#  include <arm_neon.h>
+#endif
+
+namespace pasta {
+namespace {
+
+static_assert(sizeof(TokenKindBase) == sizeof(uint16_t),
+              "Vectorized scans assume 16-bit token kinds and roles");
+
+// Return the index of the first element of `data[begin, end)` equal to `val`,
+// or `end`.
+static size_t FindFirst(const TokenKindBase *data, size_t begin, size_t end,
+                        TokenKindBase val) noexcept {
+  auto i = begin;
+
+#if defined(__SSE2__)
+  const __m128i needle = _mm_set1_epi16(static_cast<short>(val));
+  for (; i + 8u <= end; i += 8u) {
+    const __m128i chunk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(&(data[i])));
+    const auto mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle)));
+    if (mask) {
+      return i + (static_cast<unsigned>(__builtin_ctz(mask)) / 2u);
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint16x8_t needle = vdupq_n_u16(val);
+  for (; i + 8u <= end; i += 8u) {
+    const uint16x8_t eq = vceqq_u16(vld1q_u16(&(data[i])), needle);
+    if (vmaxvq_u16(eq)) {
+      break;  // The scalar loop below finds the exact position.
+    }
+  }
+#endif
+
+  for (; i < end; ++i) {
+    if (data[i] == val) {
+      return i;
+    }
+  }
+  return end;
+}
+
+// Return the number of elements of `data[begin, end)` equal to `val`.
+static size_t CountEqual(const TokenKindBase *data, size_t begin, size_t end,
+                         TokenKindBase val) noexcept {
+  size_t count = 0u;
+  auto i = begin;
+
+#if defined(__SSE2__)
+  const __m128i needle = _mm_set1_epi16(static_cast<short>(val));
+  for (; i + 8u <= end; i += 8u) {
+    const __m128i chunk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(&(data[i])));
+    const auto mask = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle)));
+    count += static_cast<size_t>(__builtin_popcount(mask)) / 2u;
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint16x8_t needle = vdupq_n_u16(val);
+  for (; i + 8u <= end; i += 8u) {
+    const uint16x8_t eq = vceqq_u16(vld1q_u16(&(data[i])), needle);
+    count += vaddvq_u16(vshrq_n_u16(eq, 15));
+  }
+#endif
+
+  for (; i < end; ++i) {
+    count += data[i] == val;
+  }
+  return count;
+}
+
+}  // namespace
+
+// Fill in the columns from `tokens`, whose version is `tokens_version`.
+void TokenColumns::Build(const std::vector<TokenImpl> &tokens,
+                         uint32_t tokens_version) {
+  Clear();
+
+  const auto num_tokens = tokens.size();
+  kinds.reserve(num_tokens);
+  roles.reserve(num_tokens);
+
+  for (const TokenImpl &tok : tokens) {
+    kinds.push_back(tok.kind);
+    roles.push_back(static_cast<TokenKindBase>(tok.Role()));
+  }
+
+  version = tokens_version;
+}
+
+// Drop the columns.
+void TokenColumns::Clear(void) {
+  kinds.clear();
+  roles.clear();
+}
+
+// Return the index of the first token in `[begin, end)` whose kind is
+// `kind`, or `end` if there is no such token.
+size_t TokenColumns::FindKind(size_t begin, size_t end,
+                              TokenKindBase kind) const noexcept {
+  return FindFirst(kinds.data(), begin, end, kind);
+}
+
+// Return the index of the first token in `[begin, end)` whose role is
+// `role`, or `end` if there is no such token.
+size_t TokenColumns::FindRole(size_t begin, size_t end,
+                              TokenKindBase role) const noexcept {
+  return FindFirst(roles.data(), begin, end, role);
+}
+
+// Return the number of tokens in `[begin, end)` whose kind is `kind`.
+size_t TokenColumns::CountKind(size_t begin, size_t end,
+                               TokenKindBase kind) const noexcept {
+  return CountEqual(kinds.data(), begin, end, kind);
+}
+
+}  // namespace pasta
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Token.h"
+
+namespace pasta {
+
+// Structure-of-arrays copy of the hot fields of `ASTImpl::tokens`. Most scans
+// over the tokens only look at one or two fields, e.g. only the kind, or only
+// the role; keeping each field in its own contiguous array means that those
+// scans touch a fraction of the memory, and that they can be vectorized.
+//
+// Only the fields that scans actually read are mirrored, i.e. the kinds and
+// the roles.
+//
+// NOTE(pag): This is a read-only mirror, built once the tokens of an AST are
+//            final. Anything that changes the kinds or roles of
+//            `ASTImpl::tokens` in place must bump `ASTImpl::tokens_version`,
+//            which makes the columns stop mirroring the tokens until they are
+//            re-`Build`t.
+class TokenColumns {
+ public:
+  std::vector<TokenKindBase> kinds;
+  std::vector<TokenKindBase> roles;
+
+  // Value of `ASTImpl::tokens_version` when the columns were built.
+  uint32_t version{0u};
+
+  // Fill in the columns from `tokens`, whose version is `tokens_version`.
+  void Build(const std::vector<TokenImpl> &tokens, uint32_t tokens_version);
+
+  // Drop the columns.
+  void Clear(void);
+
+  // Do these columns mirror `tokens`, whose version is `tokens_version`?
+  inline bool Mirrors(const std::vector<TokenImpl> &tokens,
+                      uint32_t tokens_version) const noexcept {
+    return !kinds.empty() && kinds.size() == tokens.size() &&
+           version == tokens_version;
+  }
+
+  // Return the index of the first token in `[begin, end)` whose kind is
+  // `kind`, or `end` if there is no such token.
+  size_t FindKind(size_t begin, size_t end, TokenKindBase kind) const noexcept;
+
+  // Return the index of the first token in `[begin, end)` whose role is
+  // `role`, or `end` if there is no such token.
+  size_t FindRole(size_t begin, size_t end, TokenKindBase role) const noexcept;
+
+  // Return the number of tokens in `[begin, end)` whose kind is `kind`.
+  size_t CountKind(size_t begin, size_t end, TokenKindBase kind) const noexcept;
+};
+
+}  // namespace pasta
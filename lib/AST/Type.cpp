@@ -434,6 +434,18 @@ std::optional<::pasta::Type> Type::ArrayElementTypeNoTypeQualified(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::ArrayElementTypeNoTypeQualifiedRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getArrayElementTypeNoTypeQual();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::CXXRecordDecl> Type::AsCXXRecordDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsCXXRecordDecl();
@@ -446,6 +458,18 @@ std::optional<::pasta::CXXRecordDecl> Type::AsCXXRecordDeclaration(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Type::AsCXXRecordDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsCXXRecordDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ComplexType> Type::AsComplexIntegerType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsComplexIntegerType();
@@ -458,6 +482,18 @@ std::optional<::pasta::ComplexType> Type::AsComplexIntegerType(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsComplexIntegerTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsComplexIntegerType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCInterfacePointerType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsObjCInterfacePointerType();
@@ -470,6 +506,18 @@ std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCInterfacePointerType(v
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsObjCInterfacePointerTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsObjCInterfacePointerType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ObjCObjectType> Type::AsObjCInterfaceType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsObjCInterfaceType();
@@ -482,6 +530,18 @@ std::optional<::pasta::ObjCObjectType> Type::AsObjCInterfaceType(void) const noe
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsObjCInterfaceTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsObjCInterfaceType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCQualifiedClassType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsObjCQualifiedClassType();
@@ -494,6 +554,18 @@ std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCQualifiedClassType(voi
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsObjCQualifiedClassTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsObjCQualifiedClassType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCQualifiedIdType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsObjCQualifiedIdType();
@@ -506,6 +578,18 @@ std::optional<::pasta::ObjCObjectPointerType> Type::AsObjCQualifiedIdType(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsObjCQualifiedIdTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsObjCQualifiedIdType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::ObjCObjectType> Type::AsObjCQualifiedInterfaceType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsObjCQualifiedInterfaceType();
@@ -518,6 +602,18 @@ std::optional<::pasta::ObjCObjectType> Type::AsObjCQualifiedInterfaceType(void)
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsObjCQualifiedInterfaceTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsObjCQualifiedInterfaceType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::BuiltinType> Type::AsPlaceholderType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsPlaceholderType();
@@ -530,6 +626,18 @@ std::optional<::pasta::BuiltinType> Type::AsPlaceholderType(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsPlaceholderTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsPlaceholderType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::RecordDecl> Type::AsRecordDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsRecordDecl();
@@ -542,6 +650,18 @@ std::optional<::pasta::RecordDecl> Type::AsRecordDeclaration(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Type::AsRecordDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsRecordDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::RecordType> Type::AsStructureType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsStructureType();
@@ -554,6 +674,18 @@ std::optional<::pasta::RecordType> Type::AsStructureType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsStructureTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsStructureType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TagDecl> Type::AsTagDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsTagDecl();
@@ -566,6 +698,18 @@ std::optional<::pasta::TagDecl> Type::AsTagDeclaration(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Type::AsTagDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsTagDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::RecordType> Type::AsUnionType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getAsUnionType();
@@ -578,6 +722,18 @@ std::optional<::pasta::RecordType> Type::AsUnionType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::AsUnionTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getAsUnionType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 ::pasta::Type Type::CanonicalTypeInternal(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getCanonicalTypeInternal();
@@ -586,6 +742,14 @@ std::optional<::pasta::RecordType> Type::AsUnionType(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef Type::CanonicalTypeInternalRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getCanonicalTypeInternal();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: Type::CanonicalTypeUnqualified
 std::optional<::pasta::AutoType> Type::ContainedAutoType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
@@ -599,6 +763,18 @@ std::optional<::pasta::AutoType> Type::ContainedAutoType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::ContainedAutoTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getContainedAutoType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::DeducedType> Type::ContainedDeducedType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getContainedDeducedType();
@@ -611,6 +787,18 @@ std::optional<::pasta::DeducedType> Type::ContainedDeducedType(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::ContainedDeducedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getContainedDeducedType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: Type::Dependence
 enum Linkage Type::Linkage(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
@@ -628,6 +816,14 @@ enum Linkage Type::Linkage(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef Type::LocallyUnqualifiedSingleStepDesugaredTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getLocallyUnqualifiedSingleStepDesugaredType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::NullabilityKind> Type::Nullability(void) const noexcept {
   auto &self = *(u.Type);
   decltype(auto) val = self.getNullability(ast->ci->getASTContext());
@@ -653,6 +849,18 @@ std::optional<::pasta::CXXRecordDecl> Type::PointeeCXXRecordDeclaration(void) co
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> Type::PointeeCXXRecordDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getPointeeCXXRecordDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> Type::PointeeOrArrayElementType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getPointeeOrArrayElementType();
@@ -665,6 +873,18 @@ std::optional<::pasta::Type> Type::PointeeOrArrayElementType(void) const noexcep
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::PointeeOrArrayElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getPointeeOrArrayElementType();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> Type::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getPointeeType();
@@ -675,6 +895,16 @@ std::optional<::pasta::Type> Type::PointeeType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> Type::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getPointeeType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<enum TypeScalarTypeKind> Type::ScalarTypeKind(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   if (!self.isScalarType()) {
@@ -715,6 +945,16 @@ std::optional<::pasta::Type> Type::SveElementType(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef Type::UnqualifiedDesugaredTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::Type *>(u.Type);
+  decltype(auto) val = self.getUnqualifiedDesugaredType();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "Type::UnqualifiedDesugaredTypeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum Visibility Type::Visibility(void) const noexcept {
   auto &self = *const_cast<clang::Type *>(u.Type);
   decltype(auto) val = self.getVisibility();
@@ -2168,6 +2408,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypeOfExprType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TypeOfExprType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeOfExprType *>(u.TypeOfExprType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr TypeOfExprType::UnderlyingExpression(void) const noexcept {
   auto &self = *const_cast<clang::TypeOfExprType *>(u.TypeOfExprType);
   decltype(auto) val = self.getUnderlyingExpr();
@@ -2178,6 +2426,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypeOfExprType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef TypeOfExprType::UnderlyingExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeOfExprType *>(u.TypeOfExprType);
+  decltype(auto) val = self.getUnderlyingExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TypeOfExprType::UnderlyingExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool TypeOfExprType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::TypeOfExprType *>(u.TypeOfExprType);
   decltype(auto) val = self.isSugared();
@@ -2194,6 +2452,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypeOfType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TypeOfType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeOfType *>(u.TypeOfType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type TypeOfType::UnderlyingType(void) const noexcept {
   auto &self = *const_cast<clang::TypeOfType *>(u.TypeOfType);
   decltype(auto) val = self.getUnderlyingType();
@@ -2202,6 +2468,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypeOfType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TypeOfType::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypeOfType *>(u.TypeOfType);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool TypeOfType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::TypeOfType *>(u.TypeOfType);
   decltype(auto) val = self.isSugared();
@@ -2218,6 +2492,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypedefType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TypedefType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypedefType *>(u.TypedefType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TypedefNameDecl TypedefType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::TypedefType *>(u.TypedefType);
   decltype(auto) val = self.getDecl();
@@ -2228,6 +2510,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TypedefType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TypedefType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TypedefType *>(u.TypedefType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TypedefType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool TypedefType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::TypedefType *>(u.TypedefType);
   decltype(auto) val = self.isSugared();
@@ -2244,6 +2536,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UnaryTransformType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UnaryTransformType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type UnaryTransformType::BaseType(void) const noexcept {
   auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
   decltype(auto) val = self.getBaseType();
@@ -2252,6 +2552,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UnaryTransformType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UnaryTransformType::BaseTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
+  decltype(auto) val = self.getBaseType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum UnaryTransformTypeUTTKind UnaryTransformType::UTTKind(void) const noexcept {
   auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
   decltype(auto) val = self.getUTTKind();
@@ -2267,6 +2575,14 @@ enum UnaryTransformTypeUTTKind UnaryTransformType::UTTKind(void) const noexcept
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UnaryTransformType::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UnaryTransformType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::UnaryTransformType *>(u.UnaryTransformType);
   decltype(auto) val = self.isSugared();
@@ -2283,16 +2599,34 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UnresolvedUsingType)
   __builtin_unreachable();
 }
 
-::pasta::UnresolvedUsingTypenameDecl UnresolvedUsingType::Declaration(void) const noexcept {
+::pasta::TypeRef UnresolvedUsingType::DesugarRef(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingType *>(u.UnresolvedUsingType);
-  decltype(auto) val = self.getDecl();
-  if (val) {
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::UnresolvedUsingTypenameDecl UnresolvedUsingType::Declaration(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingType *>(u.UnresolvedUsingType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
     return DeclBuilder::Create<::pasta::UnresolvedUsingTypenameDecl>(ast, val);
   }
   assert(false && "UnresolvedUsingType::Declaration can return nullptr!");
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UnresolvedUsingType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UnresolvedUsingType *>(u.UnresolvedUsingType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UnresolvedUsingType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool UnresolvedUsingType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::UnresolvedUsingType *>(u.UnresolvedUsingType);
   decltype(auto) val = self.isSugared();
@@ -2309,6 +2643,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UsingType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UsingType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingType *>(u.UsingType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::UsingShadowDecl UsingType::FoundDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::UsingType *>(u.UsingType);
   decltype(auto) val = self.getFoundDecl();
@@ -2319,6 +2661,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UsingType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef UsingType::FoundDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingType *>(u.UsingType);
+  decltype(auto) val = self.getFoundDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "UsingType::FoundDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type UsingType::UnderlyingType(void) const noexcept {
   auto &self = *const_cast<clang::UsingType *>(u.UsingType);
   decltype(auto) val = self.getUnderlyingType();
@@ -2327,6 +2679,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, UsingType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef UsingType::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::UsingType *>(u.UsingType);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool UsingType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::UsingType *>(u.UsingType);
   decltype(auto) val = self.isSugared();
@@ -2344,6 +2704,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(VectorType, ExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef VectorType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::VectorType *>(u.VectorType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type VectorType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::VectorType *>(u.VectorType);
   decltype(auto) val = self.getElementType();
@@ -2352,6 +2720,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(VectorType, ExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef VectorType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::VectorType *>(u.VectorType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t VectorType::NumElements(void) const noexcept {
   auto &self = *const_cast<clang::VectorType *>(u.VectorType);
   decltype(auto) val = self.getNumElements();
@@ -2405,6 +2781,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(AdjustedType, DecayedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AdjustedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type AdjustedType::ResolvedType(void) const noexcept {
   auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
   decltype(auto) val = self.getAdjustedType();
@@ -2413,6 +2797,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(AdjustedType, DecayedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AdjustedType::ResolvedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
+  decltype(auto) val = self.getAdjustedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type AdjustedType::OriginalType(void) const noexcept {
   auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
   decltype(auto) val = self.getOriginalType();
@@ -2421,6 +2813,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(AdjustedType, DecayedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AdjustedType::OriginalTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
+  decltype(auto) val = self.getOriginalType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool AdjustedType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::AdjustedType *>(u.AdjustedType);
   decltype(auto) val = self.isSugared();
@@ -2441,6 +2841,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ArrayType, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ArrayType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ArrayType *>(u.ArrayType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t ArrayType::IndexTypeCVRQualifiers(void) const noexcept {
   auto &self = *const_cast<clang::ArrayType *>(u.ArrayType);
   decltype(auto) val = self.getIndexTypeCVRQualifiers();
@@ -2465,6 +2873,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, AtomicType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AtomicType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicType *>(u.AtomicType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type AtomicType::ValueType(void) const noexcept {
   auto &self = *const_cast<clang::AtomicType *>(u.AtomicType);
   decltype(auto) val = self.getValueType();
@@ -2473,6 +2889,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, AtomicType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AtomicType::ValueTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AtomicType *>(u.AtomicType);
+  decltype(auto) val = self.getValueType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool AtomicType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::AtomicType *>(u.AtomicType);
   decltype(auto) val = self.isSugared();
@@ -2489,6 +2913,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, AttributedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AttributedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum ::pasta::AttrKind AttributedType::AttributeKind(void) const noexcept {
   auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
   decltype(auto) val = self.getAttrKind();
@@ -2504,6 +2936,14 @@ enum ::pasta::AttrKind AttributedType::AttributeKind(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AttributedType::EquivalentTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
+  decltype(auto) val = self.getEquivalentType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::NullabilityKind> AttributedType::ImmediateNullability(void) const noexcept {
   auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
   decltype(auto) val = self.getImmediateNullability();
@@ -2523,6 +2963,14 @@ std::optional<::pasta::NullabilityKind> AttributedType::ImmediateNullability(voi
   __builtin_unreachable();
 }
 
+::pasta::TypeRef AttributedType::ModifiedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
+  decltype(auto) val = self.getModifiedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool AttributedType::IsCallingConv(void) const noexcept {
   auto &self = *const_cast<clang::AttributedType *>(u.AttributedType);
   decltype(auto) val = self.isCallingConv();
@@ -2560,6 +3008,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BTFTagAttributedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BTFTagAttributedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::BTFTypeTagAttr BTFTagAttributedType::Attribute(void) const noexcept {
   auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
   decltype(auto) val = self.getAttr();
@@ -2570,6 +3026,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BTFTagAttributedType)
   __builtin_unreachable();
 }
 
+::pasta::AttrRef BTFTagAttributedType::AttributeRef(void) const noexcept {
+  auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
+  decltype(auto) val = self.getAttr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "BTFTagAttributedType::AttributeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type BTFTagAttributedType::WrappedType(void) const noexcept {
   auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
   decltype(auto) val = self.getWrappedType();
@@ -2578,6 +3044,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BTFTagAttributedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BTFTagAttributedType::WrappedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
+  decltype(auto) val = self.getWrappedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool BTFTagAttributedType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::BTFTagAttributedType *>(u.BTFTagAttributedType);
   decltype(auto) val = self.isSugared();
@@ -2594,6 +3068,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BitIntType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BitIntType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::BitIntType *>(u.BitIntType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t BitIntType::NumBits(void) const noexcept {
   auto &self = *const_cast<clang::BitIntType *>(u.BitIntType);
   decltype(auto) val = self.getNumBits();
@@ -2631,6 +3113,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BlockPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BlockPointerType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockPointerType *>(u.BlockPointerType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type BlockPointerType::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::BlockPointerType *>(u.BlockPointerType);
   decltype(auto) val = self.getPointeeType();
@@ -2639,6 +3129,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BlockPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BlockPointerType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::BlockPointerType *>(u.BlockPointerType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool BlockPointerType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::BlockPointerType *>(u.BlockPointerType);
   decltype(auto) val = self.isSugared();
@@ -2655,6 +3153,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, BuiltinType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef BuiltinType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::BuiltinType *>(u.BuiltinType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::BuiltinTypeKind BuiltinType::Kind(void) const noexcept {
   auto &self = *const_cast<clang::BuiltinType *>(u.BuiltinType);
   decltype(auto) val = self.getKind();
@@ -2729,6 +3235,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ComplexType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ComplexType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ComplexType *>(u.ComplexType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ComplexType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::ComplexType *>(u.ComplexType);
   decltype(auto) val = self.getElementType();
@@ -2737,6 +3251,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ComplexType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ComplexType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ComplexType *>(u.ComplexType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ComplexType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ComplexType *>(u.ComplexType);
   decltype(auto) val = self.isSugared();
@@ -2754,6 +3276,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ConstantArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ConstantArrayType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstantArrayType *>(u.ConstantArrayType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 llvm::APInt ConstantArrayType::Size(void) const noexcept {
   auto &self = *const_cast<clang::ConstantArrayType *>(u.ConstantArrayType);
   decltype(auto) val = self.getSize();
@@ -2773,6 +3303,18 @@ std::optional<::pasta::Expr> ConstantArrayType::SizeExpression(void) const noexc
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> ConstantArrayType::SizeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::ConstantArrayType *>(u.ConstantArrayType);
+  decltype(auto) val = self.getSizeExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool ConstantArrayType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ConstantArrayType *>(u.ConstantArrayType);
   decltype(auto) val = self.isSugared();
@@ -2790,6 +3332,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DecayedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DecayedType::ResolvedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DecayedType *>(u.DecayedType);
+  decltype(auto) val = self.getDecayedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type DecayedType::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::DecayedType *>(u.DecayedType);
   decltype(auto) val = self.getPointeeType();
@@ -2798,6 +3348,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DecayedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DecayedType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DecayedType *>(u.DecayedType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 PASTA_DEFINE_BASE_OPERATORS(Type, DecltypeType)
 ::pasta::Type DecltypeType::Desugar(void) const noexcept {
   auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
@@ -2807,6 +3365,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DecltypeType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DecltypeType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DecltypeType::UnderlyingExpression(void) const noexcept {
   auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
   decltype(auto) val = self.getUnderlyingExpr();
@@ -2817,6 +3383,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DecltypeType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DecltypeType::UnderlyingExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
+  decltype(auto) val = self.getUnderlyingExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DecltypeType::UnderlyingExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type DecltypeType::UnderlyingType(void) const noexcept {
   auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
   decltype(auto) val = self.getUnderlyingType();
@@ -2825,6 +3401,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DecltypeType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DecltypeType::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool DecltypeType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::DecltypeType *>(u.DecltypeType);
   decltype(auto) val = self.isSugared();
@@ -2843,6 +3427,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(DeducedType, DeducedTemplateSpecializationType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DeducedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeducedType *>(u.DeducedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> DeducedType::ResolvedType(void) const noexcept {
   auto &self = *const_cast<clang::DeducedType *>(u.DeducedType);
   decltype(auto) val = self.getDeducedType();
@@ -2853,6 +3445,16 @@ std::optional<::pasta::Type> DeducedType::ResolvedType(void) const noexcept {
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> DeducedType::ResolvedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DeducedType *>(u.DeducedType);
+  decltype(auto) val = self.getDeducedType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool DeducedType::IsDeduced(void) const noexcept {
   auto &self = *const_cast<clang::DeducedType *>(u.DeducedType);
   decltype(auto) val = self.isDeduced();
@@ -2876,6 +3478,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentAddressSpaceType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentAddressSpaceType::AddressSpaceExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
   decltype(auto) val = self.getAddrSpaceExpr();
@@ -2886,6 +3496,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentAddressSpaceType::AddressSpaceExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
+  decltype(auto) val = self.getAddrSpaceExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentAddressSpaceType::AddressSpaceExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentAddressSpaceType::AttributeToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
   decltype(auto) val = self.getAttributeLoc();
@@ -2893,6 +3513,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentAddressSpaceType::AttributeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
+  decltype(auto) val = self.getAttributeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type DependentAddressSpaceType::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
   decltype(auto) val = self.getPointeeType();
@@ -2901,6 +3528,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentAddressSpaceType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool DependentAddressSpaceType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType);
   decltype(auto) val = self.isSugared();
@@ -2917,6 +3552,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentBitIntType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentBitIntType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentBitIntType *>(u.DependentBitIntType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentBitIntType::NumBitsExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentBitIntType *>(u.DependentBitIntType);
   decltype(auto) val = self.getNumBitsExpr();
@@ -2927,6 +3570,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentBitIntType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentBitIntType::NumBitsExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentBitIntType *>(u.DependentBitIntType);
+  decltype(auto) val = self.getNumBitsExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentBitIntType::NumBitsExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool DependentBitIntType::IsSigned(void) const noexcept {
   auto &self = *const_cast<clang::DependentBitIntType *>(u.DependentBitIntType);
   decltype(auto) val = self.isSigned();
@@ -2958,6 +3611,14 @@ PASTA_DEFINE_BASE_OPERATORS(TypeWithKeyword, DependentNameType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentNameType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentNameType *>(u.DependentNameType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DependentNameType::Identifier
 // 0: DependentNameType::Qualifier
 bool DependentNameType::IsSugared(void) const noexcept {
@@ -2977,6 +3638,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentSizedArrayType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange DependentSizedArrayType::BracketsRange(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
   decltype(auto) val = self.getBracketsRange();
@@ -2984,6 +3653,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange DependentSizedArrayType::BracketsRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
+  decltype(auto) val = self.getBracketsRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentSizedArrayType::LBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
   decltype(auto) val = self.getLBracketLoc();
@@ -2991,6 +3667,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentSizedArrayType::LBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
+  decltype(auto) val = self.getLBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentSizedArrayType::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
   decltype(auto) val = self.getRBracketLoc();
@@ -2998,6 +3681,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentSizedArrayType::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentSizedArrayType::SizeExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
   decltype(auto) val = self.getSizeExpr();
@@ -3008,6 +3698,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedArrayType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentSizedArrayType::SizeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
+  decltype(auto) val = self.getSizeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentSizedArrayType::SizeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool DependentSizedArrayType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType);
   decltype(auto) val = self.isSugared();
@@ -3024,6 +3724,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentSizedExtVectorType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentSizedExtVectorType::AttributeToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
   decltype(auto) val = self.getAttributeLoc();
@@ -3031,6 +3739,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentSizedExtVectorType::AttributeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
+  decltype(auto) val = self.getAttributeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type DependentSizedExtVectorType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
   decltype(auto) val = self.getElementType();
@@ -3039,6 +3754,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentSizedExtVectorType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentSizedExtVectorType::SizeExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
   decltype(auto) val = self.getSizeExpr();
@@ -3049,6 +3772,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentSizedExtVectorType::SizeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
+  decltype(auto) val = self.getSizeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentSizedExtVectorType::SizeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool DependentSizedExtVectorType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType);
   decltype(auto) val = self.isSugared();
@@ -3067,6 +3800,14 @@ PASTA_DEFINE_BASE_OPERATORS(TypeWithKeyword, DependentTemplateSpecializationType
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentTemplateSpecializationType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentTemplateSpecializationType *>(u.DependentTemplateSpecializationType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: DependentTemplateSpecializationType::
 // 1: DependentTemplateSpecializationType::Argument
 // 0: DependentTemplateSpecializationType::Arguments
@@ -3106,6 +3847,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentVectorType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token DependentVectorType::AttributeToken(void) const noexcept {
   auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
   decltype(auto) val = self.getAttributeLoc();
@@ -3113,6 +3862,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentVectorType::AttributeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
+  decltype(auto) val = self.getAttributeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type DependentVectorType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
   decltype(auto) val = self.getElementType();
@@ -3121,6 +3877,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef DependentVectorType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentVectorType::SizeExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
   decltype(auto) val = self.getSizeExpr();
@@ -3131,6 +3895,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentVectorType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentVectorType::SizeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
+  decltype(auto) val = self.getSizeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentVectorType::SizeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 enum VectorTypeVectorKind DependentVectorType::VectorKind(void) const noexcept {
   auto &self = *const_cast<clang::DependentVectorType *>(u.DependentVectorType);
   decltype(auto) val = self.getVectorKind();
@@ -3155,6 +3929,14 @@ PASTA_DEFINE_BASE_OPERATORS(TypeWithKeyword, ElaboratedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ElaboratedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ElaboratedType::NamedType(void) const noexcept {
   auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
   decltype(auto) val = self.getNamedType();
@@ -3163,6 +3945,14 @@ PASTA_DEFINE_BASE_OPERATORS(TypeWithKeyword, ElaboratedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ElaboratedType::NamedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
+  decltype(auto) val = self.getNamedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TagDecl> ElaboratedType::OwnedTagDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
   decltype(auto) val = self.getOwnedTagDecl();
@@ -3175,6 +3965,18 @@ std::optional<::pasta::TagDecl> ElaboratedType::OwnedTagDeclaration(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> ElaboratedType::OwnedTagDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
+  decltype(auto) val = self.getOwnedTagDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: ElaboratedType::Qualifier
 bool ElaboratedType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ElaboratedType *>(u.ElaboratedType);
@@ -3193,6 +3995,14 @@ PASTA_DEFINE_BASE_OPERATORS(VectorType, ExtVectorType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ExtVectorType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ExtVectorType *>(u.ExtVectorType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 2: IsAccessorWithinNumElements
 bool ExtVectorType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ExtVectorType *>(u.ExtVectorType);
@@ -3256,6 +4066,14 @@ uint32_t FunctionType::RegParmType(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionType::ReturnTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionType *>(u.FunctionType);
+  decltype(auto) val = self.getReturnType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool FunctionType::IsConst(void) const noexcept {
   auto &self = *const_cast<clang::FunctionType *>(u.FunctionType);
   decltype(auto) val = self.isConst();
@@ -3287,6 +4105,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, IncompleteArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef IncompleteArrayType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::IncompleteArrayType *>(u.IncompleteArrayType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool IncompleteArrayType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::IncompleteArrayType *>(u.IncompleteArrayType);
   decltype(auto) val = self.isSugared();
@@ -3303,6 +4129,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, InjectedClassNameType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef InjectedClassNameType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::CXXRecordDecl InjectedClassNameType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
   decltype(auto) val = self.getDecl();
@@ -3313,6 +4147,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, InjectedClassNameType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef InjectedClassNameType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "InjectedClassNameType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type InjectedClassNameType::InjectedSpecializationType(void) const noexcept {
   auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
   decltype(auto) val = self.getInjectedSpecializationType();
@@ -3321,6 +4165,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, InjectedClassNameType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef InjectedClassNameType::InjectedSpecializationTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
+  decltype(auto) val = self.getInjectedSpecializationType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TemplateSpecializationType InjectedClassNameType::InjectedTST(void) const noexcept {
   auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
   decltype(auto) val = self.getInjectedTST();
@@ -3331,6 +4183,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, InjectedClassNameType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef InjectedClassNameType::InjectedTSTRef(void) const noexcept {
+  auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
+  decltype(auto) val = self.getInjectedTST();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "InjectedClassNameType::InjectedTSTRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 // 0: InjectedClassNameType::TemplateName
 bool InjectedClassNameType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::InjectedClassNameType *>(u.InjectedClassNameType);
@@ -3348,6 +4210,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, MacroQualifiedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MacroQualifiedType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: MacroQualifiedType::MacroIdentifier
 ::pasta::Type MacroQualifiedType::ModifiedType(void) const noexcept {
   auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
@@ -3357,6 +4227,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, MacroQualifiedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MacroQualifiedType::ModifiedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
+  decltype(auto) val = self.getModifiedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type MacroQualifiedType::UnderlyingType(void) const noexcept {
   auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
   decltype(auto) val = self.getUnderlyingType();
@@ -3365,6 +4243,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, MacroQualifiedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MacroQualifiedType::UnderlyingTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
+  decltype(auto) val = self.getUnderlyingType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool MacroQualifiedType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::MacroQualifiedType *>(u.MacroQualifiedType);
   decltype(auto) val = self.isSugared();
@@ -3383,6 +4269,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(MatrixType, DependentSizedMatrixType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MatrixType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixType *>(u.MatrixType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type MatrixType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::MatrixType *>(u.MatrixType);
   decltype(auto) val = self.getElementType();
@@ -3391,6 +4285,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(MatrixType, DependentSizedMatrixType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MatrixType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::MatrixType *>(u.MatrixType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool MatrixType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::MatrixType *>(u.MatrixType);
   decltype(auto) val = self.isSugared();
@@ -3407,23 +4309,51 @@ PASTA_DEFINE_BASE_OPERATORS(Type, MemberPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MemberPointerType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type MemberPointerType::Class(void) const noexcept {
   auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
   decltype(auto) val = self.getClass();
   if (val) {
     return TypeBuilder::Create<::pasta::Type>(ast, val);
   }
-  assert(false && "MemberPointerType::Class can return nullptr!");
+  assert(false && "MemberPointerType::Class can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::TypeRef MemberPointerType::ClassRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
+  decltype(auto) val = self.getClass();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "MemberPointerType::ClassRef can return nullptr!");
+  __builtin_unreachable();
+}
+
+::pasta::CXXRecordDecl MemberPointerType::MostRecentCXXRecordDeclaration(void) const noexcept {
+  auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
+  decltype(auto) val = self.getMostRecentCXXRecordDecl();
+  if (val) {
+    return DeclBuilder::Create<::pasta::CXXRecordDecl>(ast, val);
+  }
+  assert(false && "MemberPointerType::MostRecentCXXRecordDeclaration can return nullptr!");
   __builtin_unreachable();
 }
 
-::pasta::CXXRecordDecl MemberPointerType::MostRecentCXXRecordDeclaration(void) const noexcept {
+::pasta::DeclRef MemberPointerType::MostRecentCXXRecordDeclarationRef(void) const noexcept {
   auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
   decltype(auto) val = self.getMostRecentCXXRecordDecl();
   if (val) {
-    return DeclBuilder::Create<::pasta::CXXRecordDecl>(ast, val);
+    return RefBuilder::Create(*ast, val);
   }
-  assert(false && "MemberPointerType::MostRecentCXXRecordDeclaration can return nullptr!");
+  assert(false && "MemberPointerType::MostRecentCXXRecordDeclarationRef can return nullptr!");
   __builtin_unreachable();
 }
 
@@ -3435,6 +4365,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, MemberPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef MemberPointerType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool MemberPointerType::IsMemberDataPointer(void) const noexcept {
   auto &self = *const_cast<clang::MemberPointerType *>(u.MemberPointerType);
   decltype(auto) val = self.isMemberDataPointer();
@@ -3465,6 +4403,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCObjectPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectPointerType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCObjectPointerType::InterfaceDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.getInterfaceDecl();
@@ -3475,6 +4421,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCObjectPointerType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCObjectPointerType::InterfaceDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.getInterfaceDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCObjectPointerType::InterfaceDeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceType ObjCObjectPointerType::InterfaceType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.getInterfaceType();
@@ -3485,6 +4441,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCObjectPointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectPointerType::InterfaceTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.getInterfaceType();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCObjectPointerType::InterfaceTypeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 uint32_t ObjCObjectPointerType::NumProtocols(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.getNumProtocols();
@@ -3502,6 +4468,16 @@ uint32_t ObjCObjectPointerType::NumProtocols(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectPointerType::ObjectTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.getObjectType();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCObjectPointerType::ObjectTypeRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCObjectPointerType::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.getPointeeType();
@@ -3510,6 +4486,14 @@ uint32_t ObjCObjectPointerType::NumProtocols(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectPointerType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: ObjCObjectPointerType::Protocol
 ::pasta::Type ObjCObjectPointerType::SuperClassType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
@@ -3519,6 +4503,14 @@ uint32_t ObjCObjectPointerType::NumProtocols(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectPointerType::SuperClassTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
+  decltype(auto) val = self.getSuperClassType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Type> ObjCObjectPointerType::TypeArguments(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.getTypeArgs();
@@ -3671,6 +4663,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ObjCObjectType::BaseType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
   decltype(auto) val = self.getBaseType();
@@ -3679,6 +4679,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCObjectType::BaseTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
+  decltype(auto) val = self.getBaseType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCObjectType::Interface(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
   decltype(auto) val = self.getInterface();
@@ -3689,6 +4697,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCObjectType::InterfaceRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
+  decltype(auto) val = self.getInterface();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCObjectType::InterfaceRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::Type> ObjCObjectType::SuperClassType(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
   decltype(auto) val = self.getSuperClassType();
@@ -3699,6 +4717,16 @@ std::optional<::pasta::Type> ObjCObjectType::SuperClassType(void) const noexcept
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> ObjCObjectType::SuperClassTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
+  decltype(auto) val = self.getSuperClassType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::vector<::pasta::Type> ObjCObjectType::TypeArguments(void) const noexcept {
   auto &self = *const_cast<clang::ObjCObjectType *>(u.ObjCObjectType);
   decltype(auto) val = self.getTypeArgs();
@@ -3836,6 +4864,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCTypeParamType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCTypeParamType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCTypeParamType *>(u.ObjCTypeParamType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCTypeParamDecl ObjCTypeParamType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCTypeParamType *>(u.ObjCTypeParamType);
   decltype(auto) val = self.getDecl();
@@ -3846,6 +4882,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCTypeParamType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCTypeParamType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCTypeParamType *>(u.ObjCTypeParamType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCTypeParamType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCTypeParamType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ObjCTypeParamType *>(u.ObjCTypeParamType);
   decltype(auto) val = self.isSugared();
@@ -3862,6 +4908,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, PackExpansionType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PackExpansionType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionType *>(u.PackExpansionType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<unsigned> PackExpansionType::NumExpansions(void) const noexcept {
   auto &self = *const_cast<clang::PackExpansionType *>(u.PackExpansionType);
   decltype(auto) val = self.getNumExpansions();
@@ -3881,6 +4935,14 @@ std::optional<unsigned> PackExpansionType::NumExpansions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PackExpansionType::PatternRef(void) const noexcept {
+  auto &self = *const_cast<clang::PackExpansionType *>(u.PackExpansionType);
+  decltype(auto) val = self.getPattern();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool PackExpansionType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::PackExpansionType *>(u.PackExpansionType);
   decltype(auto) val = self.isSugared();
@@ -3897,6 +4959,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ParenType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ParenType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenType *>(u.ParenType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ParenType::InnerType(void) const noexcept {
   auto &self = *const_cast<clang::ParenType *>(u.ParenType);
   decltype(auto) val = self.getInnerType();
@@ -3905,6 +4975,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ParenType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ParenType::InnerTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ParenType *>(u.ParenType);
+  decltype(auto) val = self.getInnerType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ParenType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ParenType *>(u.ParenType);
   decltype(auto) val = self.isSugared();
@@ -3921,6 +4999,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, PipeType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PipeType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::PipeType *>(u.PipeType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type PipeType::ElementType(void) const noexcept {
   auto &self = *const_cast<clang::PipeType *>(u.PipeType);
   decltype(auto) val = self.getElementType();
@@ -3929,6 +5015,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, PipeType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PipeType::ElementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::PipeType *>(u.PipeType);
+  decltype(auto) val = self.getElementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool PipeType::IsReadOnly(void) const noexcept {
   auto &self = *const_cast<clang::PipeType *>(u.PipeType);
   decltype(auto) val = self.isReadOnly();
@@ -3952,6 +5046,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, PointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PointerType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::PointerType *>(u.PointerType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type PointerType::PointeeType(void) const noexcept {
   auto &self = *const_cast<clang::PointerType *>(u.PointerType);
   decltype(auto) val = self.getPointeeType();
@@ -3960,6 +5062,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, PointerType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef PointerType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::PointerType *>(u.PointerType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool PointerType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::PointerType *>(u.PointerType);
   decltype(auto) val = self.isSugared();
@@ -3978,6 +5088,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, QualifiedType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::IgnoreParenthesesRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.IgnoreParens();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 enum LangAS QualifiedType::AddressSpace(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -3998,6 +5118,16 @@ enum LangAS QualifiedType::AddressSpace(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::AtomicUnqualifiedTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getAtomicUnqualifiedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: QualifiedType::BaseTypeIdentifier
 uint32_t QualifiedType::CVRQualifiers(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
@@ -4018,6 +5148,16 @@ uint32_t QualifiedType::CVRQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::CanonicalTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getCanonicalType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type QualifiedType::DesugaredType(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -4028,6 +5168,16 @@ uint32_t QualifiedType::CVRQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::DesugaredTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getDesugaredType(ast->ci->getASTContext());
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 uint32_t QualifiedType::LocalCVRQualifiers(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -4057,6 +5207,16 @@ uint32_t QualifiedType::LocalFastQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::LocalUnqualifiedTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getLocalUnqualifiedType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type QualifiedType::NonLValueExpressionType(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -4067,6 +5227,16 @@ uint32_t QualifiedType::LocalFastQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::NonLValueExpressionTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getNonLValueExprType(ast->ci->getASTContext());
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type QualifiedType::NonPackExpansionType(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -4077,6 +5247,16 @@ uint32_t QualifiedType::LocalFastQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::NonPackExpansionTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getNonPackExpansionType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type QualifiedType::NonReferenceType(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
@@ -4087,6 +5267,16 @@ uint32_t QualifiedType::LocalFastQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::NonReferenceTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getNonReferenceType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: QualifiedType::ObjCGCAttr
 // 0: QualifiedType::ObjCLifetime
 // 0: QualifiedType::Qualifiers
@@ -4100,6 +5290,16 @@ uint32_t QualifiedType::LocalFastQualifiers(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::SingleStepDesugaredTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.getSingleStepDesugaredType(ast->ci->getASTContext());
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: QualifiedType::SplitDesugaredType
 // 0: QualifiedType::SplitUnqualifiedType
 // 0: QualifiedType::
@@ -4403,6 +5603,16 @@ bool QualifiedType::MayBeNotDynamicClass(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef QualifiedType::StripObjCKindOfTypeRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.stripObjCKindOfType(ast->ci->getASTContext());
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 3: QualifiedType::SubstObjCMemberType
 // 3: QualifiedType::SubstObjCTypeArguments
 // 1: QualifiedType::WithCVRQualifiers
@@ -4416,35 +5626,75 @@ bool QualifiedType::MayBeNotDynamicClass(void) const noexcept {
   __builtin_unreachable();
 }
 
-// 1: QualifiedType::WithExactLocalFastQualifiers
-// 1: QualifiedType::WithFastQualifiers
-::pasta::Type QualifiedType::WithRestrict(void) const noexcept {
+::pasta::TypeRef QualifiedType::WithConstRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.withConst();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+// 1: QualifiedType::WithExactLocalFastQualifiers
+// 1: QualifiedType::WithFastQualifiers
+::pasta::Type QualifiedType::WithRestrict(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.withRestrict();
+  assert(!val.isNull());
+  return TypeBuilder::Build(ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::TypeRef QualifiedType::WithRestrictRef(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.withRestrict();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::Type QualifiedType::WithVolatile(void) const noexcept {
+  auto &ast_ctx = ast->ci->getASTContext();
+  clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
+  auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
+  decltype(auto) val = self.withVolatile();
+  assert(!val.isNull());
+  return TypeBuilder::Build(ast, val);
+  __builtin_unreachable();
+}
+
+::pasta::TypeRef QualifiedType::WithVolatileRef(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
   auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
-  decltype(auto) val = self.withRestrict();
+  decltype(auto) val = self.withVolatile();
   assert(!val.isNull());
-  return TypeBuilder::Build(ast, val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
-::pasta::Type QualifiedType::WithVolatile(void) const noexcept {
+::pasta::Type QualifiedType::WithoutLocalFastQualifiers(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
   auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
-  decltype(auto) val = self.withVolatile();
+  decltype(auto) val = self.withoutLocalFastQualifiers();
   assert(!val.isNull());
   return TypeBuilder::Build(ast, val);
   __builtin_unreachable();
 }
 
-::pasta::Type QualifiedType::WithoutLocalFastQualifiers(void) const noexcept {
+::pasta::TypeRef QualifiedType::WithoutLocalFastQualifiersRef(void) const noexcept {
   auto &ast_ctx = ast->ci->getASTContext();
   clang::QualType fast_qtype(u.Type, qualifiers & clang::Qualifiers::FastMask);
   auto self = ast_ctx.getQualifiedType(fast_qtype, clang::Qualifiers::fromOpaqueValue(qualifiers));
   decltype(auto) val = self.withoutLocalFastQualifiers();
   assert(!val.isNull());
-  return TypeBuilder::Build(ast, val);
+  return RefBuilder::Create(*ast, val);
   __builtin_unreachable();
 }
 
@@ -4459,6 +5709,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ReferenceType, RValueReferenceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ReferenceType::PointeeTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReferenceType *>(u.ReferenceType);
+  decltype(auto) val = self.getPointeeType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Type ReferenceType::PointeeTypeAsWritten(void) const noexcept {
   auto &self = *const_cast<clang::ReferenceType *>(u.ReferenceType);
   decltype(auto) val = self.getPointeeTypeAsWritten();
@@ -4467,6 +5725,14 @@ PASTA_DEFINE_DERIVED_OPERATORS(ReferenceType, RValueReferenceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ReferenceType::PointeeTypeAsWrittenRef(void) const noexcept {
+  auto &self = *const_cast<clang::ReferenceType *>(u.ReferenceType);
+  decltype(auto) val = self.getPointeeTypeAsWritten();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool ReferenceType::IsInnerReference(void) const noexcept {
   auto &self = *const_cast<clang::ReferenceType *>(u.ReferenceType);
   decltype(auto) val = self.isInnerRef();
@@ -4490,6 +5756,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, SubstTemplateTypeParmPackType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef SubstTemplateTypeParmPackType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstTemplateTypeParmPackType *>(u.SubstTemplateTypeParmPackType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: SubstTemplateTypeParmPackType::ArgumentPack
 // 0: SubstTemplateTypeParmPackType::Identifier
 uint32_t SubstTemplateTypeParmPackType::NumArguments(void) const noexcept {
@@ -4509,6 +5783,16 @@ uint32_t SubstTemplateTypeParmPackType::NumArguments(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TypeRef SubstTemplateTypeParmPackType::ReplacedParameterRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstTemplateTypeParmPackType *>(u.SubstTemplateTypeParmPackType);
+  decltype(auto) val = self.getReplacedParameter();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SubstTemplateTypeParmPackType::ReplacedParameterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool SubstTemplateTypeParmPackType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::SubstTemplateTypeParmPackType *>(u.SubstTemplateTypeParmPackType);
   decltype(auto) val = self.isSugared();
@@ -4525,6 +5809,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, SubstTemplateTypeParmType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef SubstTemplateTypeParmType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TemplateTypeParmType SubstTemplateTypeParmType::ReplacedParameter(void) const noexcept {
   auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
   decltype(auto) val = self.getReplacedParameter();
@@ -4535,6 +5827,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, SubstTemplateTypeParmType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef SubstTemplateTypeParmType::ReplacedParameterRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
+  decltype(auto) val = self.getReplacedParameter();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "SubstTemplateTypeParmType::ReplacedParameterRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Type SubstTemplateTypeParmType::ReplacementType(void) const noexcept {
   auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
   decltype(auto) val = self.getReplacementType();
@@ -4543,6 +5845,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, SubstTemplateTypeParmType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef SubstTemplateTypeParmType::ReplacementTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
+  decltype(auto) val = self.getReplacementType();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool SubstTemplateTypeParmType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::SubstTemplateTypeParmType *>(u.SubstTemplateTypeParmType);
   decltype(auto) val = self.isSugared();
@@ -4563,6 +5873,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(TagType, RecordType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef TagType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TagType *>(u.TagType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "TagType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool TagType::IsBeingDefined(void) const noexcept {
   auto &self = *const_cast<clang::TagType *>(u.TagType);
   decltype(auto) val = self.isBeingDefined();
@@ -4580,6 +5900,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TemplateSpecializationType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TemplateSpecializationType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateSpecializationType *>(u.TemplateSpecializationType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: TemplateSpecializationType::
 std::optional<::pasta::Type> TemplateSpecializationType::AliasedType(void) const noexcept {
   auto &self = *const_cast<clang::TemplateSpecializationType *>(u.TemplateSpecializationType);
@@ -4594,6 +5922,19 @@ std::optional<::pasta::Type> TemplateSpecializationType::AliasedType(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::TypeRef> TemplateSpecializationType::AliasedTypeRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateSpecializationType *>(u.TemplateSpecializationType);
+  if (!self.isTypeAlias()) {
+    return std::nullopt;
+  }
+  decltype(auto) val = self.getAliasedType();
+  if (val.isNull()) {
+    return std::nullopt;
+  }
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 1: TemplateSpecializationType::Argument
 // 0: TemplateSpecializationType::Arguments
 uint32_t TemplateSpecializationType::NumArguments(void) const noexcept {
@@ -4645,6 +5986,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, TemplateTypeParmType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef TemplateTypeParmType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateTypeParmType *>(u.TemplateTypeParmType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::TemplateTypeParmDecl> TemplateTypeParmType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::TemplateTypeParmType *>(u.TemplateTypeParmType);
   decltype(auto) val = self.getDecl();
@@ -4657,6 +6006,18 @@ std::optional<::pasta::TemplateTypeParmDecl> TemplateTypeParmType::Declaration(v
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> TemplateTypeParmType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::TemplateTypeParmType *>(u.TemplateTypeParmType);
+  decltype(auto) val = self.getDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t TemplateTypeParmType::Depth(void) const noexcept {
   auto &self = *const_cast<clang::TemplateTypeParmType *>(u.TemplateTypeParmType);
   decltype(auto) val = self.getDepth();
@@ -4696,6 +6057,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef VariableArrayType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::TokenRange VariableArrayType::BracketsRange(void) const noexcept {
   auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
   decltype(auto) val = self.getBracketsRange();
@@ -4703,6 +6072,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRefRange VariableArrayType::BracketsRangeRef(void) const noexcept {
+  auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
+  decltype(auto) val = self.getBracketsRange();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token VariableArrayType::LBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
   decltype(auto) val = self.getLBracketLoc();
@@ -4710,6 +6086,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VariableArrayType::LBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
+  decltype(auto) val = self.getLBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Token VariableArrayType::RBracketToken(void) const noexcept {
   auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
   decltype(auto) val = self.getRBracketLoc();
@@ -4717,6 +6100,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef VariableArrayType::RBracketTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
+  decltype(auto) val = self.getRBracketLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr VariableArrayType::SizeExpression(void) const noexcept {
   auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
   decltype(auto) val = self.getSizeExpr();
@@ -4727,6 +6117,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, VariableArrayType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef VariableArrayType::SizeExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
+  decltype(auto) val = self.getSizeExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "VariableArrayType::SizeExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool VariableArrayType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::VariableArrayType *>(u.VariableArrayType);
   decltype(auto) val = self.isSugared();
@@ -4775,6 +6175,18 @@ std::optional<::pasta::ConceptDecl> AutoType::TypeConstraintConcept(void) const
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> AutoType::TypeConstraintConceptRef(void) const noexcept {
+  auto &self = *const_cast<clang::AutoType *>(u.AutoType);
+  decltype(auto) val = self.getTypeConstraintConcept();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 bool AutoType::IsConstrained(void) const noexcept {
   auto &self = *const_cast<clang::AutoType *>(u.AutoType);
   decltype(auto) val = self.isConstrained();
@@ -4831,6 +6243,13 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedMatrixType)
   __builtin_unreachable();
 }
 
+::pasta::TokenRef DependentSizedMatrixType::AttributeTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType);
+  decltype(auto) val = self.getAttributeLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentSizedMatrixType::ColumnExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType);
   decltype(auto) val = self.getColumnExpr();
@@ -4841,6 +6260,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedMatrixType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentSizedMatrixType::ColumnExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType);
+  decltype(auto) val = self.getColumnExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentSizedMatrixType::ColumnExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 ::pasta::Expr DependentSizedMatrixType::RowExpression(void) const noexcept {
   auto &self = *const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType);
   decltype(auto) val = self.getRowExpr();
@@ -4851,6 +6280,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, DependentSizedMatrixType)
   __builtin_unreachable();
 }
 
+::pasta::StmtRef DependentSizedMatrixType::RowExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType);
+  decltype(auto) val = self.getRowExpr();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "DependentSizedMatrixType::RowExpressionRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 PASTA_DEFINE_BASE_OPERATORS(TagType, EnumType)
 PASTA_DEFINE_BASE_OPERATORS(Type, EnumType)
 ::pasta::Type EnumType::Desugar(void) const noexcept {
@@ -4861,6 +6300,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, EnumType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef EnumType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumType *>(u.EnumType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::EnumDecl EnumType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::EnumType *>(u.EnumType);
   decltype(auto) val = self.getDecl();
@@ -4871,6 +6318,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, EnumType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef EnumType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::EnumType *>(u.EnumType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "EnumType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool EnumType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::EnumType *>(u.EnumType);
   decltype(auto) val = self.isSugared();
@@ -4888,6 +6345,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, FunctionNoProtoType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionNoProtoType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionNoProtoType *>(u.FunctionNoProtoType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool FunctionNoProtoType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::FunctionNoProtoType *>(u.FunctionNoProtoType);
   decltype(auto) val = self.isSugared();
@@ -4919,6 +6384,14 @@ std::optional<enum CanThrowResult> FunctionProtoType::CanThrow(void) const noexc
   __builtin_unreachable();
 }
 
+::pasta::TypeRef FunctionProtoType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 // 0: FunctionProtoType::
 // 0: FunctionProtoType::
 std::vector<::pasta::Type> FunctionProtoType::Exceptions(void) const noexcept {
@@ -4939,6 +6412,13 @@ std::vector<::pasta::Type> FunctionProtoType::Exceptions(void) const noexcept {
   __builtin_unreachable();
 }
 
+::pasta::TokenRef FunctionProtoType::EllipsisTokenRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
+  decltype(auto) val = self.getEllipsisLoc();
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 std::optional<::pasta::FunctionDecl> FunctionProtoType::ExceptionSpecDeclaration(void) const noexcept {
   auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
   decltype(auto) val = self.getExceptionSpecDecl();
@@ -4951,6 +6431,18 @@ std::optional<::pasta::FunctionDecl> FunctionProtoType::ExceptionSpecDeclaration
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionProtoType::ExceptionSpecDeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
+  decltype(auto) val = self.getExceptionSpecDecl();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 // 0: FunctionProtoType::ExceptionSpecInfo
 std::optional<::pasta::FunctionDecl> FunctionProtoType::ExceptionSpecTemplate(void) const noexcept {
   auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
@@ -4964,6 +6456,18 @@ std::optional<::pasta::FunctionDecl> FunctionProtoType::ExceptionSpecTemplate(vo
   __builtin_unreachable();
 }
 
+std::optional<::pasta::DeclRef> FunctionProtoType::ExceptionSpecTemplateRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
+  decltype(auto) val = self.getExceptionSpecTemplate();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 enum ExceptionSpecificationType FunctionProtoType::ExceptionSpecType(void) const noexcept {
   auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
   decltype(auto) val = self.getExceptionSpecType();
@@ -4989,6 +6493,18 @@ std::optional<::pasta::Expr> FunctionProtoType::NoexceptExpression(void) const n
   __builtin_unreachable();
 }
 
+std::optional<::pasta::StmtRef> FunctionProtoType::NoexceptExpressionRef(void) const noexcept {
+  auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
+  decltype(auto) val = self.getNoexceptExpr();
+  if (!val) {
+    return std::nullopt;
+  }
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  __builtin_unreachable();
+}
+
 uint32_t FunctionProtoType::NumExceptions(void) const noexcept {
   auto &self = *const_cast<clang::FunctionProtoType *>(u.FunctionProtoType);
   decltype(auto) val = self.getNumExceptions();
@@ -5134,6 +6650,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, LValueReferenceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef LValueReferenceType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::LValueReferenceType *>(u.LValueReferenceType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool LValueReferenceType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::LValueReferenceType *>(u.LValueReferenceType);
   decltype(auto) val = self.isSugared();
@@ -5151,6 +6675,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCInterfaceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef ObjCInterfaceType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceType *>(u.ObjCInterfaceType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::ObjCInterfaceDecl ObjCInterfaceType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceType *>(u.ObjCInterfaceType);
   decltype(auto) val = self.getDecl();
@@ -5161,6 +6693,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, ObjCInterfaceType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef ObjCInterfaceType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::ObjCInterfaceType *>(u.ObjCInterfaceType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "ObjCInterfaceType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool ObjCInterfaceType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::ObjCInterfaceType *>(u.ObjCInterfaceType);
   decltype(auto) val = self.isSugared();
@@ -5178,6 +6720,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, RValueReferenceType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef RValueReferenceType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::RValueReferenceType *>(u.RValueReferenceType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 bool RValueReferenceType::IsSugared(void) const noexcept {
   auto &self = *const_cast<clang::RValueReferenceType *>(u.RValueReferenceType);
   decltype(auto) val = self.isSugared();
@@ -5195,6 +6745,14 @@ PASTA_DEFINE_BASE_OPERATORS(Type, RecordType)
   __builtin_unreachable();
 }
 
+::pasta::TypeRef RecordType::DesugarRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordType *>(u.RecordType);
+  decltype(auto) val = self.desugar();
+  assert(!val.isNull());
+  return RefBuilder::Create(*ast, val);
+  __builtin_unreachable();
+}
+
 ::pasta::RecordDecl RecordType::Declaration(void) const noexcept {
   auto &self = *const_cast<clang::RecordType *>(u.RecordType);
   decltype(auto) val = self.getDecl();
@@ -5205,6 +6763,16 @@ PASTA_DEFINE_BASE_OPERATORS(Type, RecordType)
   __builtin_unreachable();
 }
 
+::pasta::DeclRef RecordType::DeclarationRef(void) const noexcept {
+  auto &self = *const_cast<clang::RecordType *>(u.RecordType);
+  decltype(auto) val = self.getDecl();
+  if (val) {
+    return RefBuilder::Create(*ast, val);
+  }
+  assert(false && "RecordType::DeclarationRef can return nullptr!");
+  __builtin_unreachable();
+}
+
 bool RecordType::HasConstFields(void) const noexcept {
   auto &self = *const_cast<clang::RecordType *>(u.RecordType);
   decltype(auto) val = self.hasConstFields();
@@ -5219,5 +6787,21 @@ bool RecordType::IsSugared(void) const noexcept {
   __builtin_unreachable();
 }
 
+TypeRef::TypeRef(ASTImpl *ast_, const ::clang::Type *type_,
+                 uint32_t qualifiers_)
+    : ast(ast_),
+      type(type_),
+      kind(static_cast<TypeKind>(type_->getTypeClass())),
+      qualifiers(qualifiers_) {}
+
+std::string_view TypeRef::KindName(void) const noexcept {
+  return type->getTypeClassName();
+}
+
+::pasta::Type TypeRef::Owned(void) const {
+  return TypeBuilder::Create<::pasta::Type>(
+      ast->shared_from_this(), type, qualifiers);
+}
+
 }  // namespace pasta
 #endif  // PASTA_IN_BOOTSTRAP
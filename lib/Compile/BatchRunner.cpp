@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/Compile/BatchRunner.h>
+#include <pasta/AST/AST.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
+#pragma GCC diagnostic pop
+
+namespace pasta {
+
+BatchRunner::BatchRunner(BatchRunnerOptions options_)
+    : options(std::move(options_)) {}
+
+// Run all of `jobs`, and stream the AST or the first error of each job back
+// through `callback`.
+void BatchRunner::Run(const std::vector<CompileJob> &jobs,
+                      const Callback &callback) const {
+  if (jobs.empty()) {
+    return;
+  }
+
+  unsigned num_threads = options.num_threads;
+  if (!num_threads) {
+    num_threads = llvm::hardware_concurrency().compute_thread_count();
+  }
+
+  num_threads = static_cast<unsigned>(
+      std::min<size_t>(std::max(num_threads, 1u), jobs.size()));
+
+  unsigned max_live_asts = options.max_live_asts;
+  if (!max_live_asts) {
+    max_live_asts = num_threads;
+  }
+
+  std::mutex lock;
+  std::condition_variable cv;
+  unsigned num_live_asts = 0u;
+  std::deque<std::pair<size_t, Result<AST, std::string>>> finished;
+
+  llvm::ThreadPool pool(llvm::hardware_concurrency(num_threads));
+
+  for (size_t i = 0u, max_i = jobs.size(); i < max_i; ++i) {
+    pool.async([&, i] (void) {
+
+      // Wait for a slot before building the AST.
+      {
+        std::unique_lock<std::mutex> locker(lock);
+        cv.wait(locker, [&] (void) {
+          return num_live_asts < max_live_asts;
+        });
+        ++num_live_asts;
+      }
+
+      Result<AST, std::string> maybe_ast = jobs[i].Run(options.job_options);
+
+      std::unique_lock<std::mutex> locker(lock);
+      finished.emplace_back(i, std::move(maybe_ast));
+      cv.notify_all();
+    });
+  }
+
+  // Report the jobs on this thread, in the order that they finished.
+  for (size_t num_reported = 0u; num_reported < jobs.size(); ++num_reported) {
+    std::unique_lock<std::mutex> locker(lock);
+    cv.wait(locker, [&] (void) {
+      return !finished.empty();
+    });
+
+    auto [job_index, maybe_ast] = std::move(finished.front());
+    finished.pop_front();
+    locker.unlock();
+
+    callback(jobs[job_index], std::move(maybe_ast));
+
+    // The AST passed to `callback` is now dead (unless the callback retained
+    // it), so let another job start.
+    locker.lock();
+    --num_live_asts;
+    cv.notify_all();
+  }
+
+  pool.wait();
+}
+
+}  // namespace pasta
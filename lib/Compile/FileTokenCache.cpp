@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "FileTokenCache.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/LangOptions.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
+#pragma GCC diagnostic pop
+
+#include "../Util/FileManager.h"
+
+namespace pasta {
+namespace {
+
+static_assert(std::is_trivially_copyable_v<FileTokenImpl>);
+
+// Bump this whenever `FileTokenImpl`, or how `TokenizeFile` lexes files,
+// changes.
+static constexpr uint32_t kTokenCacheVersion = 1u;
+
+static constexpr uint64_t kTokenCacheMagic = 0x534e4b5441545350ull;
+
+// Header of a cached token file. The header is immediately followed by an
+// array of `num_tokens` `FileTokenImpl`s.
+struct TokenCacheHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t token_size;
+  uint64_t data_hash;
+  uint64_t lang_opts_hash;
+  uint64_t data_size;
+  uint64_t num_tokens;
+};
+
+static std::filesystem::path CachePath(const std::filesystem::path &cache_dir,
+                                       uint64_t data_hash,
+                                       uint64_t lang_opts_hash) {
+  std::string name;
+  llvm::raw_string_ostream os(name);
+  os << llvm::format_hex_no_prefix(data_hash, 16) << '-'
+     << llvm::format_hex_no_prefix(lang_opts_hash, 16) << ".toks";
+  os.flush();
+  return cache_dir / name;
+}
+
+}  // namespace
+
+// Hash all of the language options.
+//
+// NOTE(pag): The hash names cache entries shared across processes, so it must
+//            be stable across executions. `llvm::hash_code` isn't, as it may be
+//            seeded per process, so we serialize the options as `name=value;`
+//            text and hash that with xxHash64.
+uint64_t HashLangOptions(const clang::LangOptions &lang_opts) {
+  std::string opts;
+  llvm::raw_string_ostream os(opts);
+  os << "version=" << kTokenCacheVersion << ';';
+#define LANGOPT(Name, Bits, Default, Description) \
+    os << #Name << '=' << static_cast<unsigned>(lang_opts.Name) << ';';
+#define ENUM_LANGOPT(Name, Type, Bits, Default, Description) \
+    os << #Name << '=' << static_cast<unsigned>(lang_opts.get##Name()) << ';';
+#include <clang/Basic/LangOptions.def>
+  os.flush();
+  return llvm::xxHash64(opts);
+}
+
+// Try to fill in `file.tokens` from the on-disk token cache in `cache_dir`.
+bool LoadCachedFileTokens(const std::filesystem::path &cache_dir,
+                          uint64_t lang_opts_hash, FileImpl &file) {
+  const auto path = CachePath(cache_dir, file.data_hash, lang_opts_hash);
+
+  // NOTE(pag): `getFile` will `mmap` the file if it's big enough.
+  auto maybe_buff = llvm::MemoryBuffer::getFile(
+      path.generic_string(), false /* IsText */,
+      false /* RequiresNullTerminator */);
+  if (!maybe_buff) {
+    return false;
+  }
+
+  const llvm::MemoryBuffer &buff = *maybe_buff.get();
+  const size_t buff_size = buff.getBufferSize();
+  if (buff_size < sizeof(TokenCacheHeader)) {
+    return false;
+  }
+
+  TokenCacheHeader header;
+  memcpy(&header, buff.getBufferStart(), sizeof(header));
+
+  if (header.magic != kTokenCacheMagic ||
+      header.version != kTokenCacheVersion ||
+      header.token_size != sizeof(FileTokenImpl) ||
+      header.data_hash != file.data_hash ||
+      header.lang_opts_hash != lang_opts_hash ||
+      header.data_size != file.data.size() ||
+      !header.num_tokens ||
+      header.num_tokens > ((buff_size - sizeof(header)) /
+                           sizeof(FileTokenImpl)) ||
+      (sizeof(header) + header.num_tokens * sizeof(FileTokenImpl)) !=
+          buff_size) {
+    return false;
+  }
+
+  const auto num_tokens = static_cast<size_t>(header.num_tokens);
+  file.tokens.resize(num_tokens, FileTokenImpl(0, 0, 0, 0, clang::tok::eof));
+  memcpy(file.tokens.data(), &(buff.getBufferStart()[sizeof(header)]),
+         num_tokens * sizeof(FileTokenImpl));
+
+  // Sanity check that the tokens are in bounds of the file's data, and that
+  // the last token is the EOF token.
+  const FileTokenImpl &last = file.tokens.back();
+  if (last.Kind() != clang::tok::eof ||
+      (last.data_offset + 1u) != file.data.size()) {
+    file.tokens.clear();
+    return false;
+  }
+
+  return true;
+}
+
+// Try to save `file.tokens` into the on-disk token cache in `cache_dir`.
+void StoreCachedFileTokens(const std::filesystem::path &cache_dir,
+                           uint64_t lang_opts_hash, const FileImpl &file) {
+  if (file.tokens.empty()) {
+    return;
+  }
+
+  const std::string dir = cache_dir.generic_string();
+  if (llvm::sys::fs::create_directories(dir)) {
+    return;
+  }
+
+  // Write to a temporary file, then rename it into place, so that concurrent
+  // readers and writers (threads, or other processes) never observe a
+  // partially written cache entry.
+  int fd = -1;
+  llvm::SmallString<256> tmp_path;
+  if (llvm::sys::fs::createUniqueFile(
+          dir + "/%%%%%%%%%%%%%%%%.toks.tmp", fd, tmp_path)) {
+    return;
+  }
+
+  TokenCacheHeader header = {};
+  header.magic = kTokenCacheMagic;
+  header.version = kTokenCacheVersion;
+  header.token_size = sizeof(FileTokenImpl);
+  header.data_hash = file.data_hash;
+  header.lang_opts_hash = lang_opts_hash;
+  header.data_size = file.data.size();
+  header.num_tokens = file.tokens.size();
+
+  bool failed = false;
+  {
+    llvm::raw_fd_ostream os(fd, true /* shouldClose */);
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char *>(file.tokens.data()),
+             file.tokens.size() * sizeof(FileTokenImpl));
+    os.close();
+    failed = os.has_error();
+    os.clear_error();
+  }
+
+  const auto path = CachePath(cache_dir, file.data_hash, lang_opts_hash);
+  if (failed || llvm::sys::fs::rename(tmp_path, path.generic_string())) {
+    (void) llvm::sys::fs::remove(tmp_path);
+  }
+}
+
+}  // namespace pasta
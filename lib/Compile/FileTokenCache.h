@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <pasta/Util/StdFileSystem.h>
+
+namespace clang {
+class LangOptions;
+}  // namespace clang
+
+namespace pasta {
+
+class FileImpl;
+
+// Hash all of the language options. The raw lexer is sensitive to a handful
+// of them (e.g. digraphs, trigraphs, line comments, `char8_t`, etc.), and so
+// we conservatively key cached file tokens on all of them. The hash is stable
+// across executions, and changes with the cache's version.
+uint64_t HashLangOptions(const clang::LangOptions &lang_opts);
+
+// Try to fill in `file.tokens` from the on-disk token cache in `cache_dir`.
+// The cache entry is keyed by `file.data_hash` and by `lang_opts_hash`. The
+// caller must hold `file.tokens_lock`, and `file.data` must be loaded.
+bool LoadCachedFileTokens(const std::filesystem::path &cache_dir,
+                          uint64_t lang_opts_hash, FileImpl &file);
+
+// Try to save `file.tokens` into the on-disk token cache in `cache_dir`. The
+// caller must hold `file.tokens_lock`. Failures are silently ignored.
+void StoreCachedFileTokens(const std::filesystem::path &cache_dir,
+                           uint64_t lang_opts_hash, const FileImpl &file);
+
+}  // namespace pasta
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "FileTokenizer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <utility>
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#  include <arm_neon.h>
+#endif
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/LangOptions.h>
+#include <clang/Basic/TokenKinds.h>
+#include <clang/Lex/Lexer.h>
+#pragma GCC diagnostic pop
+
+#include "../Util/FileManager.h"
+
+namespace pasta {
+namespace {
+
+// Perfect hash table mapping the spellings of one family of keywords, e.g.
+// the preprocessor keywords, to their token kinds. The seed of the hash is
+// picked at startup so that no two keywords share a slot, and so a lookup is
+// one hash, and at most one string comparison.
+class KeywordTable {
+ public:
+  using Keyword = std::pair<std::string_view, uint16_t>;
+
+  explicit KeywordTable(std::initializer_list<Keyword> keywords) {
+    for (const Keyword &kw : keywords) {
+      max_length = std::max(max_length, kw.first.size());
+    }
+
+    for (seed = 0u; !TryFill(keywords); ++seed) {
+      assert(seed < (1u << 16u));
+    }
+  }
+
+  // Return the kind of the keyword spelled `ident`, or `0` if it isn't one.
+  inline uint16_t Find(std::string_view ident) const noexcept {
+    if (ident.empty() || ident.size() > max_length) {
+      return 0u;
+    }
+    const Keyword &slot = slots[Hash(ident, seed)];
+    return slot.first == ident ? slot.second : 0u;
+  }
+
+ private:
+  static constexpr uint32_t kNumSlots = 128u;
+
+  static inline uint32_t Hash(std::string_view str, uint32_t seed) noexcept {
+    auto h = seed ^ static_cast<uint32_t>(str.size());
+    h = (h ^ static_cast<uint8_t>(str.front())) * 0x9e3779b1u;
+    h = (h ^ static_cast<uint8_t>(str.back())) * 0x85ebca77u;
+    h = (h ^ static_cast<uint8_t>(str[str.size() / 2u])) * 0xc2b2ae3du;
+    return (h ^ (h >> 15u)) & (kNumSlots - 1u);
+  }
+
+  bool TryFill(std::initializer_list<Keyword> keywords) noexcept {
+    for (Keyword &slot : slots) {
+      slot = {};
+    }
+    for (const Keyword &kw : keywords) {
+      Keyword &slot = slots[Hash(kw.first, seed)];
+      if (!slot.first.empty()) {
+        return false;
+      }
+      slot = kw;
+    }
+    return true;
+  }
+
+  Keyword slots[kNumSlots];
+  uint32_t seed{0u};
+  size_t max_length{0u};
+};
+
+static const KeywordTable kPPKeywords({
+#define PPKEYWORD(x) {#x, static_cast<uint16_t>(clang::tok::pp_##x)},
+#include <clang/Basic/TokenKinds.def>
+});
+
+static const KeywordTable kObjCKeywords({
+#define OBJC_AT_KEYWORD(x) {#x, static_cast<uint16_t>(clang::tok::objc_##x)},
+#include <clang/Basic/TokenKinds.def>
+});
+
+}  // namespace
+
+LineTable::LineTable(std::string_view data_)
+    : data(data_) {
+  assert(!data.empty());
+  assert(data.back() == '\0');
+
+  const char * const bytes = data.data();
+  const size_t size = data.size();
+
+  line_starts.reserve((size / 32u) + 1u);
+  line_starts.push_back(0u);
+
+  // A `\n` always ends a line, and a `\r` ends one unless it's the first half
+  // of a `\r\n`. Looking at `bytes[i + 1u]` is safe because the last byte is
+  // a NUL.
+  auto add_line_end = [=, this] (size_t i) {
+    if (bytes[i] == '\n' || bytes[i + 1u] != '\n') {
+      line_starts.push_back(static_cast<uint32_t>(i + 1u));
+    }
+  };
+
+  size_t i = 0u;
+
+#if defined(__SSE2__)
+  const __m128i lf = _mm_set1_epi8('\n');
+  const __m128i cr = _mm_set1_epi8('\r');
+  for (; i + 16u <= size; i += 16u) {
+    const __m128i chunk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(&(bytes[i])));
+    auto mask = static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, lf), _mm_cmpeq_epi8(chunk, cr))));
+    while (mask) {
+      add_line_end(i + static_cast<unsigned>(__builtin_ctz(mask)));
+      mask &= mask - 1u;
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint8x16_t lf = vdupq_n_u8('\n');
+  const uint8x16_t cr = vdupq_n_u8('\r');
+  for (; i + 16u <= size; i += 16u) {
+    const uint8x16_t chunk = vld1q_u8(
+        reinterpret_cast<const uint8_t *>(&(bytes[i])));
+    const uint8x16_t eq = vorrq_u8(vceqq_u8(chunk, lf), vceqq_u8(chunk, cr));
+    if (vmaxvq_u8(eq)) {
+      for (auto j = i; j < (i + 16u); ++j) {
+        if (bytes[j] == '\n' || bytes[j] == '\r') {
+          add_line_end(j);
+        }
+      }
+    }
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (bytes[i] == '\n' || bytes[i] == '\r') {
+      add_line_end(i);
+    }
+  }
+}
+
+// Move to `offset`.
+void LineTable::Cursor::Seek(size_t offset) noexcept {
+  const std::vector<uint32_t> &starts = table.line_starts;
+  assert(starts[line_index] <= offset);
+  while ((line_index + 1u) < starts.size() &&
+         starts[line_index + 1u] <= offset) {
+    ++line_index;
+  }
+
+  // NOTE(pag): The `\n` of a `\r\n` is on the same line as the `\r`, but
+  //            like `clang::SourceManager`, we restart columns after any `\r`.
+  if (offset && table.data[offset - 1u] == '\r') {
+    column = 1u;
+  } else {
+    column = static_cast<unsigned>(offset - starts[line_index]) + 1u;
+  }
+}
+
+// Raw lex `data`, the contents of the file starting at `file_loc`, into
+// `tokens`. This doesn't touch a source manager, and so is safe to call
+// from any thread.
+void TokenizeFile(const clang::LangOptions &lang_opts, std::string_view data,
+                  clang::SourceLocation file_loc,
+                  std::vector<FileTokenImpl> &tokens) {
+  assert(!data.empty());
+  assert(data.back() == '\0');
+
+  const size_t buff_size = data.size();
+  const char * const buff_begin = &(data.front());
+  const char * const buff_end = &(data[buff_size]);
+  clang::Lexer lexer(file_loc, lang_opts, buff_begin, buff_begin, buff_end);
+  lexer.SetKeepWhitespaceMode(true);  // Implies keep comments.
+
+  const LineTable lines(data);
+  LineTable::Cursor cursor(lines);
+  const auto file_start = file_loc.getRawEncoding();
+
+  // Kind of the last non-whitespace token, which tells us if an identifier
+  // follows a `#` or an `@`.
+  auto last_kind = clang::tok::unknown;
+
+  // Raw lex this file's tokens.
+  clang::Token tok;
+  auto has_more_buffer = true;
+  do {
+    has_more_buffer = !lexer.LexFromRawLexer(tok);
+    assert(!tok.hasLeadingEmptyMacro());
+    assert(!tok.isAnnotation());
+    if (tok.is(clang::tok::eof)) {
+      break;
+    }
+
+    // NOTE(pag): Locations within a file ID are contiguous, so the offset of
+    //            the token in the file is its distance from `file_loc`.
+    const clang::SourceLocation tok_loc = tok.getLocation();
+    const auto offset = tok_loc.getRawEncoding() - file_start;
+    const auto len = tok.getLength();
+    assert(offset < buff_size);
+    assert((offset + tok.getLength()) <= buff_size);
+    auto tok_kind = tok.getKind();
+
+    uint16_t is_pp_keyword = 0;
+    uint16_t is_objc_keyword = 0;
+    uint16_t alt_keyword = 0;
+
+    auto fixed_offset = offset;
+    auto fixed_len = len;
+
+    // Skip over leading whitespace if this isn't a whitespace token.
+    for (auto skip = clang::tok::unknown != tok_kind;
+         skip && fixed_len && fixed_offset < buff_size; ) {
+      skip = false;
+      switch (buff_begin[fixed_offset]) {
+        case '\\':
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          ++fixed_offset;
+          --fixed_len;
+          skip = true;
+          break;
+        default:
+          skip = false;
+      }
+    }
+
+    // There was leading whitespace, go and form a token for it.
+    if (auto diff = fixed_offset - offset) {
+      assert(diff < len);
+      cursor.Seek(offset);
+      tokens.emplace_back(offset, diff, cursor.Line(), cursor.Column(),
+                          clang::tok::unknown);
+    }
+
+    if (clang::tok::isAnyIdentifier(tok_kind)) {
+      assert(tok_kind == clang::tok::raw_identifier);
+      tok_kind = clang::tok::identifier;
+
+      // Try to form a `pp_*` keyword, or an `objc_*` keyword.
+      //
+      // NOTE(pag): Identifiers after an `@` are also checked against the
+      //            preprocessor keywords, which take precedence, e.g. in
+      //            `@import`.
+      if (last_kind == clang::tok::at || last_kind == clang::tok::hash) {
+        const std::string_view ident(&(buff_begin[fixed_offset]), fixed_len);
+        if (last_kind == clang::tok::at) {
+          if (auto kind = kObjCKeywords.Find(ident)) {
+            is_objc_keyword = 1;
+            alt_keyword = kind;
+          }
+        }
+        if (auto kind = kPPKeywords.Find(ident)) {
+          is_pp_keyword = 1;
+          alt_keyword = kind;
+        }
+      }
+    }
+
+    cursor.Seek(fixed_offset);
+    auto &last_tok = tokens.emplace_back(
+        fixed_offset, fixed_len, cursor.Line(), cursor.Column(), tok_kind);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    last_tok.kind.extended.is_pp_kw = is_pp_keyword;
+    last_tok.kind.extended.is_objc_kw = is_objc_keyword;
+    last_tok.kind.extended.alt_kind = alt_keyword;
+#pragma GCC diagnostic pop
+
+    if (tok_kind != clang::tok::unknown) {
+      last_kind = tok_kind;
+    }
+  } while (has_more_buffer);
+
+  // Add the end of file token. Its data is the trailing NUL.
+  const auto eof_offset = static_cast<uint32_t>(buff_size - 1u);
+  cursor.Seek(eof_offset);
+  tokens.emplace_back(eof_offset, 0u, cursor.Line(), cursor.Column(),
+                      clang::tok::eof);
+}
+
+}  // namespace pasta
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/SourceLocation.h>
+#pragma GCC diagnostic pop
+
+namespace clang {
+class LangOptions;
+}  // namespace clang
+namespace pasta {
+
+struct FileTokenImpl;
+
+// Offsets of the starts of the lines of a file. Line endings follow the
+// rules of `clang::SourceManager`: each of `\n`, `\r`, and `\r\n` ends a line.
+class LineTable {
+ public:
+  // `data` must end with a NUL.
+  explicit LineTable(std::string_view data_);
+
+  // Returns the spelling line and column numbers of file offsets. Offsets
+  // passed to `Seek` must be non-decreasing.
+  class Cursor {
+   public:
+    inline explicit Cursor(const LineTable &table_)
+        : table(table_) {}
+
+    // Move to `offset`.
+    void Seek(size_t offset) noexcept;
+
+    // One-based line number of the last `Seek`ed offset.
+    inline unsigned Line(void) const noexcept {
+      return static_cast<unsigned>(line_index) + 1u;
+    }
+
+    // One-based column number of the last `Seek`ed offset.
+    inline unsigned Column(void) const noexcept {
+      return column;
+    }
+
+   private:
+    const LineTable &table;
+    size_t line_index{0u};
+    unsigned column{1u};
+  };
+
+  inline size_t NumLines(void) const noexcept {
+    return line_starts.size();
+  }
+
+ private:
+  const std::string_view data;
+
+  // `line_starts[i]` is the offset of the first byte of line `i + 1`.
+  std::vector<uint32_t> line_starts;
+};
+
+// Raw lex `data`, the contents of the file starting at `file_loc`, into
+// `tokens`. This doesn't touch a source manager, and so is safe to call
+// from any thread.
+void TokenizeFile(const clang::LangOptions &lang_opts, std::string_view data,
+                  clang::SourceLocation file_loc,
+                  std::vector<FileTokenImpl> &tokens);
+
+}  // namespace pasta
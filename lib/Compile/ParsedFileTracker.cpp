@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "ParsedFileTracker.h"
+
+namespace pasta {
+
+// Each time we enter a source file, try to keep track of it.
+void ParsedFileTracker::FileChanged(
+    clang::SourceLocation loc, clang::PPCallbacks::FileChangeReason reason,
+    clang::SrcMgr::CharacteristicKind file_type, clang::FileID file_id) {
+
+  if (clang::PPCallbacks::EnterFile == reason ||
+      clang::PPCallbacks::ExitFile == reason) {
+    switch (file_type) {
+      case clang::SrcMgr::CharacteristicKind::C_User:
+      case clang::SrcMgr::CharacteristicKind::C_System:
+      case clang::SrcMgr::CharacteristicKind::C_ExternCSystem:
+        break;
+      case clang::SrcMgr::CharacteristicKind::C_User_ModuleMap:
+      case clang::SrcMgr::CharacteristicKind::C_System_ModuleMap:
+        return;
+    }
+  } else {
+    return;
+  }
+
+  if (clang::PPCallbacks::EnterFile == reason) {
+    assert(loc.isValid());
+    assert(loc.isFileID());
+    file_id = sm.getFileID(loc);
+  }
+
+  const clang::FileEntry *fe = sm.getFileEntryForID(file_id);
+  if (!fe) {
+    return;
+  }
+
+  std::filesystem::path fs_path = fs->ParsePath(
+      fe->getName().str(), cwd, fs->PathKind());
+  Result<Stat, std::error_code> fs_stat = fs->Stat(fs_path, cwd);
+  if (!fs_stat.Succeeded()) {
+    assert(false);
+    return;
+  }
+
+  Result<File, std::error_code> maybe_file = fm.OpenFile(fs_stat.TakeValue());
+  if (!maybe_file.Succeeded()) {
+    assert(false);
+    return;
+  }
+
+  File file = maybe_file.TakeValue();
+
+  // Keep a mapping of Clang file IDs to parsed files.
+  auto [file_it, just_added] = ast->id_to_file.emplace(
+      file_id.getHashValue(), file);
+  assert(file_it->second.impl.get() == file.impl.get());
+  (void) file_it;
+  (void) just_added;
+
+  // If we've seen this file already, then don't tokenize it.
+  if (auto [seen_it, added] = seen.emplace(file.impl.get()); !added) {
+    return;
+  }
+
+  auto maybe_data = file.Data();
+  if (!maybe_data.Succeeded()) {
+    return;
+  }
+
+  ast->parsed_files.emplace_back(file);
+
+  std::unique_lock<std::mutex> locker(file.impl->tokens_lock);
+  if (file.impl->has_tokens) {
+    return;
+  }
+
+  auto data = maybe_data.TakeValue();
+  file.impl->has_tokens = true;
+  if (data.empty()) {
+    return;
+  }
+
+  // NOTE(pag): For `ExitFile`, `loc` is in the file being returned to, so we
+  //            always ask for the start of `file_id`.
+  const clang::SourceLocation file_loc = sm.getLocForStartOfFile(file_id);
+
+  if (!tokenizer_pool) {
+
+    // Try to reuse the tokens from a prior lexing of this file.
+    if (!token_cache_dir.empty() &&
+        LoadCachedFileTokens(token_cache_dir, lang_opts_hash, *(file.impl))) {
+      num_token_cache_hits.fetch_add(1u, std::memory_order_relaxed);
+      return;
+    }
+
+    TokenizeFile(lang_opts, data, file_loc, file.impl->tokens);
+
+    if (!token_cache_dir.empty()) {
+      num_token_cache_misses.fetch_add(1u, std::memory_order_relaxed);
+      StoreCachedFileTokens(token_cache_dir, lang_opts_hash, *(file.impl));
+    }
+    return;
+  }
+
+  // Tokenize the file on the pool. Until the task finishes, anyone reading
+  // the file's tokens (e.g. the macro tracker) waits in `WaitForTokens`.
+  file.impl->tokens_pending = true;
+  locker.unlock();
+
+  tokenizer_pool->async([=, this, file = std::move(file)] (void) {
+    FileImpl &impl = *(file.impl);
+    std::unique_lock<std::mutex> task_locker(impl.tokens_lock);
+    if (token_cache_dir.empty() ||
+        !LoadCachedFileTokens(token_cache_dir, lang_opts_hash, impl)) {
+
+      task_locker.unlock();
+      std::vector<FileTokenImpl> tokens;
+      TokenizeFile(lang_opts, data, file_loc, tokens);
+      task_locker.lock();
+
+      impl.tokens.swap(tokens);
+      if (!token_cache_dir.empty()) {
+        num_token_cache_misses.fetch_add(1u, std::memory_order_relaxed);
+        StoreCachedFileTokens(token_cache_dir, lang_opts_hash, impl);
+      }
+    } else {
+      num_token_cache_hits.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    impl.tokens_pending = false;
+    task_locker.unlock();
+    impl.tokens_cv.notify_all();
+  });
+}
+
+}  // namespace pasta
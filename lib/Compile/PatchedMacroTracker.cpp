@@ -21,28 +21,29 @@
 
 namespace pasta {
 
-static void ReparentNode(Node &node, MacroNodeImpl *new_parent) {
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
-    std::get<MacroTokenImpl *>(node)->parent = new_parent;
-
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    auto impl = std::get<MacroNodeImpl *>(node);
-    if (dynamic_cast<MacroArgumentImpl *>(impl)) {
-      assert(!dynamic_cast<MacroArgumentImpl *>(new_parent));
-      assert(dynamic_cast<MacroExpansionImpl *>(new_parent));
+static void ReparentNode(RootMacroNode &root, Node node,
+                         MacroNodeImpl *new_parent) {
+  if (node.IsToken()) {
+    root.TokenAt(node)->parent = new_parent;
+
+  } else if (node.IsNode()) {
+    auto impl = root.NodeAt(node);
+    if (llvm::isa<MacroArgumentImpl>(impl)) {
+      assert(!llvm::isa<MacroArgumentImpl>(new_parent));
+      assert(llvm::isa<MacroExpansionImpl>(new_parent));
     }
     impl->parent = new_parent;
   }
 }
 
-static void ReparentNodes(NodeList nodes, MacroNodeImpl *new_parent) {
-  for (Node &node : nodes) {
-    ReparentNode(node, new_parent);
+// Move all of `nodes` to the end of `new_parent->nodes`.
+static void ReparentNodes(RootMacroNode &root, NodeList &nodes,
+                          MacroNodeImpl *new_parent) {
+  for (Node node : root.Nodes(nodes)) {
+    ReparentNode(root, node, new_parent);
   }
 
-  new_parent->nodes.insert(new_parent->nodes.end(),
-                           nodes.begin(),
-                           nodes.end());
+  root.Append(new_parent->nodes, root.Nodes(nodes));
   nodes.clear();
 }
 
@@ -57,7 +58,7 @@ static void InjectArgumentNode(std::vector<MacroNodeImpl *> &nodes,
   D( bool found = false; )
   for (MacroNodeImpl *old_node : nodes) {
     new_nodes.push_back(old_node);
-    if (auto old_arg = dynamic_cast<MacroArgumentImpl *>(old_node)) {
+    if (auto old_arg = llvm::dyn_cast<MacroArgumentImpl>(old_node)) {
       new_arguments.push_back(old_arg);
 
     } else if (old_node == exp) {
@@ -80,12 +81,13 @@ PatchedMacroTracker::PatchedMacroTracker(
       ci(*(ast_->ci)),
       lo(ci.getLangOpts()),
       ast(ast_),
+      root(ast_->root_macro_node),
       token_data_stream(ast->preprocessed_code),
       backup_token_data_stream(ast->backup_token_data) {
   (void) pp;
   (void) suppress_indent;
   (void) indent;
-  nodes.push_back(&(ast->root_macro_node));
+  nodes.push_back(&root);
   tok_data_vec.resize(16);
 }
 
@@ -168,8 +170,7 @@ bool PatchedMacroTracker::TryExtractHeaderName(const clang::Token &tok) {
     return false;
   }
 
-  MacroSubstitutionImpl *sub =
-      &(ast->root_macro_node.substitutions.emplace_back());
+  MacroSubstitutionImpl *sub = root.NewSubstitution();
   D( sub->line_added = __LINE__; )
   MacroNodeImpl *parent_node = nodes.back();
   sub->parent = parent_node;
@@ -209,30 +210,29 @@ MacroExpansionImpl *PatchedMacroTracker::DoPreExpansionSetup(
   assert(exp->l_paren != nullptr);
 
   // Create a new expansion.
-  MacroExpansionImpl *new_exp =
-      &(ast->root_macro_node.expansions.emplace_back());
+  MacroExpansionImpl *new_exp = root.NewExpansion();
   D( new_exp->line_added = __LINE__; )
   new_exp->defined_macro = exp->defined_macro;
 
-  if (std::holds_alternative<MacroNodeImpl *>(exp->definition)) {
-    MacroDirectiveImpl *def = dynamic_cast<MacroDirectiveImpl *>(
-        std::get<MacroNodeImpl *>(exp->definition));
+  if (exp->definition.IsNode()) {
+    MacroDirectiveImpl *def = llvm::dyn_cast<MacroDirectiveImpl>(
+        root.NodeAt(exp->definition));
     new_exp->definition = def;
-    def->macro_uses.emplace_back(new_exp);
+    root.Append(def->macro_uses, new_exp);
   }
 
   MacroTokenImpl *new_ident = exp->ident->Clone(*ast, new_exp);
   MacroTokenImpl *new_l_paren = exp->l_paren->Clone(*ast, new_exp);
   assert(exp->ident->token_offset < new_ident->token_offset);
   assert(exp->l_paren->token_offset < new_l_paren->token_offset);
-  new_exp->nodes.push_back(new_ident);
-  new_exp->nodes.push_back(new_l_paren);
+  root.Append(new_exp->nodes, new_ident);
+  root.Append(new_exp->nodes, new_l_paren);
   new_exp->ident = new_ident;
   new_exp->l_paren = new_l_paren;
 
-  ReparentNodes(std::move(exp->nodes), new_exp);
+  ReparentNodes(root, exp->nodes, new_exp);
 
-  exp->nodes.push_back(new_exp);
+  root.Append(exp->nodes, new_exp);
   new_exp->is_prearg_expansion = true;
   new_exp->parent = exp;
   new_exp->parent_for_prearg = exp;
@@ -241,36 +241,40 @@ MacroExpansionImpl *PatchedMacroTracker::DoPreExpansionSetup(
 }
 
 #ifndef NDEBUG
-static MacroTokenImpl *FirstExpansionToken(const Node &node) {
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
-    return std::get<MacroTokenImpl *>(node);
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    return std::get<MacroNodeImpl *>(node)->FirstExpansionToken();
+static MacroTokenImpl *FirstExpansionToken(const RootMacroNode &root,
+                                           Node node) {
+  if (node.IsToken()) {
+    return root.TokenAt(node);
+  } else if (node.IsNode()) {
+    return root.NodeAt(node)->FirstExpansionToken(root);
   } else {
     return nullptr;
   }
 }
 
-static bool LastIsNotArgument(MacroExpansionImpl *exp) {
+static bool LastIsNotArgument(const RootMacroNode &root,
+                              MacroExpansionImpl *exp) {
   if (exp->nodes.empty()) {
     return false;
   }
 
-  if (!std::holds_alternative<MacroNodeImpl *>(exp->nodes.back())) {
+  Node last = root.Nodes(exp->nodes).back();
+  if (!last.IsNode()) {
     return false;
   }
 
-  auto impl = std::get<MacroNodeImpl *>(exp->nodes.back());
-  return !!dynamic_cast<MacroArgumentImpl *>(impl);
+  auto impl = root.NodeAt(last);
+  return llvm::isa<MacroArgumentImpl>(impl);
 }
 
-static bool HasArgumentSeparator(MacroExpansionImpl *exp) {
+static bool HasArgumentSeparator(const RootMacroNode &root,
+                                 MacroExpansionImpl *exp) {
   if (exp->nodes.empty()) {
     return false;
   }
 
   // TODO(pag): Probably want last expansion token.
-  if (auto sep = FirstExpansionToken(exp->nodes.back())) {
+  if (auto sep = FirstExpansionToken(root, root.Nodes(exp->nodes).back())) {
     return sep->kind_flags.kind == pasta::TokenKind::kComma ||
            sep->kind_flags.kind == pasta::TokenKind::kLParenthesis;
   }
@@ -288,25 +292,25 @@ static void InjectArgument(ASTImpl &ast, std::vector<MacroNodeImpl *> &nodes,
   assert(!pre_exp->is_cancelled);
   assert(pre_exp->use_nodes.empty());
 
-  MacroArgumentImpl *missing_arg =
-      &(ast.root_macro_node.arguments.emplace_back());
+  RootMacroNode &root = ast.root_macro_node;
+  MacroArgumentImpl *missing_arg = root.NewArgument();
   D( missing_arg->line_added = __LINE__; )
 
-  assert(!LastIsNotArgument(pre_exp));
+  assert(!LastIsNotArgument(root, pre_exp));
 
-  Node just_added_node = std::move(pre_exp->nodes.back());
+  Node just_added_node = root.Nodes(pre_exp->nodes).back();
   pre_exp->nodes.pop_back();
-  ReparentNode(just_added_node, missing_arg);
+  ReparentNode(root, just_added_node, missing_arg);
 
-  assert(HasArgumentSeparator(pre_exp));
+  assert(HasArgumentSeparator(root, pre_exp));
 
   missing_arg->parent = pre_exp;
   missing_arg->is_prearg_expansion = pre_exp->is_prearg_expansion;
   missing_arg->index = static_cast<unsigned>(pre_exp->arguments.size());
   missing_arg->offset = static_cast<unsigned>(pre_exp->nodes.size());
-  missing_arg->nodes.emplace_back(std::move(just_added_node));
-  pre_exp->arguments.push_back(missing_arg);
-  pre_exp->nodes.emplace_back(missing_arg);
+  root.Append(missing_arg->nodes, just_added_node);
+  root.Append(pre_exp->arguments, missing_arg);
+  root.Append(pre_exp->nodes, missing_arg);
 
   InjectArgumentNode(nodes, arguments, pre_exp, missing_arg);
 }
@@ -317,8 +321,10 @@ static void TryWrapLastNodeInArgument(
     ASTImpl &ast, std::vector<MacroNodeImpl *> &nodes,
     std::vector<MacroArgumentImpl *> &arguments,
     MacroExpansionImpl *pre_exp, const std::string &indent) {
-  if (std::holds_alternative<MacroTokenImpl *>(pre_exp->nodes.back())) {
-    auto last_tok = std::get<MacroTokenImpl *>(pre_exp->nodes.back());
+  const RootMacroNode &root = ast.root_macro_node;
+  Node last = root.Nodes(pre_exp->nodes).back();
+  if (last.IsToken()) {
+    auto last_tok = root.TokenAt(last);
     if (last_tok != pre_exp->ident &&
         last_tok != pre_exp->l_paren &&
         (last_tok->kind_flags.kind != TokenKind::kComma ||
@@ -328,9 +334,9 @@ static void TryWrapLastNodeInArgument(
       InjectArgument(ast, nodes, arguments, pre_exp);
     }
 
-  } else if (std::holds_alternative<MacroNodeImpl *>(pre_exp->nodes.back())) {
-    auto last_node = std::get<MacroNodeImpl *>(pre_exp->nodes.back());
-    auto last_arg = dynamic_cast<MacroArgumentImpl *>(last_node);
+  } else if (last.IsNode()) {
+    auto last_node = root.NodeAt(last);
+    auto last_arg = llvm::dyn_cast<MacroArgumentImpl>(last_node);
     if (!last_arg) {
       assert(false);  // Probably not needed?
       D( std::cerr << indent << "^ Adding missing argument for node\n"; )
@@ -338,18 +344,18 @@ static void TryWrapLastNodeInArgument(
 
     } else {
       D( std::cerr << indent << "^ Last node was already an argument\n"; )
-      assert(std::get<MacroNodeImpl *>(last_arg->parent) == pre_exp);
+      assert(root.NodeAt(last_arg->parent) == pre_exp);
     }
   }
 }
 
-static int ParenCount(MacroNodeImpl *arg) {
+static int ParenCount(const RootMacroNode &root, MacroNodeImpl *arg) {
   int paren_count = 0;
-  for (const Node &node : arg->nodes) {
-    if (std::holds_alternative<MacroNodeImpl *>(node)) {
-      paren_count += ParenCount(std::get<MacroNodeImpl *>(node));
-    } else if (std::holds_alternative<MacroTokenImpl *>(node)){
-      MacroTokenImpl *tok = std::get<MacroTokenImpl *>(node);
+  for (Node node : root.Nodes(arg->nodes)) {
+    if (node.IsNode()) {
+      paren_count += ParenCount(root, root.NodeAt(node));
+    } else if (node.IsToken()){
+      MacroTokenImpl *tok = root.TokenAt(node);
       if (tok->kind_flags.kind == TokenKind::kLParenthesis) {
         ++paren_count;
       } else if (tok->kind_flags.kind == TokenKind::kRParenthesis) {
@@ -462,9 +468,9 @@ void PatchedMacroTracker::FixupDerivedLocations(void) {
 // Returns `true` if adding to the parent node ended up wrapping this thing
 // in an argument.
 bool PatchedMacroTracker::AddToParentNode(Node node) {
-  MacroExpansionImpl *exp = dynamic_cast<MacroExpansionImpl *>(nodes.back());
+  MacroExpansionImpl *exp = llvm::dyn_cast<MacroExpansionImpl>(nodes.back());
 
-  nodes.back()->nodes.emplace_back(std::move(node));
+  root.Append(nodes.back()->nodes, node);
 
   if (!exp || exp->is_cancelled || exp->done_prearg_expansion ||
       !exp->use_nodes.empty()  /* it has switched to expanding */) {
@@ -783,7 +789,7 @@ void PatchedMacroTracker::DoToken(const clang::Token &tok_, uintptr_t data) {
   ast->AppendBackupToken(tok, offset, tok_data.size(), role);
 
   TokenImpl &added_tok = ast->tokens.back();
-  MacroTokenImpl *tok_node = &(ast->root_macro_node.tokens.emplace_back());
+  MacroTokenImpl *tok_node = root.NewToken();
   tok_node->token_offset = static_cast<uint32_t>(tok_index);
   assert(tok_node->token_offset == tok_index);
   tok_node->parent = parent_node;
@@ -795,9 +801,10 @@ void PatchedMacroTracker::DoToken(const clang::Token &tok_, uintptr_t data) {
   tok_node->kind_flags.is_ignored_comma =
       tok.getFlag(clang::Token::IgnoredComma);
   added_tok.kind = 0;
+  ++ast->tokens_version;
 
   // Add the token to the node.
-  parent_node->nodes.push_back(tok_node);
+  root.Append(parent_node->nodes, tok_node);
   last_token_was_added = true;
   last_token = tok;
 
@@ -857,7 +864,7 @@ void PatchedMacroTracker::DoToken(const clang::Token &tok_, uintptr_t data) {
         exp->defined_macro && exp->defined_macro->isFunctionLike() &&
         exp->defined_macro->isVariadic() &&
         exp->arguments.size() >= exp->defined_macro->getNumParams() &&
-        !exp->done_prearg_expansion && 0 >= ParenCount(arg)) {
+        !exp->done_prearg_expansion && 0 >= ParenCount(root, arg)) {
 
       if (tok.is(clang::tok::comma)) {
         D( std::cerr << indent << "Injecting EndMacroCallArgument\n"; )
@@ -874,12 +881,12 @@ void ASTImpl::MarkMacroTokens(void) {
   for (const MacroTokenImpl &mt : root_macro_node.tokens) {
     TokenImpl &tok = tokens[mt.token_offset];
     Node parent = mt.parent;
-    while (std::holds_alternative<MacroNodeImpl *>(parent)) {
-      auto parent_node = std::get<MacroNodeImpl *>(parent);
+    while (parent.IsNode()) {
+      auto parent_node = root_macro_node.NodeAt(parent);
       switch (parent_node->kind) {
         case MacroKind::kPragmaDirective:
           tok.is_in_pragma_directive = 1;
-          parent = std::monostate{};
+          parent = Node();
           break;
         default:
           tok.is_in_pragma_directive = 0;
@@ -910,12 +917,14 @@ void ASTImpl::LinkMacroTokenContexts(void) {
     }
 #endif
 
-    root_macro_node.token_nodes.emplace_back(&mt);
+    root_macro_node.token_nodes.emplace_back(mt.self);
     tok.kind = static_cast<TokenKindBase>(mt.kind_flags.kind);
     mt.token_context = tok.context_index;
     tok.context_index = i;
     ++i;
   }
+
+  ++tokens_version;
 }
 
 MacroKind KindFromName(llvm::StringRef ident,
@@ -1179,8 +1188,7 @@ void PatchedMacroTracker::DoBeginDirective(
     const clang::Token &tok, uintptr_t data) {
   Push(tok);
   assert(directives.empty());
-  MacroDirectiveImpl *directive =
-      &(ast->root_macro_node.directives.emplace_back());
+  MacroDirectiveImpl *directive = root.NewDirective();
   D( directive->line_added = __LINE__; )
   AddToParentNode(directive);
   directive->parent = nodes.back();
@@ -1199,12 +1207,12 @@ void PatchedMacroTracker::DoSetNamedDirective(const clang::Token &, uintptr_t) {
 //    return;
 //  }
 
-  if (!std::holds_alternative<MacroTokenImpl *>(directive->nodes.back())) {
+  if (!root.Nodes(directive->nodes).back().IsToken()) {
     assert(false);
     return;
   }
 
-  auto name_tok = std::get<MacroTokenImpl *>(directive->nodes.back());
+  auto name_tok = root.TokenAt(root.Nodes(directive->nodes).back());
   if (name_tok->kind_flags.kind != TokenKind::kIdentifier &&
       name_tok->kind_flags.kind != TokenKind::kRawIdentifier &&
       name_tok->kind_flags.kind != TokenKind::kKeywordIf &&
@@ -1218,12 +1226,13 @@ void PatchedMacroTracker::DoSetNamedDirective(const clang::Token &, uintptr_t) {
   std::string_view data = kw_name_tok.Data(*ast);
   directive->kind = KindFromName(data, kw_kind);
   if (directive->kind != MacroKind::kToken) {
-    directive->directive_name = directive->nodes.back();
+    directive->directive_name = root.Nodes(directive->nodes).back();
     D( std::cerr << indent << "DirectiveName=" << data << '\n'; )
 
     // Upgrade the file token in-place.
     name_tok->kind_flags.kind = TokenKind::kRawIdentifier;
     kw_name_tok.kind = static_cast<TokenKindBase>(clang::tok::raw_identifier);
+    ++ast->tokens_version;
     TryUpgradeFileTokenKind(*ast, kw_name_tok.Location(), kw_kind);
   }
 }
@@ -1239,11 +1248,11 @@ void PatchedMacroTracker::DoEndNonDirective(const clang::Token &tok,
   MacroNodeImpl *parent_node = nodes.back();
 
   // Remove it from the parent, and move all child nodes up to the parent.
-  assert(std::holds_alternative<MacroNodeImpl *>(parent_node->nodes.back()));
-  assert(std::get<MacroNodeImpl *>(parent_node->nodes.back()) ==
+  assert(root.Nodes(parent_node->nodes).back().IsNode());
+  assert(root.NodeAt(root.Nodes(parent_node->nodes).back()) ==
          last_directive);
   parent_node->nodes.pop_back();
-  ReparentNodes(std::move(last_directive->nodes), parent_node);
+  ReparentNodes(root, last_directive->nodes, parent_node);
   Pop(tok);
   last_directive = nullptr;
   last_token.startToken();
@@ -1252,8 +1261,9 @@ void PatchedMacroTracker::DoEndNonDirective(const clang::Token &tok,
 static void Expand(std::ostream &os, const ASTImpl &ast,
                    Node node, const char *&sep,
                    clang::SourceLocation &last_loc) {
-  if (std::holds_alternative<MacroTokenImpl *>(node)) {
-    auto tok = std::get<MacroTokenImpl *>(node);
+  const RootMacroNode &root = ast.root_macro_node;
+  if (node.IsToken()) {
+    auto tok = root.TokenAt(node);
     const TokenImpl &real_tok = ast.tokens[tok->token_offset];
     last_loc = real_tok.Location();
     auto data = real_tok.Data(ast);
@@ -1263,9 +1273,9 @@ static void Expand(std::ostream &os, const ASTImpl &ast,
       sep = " ";
     }
 
-  } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-    auto sub = std::get<MacroNodeImpl *>(node);
-    for (const Node &sub_node : sub->nodes) {
+  } else if (node.IsNode()) {
+    auto sub = root.NodeAt(node);
+    for (Node sub_node : root.Nodes(sub->nodes)) {
       Expand(os, ast, sub_node, sep, last_loc);
     }
   }
@@ -1322,7 +1332,7 @@ void PatchedMacroTracker::DoEndDirective(
         last_loc.getRawEncoding(), 0u, 0u,
         clang::tok::unknown, TokenRole::kEndOfInternalMacroEventMarker);
 
-    MacroTokenImpl *macro_tok = &(ast->root_macro_node.tokens.emplace_back());
+    MacroTokenImpl *macro_tok = root.NewToken();
     macro_tok->token_offset = static_cast<uint32_t>(tok_index);
     assert(macro_tok->token_offset == tok_index);
     macro_tok->parent = last_directive;
@@ -1334,7 +1344,7 @@ void PatchedMacroTracker::DoEndDirective(
     macro_tok->kind_flags.is_ignored_comma = false;
 
     // Add the token to the end of the pragma directive node.
-    last_directive->nodes.push_back(macro_tok);
+    root.Append(last_directive->nodes, macro_tok);
   }
 
   Pop(tok);
@@ -1346,8 +1356,7 @@ void PatchedMacroTracker::DoBeginMacroExpansion(
 
   assert(!cond_skip_depth);
 
-  MacroExpansionImpl *expansion =
-      &(ast->root_macro_node.expansions.emplace_back());
+  MacroExpansionImpl *expansion = root.NewExpansion();
   D( expansion->line_added = __LINE__; )
 
   // NOTE(pag): This inspects `expansions.back()` to see if we need to wrap
@@ -1371,7 +1380,7 @@ void PatchedMacroTracker::DoBeginMacroExpansion(
     if (MacroDirectiveImpl *def = it->second) {
       assert(def->kind == MacroKind::kDefineDirective);
       assert(def->defined_macro == mi);
-      def->macro_uses.push_back(expansion);
+      root.Append(def->macro_uses, expansion);
       expansion->definition = def;
 
       ast->tokens.back().is_macro_name = 1;
@@ -1399,11 +1408,10 @@ void PatchedMacroTracker::DoBeginMacroCallArgument(
     end_of_arg_toks.emplace(tok.getLocation().getRawEncoding(), tok);
   }
 
-  assert(!LastIsNotArgument(expansion));
-  assert(HasArgumentSeparator(expansion));
+  assert(!LastIsNotArgument(root, expansion));
+  assert(HasArgumentSeparator(root, expansion));
 
-  MacroArgumentImpl *argument =
-      &(ast->root_macro_node.arguments.emplace_back());
+  MacroArgumentImpl *argument = root.NewArgument();
   D( argument->line_added = __LINE__; )
   argument->index = static_cast<unsigned>(expansion->arguments.size());
   argument->offset = static_cast<unsigned>(expansion->nodes.size());
@@ -1413,7 +1421,7 @@ void PatchedMacroTracker::DoBeginMacroCallArgument(
   AddToParentNode(argument);  // Adds to `expansion`.
   assert(nodes.back() == expansion);
   argument->parent = nodes.back();
-  expansion->arguments.emplace_back(argument);
+  root.Append(expansion->arguments, argument);
   nodes.push_back(argument);
   arguments.push_back(argument);
   assert(expansion->arguments.size() == (argument->index + 1u));
@@ -1451,19 +1459,20 @@ void PatchedMacroTracker::DoEndMacroCallArgument(
   arguments.pop_back();
   nodes.pop_back();
   assert(nodes.back() == expansions.back());
-  assert(std::holds_alternative<MacroNodeImpl *>(argument->parent));
-  assert(nodes.back() == std::get<MacroNodeImpl *>(argument->parent));
+  assert(argument->parent.IsNode());
+  assert(nodes.back() == root.NodeAt(argument->parent));
 
   // Pop off the `,` or the `)` from the argument, and add it to the
   // expansion.
   if (argument->nodes.empty()) {
     assert(false);
   }
-  MacroNodeImpl *parent_node = std::get<MacroNodeImpl *>(argument->parent);
+  MacroNodeImpl *parent_node = root.NodeAt(argument->parent);
   assert(parent_node->kind == MacroKind::kExpansion);
 
-  ReparentNode(argument->nodes.back(), parent_node);
-  parent_node->nodes.push_back(std::move(argument->nodes.back()));
+  Node sep_node = root.Nodes(argument->nodes).back();
+  ReparentNode(root, sep_node, parent_node);
+  root.Append(parent_node->nodes, sep_node);
   argument->nodes.pop_back();
 }
 
@@ -1536,14 +1545,14 @@ void PatchedMacroTracker::DoEndPreArgumentExpansion(
   assert(parent_exp->r_paren != nullptr);
 
   assert(!expansion->nodes.empty());
-  Node r_paren_node = expansion->nodes.back();
+  Node r_paren_node = root.Nodes(expansion->nodes).back();
   assert(arguments.empty() || nodes.back() != arguments.back());
 
   // Go get the `r_paren` at the end of the expansion nodes list.
-  if (std::holds_alternative<MacroTokenImpl *>(r_paren_node) &&
-      (std::get<MacroTokenImpl *>(r_paren_node)->kind_flags.kind ==
+  if (r_paren_node.IsToken() &&
+      (root.TokenAt(r_paren_node)->kind_flags.kind ==
           TokenKind::kRParenthesis)) {
-    expansion->r_paren = std::get<MacroTokenImpl *>(r_paren_node);
+    expansion->r_paren = root.TokenAt(r_paren_node);
     expansion->r_paren_index = static_cast<unsigned>(
         expansion->nodes.size() - 1u);
   }
@@ -1558,41 +1567,41 @@ void PatchedMacroTracker::DoEndPreArgumentExpansion(
 
     if (!parent_exp->arguments.empty()) {
       assert(parent_exp->arguments.size() == 1u);
-      auto parent_arg = dynamic_cast<MacroArgumentImpl *>(
-          std::get<MacroNodeImpl *>(parent_exp->arguments.back()));
+      auto parent_arg = llvm::dyn_cast<MacroArgumentImpl>(
+          root.NodeAt(root.Nodes(parent_exp->arguments).back()));
 
       // Eliminate the empty argument in the initial expansion.
       if (parent_arg && parent_arg->nodes.empty() &&
           parent_exp->r_paren_index &&
           (parent_exp->r_paren_index + 1u) == parent_exp->nodes.size()) {
 
+        std::span<Node> parent_nodes = root.Nodes(parent_exp->nodes);
         parent_exp->arguments.pop_back();
-        parent_exp->nodes[parent_exp->r_paren_index - 1u] =
-            std::move(parent_exp->nodes[parent_exp->r_paren_index]);
+        parent_nodes[parent_exp->r_paren_index - 1u] =
+            parent_nodes[parent_exp->r_paren_index];
         parent_exp->nodes.pop_back();
         --parent_exp->r_paren_index;
 
       // Make an empty dummy argument.
       } else {
-        MacroArgumentImpl *missing_arg =
-            &(ast->root_macro_node.arguments.emplace_back());
+        MacroArgumentImpl *missing_arg = root.NewArgument();
         D( missing_arg->line_added = __LINE__; )
 
-        assert(!LastIsNotArgument(expansion));
-        assert(HasArgumentSeparator(expansion));
+        assert(!LastIsNotArgument(root, expansion));
+        assert(HasArgumentSeparator(root, expansion));
 
         missing_arg->parent = expansion;
         missing_arg->is_prearg_expansion = true;
         missing_arg->index = static_cast<unsigned>(expansion->arguments.size());
         missing_arg->offset = static_cast<unsigned>(expansion->nodes.size());
-        expansion->arguments.push_back(missing_arg);
-        expansion->nodes.emplace_back(missing_arg);
+        root.Append(expansion->arguments, missing_arg);
+        root.Append(expansion->nodes, missing_arg);
       }
     }
 
     expansion->r_paren_index = static_cast<unsigned>(expansion->nodes.size());
     expansion->r_paren = parent_exp->r_paren->Clone(*ast, expansion);
-    expansion->nodes.emplace_back(expansion->r_paren);
+    root.Append(expansion->nodes, expansion->r_paren);
   }
 
   // We should now be looking at the expansion.
@@ -1618,17 +1627,17 @@ void PatchedMacroTracker::DoEndPreArgumentExpansion(
   for (++r_paren_index; r_paren_index < num_parent_exp_nodes;
        ++r_paren_index) {
     D( std::cerr << indent << " > adding post-r_paren trailing token\n"; )
-    const Node &trailing_node = parent_exp->nodes[r_paren_index];
+    const Node trailing_node = root.Nodes(parent_exp->nodes)[r_paren_index];
     assert(expansion != parent_exp);
-    if (std::holds_alternative<MacroTokenImpl *>(trailing_node)) {
-      MacroTokenImpl *trailing_tok = std::get<MacroTokenImpl *>(trailing_node);
+    if (trailing_node.IsToken()) {
+      MacroTokenImpl *trailing_tok = root.TokenAt(trailing_node);
       MacroTokenImpl *trailing_tok_clone = trailing_tok->Clone(*ast, expansion);
       assert(trailing_tok->token_offset < trailing_tok_clone->token_offset);
-      expansion->nodes.emplace_back(trailing_tok_clone);
+      root.Append(expansion->nodes, trailing_tok_clone);
 
-    } else if (std::holds_alternative<MacroNodeImpl *>(trailing_node)) {
-      expansion->nodes.emplace_back(
-          std::get<MacroNodeImpl *>(trailing_node)->Clone(*ast, expansion));
+    } else if (trailing_node.IsNode()) {
+      root.Append(expansion->nodes,
+                  root.NodeAt(trailing_node)->Clone(*ast, expansion));
     }
   }
 
@@ -1672,10 +1681,10 @@ void PatchedMacroTracker::DoSwitchToExpansion(
 
   // Go find the `r_paren` for the expansion and record it, as well at the index
   // at which it occurs.
-  auto &use_nodes = expansion->use_nodes;
+  std::span<Node> use_nodes = root.Nodes(expansion->use_nodes);
   assert(3u <= use_nodes.size());
-  assert(std::holds_alternative<MacroTokenImpl *>(use_nodes.back()));
-  assert(std::get<MacroTokenImpl *>(use_nodes.back())->kind_flags.kind ==
+  assert(use_nodes.back().IsToken());
+  assert(root.TokenAt(use_nodes.back())->kind_flags.kind ==
          TokenKind::kRParenthesis);
 
 //  MacroTokenImpl *r_paren = nullptr;
@@ -1686,10 +1695,10 @@ void PatchedMacroTracker::DoSwitchToExpansion(
 //  for (; r_paren_index < num_use_nodes; ++r_paren_index) {
 //    const Node &node = expansion->use_nodes[r_paren_index];
 //    MacroTokenImpl *tok = nullptr;
-//    if (std::holds_alternative<MacroTokenImpl *>(node)) {
-//      tok = std::get<MacroTokenImpl *>(node);
-//    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
-//      auto impl = std::get<MacroNodeImpl *>(node);
+//    if (node.IsToken()) {
+//      tok = root.TokenAt(node);
+//    } else if (node.IsNode()) {
+//      auto impl = root.NodeAt(node);
 //      auto sub_count = ParenCount(impl);
 //      if (!sub_count) {
 //        continue;
@@ -1720,7 +1729,7 @@ void PatchedMacroTracker::DoSwitchToExpansion(
 
 //  assert(expansion->r_paren == nullptr);
 //  assert(r_paren != nullptr);
-  expansion->r_paren = std::get<MacroTokenImpl *>(use_nodes.back());
+  expansion->r_paren = root.TokenAt(use_nodes.back());
   expansion->r_paren_index = static_cast<unsigned>(use_nodes.size() - 1u);
 
   // Keep track of argument separators.
@@ -1834,14 +1843,14 @@ void PatchedMacroTracker::DoEndMacroExpansion(
   // Go get the parent. In the case of pre-argument expansions, and in the
   // case of deferred expansions, `nodes.back()` isn't guaranteed to be equal to
   // `expansion->parent`.
-  MacroNodeImpl *parent_node = std::get<MacroNodeImpl *>(expansion->parent);
-  assert(std::holds_alternative<MacroNodeImpl *>(parent_node->nodes.back()));
-  assert(std::get<MacroNodeImpl *>(parent_node->nodes.back()) == expansion);
+  MacroNodeImpl *parent_node = root.NodeAt(expansion->parent);
+  assert(root.Nodes(parent_node->nodes).back().IsNode());
+  assert(root.NodeAt(root.Nodes(parent_node->nodes).back()) == expansion);
 
   if (expansion->is_cancelled) {
     assert(expansion->use_nodes.empty());
     parent_node->nodes.pop_back();
-    ReparentNodes(std::move(expansion->nodes), parent_node);
+    ReparentNodes(root, expansion->nodes, parent_node);
   }
 
   if (!deferred_expansion) {
@@ -1865,15 +1874,15 @@ void PatchedMacroTracker::DoEndMacroExpansion(
   }
 
   // The only node in `expansion->nodes` is `deferred_expansion`.
-  assert(std::holds_alternative<MacroNodeImpl *>(expansion->nodes.back()));
-  assert(std::get<MacroNodeImpl *>(expansion->nodes.back()) ==
+  assert(root.Nodes(expansion->nodes).back().IsNode());
+  assert(root.NodeAt(root.Nodes(expansion->nodes).back()) ==
          deferred_expansion);
 
   assert(parent_node != expansion);
   assert(parent_node != deferred_expansion);
   assert(!parent_node->nodes.empty());
-  assert(std::holds_alternative<MacroNodeImpl *>(parent_node->nodes.back()));
-  assert(std::get<MacroNodeImpl *>(parent_node->nodes.back()) ==
+  assert(root.Nodes(parent_node->nodes).back().IsNode());
+  assert(root.NodeAt(root.Nodes(parent_node->nodes).back()) ==
          expansion);
 
   // What we have:
@@ -1899,31 +1908,30 @@ void PatchedMacroTracker::DoEndMacroExpansion(
   if (expansion->is_prearg_expansion) {
     D( std::cerr << indent << "Deferral in argument pre-expansion\n"; )
     assert(expansion->parent_for_prearg == parent_node);
-    assert(std::get<MacroNodeImpl *>(expansion->parent) ==
+    assert(root.NodeAt(expansion->parent) ==
            expansion->parent_for_prearg);
 
     assert(!expansion->nodes.empty());
-    assert(std::holds_alternative<MacroNodeImpl *>(expansion->nodes.back()));
-    assert(std::get<MacroNodeImpl *>(expansion->nodes.back()) ==
+    assert(root.Nodes(expansion->nodes).back().IsNode());
+    assert(root.NodeAt(root.Nodes(expansion->nodes).back()) ==
            deferred_expansion);
 
-    MacroNodeImpl *grand_parent_node = std::get<MacroNodeImpl *>(
-        parent_node->parent);
+    MacroNodeImpl *grand_parent_node = root.NodeAt(parent_node->parent);
     assert(!grand_parent_node->nodes.empty());
-    assert(std::holds_alternative<MacroNodeImpl *>(grand_parent_node->nodes.back()));
-    assert(std::get<MacroNodeImpl *>(grand_parent_node->nodes.back()) ==
+    assert(root.Nodes(grand_parent_node->nodes).back().IsNode());
+    assert(root.NodeAt(root.Nodes(grand_parent_node->nodes).back()) ==
            parent_node);
 
     expansion->nodes.pop_back();  // Remove `DE` from `E`.
     grand_parent_node->nodes.pop_back();  // Remove `NP`.
 
-    grand_parent_node->nodes.push_back(deferred_expansion);  // Add `DE`.
+    root.Append(grand_parent_node->nodes, deferred_expansion);  // Add `DE`.
     deferred_expansion->parent = grand_parent_node;
     parent_node->parent = deferred_expansion;
 
-    ReparentNodes(std::move(deferred_expansion->nodes), expansion);
+    ReparentNodes(root, deferred_expansion->nodes, expansion);
 
-    deferred_expansion->nodes.push_back(parent_node);
+    root.Append(deferred_expansion->nodes, parent_node);
 
 
   // Othwerwise, in the normal case, what we want is:
@@ -1941,13 +1949,13 @@ void PatchedMacroTracker::DoEndMacroExpansion(
     D( std::cerr << indent << "Normal deferral\n"; )
 
     parent_node->nodes.pop_back();  // Remove `E`
-    parent_node->nodes.push_back(deferred_expansion);  // Add `DE`.
+    root.Append(parent_node->nodes, deferred_expansion);  // Add `DE`.
     deferred_expansion->parent = parent_node;
     expansion->parent = deferred_expansion;
 
     expansion->nodes.pop_back();
-    ReparentNodes(std::move(deferred_expansion->nodes), expansion);
-    deferred_expansion->nodes.push_back(expansion);
+    ReparentNodes(root, deferred_expansion->nodes, expansion);
+    root.Append(deferred_expansion->nodes, expansion);
 
   // We have a `dprintk`-like situation. We have come across a macro close
   // for `dprintk`, but the expansion of `printk` has already begun, so we
@@ -1968,8 +1976,7 @@ void PatchedMacroTracker::DoEndMacroExpansion(
 void PatchedMacroTracker::DoBeginSubstitution(
     const clang::Token &tok, uintptr_t data) {
   Push(tok);
-  MacroSubstitutionImpl *expansion =
-      &(ast->root_macro_node.substitutions.emplace_back());
+  MacroSubstitutionImpl *expansion = root.NewSubstitution();
   D( expansion->line_added = __LINE__; )
   AddToParentNode(expansion);
   expansion->parent = nodes.back();
@@ -2009,8 +2016,7 @@ void PatchedMacroTracker::DoBeginDelayedSubstitution(
     Push(last_token);
   }
 
-  MacroSubstitutionImpl *expansion =
-      &(ast->root_macro_node.substitutions.emplace_back());
+  MacroSubstitutionImpl *expansion = root.NewSubstitution();
   D( expansion->line_added = __LINE__; )
 
   MacroNodeImpl * const parent_node = nodes.back();
@@ -2018,8 +2024,9 @@ void PatchedMacroTracker::DoBeginDelayedSubstitution(
 
   if (last_token_was_added) {
     assert(!parent_node->nodes.empty());
-    ReparentNode(parent_node->nodes.back(), expansion);
-    expansion->nodes.push_back(std::move(parent_node->nodes.back()));
+    Node last_node = root.Nodes(parent_node->nodes).back();
+    ReparentNode(root, last_node, expansion);
+    root.Append(expansion->nodes, last_node);
     parent_node->nodes.pop_back();
   }
 
@@ -2619,18 +2626,22 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
     defines[last_directive->defined_macro] = last_directive;
   }
 
+  // NOTE(pag): `old_nodes` stays valid while we build `new_nodes`, as only
+  //            `last_directive->nodes` owns its storage.
+  const std::span<Node> old_nodes = root.Nodes(last_directive->nodes);
   NodeList new_nodes;
+  root.node_lists.Reserve(new_nodes, old_nodes.size());
 
   // Go find the macro name.
   auto i = 0u;  // Skip past `#`, and possibly past the `define`.
-  auto max_i = last_directive->nodes.size();
+  auto max_i = old_nodes.size();
   bool name_found = false;
   for (; i < max_i; ++i) {
-    Node &node = last_directive->nodes[i];
-    new_nodes.push_back(node);
-    if (std::holds_alternative<MacroTokenImpl *>(node)) {
+    Node node = old_nodes[i];
+    root.Append(new_nodes, node);
+    if (node.IsToken()) {
       TokenImpl &tok =
-          ast->tokens[std::get<MacroTokenImpl *>(node)->token_offset];
+          ast->tokens[root.TokenAt(node)->token_offset];
       if (tok.Location() == name_tok.getLocation()) {
         last_directive->macro_name = node;
         name_found = true;
@@ -2644,8 +2655,7 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
   if (directive && name_found) {
     last_directive->defined_macro = directive->getMacroInfo();
     defines[last_directive->defined_macro] = last_directive;
-    uint32_t to = std::get<MacroTokenImpl *>(
-        last_directive->macro_name)->token_offset;
+    uint32_t to = root.TokenAt(last_directive->macro_name)->token_offset;
 
     ast->tokens[to].is_macro_name = 1;
     ast->tokens_to_macro_definitions[to] = last_directive;
@@ -2658,10 +2668,10 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
       last_directive->defined_macro->isFunctionLike()) {
     bool found_l_paren = false;
     for (; i < max_i && name_found; ++i) {
-      Node &node = last_directive->nodes[i];
-      new_nodes.push_back(node);
-      if (std::holds_alternative<MacroTokenImpl *>(node)) {
-        MacroTokenImpl *tok = std::get<MacroTokenImpl *>(node);
+      Node node = old_nodes[i];
+      root.Append(new_nodes, node);
+      if (node.IsToken()) {
+        MacroTokenImpl *tok = root.TokenAt(node);
         if (tok->kind_flags.kind == TokenKind::kLParenthesis) {
           found_l_paren = true;
           break;
@@ -2674,13 +2684,13 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
     MacroParameterImpl *last_param = nullptr;
 
     for (; i < max_i && found_l_paren && !found_r_paren; ++i) {
-      Node &node = last_directive->nodes[i];
-      new_nodes.push_back(node);
-      if (!std::holds_alternative<MacroTokenImpl *>(node)) {
+      Node node = old_nodes[i];
+      root.Append(new_nodes, node);
+      if (!node.IsToken()) {
         continue;
       }
 
-      MacroTokenImpl *tok = std::get<MacroTokenImpl *>(node);
+      MacroTokenImpl *tok = root.TokenAt(node);
       switch (tok->kind_flags.kind) {
         case TokenKind::kRParenthesis:
           last_param = nullptr;
@@ -2693,41 +2703,41 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
           new_nodes.pop_back();
           if (last_param) {
             assert(!last_param->is_variadic);
-            last_param->nodes.push_back(node);
+            root.Append(last_param->nodes, node);
             last_param->is_variadic = true;
-            ReparentNode(node, last_param);
+            ReparentNode(root, node, last_param);
           } else {
-            last_param = &(ast->root_macro_node.parameters.emplace_back());
+            last_param = root.NewParameter();
             last_param->parent = last_directive;
             last_param->is_variadic = true;
             last_param->index = static_cast<unsigned>(
                 last_directive->parameters.size());
-            last_directive->parameters.emplace_back(last_param);
-            last_param->nodes.push_back(node);
-            ReparentNode(node, last_param);
-            new_nodes.push_back(last_param);
+            root.Append(last_directive->parameters, last_param);
+            root.Append(last_param->nodes, node);
+            ReparentNode(root, node, last_param);
+            root.Append(new_nodes, last_param);
           }
           break;
         case TokenKind::kIdentifier: {
           assert(!last_param);
           new_nodes.pop_back();
-          last_param = &(ast->root_macro_node.parameters.emplace_back());
+          last_param = root.NewParameter();
           last_param->parent = last_directive;
           last_param->has_name = true;
           last_param->index = static_cast<unsigned>(
               last_directive->parameters.size());
-          last_directive->parameters.emplace_back(last_param);
-          last_param->nodes.push_back(node);
-          ReparentNode(node, last_param);
-          new_nodes.push_back(last_param);
+          root.Append(last_directive->parameters, last_param);
+          root.Append(last_param->nodes, node);
+          ReparentNode(root, node, last_param);
+          root.Append(new_nodes, last_param);
           break;
         }
         default:
           // E.g. could have comment like `args/*comment*/...` perhaps?
           if (last_param) {
             new_nodes.pop_back();
-            last_param->nodes.push_back(node);
-            ReparentNode(node, last_param);
+            root.Append(last_param->nodes, node);
+            ReparentNode(root, node, last_param);
           }
           break;
       }
@@ -2738,19 +2748,21 @@ void PatchedMacroTracker::MacroDefined(const clang::Token &name_tok,
     last_directive->body_offset = i;
 
     // Add in the rest.
-    for (; i < max_i && found_r_paren; ++i) {
-      new_nodes.push_back(std::move(last_directive->nodes[i]));
+    if (found_r_paren && i < max_i) {
+      root.Append(new_nodes, old_nodes.subspan(i));
+      i = static_cast<unsigned>(max_i);
     }
 
     assert(i == max_i);
 
-    last_directive->nodes = std::move(new_nodes);
+    root.Replace(last_directive->nodes, new_nodes);
 
   } else {
+    root.node_lists.Free(new_nodes);
     last_directive->body_offset = i;
   }
 
-  assert(std::holds_alternative<MacroTokenImpl *>(last_directive->macro_name));
+  assert(last_directive->macro_name.IsToken());
 }
 
 // Hook called whenever a macro `#undef` is seen.
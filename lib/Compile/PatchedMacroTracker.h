@@ -54,6 +54,7 @@ class PatchedMacroTracker : public clang::PPCallbacks {
   clang::Token skipped_hash;
 
   ASTImpl * const ast;
+  RootMacroNode &root;
   llvm::raw_string_ostream token_data_stream;
   llvm::raw_string_ostream backup_token_data_stream;
 
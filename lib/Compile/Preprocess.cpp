@@ -2,15 +2,18 @@
  * Copyright (c) 2023 Trail of Bits, Inc.
  */
 
+#include <cstring>
 #include <fcntl.h>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
 #pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
 #pragma GCC diagnostic ignored "-Wsign-conversion"
 #pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/CharInfo.h>
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Lex/PPCallbacks.h>
 #include <clang/Lex/Preprocessor.h>
@@ -331,4 +334,98 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
 #endif  // PASTA_DEBUG_RUN
 }
 
+// Form the tokens that Clang would produce if it were to lex and preprocess
+// `impl.preprocessed_code`, without actually lexing or preprocessing it. Each
+// non-empty line of `impl.preprocessed_code` is exactly one token, and so we
+// can form that token directly from the corresponding `TokenImpl`, giving it a
+// location at the beginning of its line in `file_id`. This keeps
+// `ASTImpl::RawTokenAt` working as-is.
+//
+// Returns `false` if the code contains something that can't be replayed, e.g.
+// a rendered `#pragma` line that needs Clang's pragma handlers, in which case
+// the caller needs to fall back on lexing `impl.preprocessed_code`.
+bool ReplayPreprocessedCode(ASTImpl &impl, clang::Preprocessor &pp,
+                            clang::FileID file_id,
+                            std::vector<clang::Token> &toks) {
+  toks.clear();
+
+  const std::string &code = impl.preprocessed_code;
+  const std::vector<TokenImpl> &tokens = impl.tokens;
+  if (impl.num_lines != tokens.size()) {
+    return false;
+  }
+
+  const clang::SourceLocation file_loc =
+      pp.getSourceManager().getLocForStartOfFile(file_id);
+  const char * const code_begin = code.data();
+  const size_t code_size = code.size();
+
+  toks.reserve(tokens.size());
+
+  size_t line_begin = 0u;
+  for (const TokenImpl &tok_impl : tokens) {
+    if (line_begin >= code_size) {
+      break;
+    }
+
+    const void *nl = memchr(&(code_begin[line_begin]), '\n',
+                            code_size - line_begin);
+    const size_t line_end = nl ? static_cast<size_t>(
+        reinterpret_cast<const char *>(nl) - code_begin) : code_size;
+    const size_t line_begin_offset = line_begin;
+    const size_t line_len = line_end - line_begin;
+    line_begin = line_end + 1u;
+
+    if (!line_len) {
+      continue;
+    }
+
+    switch (tok_impl.Role()) {
+      case TokenRole::kFileToken:
+      case TokenRole::kFinalMacroExpansionToken:
+        break;
+      default:
+        return false;
+    }
+
+    const auto kind = tok_impl.Kind();
+    if (tok_impl.is_in_pragma_directive || kind == clang::tok::unknown ||
+        kind == clang::tok::eof || clang::tok::isAnnotation(kind)) {
+      return false;
+    }
+
+    const char * const tok_data = &(code_begin[line_begin_offset]);
+    clang::Token &tok = toks.emplace_back();
+    tok.startToken();
+    tok.setLocation(file_loc.getLocWithOffset(
+        static_cast<clang::SourceLocation::IntTy>(line_begin_offset)));
+    tok.setLength(static_cast<unsigned>(line_len));
+
+    // NOTE(pag): Every token in `preprocessed_code` is on its own line.
+    tok.setFlag(clang::Token::StartOfLine);
+
+    if (clang::tok::isLiteral(kind)) {
+      tok.setKind(kind);
+      tok.setLiteralData(tok_data);
+
+    // Identifiers and keywords. The `TokenLexer` used by
+    // `Preprocessor::EnterTokenStream` will change the kind of the token to
+    // the one recorded in the identifier info, e.g. turning `for` into
+    // `kw_for`, just as it would have happened when lexing.
+    } else if (clang::tok::isAnyIdentifier(kind) ||
+               clang::tok::getKeywordSpelling(kind) ||
+               clang::isAsciiIdentifierStart(tok_data[0], true) ||
+               static_cast<unsigned char>(tok_data[0]) >= 0x80u) {
+      tok.setKind(clang::tok::identifier);
+      tok.setIdentifierInfo(
+          pp.getIdentifierInfo(llvm::StringRef(tok_data, line_len)));
+
+    } else {
+      tok.setKind(kind);
+    }
+  }
+
+  return true;
+}
+
 }  // namespace pasta
@@ -10,10 +10,13 @@
 #include <unistd.h>
 
 #include <cassert>
+#include <chrono>
+#include <ctime>
 #include <sstream>
 #include <iostream>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
@@ -76,14 +79,117 @@ PASTA_BYPASS_MEMBER_OBJECT_ACCESS(clang, FileEntry, File,
 extern void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
                            clang::Preprocessor &pp);
 
+extern bool ReplayPreprocessedCode(ASTImpl &impl, clang::Preprocessor &pp,
+                                   clang::FileID file_id,
+                                   std::vector<clang::Token> &toks);
+
 extern void AddCustomBuiltinsToPreprocessor(ASTImpl &ast,
                                             clang::Preprocessor &pp);
 
+namespace {
+
+// Records the wall-clock and CPU time of each phase of `CompileJob::Run` into
+// an `ASTStatistics`. Starting a phase ends the previous one.
+class PhaseTimer {
+ public:
+  explicit PhaseTimer(ASTStatistics &stats_)
+      : stats(stats_),
+        job_start(std::chrono::steady_clock::now()) {}
+
+  void Begin(std::string_view name) {
+    End();
+    phase = name;
+    phase_start = std::chrono::steady_clock::now();
+    cpu_start = std::clock();
+  }
+
+  void End(void) {
+    if (phase.empty()) {
+      return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto cpu_now = std::clock();
+
+    ASTPhaseTiming &timing = stats.phases.emplace_back();
+    timing.name = phase;
+    timing.start_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            phase_start - job_start).count());
+    timing.wall_us = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            now - phase_start).count());
+    timing.cpu_us = static_cast<uint64_t>(
+        (static_cast<double>(cpu_now - cpu_start) * 1000000.0) /
+        CLOCKS_PER_SEC);
+    phase = {};
+  }
+
+ private:
+  ASTStatistics &stats;
+  const std::chrono::steady_clock::time_point job_start;
+  std::chrono::steady_clock::time_point phase_start;
+  std::clock_t cpu_start{0};
+  std::string_view phase;
+};
+
+// Enters the replayed tokens of `<pasta-input>` into the preprocessor when
+// it leaves the predefines buffer, i.e. at the point where it would have
+// started lexing the (now skipped) main file. Entering them any earlier would
+// put them in front of the predefines.
+class ReplayedTokenInjector : public clang::PPCallbacks {
+ public:
+  ReplayedTokenInjector(clang::Preprocessor &pp_,
+                        std::vector<clang::Token> &toks_)
+      : pp(pp_),
+        toks(toks_) {}
+
+  void FileChanged(clang::SourceLocation,
+                   clang::PPCallbacks::FileChangeReason reason,
+                   clang::SrcMgr::CharacteristicKind,
+                   clang::FileID prev_file_id) final {
+    if (entered || reason != clang::PPCallbacks::ExitFile ||
+        prev_file_id != pp.getPredefinesFileID()) {
+      return;
+    }
+
+    // NOTE(pag): Macro expansion is left enabled on the replayed tokens, even
+    //            though they are already fully expanded. The re-lexing path
+    //            expands any identifier that names one of this preprocessor's
+    //            own macros, i.e. the predefined ones, such as `linux` in GNU
+    //            modes, even when the original code `#undef`ed it, and so
+    //            replaying must too, or the two paths would parse different
+    //            code.
+    entered = true;
+    pp.EnterTokenStream(toks, false /* DisableMacroExpansion */,
+                        false /* IsReinject */);
+  }
+
+ private:
+  clang::Preprocessor &pp;
+
+  // Must outlive the parse.
+  std::vector<clang::Token> &toks;
+  bool entered{false};
+};
+
+}  // namespace
+
 // Run a command ans return the AST or the first error.
 Result<AST, std::string> CompileJob::Run(void) const {
+  return Run(CompileJobOptions{});
+}
+
+// Run a command with some specific options, and return the AST or the first
+// error.
+Result<AST, std::string> CompileJob::Run(
+    const CompileJobOptions &options) const {
   std::stringstream err;
 
   std::shared_ptr<ASTImpl> ast = std::make_shared<ASTImpl>(SourceFile());
+  PhaseTimer timer(ast->statistics);
+  timer.Begin("setup");
+
   llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> real_vfs(
       new LLVMFileSystem(impl->file_manager));
   llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> overlay_vfs(
@@ -331,7 +437,8 @@ Result<AST, std::string> CompileJob::Run(void) const {
   }
 
   ParsedFileTracker *file_tracker_ptr = new ParsedFileTracker(
-      sm, *lang_opts, impl->file_manager, WorkingDirectory(), ast.get());
+      sm, *lang_opts, impl->file_manager, WorkingDirectory(), ast.get(),
+      options.token_cache_directory, options.num_tokenizer_threads);
   {
     std::unique_ptr<clang::PPCallbacks> file_tracker(file_tracker_ptr);
     pp.addPPCallbacks(std::move(file_tracker));
@@ -345,12 +452,21 @@ Result<AST, std::string> CompileJob::Run(void) const {
 
   // Picks up on the pre-processor and stuff.
   ci.InitializeSourceManager(input_files[0]);
+  timer.Begin("preprocess");
   PreprocessCode(*ast, ci, pp);
 
+  // NOTE(pag): This waits for any files still being tokenized, so that time
+  //            is counted as part of preprocessing.
+  file_tracker_ptr->Clear();
+  ast->statistics.num_token_cache_hits =
+      file_tracker_ptr->num_token_cache_hits.load();
+  ast->statistics.num_token_cache_misses =
+      file_tracker_ptr->num_token_cache_misses.load();
+  timer.Begin("parse");
+
   // If we didn't end up tracking any files then something is seriously wrong.
   assert(!ast->id_to_file.empty());
 
-  file_tracker_ptr->Clear();
   macro_tracker_ptr->Clear();
 
   // Replace the main source file with the preprocessed file.
@@ -410,7 +526,24 @@ Result<AST, std::string> CompileJob::Run(void) const {
   assert(lang_opts->EmitAllDecls);
 
   std::unique_ptr<clang::Parser> parser(
-      new clang::Parser(pp2, sema, false /* SkipFunctionBodies */));
+      new clang::Parser(pp2, sema, options.skip_function_bodies));
+
+  // Try to avoid re-lexing and re-preprocessing `<pasta-input>` by forming
+  // its tokens directly. If we can, then we tell the preprocessor to skip
+  // over the entire main file, and feed it the replayed tokens instead.
+  std::vector<clang::Token> replayed_toks;
+  const bool replay = options.replay_preprocessed_tokens &&
+                      ReplayPreprocessedCode(*ast, pp2, main_file_id,
+                                             replayed_toks);
+  if (replay) {
+    pp2.setSkipMainFilePreamble(
+        static_cast<unsigned>(ast->preprocessed_code.size()),
+        true /* StartOfLine */);
+    if (!replayed_toks.empty()) {
+      pp2.addPPCallbacks(
+          std::make_unique<ReplayedTokenInjector>(pp2, replayed_toks));
+    }
+  }
 
   AddCustomBuiltinsToPreprocessor(*ast, pp2);
   pp2.setPreprocessedOutput(false);
@@ -438,6 +571,10 @@ Result<AST, std::string> CompileJob::Run(void) const {
   // Finalize any leftover instantiations.
   sema.PerformPendingInstantiations(false);
 
+  // The parser refers back to `sema`, and its destructor resets state in it,
+  // so it has to go before `sema` might, e.g. in `ASTImpl::Compact`.
+  parser.reset();
+
   if (diagnostics_engine->hasUncompilableErrorOccurred() ||
       diagnostics_engine->hasFatalErrorOccurred()) {
     if (diag->error.empty()) {
@@ -475,12 +612,41 @@ Result<AST, std::string> CompileJob::Run(void) const {
     policy->IncludeTagDefinition = true;
   }
 
+  timer.Begin("mark_macro_tokens");
   ast->MarkMacroTokens();
 
 #ifdef PASTA_IN_BOOTSTRAP
+  timer.End();
+  ast->CollectStatistics();
   return AST(std::move(ast));
 #else
-  return ASTImpl::AlignTokens(std::move(ast));
+  timer.Begin("align_tokens");
+  std::shared_ptr<ASTImpl> ast_impl = ast;
+  auto maybe_ast = ASTImpl::AlignTokens(
+      std::move(ast), options.num_alignment_threads,
+      options.alignment_file_filter, options.lazy_token_alignment);
+
+  // Alignment fills in the token contexts, so the columns can only be built
+  // after it.
+  if (options.columnar_tokens && maybe_ast.Succeeded()) {
+    timer.Begin("build_token_columns");
+    ast_impl->token_columns.Build(ast_impl->tokens,
+                                  ast_impl->tokens_version);
+  }
+
+  if (options.precompute_decl_bounds && maybe_ast.Succeeded()) {
+    timer.Begin("precompute_decl_bounds");
+    ast_impl->PrecomputeDeclBounds();
+  }
+
+  if (options.compact_ast && maybe_ast.Succeeded()) {
+    timer.Begin("compact");
+    ast_impl->Compact();
+  }
+
+  timer.End();
+  ast_impl->CollectStatistics();
+  return maybe_ast;
 #endif
 }
 
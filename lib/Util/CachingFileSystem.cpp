@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/Util/CachingFileSystem.h>
+
+#include <cassert>
+#include <mutex>
+
+namespace pasta {
+namespace {
+
+// Form a cache key for a `Stat` query.
+static std::string StatKey(const std::filesystem::path &path,
+                           const std::filesystem::path &cwd) {
+  if (path.is_absolute() || cwd.empty()) {
+    return path.lexically_normal().generic_string();
+  } else {
+    return (cwd / path).lexically_normal().generic_string();
+  }
+}
+
+}  // namespace
+
+CachingFileSystem::~CachingFileSystem(void) {}
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> next_)
+    : next(std::move(next_)) {
+  assert(next.get() != nullptr);
+}
+
+// Create a caching file system that wraps `next`.
+std::shared_ptr<CachingFileSystem> CachingFileSystem::Create(
+    std::shared_ptr<FileSystem> next) {
+  return std::make_shared<CachingFileSystem>(std::move(next));
+}
+
+// Forget anything cached about `path`, as well as the listing of its
+// parent directory.
+void CachingFileSystem::Invalidate(std::filesystem::path path,
+                                   std::filesystem::path cwd) {
+  const std::string key = StatKey(path, cwd);
+  const std::filesystem::path full_path(key);
+  const std::string parent_key = full_path.parent_path().generic_string();
+
+  std::unique_lock<std::shared_mutex> locker(cache_lock);
+
+  // The path may be a symbolic link, in which case the stat of the link
+  // target is also dropped, as is its listing if it's a directory.
+  if (auto it = stats.find(key); it != stats.end()) {
+    if (auto stat = std::get_if<::pasta::Stat>(&(it->second))) {
+      const auto real_path = stat->real_path.generic_string();
+      listings.erase(real_path);
+      listings.erase(stat->real_path.parent_path().generic_string());
+      stats.erase(real_path);
+    }
+    stats.erase(it);
+  }
+
+  listings.erase(key);
+  listings.erase(parent_key);
+}
+
+// Forget everything cached.
+void CachingFileSystem::InvalidateAll(void) {
+  std::unique_lock<std::shared_mutex> locker(cache_lock);
+  stats.clear();
+  listings.clear();
+}
+
+// Tells us what kind of file system path to use.
+::pasta::PathKind CachingFileSystem::PathKind(void) const {
+  return next->PathKind();
+}
+
+// Try to read the contents of a file, given the result of a `Stat` call.
+Result<std::string, std::error_code>
+CachingFileSystem::ReadFile(::pasta::Stat stat) {
+  return next->ReadFile(std::move(stat));
+}
+
+// Try to map the contents of a file into memory.
+Result<std::shared_ptr<const FileBuffer>, std::error_code>
+CachingFileSystem::MapFile(::pasta::Stat stat) {
+  return next->MapFile(std::move(stat));
+}
+
+// Return the root directory of `path`, possibly within the context of `cwd`.
+Result<std::filesystem::path, std::error_code>
+CachingFileSystem::RootDirectory(std::filesystem::path path,
+                                 std::filesystem::path cwd) {
+  return next->RootDirectory(std::move(path), std::move(cwd));
+}
+
+// Return the current working directory of the process.
+//
+// NOTE(pag): This isn't cached, as the process's working directory can change.
+Result<std::filesystem::path, std::error_code>
+CachingFileSystem::CurrentWorkingDirectory(void) {
+  return next->CurrentWorkingDirectory();
+}
+
+// Get information about a file path.
+Result<::pasta::Stat, std::error_code>
+CachingFileSystem::Stat(std::filesystem::path path, std::filesystem::path cwd) {
+  const std::string key = StatKey(path, cwd);
+  {
+    std::shared_lock<std::shared_mutex> locker(cache_lock);
+    if (auto it = stats.find(key); it != stats.end()) {
+      if (auto stat = std::get_if<::pasta::Stat>(&(it->second))) {
+        return *stat;
+      } else {
+        return std::get<std::error_code>(it->second);
+      }
+    }
+  }
+
+  // NOTE(pag): The lookup happens outside of the lock, so two threads may
+  //            race to stat the same path. The results are the same, so the
+  //            first one to insert wins.
+  auto maybe_stat = next->Stat(std::move(path), std::move(cwd));
+  StatOrError entry;
+  if (maybe_stat.Succeeded()) {
+    entry = maybe_stat.TakeValue();
+  } else {
+    entry = maybe_stat.TakeError();
+  }
+
+  std::unique_lock<std::shared_mutex> locker(cache_lock);
+  auto [it, added] = stats.emplace(key, std::move(entry));
+  (void) added;
+  if (auto stat = std::get_if<::pasta::Stat>(&(it->second))) {
+    return *stat;
+  } else {
+    return std::get<std::error_code>(it->second);
+  }
+}
+
+// List out the files in a directory.
+Result<std::vector<std::filesystem::path>, std::error_code>
+CachingFileSystem::ListDirectory(::pasta::Stat stat) {
+  const std::string key = stat.real_path.generic_string();
+  {
+    std::shared_lock<std::shared_mutex> locker(cache_lock);
+    if (auto it = listings.find(key); it != listings.end()) {
+      if (auto paths = std::get_if<std::vector<std::filesystem::path>>(
+              &(it->second))) {
+        return *paths;
+      } else {
+        return std::get<std::error_code>(it->second);
+      }
+    }
+  }
+
+  auto maybe_paths = next->ListDirectory(std::move(stat));
+  ListingOrError entry;
+  if (maybe_paths.Succeeded()) {
+    entry = maybe_paths.TakeValue();
+  } else {
+    entry = maybe_paths.TakeError();
+  }
+
+  std::unique_lock<std::shared_mutex> locker(cache_lock);
+  auto [it, added] = listings.emplace(key, std::move(entry));
+  (void) added;
+  if (auto paths = std::get_if<std::vector<std::filesystem::path>>(
+          &(it->second))) {
+    return *paths;
+  } else {
+    return std::get<std::error_code>(it->second);
+  }
+}
+
+}  // namespace pasta
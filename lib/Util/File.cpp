@@ -64,31 +64,42 @@ Result<std::string_view, std::error_code> File::Data(void) const noexcept {
     } else {
       assert(!impl->data.empty());
       assert(impl->data.back() == '\0');
-      return std::string_view(impl->data.data(), impl->data.size() - 1u);
+      return impl->data.substr(0u, impl->data.size() - 1u);
     }
   }
 
   impl->has_data = true;
 
   auto fm = impl->owner.lock();
-  auto maybe_file = fm->file_system->ReadFile(impl->stat);
+  auto maybe_file = fm->file_system->MapFile(impl->stat);
   if (maybe_file.Succeeded()) {
-    maybe_file.TakeValue().swap(impl->data);
-
-    // A lot of code in PASTA relies on the file being formatted as UTF-8.
-    if (!llvm::json::isUTF8(impl->data)) {
-      impl->data = llvm::json::fixUTF8(impl->data);
-    }
-
+    impl->data_buffer = maybe_file.TakeValue();
+    const std::string_view buffer_data = impl->data_buffer->Data();
+    const llvm::StringRef buffer_ref(buffer_data.data(), buffer_data.size());
+
+    // A lot of code in PASTA relies on the file being formatted as UTF-8. If
+    // it is, then we can use the buffer's data as-is, because it's followed
+    // by the trailing NUL that we need.
+    //
     // NOTE(pag): We use this extra trailing NUL to help us with location
     //            offsets for EOF tokens.
-    impl->data.push_back('\0');
+    if (llvm::json::isUTF8(buffer_ref)) {
+      assert(buffer_data.data()[buffer_data.size()] == '\0');
+      impl->data = std::string_view(buffer_data.data(),
+                                    buffer_data.size() + 1u);
+    } else {
+      impl->fixed_data = llvm::json::fixUTF8(buffer_ref);
+      impl->fixed_data.push_back('\0');
+      impl->data = impl->fixed_data;
+      impl->data_buffer.reset();
+    }
 
     // NOTE(pag): We use the data hash to help us maintain semi-determinstic
     //            `__COUNTER__` values across files.
-    impl->data_hash = llvm::xxHash64(impl->data);
+    impl->data_hash = llvm::xxHash64(
+        llvm::StringRef(impl->data.data(), impl->data.size()));
 
-    return std::string_view(impl->data.data(), impl->data.size() - 1u);
+    return impl->data.substr(0u, impl->data.size() - 1u);
 
   } else {
     impl->data_ec = maybe_file.TakeError();
@@ -120,6 +131,7 @@ const ::pasta::Stat &File::Stat(void) const noexcept {
 // Return a range of file tokens.
 FileTokenRange File::Tokens(void) const noexcept {
   std::unique_lock<std::mutex> locker(impl->tokens_lock);
+  impl->WaitForTokens(locker);
   const auto num_toks = impl->tokens.size();
   if (1u >= num_toks) {
     return FileTokenRange(impl);
@@ -141,6 +153,7 @@ std::optional<FileToken> File::TokenAtOffset(unsigned offset) const noexcept {
 
   {
     std::unique_lock<std::mutex> locker(impl->tokens_lock);
+    impl->WaitForTokens(locker);
     auto tokens = impl->tokens.data();
     auto end_tokens = &(impl->tokens[impl->tokens.size()]);
     auto ret = std::lower_bound(
@@ -6,8 +6,11 @@
 
 #include <pasta/Util/FileManager.h>
 
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <pasta/Util/File.h>
@@ -71,8 +74,12 @@ class FileImpl final {
   bool has_data{false};
   std::error_code data_ec;
 
-  // All data read for the file.
-  std::string data;
+  // All data read for the file, including a trailing NUL. This points into
+  // `data_buffer` if the file was valid UTF-8, and into `fixed_data`
+  // otherwise.
+  std::string_view data;
+  std::shared_ptr<const FileBuffer> data_buffer;
+  std::string fixed_data;
   uint64_t data_hash{0u};
 
   // Lock on mutating `data`.
@@ -85,6 +92,16 @@ class FileImpl final {
   std::mutex tokens_lock;
   bool has_tokens{false};
 
+  // Set while `tokens` is being filled in on a tokenizer thread. Readers of
+  // `tokens` must wait on `tokens_cv` until this is cleared.
+  bool tokens_pending{false};
+  std::condition_variable tokens_cv;
+
+  // Wait until `tokens` is filled in. `locker` must hold `tokens_lock`.
+  inline void WaitForTokens(std::unique_lock<std::mutex> &locker) {
+    tokens_cv.wait(locker, [this] (void) { return !tokens_pending; });
+  }
+
   // This points into `data`. A token is bound by `token_data[i]` and
   // `token_data[i + 1]`.
   std::vector<FileTokenImpl> tokens;
@@ -14,6 +14,13 @@
 
 #include <pasta/Util/Error.h>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <llvm/Support/MemoryBuffer.h>
+#pragma GCC diagnostic pop
+
 namespace pasta {
 namespace {
 
@@ -55,6 +62,38 @@ static constexpr auto kAnyRead =
     std::filesystem::perms::others_read |
     std::filesystem::perms::owner_read;
 
+// File contents held in a string. `std::string` guarantees a trailing NUL.
+class StringFileBuffer final : public FileBuffer {
+ public:
+  const std::string data;
+
+  virtual ~StringFileBuffer(void) = default;
+
+  inline explicit StringFileBuffer(std::string data_)
+      : data(std::move(data_)) {}
+
+  std::string_view Data(void) const noexcept final {
+    return data;
+  }
+};
+
+// File contents held in an LLVM memory buffer. Large files are backed by a
+// shared, read-only memory mapping.
+class LLVMFileBuffer final : public FileBuffer {
+ public:
+  const std::unique_ptr<llvm::MemoryBuffer> buffer;
+
+  virtual ~LLVMFileBuffer(void) = default;
+
+  inline explicit LLVMFileBuffer(std::unique_ptr<llvm::MemoryBuffer> buffer_)
+      : buffer(std::move(buffer_)) {}
+
+  std::string_view Data(void) const noexcept final {
+    return std::string_view(buffer->getBufferStart(),
+                            buffer->getBufferSize());
+  }
+};
+
 // Implementation of a native file system.
 class NativeFileSystem final : public FileSystem {
  public:
@@ -66,6 +105,10 @@ class NativeFileSystem final : public FileSystem {
   // Try to read the contents of a file.
   Result<std::string, std::error_code> ReadFile(::pasta::Stat stat) final;
 
+  // Try to map the contents of a file into memory.
+  Result<std::shared_ptr<const FileBuffer>, std::error_code>
+  MapFile(::pasta::Stat stat) final;
+
   // Return the root directory of `path`, possibly within the context of `cwd`.
   Result<std::filesystem::path, std::error_code>
   RootDirectory(std::filesystem::path path, std::filesystem::path cwd) final;
@@ -152,6 +195,28 @@ Result<std::string, std::error_code> NativeFileSystem::ReadFile(
   return ret;
 }
 
+// Try to map the contents of a file into memory.
+//
+// NOTE(pag): LLVM only `mmap`s files that are big enough to make it worth it,
+//            and where it can guarantee a trailing NUL without a copy (i.e.
+//            when the file size isn't a multiple of the page size). Otherwise
+//            it falls back on reading the file into a heap buffer.
+Result<std::shared_ptr<const FileBuffer>, std::error_code>
+NativeFileSystem::MapFile(::pasta::Stat stat) {
+  if ((kAnyRead & stat.permissions) == std::filesystem::perms::none) {
+    return kErrNotPermitted;
+  }
+
+  auto maybe_buff = llvm::MemoryBuffer::getFile(
+      stat.real_path.generic_string(), false /* IsText */,
+      true /* RequiresNullTerminator */, false /* IsVolatile */);
+  if (!maybe_buff) {
+    return maybe_buff.getError();
+  }
+
+  return std::make_shared<LLVMFileBuffer>(std::move(maybe_buff.get()));
+}
+
 // Return the root directory of `path`, possibly within the context of `cwd`.
 Result<std::filesystem::path, std::error_code>
 NativeFileSystem::RootDirectory(std::filesystem::path path,
@@ -252,6 +317,18 @@ NativeFileSystem::Stat(std::filesystem::path path,
   return kErrNotRecoverable;
 }
 
+// Try to map the contents of a file into memory. By default this is
+// implemented with `ReadFile`.
+Result<std::shared_ptr<const FileBuffer>, std::error_code>
+FileSystem::MapFile(::pasta::Stat stat) {
+  auto maybe_data = this->ReadFile(std::move(stat));
+  if (maybe_data.Succeeded()) {
+    return std::make_shared<StringFileBuffer>(maybe_data.TakeValue());
+  } else {
+    return maybe_data.TakeError();
+  }
+}
+
 // List out the files in a directory.
 Result<std::vector<std::filesystem::path>, std::error_code>
 NativeFileSystem::ListDirectory(::pasta::Stat stat) try {
@@ -287,6 +364,8 @@ NativeFileSystem::ListDirectory(::pasta::Stat stat) try {
 
 }  // namespace
 
+FileBuffer::~FileBuffer(void) {}
+
 FileSystem::~FileSystem(void) {}
 
 // Create a native file system.
@@ -0,0 +1,28 @@
+// A `BatchRunner` reports every job exactly once, with its own AST or error,
+// and never has more than `max_live_asts` ASTs alive at once. With a single
+// thread, the jobs finish, and so are reported, in order.
+//
+// RUN: printf 'int a;\n' > %t.1.c
+// RUN: printf 'struct S { int x; };\n' > %t.2.c
+// RUN: printf 'int f(void) { return 0; }\n' > %t.3.c
+// RUN: printf 'int b = ;\n' > %t.4.c
+// RUN: printf 'enum E { A, B };\n' > %t.5.c
+// RUN: printf 'typedef int T;\nT c;\n' > %t.6.c
+// RUN: run-c-batch --threads 1 %t.1.c %t.2.c %t.3.c %t.4.c %t.5.c %t.6.c | FileCheck --check-prefix=SERIAL %s
+// RUN: run-c-batch --threads 4 --max-live-asts 2 %t.1.c %t.2.c %t.3.c %t.4.c %t.5.c %t.6.c | FileCheck --check-prefix=LIMITED %s
+
+// SERIAL: {{^}}{{.*}}.1.c ok{{$}}
+// SERIAL-NEXT: {{^}}{{.*}}.2.c ok{{$}}
+// SERIAL-NEXT: {{^}}{{.*}}.3.c ok{{$}}
+// SERIAL-NEXT: {{^}}{{.*}}.4.c error{{$}}
+// SERIAL-NEXT: {{^}}{{.*}}.5.c ok{{$}}
+// SERIAL-NEXT: {{^}}{{.*}}.6.c ok{{$}}
+// SERIAL-NEXT: {{^}}max live ASTs: 1{{$}}
+
+// LIMITED-DAG: {{^}}{{.*}}.1.c ok{{$}}
+// LIMITED-DAG: {{^}}{{.*}}.2.c ok{{$}}
+// LIMITED-DAG: {{^}}{{.*}}.3.c ok{{$}}
+// LIMITED-DAG: {{^}}{{.*}}.4.c error{{$}}
+// LIMITED-DAG: {{^}}{{.*}}.5.c ok{{$}}
+// LIMITED-DAG: {{^}}{{.*}}.6.c ok{{$}}
+// LIMITED: {{^}}max live ASTs: {{[12]}}{{$}}
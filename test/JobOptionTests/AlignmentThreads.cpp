@@ -0,0 +1,46 @@
+// Aligning top-level declaration groups on a thread pool must produce the
+// same token contexts, with the same indices, as aligning them on the calling
+// thread, including for groups that overlap, e.g. a class and the out-of-line
+// definitions of its methods.
+//
+// RUN: print-cxx-tokens --parsed-tokens --alignment-threads 1 %s > %t.serial
+// RUN: print-cxx-tokens --parsed-tokens --alignment-threads 4 %s > %t.parallel
+// RUN: diff %t.serial %t.parallel
+// RUN: print-cxx-tokens --alignment-threads 1 %s > %t.serial.printed
+// RUN: print-cxx-tokens --alignment-threads 4 %s > %t.parallel.printed
+// RUN: diff %t.serial.printed %t.parallel.printed
+
+#define DECLARE_GETTER(name, type) type Get ## name(void) const;
+
+namespace ns {
+
+struct A {
+  int x;
+  DECLARE_GETTER(X, int)
+};
+
+int A::GetX(void) const {
+  return x;
+}
+
+template <typename T>
+struct B {
+  T y;
+  T GetY(void) const { return y; }
+};
+
+}  // namespace ns
+
+int f(int a, int b) {
+  return a + b;
+}
+
+int g(ns::A a, ns::B<int> b) {
+  return f(a.GetX(), b.GetY());
+}
+
+enum E { kE0, kE1, kE2 };
+
+static const int kTable[] = {kE0, kE1, kE2};
+
+int h(int i) { return kTable[i]; }
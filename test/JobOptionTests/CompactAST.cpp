@@ -0,0 +1,47 @@
+// Compacting an AST must not change its parsed tokens, their contexts, or its
+// printed tokens, including when alignment is lazy, and so happens after
+// compaction has dropped `Sema` and PASTA's scratch maps.
+//
+// RUN: print-cxx-tokens --parsed-tokens %s > %t.parsed
+// RUN: print-cxx-tokens --parsed-tokens --compact %s > %t.parsed.compact
+// RUN: diff %t.parsed %t.parsed.compact
+// RUN: print-cxx-tokens %s > %t.printed
+// RUN: print-cxx-tokens --compact %s > %t.printed.compact
+// RUN: diff %t.printed %t.printed.compact
+// RUN: print-cxx-tokens --parsed-tokens --lazy-alignment %s > %t.parsed.lazy
+// RUN: print-cxx-tokens --parsed-tokens --lazy-alignment --compact %s > %t.parsed.lazy.compact
+// RUN: diff %t.parsed.lazy %t.parsed.lazy.compact
+// RUN: print-cxx-tokens --lazy-alignment %s > %t.printed.lazy
+// RUN: print-cxx-tokens --lazy-alignment --compact %s > %t.printed.lazy.compact
+// RUN: diff %t.printed.lazy %t.printed.lazy.compact
+
+#define SQUARE(x) ((x) * (x))
+
+namespace ns {
+
+template <typename T>
+struct Box {
+  T value;
+
+  T Get(void) const {
+    return value;
+  }
+
+  template <typename U>
+  U As(void) const {
+    return static_cast<U>(value);
+  }
+};
+
+}  // namespace ns
+
+static int Area(ns::Box<int> side) {
+  return SQUARE(side.Get());
+}
+
+float Ratio(ns::Box<int> a, ns::Box<float> b) {
+  if (int area = Area(a)) {
+    return b.Get() / static_cast<float>(area);
+  }
+  return a.As<float>();
+}
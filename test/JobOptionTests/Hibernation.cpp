@@ -0,0 +1,46 @@
+// Hibernating an AST, and then reading it back, must not change its file
+// tokens, its parsed tokens, their contexts, or its printed tokens, including
+// when alignment is lazy, and so happens after the AST is rehydrated.
+//
+// RUN: print-cxx-tokens --file-tokens %s > %t.file
+// RUN: print-cxx-tokens --file-tokens --hibernate %s > %t.file.hibernate
+// RUN: diff %t.file %t.file.hibernate
+// RUN: print-cxx-tokens --parsed-tokens %s > %t.parsed
+// RUN: print-cxx-tokens --parsed-tokens --hibernate %s > %t.parsed.hibernate
+// RUN: diff %t.parsed %t.parsed.hibernate
+// RUN: print-cxx-tokens %s > %t.printed
+// RUN: print-cxx-tokens --hibernate %s > %t.printed.hibernate
+// RUN: diff %t.printed %t.printed.hibernate
+// RUN: print-cxx-tokens --parsed-tokens --lazy-alignment %s > %t.parsed.lazy
+// RUN: print-cxx-tokens --parsed-tokens --lazy-alignment --hibernate %s > %t.parsed.lazy.hibernate
+// RUN: diff %t.parsed.lazy %t.parsed.lazy.hibernate
+// RUN: print-cxx-tokens --lazy-alignment %s > %t.printed.lazy
+// RUN: print-cxx-tokens --lazy-alignment --hibernate %s > %t.printed.lazy.hibernate
+// RUN: diff %t.printed.lazy %t.printed.lazy.hibernate
+
+#define MAX(a, b) ((a) < (b) ? (b) : (a))
+
+namespace ns {
+
+template <typename T>
+struct Pair {
+  T first;
+  T second;
+
+  T Larger(void) const {
+    return MAX(first, second);
+  }
+};
+
+}  // namespace ns
+
+enum class Color { kRed, kGreen };
+
+static int Pick(ns::Pair<int> p, Color c) {
+  switch (c) {
+    case Color::kRed:
+      return p.first;
+    default:
+      return p.Larger();
+  }
+}
@@ -0,0 +1,49 @@
+// Aligning top-level declaration groups lazily, when the contexts of their
+// tokens are first requested, must produce the same token contexts, with the
+// same indices, as aligning them eagerly, including for the contexts of macro
+// tokens and for groups that overlap.
+//
+// RUN: print-cxx-tokens --parsed-tokens %s > %t.eager
+// RUN: print-cxx-tokens --parsed-tokens --lazy-alignment %s > %t.lazy
+// RUN: diff %t.eager %t.lazy
+// RUN: print-cxx-tokens %s > %t.eager.printed
+// RUN: print-cxx-tokens --lazy-alignment %s > %t.lazy.printed
+// RUN: diff %t.eager.printed %t.lazy.printed
+
+#define DECLARE_FIELD(type, name) type name;
+#define SUM(a, b) ((a) + (b))
+
+namespace ns {
+
+struct Point {
+  DECLARE_FIELD(int, x)
+  DECLARE_FIELD(int, y)
+
+  int Sum(void) const;
+};
+
+int Point::Sum(void) const {
+  return SUM(x, y);
+}
+
+template <typename T>
+struct Holder {
+  T value;
+  T Get(void) const { return value; }
+};
+
+}  // namespace ns
+
+struct Outer {
+  struct Inner {
+    int z;
+  } inner;
+};
+
+static int Total(ns::Point p, ns::Holder<int> h, Outer o) {
+  return SUM(p.Sum(), SUM(h.Get(), o.inner.z));
+}
+
+typedef int (*Callback)(ns::Point, ns::Holder<int>, Outer);
+
+Callback cb = Total;
@@ -0,0 +1,13 @@
+// Replaying the preprocessed tokens must expand the second preprocessor's
+// predefined macros just like re-lexing does. Here `linux` is `#undef`ed in
+// the original code, and so survives preprocessing, but it is predefined
+// again when the preprocessed code is parsed.
+//
+// REQUIRES: system-linux
+// RUN: printf '#undef linux\nint a[linux + 1];\n' > %t.c
+// RUN: print-c-tokens -std=gnu11 --parsed-tokens %t.c > %t.relexed
+// RUN: print-c-tokens -std=gnu11 --parsed-tokens --replay %t.c > %t.replayed
+// RUN: diff %t.relexed %t.replayed
+// RUN: FileCheck %s < %t.replayed
+
+// CHECK: {{^}}identifier a 2:5 {{.*}}
@@ -0,0 +1,18 @@
+// Feeding the parser the preprocessed tokens directly must build the same
+// AST, with the same parsed tokens and contexts, as having Clang re-lex and
+// re-preprocess the one-token-per-line rendering of the preprocessed code.
+//
+// RUN: printf '#define ADD(a, b) ((a) + (b))\nstruct S { int x; };\n' > %t.h
+// RUN: printf '#include "%t.h"\nint f(struct S *s) {\n  return ADD(s->x, __LINE__);\n}\n' > %t.c
+// RUN: print-c-tokens --parsed-tokens %t.c > %t.relexed
+// RUN: print-c-tokens --parsed-tokens --replay %t.c > %t.replayed
+// RUN: diff %t.relexed %t.replayed
+// RUN: print-c-tokens %t.c > %t.relexed.printed
+// RUN: print-c-tokens --replay %t.c > %t.replayed.printed
+// RUN: diff %t.relexed.printed %t.replayed.printed
+// RUN: FileCheck %s < %t.replayed
+
+// CHECK: {{^}}kw_struct struct 2:1 {{.*}}
+// CHECK: {{^}}identifier S 2:8 {{.*}}
+// CHECK: {{^}}identifier f 2:5 {{.*}}
+// CHECK: {{^}}numeric_constant 3{{( .*)?$}}
@@ -0,0 +1,79 @@
+// With function bodies skipped, the printer prints `{}` for each skipped body,
+// alignment still succeeds, and every token of a skipped body, including the
+// skipped initializers of a constructor, gets the context of its function.
+//
+// RUN: print-cxx-tokens --skip-function-bodies %s | FileCheck --check-prefix=PRINTED %s
+// RUN: print-cxx-tokens --skip-function-bodies --parsed-tokens %s | FileCheck %s
+
+struct S {
+  int x;
+  int y;
+
+  S(int a)
+      : x(a + 1),
+        y(a) {
+    x *= (y + 2);
+  }
+
+  int Get(void) const;
+};
+
+int S::Get(void) const {
+  if (x) {
+    return y;
+  }
+  return x;
+}
+
+// PRINTED: {{^}}y{{$}}
+// PRINTED-NEXT: {{^}};{{$}}
+// PRINTED-NEXT: {{^}}S{{$}}
+// PRINTED-NEXT: {{^}}({{$}}
+// PRINTED-NEXT: {{^}}int{{$}}
+// PRINTED-NEXT: {{^}}a{{$}}
+// PRINTED-NEXT: {{^}}){{$}}
+// PRINTED-NEXT: {{^[{]$}}
+// PRINTED-NEXT: {{^[}]$}}
+// PRINTED: {{^}}const{{$}}
+// PRINTED-NEXT: {{^[{]$}}
+// PRINTED-NEXT: {{^[}]$}}
+
+// CHECK: {{^}}identifier S 12:3 [[CTOR:Decl#[0-9]+]] {{.*}}
+// CHECK: {{^}}colon : 13:7 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier x 13:9 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}l_paren ( 13:10 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier a 13:11 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}plus + 13:13 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}numeric_constant 1 13:15 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}r_paren ) 13:16 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}comma , 13:17 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier y 14:9 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}l_paren ( 14:10 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier a 14:11 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}r_paren ) 14:12 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}l_brace { 14:14 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier x 15:5 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}starequal *= 15:7 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}l_paren ( 15:10 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}identifier y 15:11 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}plus + 15:13 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}numeric_constant 2 15:15 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}r_paren ) 15:16 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}semi ; 15:17 [[CTOR]] {{.*}}
+// CHECK-NEXT: {{^}}r_brace } 16:3 [[CTOR]] {{.*}}
+
+// CHECK: {{^}}identifier Get 21:8 [[GET:Decl#[0-9]+]] {{.*}}
+// CHECK: {{^}}l_brace { 21:24 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}kw_if if 22:3 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}l_paren ( 22:6 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}identifier x 22:7 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}r_paren ) 22:8 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}l_brace { 22:10 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}kw_return return 23:5 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}identifier y 23:12 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}semi ; 23:13 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}r_brace } 24:3 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}kw_return return 25:3 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}identifier x 25:10 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}semi ; 25:11 [[GET]] {{.*}}
+// CHECK-NEXT: {{^}}r_brace } 26:1 [[GET]] {{.*}}
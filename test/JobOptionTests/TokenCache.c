@@ -0,0 +1,17 @@
+// A warm run must load the raw tokens of every parsed file from the token
+// cache written by a cold run, and the loaded tokens must match the lexed
+// ones.
+//
+// RUN: rm -rf %t.cache
+// RUN: printf 'int a;\r\nint b = 1 + \\\r\n  2;\rint c;\nin\\\r\nt d;\n' > %t.c
+// RUN: print-c-tokens --file-tokens %t.c > %t.uncached
+// RUN: print-c-tokens --statistics --token-cache %t.cache %t.c | FileCheck --check-prefix=COLD %s
+// RUN: print-c-tokens --statistics --token-cache %t.cache %t.c | FileCheck --check-prefix=WARM %s
+// RUN: print-c-tokens --file-tokens --token-cache %t.cache %t.c > %t.cached
+// RUN: diff %t.uncached %t.cached
+// RUN: print-c-tokens --statistics --token-cache %t.cache --tokenizer-threads 4 %t.c | FileCheck --check-prefix=WARM %s
+// RUN: print-c-tokens --file-tokens --token-cache %t.cache --tokenizer-threads 4 %t.c > %t.cached.async
+// RUN: diff %t.uncached %t.cached.async
+
+// COLD: "num_token_cache_hits":0,"num_token_cache_misses":{{[1-9][0-9]*}}
+// WARM: "num_token_cache_hits":{{[1-9][0-9]*}},"num_token_cache_misses":0
@@ -0,0 +1,21 @@
+// Raw lexing files on a tokenizer thread pool must produce the same file
+// tokens as lexing them on the calling thread, including for CRLF and lone CR
+// line endings, and for line splices inside and between tokens.
+//
+// RUN: printf 'int a;\r\nint b = 1 + \\\r\n  2;\rint c;\nin\\\r\nt d;\n' > %t.c
+// RUN: print-c-tokens --file-tokens --tokenizer-threads 0 %t.c > %t.serial
+// RUN: print-c-tokens --file-tokens --tokenizer-threads 4 %t.c > %t.async
+// RUN: diff %t.serial %t.async
+// RUN: FileCheck %s < %t.async
+
+// CHECK: {{^}}1:1 identifier int{{$}}
+// CHECK: {{^}}1:5 identifier a{{$}}
+// CHECK: {{^}}1:6 semi ;{{$}}
+// CHECK: {{^}}2:1 identifier int{{$}}
+// CHECK: {{^}}2:11 plus +{{$}}
+// CHECK: {{^}}3:3 numeric_constant 2{{$}}
+// CHECK: {{^}}3:4 semi ;{{$}}
+// CHECK: {{^}}4:1 identifier int{{$}}
+// CHECK: {{^}}4:5 identifier c{{$}}
+// CHECK: {{^}}5:1 identifier in\\\r\nt{{$}}
+// CHECK: {{^}}6:3 identifier d{{$}}
@@ -0,0 +1,114 @@
+// Statements, declarations, and types whose tokens the printer emits directly,
+// without re-lexing them, must be given the same kinds as re-lexing would have
+// given them: keywords are keywords, and other names are raw identifiers.
+//
+// RUN: print-cxx-tokens --printed-token-kinds %s | FileCheck %s
+
+// CHECK: kw_struct struct
+// CHECK: raw_identifier S
+// CHECK: kw_mutable mutable
+// CHECK: kw_int int
+// CHECK: raw_identifier m
+// CHECK: semi ;
+struct S {
+  mutable int m;
+};
+
+// CHECK: kw_enum enum
+// CHECK: raw_identifier E
+// CHECK: raw_identifier A
+// CHECK: equal =
+// CHECK: numeric_constant 1
+enum E {
+  A = 1
+};
+
+// CHECK: kw_extern extern
+// CHECK: kw_int int
+// CHECK: raw_identifier e
+extern int e;
+
+// CHECK: kw_static static
+// CHECK: kw_inline inline
+// CHECK: kw_int int
+// CHECK: raw_identifier f
+// CHECK: l_paren (
+// CHECK: kw_int int
+// CHECK: star *
+// CHECK: raw_identifier p
+// CHECK: comma ,
+// CHECK: kw_int int
+// CHECK: amp &
+// CHECK: raw_identifier r
+// CHECK: r_paren )
+// CHECK: l_brace {
+static inline int f(int *p, int &r) {
+
+  // CHECK: kw_int int
+  // CHECK: raw_identifier x
+  // CHECK: equal =
+  // CHECK: star *
+  // CHECK: raw_identifier p
+  // CHECK: semi ;
+  int x = *p;
+
+  // CHECK: kw_if if
+  // CHECK: l_paren (
+  // CHECK: raw_identifier x
+  // CHECK: less <
+  // CHECK: raw_identifier r
+  // CHECK: r_paren )
+  // CHECK: kw_return return
+  // CHECK: question ?
+  // CHECK: colon :
+  // CHECK: kw_else else
+  if (x < r)
+    return x ? x : r;
+  else
+    x = -x;
+
+  // CHECK: kw_for for
+  // CHECK: l_paren (
+  // CHECK: plusplus ++
+  // CHECK: r_paren )
+  // CHECK: kw_continue continue
+  for (int i = 0; i < r; ++i)
+    continue;
+
+  // CHECK: kw_while while
+  // CHECK: kw_break break
+  while (x)
+    break;
+
+  // CHECK: kw_do do
+  // CHECK: kw_while while
+  do {
+    --x;
+  } while (x > 0);
+
+  // CHECK: kw_switch switch
+  // CHECK: kw_case case
+  // CHECK: colon :
+  // CHECK: kw_default default
+  // CHECK: colon :
+  switch (x) {
+    case 1:
+      x += 2;
+      break;
+    default:
+      break;
+  }
+
+  // CHECK: kw_goto goto
+  // CHECK: raw_identifier done
+  // CHECK: raw_identifier done
+  // CHECK: colon :
+  goto done;
+done:
+
+  // CHECK: kw_return return
+  // CHECK: raw_identifier x
+  // CHECK: semi ;
+  // CHECK: r_brace }
+  return x;
+}
@@ -58,6 +58,11 @@ tools = [
         os.path.join(config.pasta_obj_root, 'bin', 'PrintTokens', 'print-tokens'),
         extra_args=["-x", "c"]),
     
+    ToolSubst(
+        "run-c-batch",
+        os.path.join(config.pasta_obj_root, 'bin', 'RunBatch', 'run-batch'),
+        extra_args=["-x", "c"]),
+
     ToolSubst(
         "FileCheck",
         config.file_check_path)